@@ -27,7 +27,7 @@ Shaders for textured cube rendering with Phong lighting model
 struct VSInput
 {
     float3 position         : POSITION;
-    float3 normal           : NORMAL;
+    float2 oct_normal       : OCTNORMAL;
     float2 texcoord         : TEXCOORD;
 };
 
@@ -51,7 +51,7 @@ PSInput CubeVS(VSInput input)
     PSInput output;
     output.position       = mul(position, g_uniforms.mvp_matrix);
     output.world_position = mul(position, g_uniforms.model_matrix).xyz;
-    output.world_normal   = normalize(mul(float4(input.normal, 0.F), g_uniforms.model_matrix).xyz);
+    output.world_normal   = normalize(mul(float4(DecodeOctahedralNormal(input.oct_normal), 0.F), g_uniforms.model_matrix).xyz);
     output.texcoord       = input.texcoord;
 
     return output;
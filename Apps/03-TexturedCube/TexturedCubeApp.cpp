@@ -72,14 +72,16 @@ void TexturedCubeApp::Init()
     const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
     m_camera.Resize(GetRenderContext().GetSettings().frame_size);
 
-    // Create vertex buffer for cube mesh
+    // Create vertex buffer for cube mesh with normals packed in octahedral encoding, which are decoded in vertex shader
     const gfx::CubeMesh<CubeVertex> cube_mesh(CubeVertex::layout);
-    const Data::Size vertex_data_size   = cube_mesh.GetVertexDataSize();
-    const Data::Size  vertex_size       = cube_mesh.GetVertexSize();
+    const gfx::Mesh::VertexLayout packed_vertex_layout = cube_mesh.GetVertexLayout().GetPackedLayout({ gfx::Mesh::VertexField::Normal });
+    const Data::Bytes packed_vertex_data = cube_mesh.GetPackedVertexData(packed_vertex_layout);
+    const auto       vertex_data_size   = static_cast<Data::Size>(packed_vertex_data.size());
+    const Data::Size vertex_size        = packed_vertex_layout.GetVertexSize();
     rhi::Buffer vertex_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForVertexBuffer(vertex_data_size, vertex_size));
     vertex_buffer.SetName("Cube Vertex Buffer");
     vertex_buffer.SetData(
-        { { reinterpret_cast<Data::ConstRawPtr>(cube_mesh.GetVertices().data()), vertex_data_size } }, // NOSONAR
+        { { packed_vertex_data.data(), vertex_data_size } },
         render_cmd_queue
     );
     m_vertex_buffer_set = rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer });
@@ -119,12 +121,14 @@ void TexturedCubeApp::Init()
                     {
                         rhi::Program::InputBufferLayout
                         {
-                            rhi::Program::InputBufferLayout::ArgumentSemantics { cube_mesh.GetVertexLayout().GetSemantics() }
+                            rhi::Program::InputBufferLayout::ArgumentSemantics { packed_vertex_layout.GetSemantics() },
+                            rhi::Program::InputBufferLayout::StepType::PerVertex, 1U,
+                            packed_vertex_layout.GetFormats()
                         }
                     },
                     rhi::ProgramArgumentAccessors
                     {
-                        { { rhi::ShaderType::All,   "g_uniforms"  }, rhi::ProgramArgumentAccessor::Type::FrameConstant },
+                        { { rhi::ShaderType::All,   "g_uniforms"  }, rhi::ProgramArgumentAccessor::Type::FrameConstant, true },
                         { { rhi::ShaderType::Pixel, "g_constants" }, rhi::ProgramArgumentAccessor::Type::Constant },
                         { { rhi::ShaderType::Pixel, "g_texture"   }, rhi::ProgramArgumentAccessor::Type::Constant },
                         { { rhi::ShaderType::Pixel, "g_sampler"   }, rhi::ProgramArgumentAccessor::Type::Constant },
@@ -152,11 +156,14 @@ void TexturedCubeApp::Init()
     );
 
     // Create frame buffer resources
-    const auto uniforms_data_size = static_cast<Data::Size>(sizeof(m_shader_uniforms));
+    // Small private addressable uniforms buffers updated every frame are written by CPU directly without staging copy, when supported by RHI
+    rhi::BufferSettings uniforms_buffer_settings = rhi::BufferSettings::ForConstantBuffer(static_cast<Data::Size>(sizeof(m_shader_uniforms)), true);
+    uniforms_buffer_settings.is_direct_cpu_write = true;
+
     for(TexturedCubeFrame& frame : GetFrames())
     {
         // Create uniforms buffer with volatile parameters for frame rendering
-        frame.uniforms_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForConstantBuffer(uniforms_data_size, false, true));
+        frame.uniforms_buffer = GetRenderContext().CreateBuffer(uniforms_buffer_settings);
         frame.uniforms_buffer.SetName(IndexedName("Uniforms Buffer", frame.index));
 
         // Configure program resource bindings
@@ -28,6 +28,7 @@ Tutorial demonstrating parallel rendering with Methane graphics API
 #include <Methane/Tutorials/AppSettings.h>
 #include <Methane/Graphics/CubeMesh.hpp>
 #include <Methane/Data/TimeAnimation.h>
+#include <Methane/Data/FrameMemoryPool.h>
 #include <Methane/Instrumentation.h>
 
 #include <taskflow/taskflow.hpp>
@@ -225,6 +226,14 @@ void ParallelRenderingApp::Init()
             frame.parallel_render_cmd_list.SetValidationEnabled(false);
             frame.parallel_render_cmd_list.SetName(IndexedName("Parallel Cubes Rendering", frame.index));
             frame.execute_cmd_list_set = rhi::CommandListSet({ frame.parallel_render_cmd_list.GetInterface() }, frame.index);
+
+            // Create render command sequences with cube drawing commands for each of parallel command lists
+            frame.cubes_sequences.reserve(m_settings.GetActiveRenderThreadCount());
+            for(uint32_t sequence_index = 0U; sequence_index < m_settings.GetActiveRenderThreadCount(); ++sequence_index)
+            {
+                rhi::RenderCommandSequence& cubes_sequence = frame.cubes_sequences.emplace_back(GetScreenRenderPattern());
+                cubes_sequence.SetName(fmt::format("Cubes Sequence {} {}", sequence_index, frame.index));
+            }
         }
         else
         {
@@ -254,6 +263,22 @@ void ParallelRenderingApp::Init()
 
     // Initialize cube parameters
     m_cube_array_parameters = InitializeCubeArrayParameters();
+    const auto cubes_count = static_cast<Data::Size>(m_cube_array_parameters.size());
+    m_cube_transforms.Resize(cubes_count);
+    m_cube_bounding_spheres.Resize(cubes_count);
+
+    // Cube positions and texture indices do not change, so bounding spheres and uniform texture indices are set only once,
+    // while MVP-matrices of cube uniforms are updated every frame from cube transforms
+    for(Data::Index cube_index = 0U; cube_index < cubes_count; ++cube_index)
+    {
+        const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
+        m_cube_transforms.Set(cube_index, cube_params.position, hlslpp::float4(0.F, 0.F, 0.F, 1.F), hlslpp::float3(cube_params.scale));
+        m_cube_bounding_spheres.Set(cube_index, cube_params.position, cube_params.bounding_radius);
+
+        hlslpp::Uniforms uniforms{};
+        uniforms.texture_index = static_cast<int>(cube_params.thread_index);
+        m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
+    }
 
     // Update initial resource states before asteroids drawing without applying barriers on GPU to let automatic state propagation from Common state work
     m_cube_array_buffers_ptr->CreateBeginningResourceBarriers().ApplyTransitions();
@@ -291,11 +316,10 @@ ParallelRenderingApp::CubeArrayParameters ParallelRenderingApp::InitializeCubeAr
             const float tz = static_cast<float>(cube_index / cbrt_count_sqr) - cbrt_count_half;
             const float cs = cube_scale_distribution(rng);
 
-            const hlslpp::float4x4 scale_matrix = hlslpp::float4x4::scale(cs);
-            const hlslpp::float4x4 translation_matrix = hlslpp::float4x4::translation(tx * ts, ty * ts, tz * ts);
-
             CubeParameters& cube_params = cube_array_parameters[cube_index];
-            cube_params.model_matrix = hlslpp::mul(scale_matrix, translation_matrix);
+            cube_params.position = hlslpp::float3(tx * ts, ty * ts, tz * ts);
+            cube_params.scale = cs;
+            cube_params.bounding_radius = cs * std::sqrt(3.F) / 2.F; // half-diagonal of the unit cube scaled
             cube_params.rotation_speed_y = rotation_speed_distribution(rng);
             cube_params.rotation_speed_z = rotation_speed_distribution(rng);
 
@@ -333,16 +357,17 @@ bool ParallelRenderingApp::Animate(double, double delta_seconds)
     m_camera.Rotate(m_camera.GetOrientation().up, static_cast<float>(delta_seconds * 360.0 / 16.0));
 
     const double delta_angle_rad = delta_seconds * gfx::ConstDouble::Pi;
-    tf::Taskflow task_flow;
-    task_flow.for_each(m_cube_array_parameters.begin(), m_cube_array_parameters.end(),
-        [delta_angle_rad](CubeParameters& cube_params)
+    constexpr uint32_t cubes_chunk_size = 256U;
+    GetRenderContext().ParallelFor(0U, m_cube_transforms.GetCount(),
+        [this, delta_angle_rad](const uint32_t cube_index)
         {
-            const hlslpp::float4x4 rotate_matrix = hlslpp::mul(hlslpp::float4x4::rotation_z(static_cast<float>(delta_angle_rad * cube_params.rotation_speed_z)),
-                                                               hlslpp::float4x4::rotation_y(static_cast<float>(delta_angle_rad * cube_params.rotation_speed_y)));
-            cube_params.model_matrix = hlslpp::mul(rotate_matrix, cube_params.model_matrix);
-        });
-
-    GetRenderContext().GetParallelExecutor().run(task_flow).get();
+            const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
+            const hlslpp::float4 rotation = gfx::CombineRotations(
+                gfx::GetAxisRotation(hlslpp::float3(0.F, 0.F, 1.F), static_cast<float>(delta_angle_rad * cube_params.rotation_speed_z)),
+                gfx::GetAxisRotation(hlslpp::float3(0.F, 1.F, 0.F), static_cast<float>(delta_angle_rad * cube_params.rotation_speed_y)));
+            m_cube_transforms.Rotate(cube_index, rotation);
+        },
+        cubes_chunk_size);
     return true;
 }
 
@@ -363,19 +388,15 @@ bool ParallelRenderingApp::Update()
     if (!UserInterfaceApp::Update())
         return false;
 
-    // Update MVP-matrices for all cube instances so that they are positioned in a cube grid
-    tf::Taskflow task_flow;
-    task_flow.for_each_index(0U, static_cast<uint32_t>(m_cube_array_parameters.size()), 1U,
-        [this](const uint32_t cube_index)
-        {
-            const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
-            hlslpp::Uniforms uniforms{};
-            uniforms.mvp_matrix = hlslpp::transpose(hlslpp::mul(cube_params.model_matrix, m_camera.GetViewProjMatrix()));
-            uniforms.texture_index = cube_params.thread_index;
-            m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
-        });
+    // Update MVP-matrices for all cube instances so that they are positioned in a cube grid,
+    // matrices are written directly to cube uniforms in batches processed in parallel
+    m_cube_transforms.WriteMvpMatrices(m_camera.GetViewProjMatrix(),
+                                       reinterpret_cast<Data::RawPtr>(m_cube_array_buffers_ptr->GetFinalPassUniformsData()), // NOSONAR
+                                       static_cast<Data::Size>(sizeof(hlslpp::Uniforms)), &GetRenderContext().GetParallelExecutor());
 
-    GetRenderContext().GetParallelExecutor().run(task_flow).get();
+    // Cull cubes outside of camera frustum, so that only visible cube instances are drawn
+    gfx::FrustumCuller(m_camera, &GetRenderContext().GetFrameMemoryPool().GetMemoryResource())
+        .CullSpheres(m_cube_bounding_spheres, m_visible_cube_indices, &GetRenderContext().GetParallelExecutor());
     return true;
 }
 
@@ -386,7 +407,7 @@ bool ParallelRenderingApp::Render()
         return false;
 
     // Update uniforms buffer related to current frame
-    const ParallelRenderingFrame& frame  = GetCurrentFrame();
+    ParallelRenderingFrame& frame = GetCurrentFrame();
     const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
     frame.cubes_array.uniforms_buffer.SetData(m_cube_array_buffers_ptr->GetFinalPassUniformsSubresources(), render_cmd_queue);
 
@@ -399,24 +420,36 @@ bool ParallelRenderingApp::Render()
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
         const std::vector<rhi::RenderCommandList>& render_cmd_lists = frame.parallel_render_cmd_list.GetParallelCommandLists();
-        const uint32_t instance_count_per_command_list = Data::DivCeil(m_cube_array_buffers_ptr->GetInstanceCount(), static_cast<uint32_t>(render_cmd_lists.size()));
+        const auto     visible_count = static_cast<uint32_t>(m_visible_cube_indices.size());
+        const uint32_t instance_count_per_command_list = Data::DivCeil(visible_count, static_cast<uint32_t>(render_cmd_lists.size()));
+        META_CHECK_ARG_EQUAL(frame.cubes_sequences.size(), render_cmd_lists.size());
 
-        // Generate thread tasks for each of parallel render command lists to encode cubes rendering commands
-        tf::Taskflow render_task_flow;
-        render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
-            [this, &frame, &render_cmd_lists, instance_count_per_command_list](const uint32_t cmd_list_index)
+        // Sequences recorded in previous frames are replayed as is, unless visible cubes have changed or sequence was invalidated
+        const bool visible_cubes_changed = frame.cubes_sequences_visible_indices != m_visible_cube_indices;
+        if (visible_cubes_changed)
+        {
+            frame.cubes_sequences_visible_indices = m_visible_cube_indices;
+        }
+
+        // Encode cubes rendering commands to each of parallel render command lists in multiple threads
+        GetRenderContext().ParallelFor(0U, static_cast<uint32_t>(render_cmd_lists.size()),
+            [this, &frame, &render_cmd_lists, visible_count, instance_count_per_command_list, visible_cubes_changed](const uint32_t cmd_list_index)
             {
-                const uint32_t begin_instance_index = cmd_list_index * instance_count_per_command_list;
-                const uint32_t end_instance_index = std::min(begin_instance_index + instance_count_per_command_list, m_cube_array_buffers_ptr->GetInstanceCount());
-                RenderCubesRange(render_cmd_lists[cmd_list_index], frame.cubes_array.program_bindings_per_instance, begin_instance_index, end_instance_index);
+                const rhi::RenderCommandSequence& cubes_sequence = frame.cubes_sequences[cmd_list_index];
+                if (visible_cubes_changed || cubes_sequence.GetState() != rhi::RenderCommandSequence::State::Recorded)
+                {
+                    const uint32_t begin_visible_index = std::min(cmd_list_index * instance_count_per_command_list, visible_count);
+                    const uint32_t end_visible_index = std::min(begin_visible_index + instance_count_per_command_list, visible_count);
+                    cubes_sequence.Reset();
+                    RenderCubesRange(cubes_sequence, frame.cubes_array.program_bindings_per_instance, begin_visible_index, end_visible_index);
+                    cubes_sequence.Commit();
+                }
+                render_cmd_lists[cmd_list_index].ReplayCommandSequence(cubes_sequence);
             }
         );
-
-        // Execute rendering in multiple threads
-        GetRenderContext().GetParallelExecutor().run(render_task_flow).get();
 #else
         // The same parallel rendering is done inside of MeshBuffers::DrawParallel helper function
-        m_cube_array_buffers_ptr->DrawParallel(*frame.parallel_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
+        m_cube_array_buffers_ptr->DrawParallel(frame.parallel_render_cmd_list, frame.cubes_array.program_bindings_per_instance, m_visible_cube_indices);
 #endif
 
         RenderOverlay(frame.parallel_render_cmd_list.GetParallelCommandLists().back());
@@ -429,9 +462,10 @@ bool ParallelRenderingApp::Render()
         frame.serial_render_cmd_list.SetViewState(GetViewState());
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
-        RenderCubesRange(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
+        RenderCubesRange(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, 0U, static_cast<uint32_t>(m_visible_cube_indices.size()));
 #else
-        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance);
+        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance,
+                                       m_visible_cube_indices.data(), m_visible_cube_indices.data() + m_visible_cube_indices.size());
 #endif
 
         RenderOverlay(frame.serial_render_cmd_list);
@@ -444,26 +478,29 @@ bool ParallelRenderingApp::Render()
     return true;
 }
 
-void ParallelRenderingApp::RenderCubesRange(const rhi::RenderCommandList& render_cmd_list,
+template<typename CommandEncoderType>
+void ParallelRenderingApp::RenderCubesRange(const CommandEncoderType& command_encoder,
                                             const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
-                                            uint32_t begin_instance_index, const uint32_t end_instance_index) const
+                                            uint32_t begin_visible_index, const uint32_t end_visible_index) const
 {
     META_FUNCTION_TASK();
     // Resource barriers are not set for vertex and index buffers, since it works with automatic state propagation from Common state
-    render_cmd_list.SetVertexBuffers(m_cube_array_buffers_ptr->GetVertexBuffers(), false);
-    render_cmd_list.SetIndexBuffer(m_cube_array_buffers_ptr->GetIndexBuffer(), false);
+    command_encoder.SetVertexBuffers(m_cube_array_buffers_ptr->GetVertexBuffers(), false);
+    command_encoder.SetIndexBuffer(m_cube_array_buffers_ptr->GetIndexBuffer(), false);
 
-    for (uint32_t instance_index = begin_instance_index; instance_index < end_instance_index; ++instance_index)
+    for (uint32_t visible_index = begin_visible_index; visible_index < end_visible_index; ++visible_index)
     {
+        const uint32_t instance_index = m_visible_cube_indices[visible_index];
+
         // Constant argument bindings are applied once per command list, mutables are applied always
         // Bound resources are retained by command list during its lifetime, but only for the first binding instance (since all binding instances use the same resource objects)
         rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior;
         bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::ConstantOnce);
-        if (instance_index == begin_instance_index)
+        if (visible_index == begin_visible_index)
             bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::RetainResources);
 
-        render_cmd_list.SetProgramBindings(program_bindings_per_instance[instance_index], bindings_apply_behavior);
-        render_cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle);
+        command_encoder.SetProgramBindings(program_bindings_per_instance[instance_index], bindings_apply_behavior);
+        command_encoder.DrawIndexed(rhi::RenderPrimitive::Triangle);
     }
 }
 
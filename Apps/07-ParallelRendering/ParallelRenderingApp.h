@@ -49,6 +49,10 @@ struct ParallelRenderingFrame final
     rhi::RenderCommandList           serial_render_cmd_list;
     rhi::CommandListSet              execute_cmd_list_set;
 
+    // Cube drawing commands recorded once per parallel command list and re-recorded only when visible cubes change
+    std::vector<rhi::RenderCommandSequence> cubes_sequences;
+    gfx::VisibleIndices                     cubes_sequences_visible_indices;
+
     using gfx::AppFrame::AppFrame;
 };
 
@@ -92,7 +96,9 @@ protected:
 private:
     struct CubeParameters
     {
-        hlslpp::float4x4 model_matrix;
+        hlslpp::float3   position;
+        float            scale            = 1.F;
+        float            bounding_radius  = 1.F;
         double           rotation_speed_y = 0.25f;
         double           rotation_speed_z = 0.5f;
         uint32_t         thread_index = 0;
@@ -103,9 +109,12 @@ private:
 
     CubeArrayParameters InitializeCubeArrayParameters() const;
     bool Animate(double elapsed_seconds, double delta_seconds);
-    void RenderCubesRange(const rhi::RenderCommandList& remder_cmd_list,
+
+    // Command encoder is either render command list or render command sequence
+    template<typename CommandEncoderType>
+    void RenderCubesRange(const CommandEncoderType& command_encoder,
                           const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
-                          uint32_t begin_instance_index, const uint32_t end_instance_index) const;
+                          uint32_t begin_visible_index, const uint32_t end_visible_index) const;
 
     Settings            m_settings;
     gfx::Camera         m_camera;
@@ -114,6 +123,9 @@ private:
     rhi::Sampler        m_texture_sampler;
     Ptr<MeshBuffers>    m_cube_array_buffers_ptr;
     CubeArrayParameters m_cube_array_parameters;
+    gfx::InstanceTransforms m_cube_transforms;
+    gfx::BoundingSpheres m_cube_bounding_spheres;
+    gfx::VisibleIndices  m_visible_cube_indices;
 };
 
 } // namespace Methane::Tutorials
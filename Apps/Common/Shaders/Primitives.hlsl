@@ -69,4 +69,16 @@ float4 ColorLinearToSrgb(float4 linear_color)
 float linstep(float min, float max, float s)
 {
     return saturate((s - min) / (max - min));
+}
+
+// Decodes normal from octahedral encoding of OCTNORMAL vertex attribute with RG16Snorm format
+float3 DecodeOctahedralNormal(float2 oct_normal)
+{
+    float3 normal = float3(oct_normal, 1.0 - abs(oct_normal.x) - abs(oct_normal.y));
+    if (normal.z < 0.0)
+    {
+        const float2 sign_xy = float2(normal.x >= 0.0 ? 1.0 : -1.0, normal.y >= 0.0 ? 1.0 : -1.0);
+        normal.xy = (1.0 - abs(normal.yx)) * sign_xy;
+    }
+    return normalize(normal);
 }
\ No newline at end of file
@@ -151,16 +151,25 @@ ITT_DOMAIN_EXTERN();
 
 #ifdef METHANE_LOGGING_ENABLED
 
-#include <Methane/Platform/Utils.h>
+#include <Methane/Platform/AsyncLogger.h>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+// Message arguments are not evaluated when logging is disabled for the category and level
+#define META_LOG_CATEGORY(/*LogCategoryId*/category_id, /*LogLevel*/level, /*std::string_view*/message, ...) \
+    do { \
+        Methane::Platform::AsyncLogger& meta_async_logger = Methane::Platform::AsyncLogger::Get(); \
+        if (meta_async_logger.IsEnabled(category_id, level)) \
+            meta_async_logger.Log(category_id, level, message, ## __VA_ARGS__); \
+    } while(false)
+
 #define META_LOG(/*std::string_view*/message, ...) \
-    Methane::Platform::PrintToDebugOutput(fmt::format(message, ## __VA_ARGS__))
+    META_LOG_CATEGORY(Methane::Platform::AsyncLogger::g_default_category_id, Methane::Platform::LogLevel::Debug, message, ## __VA_ARGS__)
 
 #else // ifdef METHANE_LOGGING_ENABLED
 
+#define META_LOG_CATEGORY(/*LogCategoryId*/category_id, /*LogLevel*/level, /*const std::string& */message, ...)
 #define META_LOG(/*const std::string& */message, ...)
 
 #endif // ifdef METHANE_LOGGING_ENABLED
@@ -25,6 +25,9 @@ Methane PIMPL implementation helper functions.
 
 #include <Methane/Pimpl.h>
 #include <Methane/Memory.hpp>
+#include <Methane/Exceptions.hpp>
+
+#include <type_traits>
 
 #ifdef META_PIMPL_NULL_CHECK_ENABLED
 #include <Methane/Checks.hpp>
@@ -42,4 +45,20 @@ ImplType& GetImpl(const Ptr<ImplType>& impl_ptr) META_PIMPL_NOEXCEPT
     return *impl_ptr;
 }
 
+// Casts interface pointer to the final implementation type. With inlined PIMPL single backend implementation is known
+// at compile time, so interface pointer is casted statically unless interface is a virtual base of implementation.
+template<typename ImplType, typename InterfaceType>
+Ptr<ImplType> GetImplPtr(const Ptr<InterfaceType>& interface_ptr)
+{
+#ifdef META_PIMPL_INLINE
+    static_assert(std::is_final_v<ImplType>, "PIMPL implementation class must be final to devirtualize inlined calls");
+    if constexpr (IsStaticCastable<InterfaceType*, ImplType*>::value)
+        return std::static_pointer_cast<ImplType>(interface_ptr);
+    else
+        return std::dynamic_pointer_cast<ImplType>(interface_ptr);
+#else
+    return std::dynamic_pointer_cast<ImplType>(interface_ptr);
+#endif
+}
+
 } // namespace Methane
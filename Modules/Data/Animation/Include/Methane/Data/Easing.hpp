@@ -0,0 +1,66 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/Easing.hpp
+Built-in easing curves used by batched value animations.
+
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+namespace Methane::Data
+{
+
+enum class EasingType : uint8_t
+{
+    Linear = 0U,
+    QuadIn,
+    QuadOut,
+    QuadInOut,
+    CubicIn,
+    CubicOut,
+    CubicInOut,
+    SineIn,
+    SineOut,
+    SineInOut,
+};
+
+// Maps normalized animation time in range [0, 1] to normalized animation progress with the given easing curve
+[[nodiscard]] inline double ApplyEasing(EasingType easing_type, double t) noexcept
+{
+    constexpr double half_pi = 1.5707963267948966;
+    switch(easing_type)
+    {
+    case EasingType::Linear:     return t;
+    case EasingType::QuadIn:     return t * t;
+    case EasingType::QuadOut:    return t * (2.0 - t);
+    case EasingType::QuadInOut:  return t < 0.5 ? 2.0 * t * t : -1.0 + (4.0 - 2.0 * t) * t;
+    case EasingType::CubicIn:    return t * t * t;
+    case EasingType::CubicOut:   { const double s = t - 1.0; return s * s * s + 1.0; }
+    case EasingType::CubicInOut: return t < 0.5 ? 4.0 * t * t * t : (t - 1.0) * (2.0 * t - 2.0) * (2.0 * t - 2.0) + 1.0;
+    case EasingType::SineIn:     return 1.0 - std::cos(t * half_pi);
+    case EasingType::SineOut:    return std::sin(t * half_pi);
+    case EasingType::SineInOut:  return 0.5 * (1.0 - std::cos(t * 2.0 * half_pi));
+    default:                     return t;
+    }
+}
+
+} // namespace Methane::Data
@@ -77,7 +77,7 @@ public:
     void DryUpdate() override
     {
         META_FUNCTION_TASK();
-        m_update_function(m_value, m_start_value, m_prev_elapsed_seconds, 0.0)
+        m_update_function(m_value, m_start_value, m_prev_elapsed_seconds, 0.0);
     }
 
 private:
@@ -0,0 +1,218 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/ValueAnimationsBatch.hpp
+Batch of typed value animations stored in structure-of-arrays layout,
+updated with one shared timestamp and built-in easing curves, optionally in parallel.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Animation.h"
+#include "Easing.hpp"
+
+#include <Methane/Data/ParallelFor.hpp>
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/taskflow.hpp>
+#include <vector>
+#include <algorithm>
+
+namespace Methane::Data
+{
+
+template<typename ValueType>
+class ValueAnimationsBatch : public Animation
+{
+public:
+    static constexpr uint32_t g_default_chunk_size = 1024U;
+
+    // Animations are updated in parallel with the given executor, when their count exceeds one chunk size
+    explicit ValueAnimationsBatch(tf::Executor* parallel_executor_ptr = nullptr, uint32_t chunk_size = g_default_chunk_size)
+        : m_parallel_executor_ptr(parallel_executor_ptr)
+        , m_chunk_size(chunk_size)
+    {
+        META_CHECK_ARG_NOT_ZERO(chunk_size);
+    }
+
+    // Animates value from its current state to the end value during duration with the given easing curve.
+    // Value reference must stay valid until animation is completed or batch is cleared.
+    void Add(ValueType& value, const ValueType& end_value, double duration_sec,
+             EasingType easing_type = EasingType::Linear, double delay_sec = 0.0)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_GREATER_DESCR(duration_sec, 0.0, "animation duration must be positive");
+        m_values.push_back(&value);
+        m_start_values.push_back(value);
+        m_end_values.push_back(end_value);
+        m_start_times.push_back(m_prev_elapsed_seconds + delay_sec);
+        m_inv_durations.push_back(1.0 / duration_sec);
+        m_easing_types.push_back(easing_type);
+        m_completed_flags.push_back(0U);
+    }
+
+    [[nodiscard]] size_t GetCount() const noexcept { return m_values.size(); }
+    [[nodiscard]] bool   IsEmpty() const noexcept  { return m_values.empty(); }
+
+    void Clear() noexcept
+    {
+        META_FUNCTION_TASK();
+        m_values.clear();
+        m_start_values.clear();
+        m_end_values.clear();
+        m_start_times.clear();
+        m_inv_durations.clear();
+        m_easing_types.clear();
+        m_completed_flags.clear();
+    }
+
+    // Updates all animations at the given elapsed time of the batch and removes completed animations
+    void UpdateAt(double elapsed_seconds)
+    {
+        META_FUNCTION_TASK();
+        m_prev_elapsed_seconds = elapsed_seconds;
+        if (m_values.empty())
+            return;
+
+        const auto animations_count = static_cast<uint32_t>(m_values.size());
+        if (!m_parallel_executor_ptr || animations_count <= m_chunk_size)
+        {
+            UpdateRange(0U, animations_count, elapsed_seconds);
+        }
+        else
+        {
+            const uint32_t chunks_count = (animations_count + m_chunk_size - 1U) / m_chunk_size;
+            ParallelFor(*m_parallel_executor_ptr, 0U, chunks_count,
+                [this, animations_count, elapsed_seconds](const uint32_t chunk_index)
+                {
+                    const uint32_t begin_index = chunk_index * m_chunk_size;
+                    UpdateRange(begin_index, std::min(begin_index + m_chunk_size, animations_count), elapsed_seconds);
+                });
+        }
+
+        RemoveCompleted();
+    }
+
+    // Animation overrides
+
+    void Restart() noexcept override
+    {
+        META_FUNCTION_TASK();
+        // Rebase start times of active animations to the restarted timer
+        for(double& start_time : m_start_times)
+        {
+            start_time -= m_prev_elapsed_seconds;
+        }
+        m_prev_elapsed_seconds = 0.0;
+        Animation::Restart();
+    }
+
+    bool Update() override
+    {
+        META_FUNCTION_TASK();
+        if (GetState() != State::Running)
+            return false;
+
+        if (IsTimeOver())
+        {
+            Stop();
+            return false;
+        }
+
+        UpdateAt(GetElapsedSecondsD());
+        return true;
+    }
+
+    void DryUpdate() override
+    {
+        META_FUNCTION_TASK();
+        const auto animations_count = static_cast<uint32_t>(m_values.size());
+        UpdateRange(0U, animations_count, m_prev_elapsed_seconds);
+    }
+
+private:
+    void UpdateRange(uint32_t begin_index, uint32_t end_index, double elapsed_seconds) noexcept
+    {
+        for(uint32_t index = begin_index; index < end_index; ++index)
+        {
+            const double time = (elapsed_seconds - m_start_times[index]) * m_inv_durations[index];
+            if (time <= 0.0)
+                continue;
+
+            if (time >= 1.0)
+            {
+                *m_values[index] = m_end_values[index];
+                m_completed_flags[index] = 1U;
+                continue;
+            }
+
+            const auto progress = static_cast<float>(ApplyEasing(m_easing_types[index], time));
+            const ValueType& start_value = m_start_values[index];
+            *m_values[index] = start_value + (m_end_values[index] - start_value) * progress;
+        }
+    }
+
+    void RemoveCompleted()
+    {
+        META_FUNCTION_TASK();
+        size_t index = 0U;
+        while(index < m_values.size())
+        {
+            if (!m_completed_flags[index])
+            {
+                ++index;
+                continue;
+            }
+
+            // Swap completed animation with the last one and pop it back, so the order of animations is not preserved
+            const size_t last_index = m_values.size() - 1U;
+            if (index != last_index)
+            {
+                m_values[index]          = m_values[last_index];
+                m_start_values[index]    = m_start_values[last_index];
+                m_end_values[index]      = m_end_values[last_index];
+                m_start_times[index]     = m_start_times[last_index];
+                m_inv_durations[index]   = m_inv_durations[last_index];
+                m_easing_types[index]    = m_easing_types[last_index];
+                m_completed_flags[index] = m_completed_flags[last_index];
+            }
+            m_values.pop_back();
+            m_start_values.pop_back();
+            m_end_values.pop_back();
+            m_start_times.pop_back();
+            m_inv_durations.pop_back();
+            m_easing_types.pop_back();
+            m_completed_flags.pop_back();
+        }
+    }
+
+    tf::Executor*           m_parallel_executor_ptr;
+    uint32_t                m_chunk_size;
+    double                  m_prev_elapsed_seconds = 0.0;
+    std::vector<ValueType*> m_values;
+    std::vector<ValueType>  m_start_values;
+    std::vector<ValueType>  m_end_values;
+    std::vector<double>     m_start_times;
+    std::vector<double>     m_inv_durations;
+    std::vector<EasingType> m_easing_types;
+    std::vector<uint8_t>    m_completed_flags; // not std::vector<bool> to allow concurrent writes from update chunks
+};
+
+} // namespace Methane::Data
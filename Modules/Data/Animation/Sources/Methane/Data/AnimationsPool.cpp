@@ -24,7 +24,7 @@ Pool of animations for centralized updating, adding and removing in application.
 #include <Methane/Data/AnimationsPool.h>
 #include <Methane/Instrumentation.h>
 
-#include <vector>
+#include <algorithm>
 
 namespace Methane::Data
 {
@@ -42,22 +42,11 @@ void AnimationsPool::Update()
         return;
     }
 
-    std::vector<size_t> completed_animation_indices;
-    for (size_t animation_index = 0; animation_index < size(); ++animation_index)
-    {
-        if (const Ptr<Animation>& animation_ptr = (*this)[animation_index];
-            !animation_ptr || !animation_ptr->Update())
-        {
-            completed_animation_indices.push_back(animation_index);
-        }
-    }
-
-    for (auto animation_index_it = completed_animation_indices.rbegin();
-              animation_index_it != completed_animation_indices.rend(); 
-            ++animation_index_it)
-    {
-        erase(begin() + *animation_index_it);
-    }
+    // Completed animations are removed in place without temporary allocations of completed indices
+    erase(std::remove_if(begin(), end(),
+                         [](const Ptr<Animation>& animation_ptr)
+                         { return !animation_ptr || !animation_ptr->Update(); }),
+          end());
 }
 
 void AnimationsPool::DryUpdate() const
@@ -0,0 +1,91 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FrameMemoryPool.h
+Pool of per-thread linear memory resources for short-lived allocations of frame code paths,
+which are reset at frame boundaries instead of returning memory to the general heap.
+
+******************************************************************************/
+
+#pragma once
+
+#include "LinearMemoryResource.h"
+
+#include <Methane/Memory.hpp>
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace Methane::Data
+{
+
+class FrameMemoryPool
+{
+public:
+    // Memory allocated in some frame stays valid until the end of the next frame,
+    // so that frame data prepared by pipelined update is still alive during its rendering
+    static constexpr uint32_t g_frame_slots_count = 2U;
+
+    struct Statistics
+    {
+        uint64_t frame_index                = 0U;
+        size_t   threads_count              = 0U;
+        size_t   allocations_count          = 0U; // allocations in current frame from all threads
+        size_t   allocated_bytes            = 0U; // bytes allocated in current frame from all threads
+        size_t   upstream_allocations_count = 0U; // blocks allocated from upstream resource during pool lifetime
+        size_t   reserved_bytes             = 0U; // total size of blocks owned by the pool
+    };
+
+    explicit FrameMemoryPool(size_t block_size = LinearMemoryResource::g_default_block_size,
+                             std::pmr::memory_resource* upstream_ptr = std::pmr::get_default_resource());
+
+    // Returns linear memory resource of the calling thread for the current frame.
+    // Resources are kept for every thread which used the pool, so it is meant for a fixed set of threads, like executor workers.
+    [[nodiscard]] std::pmr::memory_resource& GetMemoryResource();
+
+    // Starts next frame: memory resources of calling threads are lazily reset on their first use in the new frame
+    void AdvanceFrame() noexcept;
+
+    [[nodiscard]] uint64_t GetFrameIndex() const noexcept { return m_frame_index.load(std::memory_order_acquire); }
+
+    // Statistics should be queried between frames, when no other thread allocates from the pool
+    [[nodiscard]] Statistics GetStatistics() const;
+
+private:
+    struct ThreadResources
+    {
+        ThreadResources(size_t block_size, std::pmr::memory_resource* upstream_ptr);
+
+        std::array<UniquePtr<LinearMemoryResource>, g_frame_slots_count> frame_resources;
+        uint64_t frame_index = 0U;
+    };
+
+    ThreadResources& GetThreadResources();
+
+    const uint64_t                                  m_pool_id;
+    const size_t                                    m_block_size;
+    std::pmr::memory_resource*                      m_upstream_ptr;
+    std::atomic<uint64_t>                           m_frame_index{ 0U };
+    mutable std::mutex                              m_mutex;
+    std::map<std::thread::id, UniquePtr<ThreadResources>> m_thread_resources;
+};
+
+} // namespace Methane::Data
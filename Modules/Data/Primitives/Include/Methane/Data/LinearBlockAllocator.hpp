@@ -0,0 +1,80 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/LinearBlockAllocator.hpp
+Linear allocator of aligned offset ranges in memory block of fixed size,
+which is rewound to the block beginning when all allocations are freed.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <optional>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+template<typename SizeType>
+class LinearBlockAllocator
+{
+    static_assert(std::is_unsigned_v<SizeType>, "linear block allocator size type must be unsigned integer");
+
+public:
+    explicit LinearBlockAllocator(SizeType block_size) noexcept
+        : m_block_size(block_size)
+    { }
+
+    // Returns offset of the allocated range aligned to the given alignment,
+    // or empty optional when the block has not enough free space left
+    [[nodiscard]] std::optional<SizeType> Allocate(SizeType size, SizeType alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO_DESCR(alignment, "allocation alignment can not be zero");
+        const SizeType offset = (m_used_size + alignment - 1U) / alignment * alignment;
+        if (offset > m_block_size || size > m_block_size - offset)
+            return std::nullopt;
+
+        m_used_size = offset + size;
+        m_allocations_count++;
+        return offset;
+    }
+
+    // Allocated ranges are not reused one by one, the whole block is reused when all of its allocations are freed
+    void Free()
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO_DESCR(m_allocations_count, "linear block has no allocations to free");
+        if (!--m_allocations_count)
+            m_used_size = 0U;
+    }
+
+    [[nodiscard]] SizeType GetBlockSize() const noexcept        { return m_block_size; }
+    [[nodiscard]] SizeType GetUsedSize() const noexcept         { return m_used_size; }
+    [[nodiscard]] uint32_t GetAllocationsCount() const noexcept { return m_allocations_count; }
+
+private:
+    const SizeType m_block_size;
+    SizeType       m_used_size = 0U;
+    uint32_t       m_allocations_count = 0U;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,90 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/LinearMemoryResource.h
+Linear (bump) memory resource allocating from chunked blocks,
+which are rewound all at once with Reset instead of per-allocation deallocation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+
+namespace Methane::Data
+{
+
+class LinearMemoryResource final
+    : public std::pmr::memory_resource
+{
+public:
+    struct Statistics
+    {
+        size_t allocations_count          = 0U; // allocations since last reset
+        size_t allocated_bytes            = 0U; // bytes allocated since last reset, including alignment padding
+        size_t upstream_allocations_count = 0U; // blocks allocated from upstream resource during lifetime
+        size_t reserved_bytes             = 0U; // total size of currently owned blocks
+    };
+
+    static constexpr size_t g_default_block_size = 64U * 1024U;
+
+    explicit LinearMemoryResource(size_t block_size = g_default_block_size,
+                                  std::pmr::memory_resource* upstream_ptr = std::pmr::get_default_resource());
+    ~LinearMemoryResource() override;
+
+    LinearMemoryResource(const LinearMemoryResource&) = delete;
+    LinearMemoryResource(LinearMemoryResource&&) = delete;
+    LinearMemoryResource& operator=(const LinearMemoryResource&) = delete;
+    LinearMemoryResource& operator=(LinearMemoryResource&&) = delete;
+
+    // Rewinds allocation offset to the beginning of memory, making all previous allocations invalid.
+    // When memory was spread over several blocks, they are merged in one block to allocate without upstream calls next time.
+    void Reset();
+
+    // Releases all blocks back to upstream resource
+    void Release() noexcept;
+
+    [[nodiscard]] const Statistics&         GetStatistics() const noexcept { return m_statistics; }
+    [[nodiscard]] size_t                    GetBlockSize() const noexcept  { return m_block_size; }
+    [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept  { return m_upstream_ptr; }
+
+private:
+    struct Block
+    {
+        std::byte* data_ptr;
+        size_t     size;
+    };
+
+    // std::pmr::memory_resource overrides
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void  do_deallocate(void*, size_t, size_t) override { /* memory is reclaimed on Reset only */ }
+    bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    void AllocateBlock(size_t min_size);
+
+    const size_t               m_block_size;
+    std::pmr::memory_resource* m_upstream_ptr;
+    std::vector<Block>         m_blocks;
+    size_t                     m_block_index = 0U;
+    size_t                     m_block_offset = 0U;
+    Statistics                 m_statistics;
+};
+
+} // namespace Methane::Data
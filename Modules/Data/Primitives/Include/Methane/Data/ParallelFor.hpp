@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/ParallelFor.hpp
+Parallel loop over index range dispatched to executor worker threads without task graph construction.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+namespace Internal
+{
+
+template<typename IndexType>
+struct ParallelForState
+{
+    const IndexType          begin_index;
+    const IndexType          end_index;
+    const IndexType          chunk_size;
+    const IndexType          chunks_count;
+    std::atomic<IndexType>   next_chunk_index{ 0 };
+    std::atomic<IndexType>   completed_chunks_count{ 0 };
+    std::atomic<bool>        is_exception_captured{ false };
+    std::exception_ptr       exception_ptr;
+
+    ParallelForState(IndexType begin, IndexType end, IndexType chunk)
+        : begin_index(begin)
+        , end_index(end)
+        , chunk_size(chunk)
+        , chunks_count((end - begin + chunk - 1) / chunk)
+    { }
+
+    // Processes chunks until all of them are taken by this or other threads
+    template<typename FuncType>
+    void ProcessChunks(const FuncType& func) noexcept
+    {
+        for(IndexType chunk_index = next_chunk_index.fetch_add(1, std::memory_order_relaxed);
+            chunk_index < chunks_count;
+            chunk_index = next_chunk_index.fetch_add(1, std::memory_order_relaxed))
+        {
+            try
+            {
+                const IndexType chunk_begin_index = begin_index + chunk_index * chunk_size;
+                const IndexType chunk_end_index   = std::min(static_cast<IndexType>(chunk_begin_index + chunk_size), end_index);
+                for(IndexType index = chunk_begin_index; index < chunk_end_index; ++index)
+                {
+                    func(index);
+                }
+            }
+            catch(...)
+            {
+                if (!is_exception_captured.exchange(true))
+                    exception_ptr = std::current_exception();
+            }
+            completed_chunks_count.fetch_add(1, std::memory_order_acq_rel);
+        }
+    }
+};
+
+} // namespace Internal
+
+// Calls function for every index in range [begin_index, end_index) split in chunks, which are processed by the calling thread
+// together with executor worker threads. Unlike task graphs, no graph is constructed on every call: only lightweight
+// async tasks are submitted to the executor, which exit immediately when all chunks are already taken.
+// Executor type (tf::Executor) is a template parameter, so that its header is required at call site only.
+// Exception thrown from the function is re-thrown in the calling thread after all chunks are processed.
+template<typename ExecutorType, typename IndexType, typename FuncType>
+void ParallelFor(ExecutorType& executor, IndexType begin_index, IndexType end_index, const FuncType& func, IndexType chunk_size = 1)
+{
+    META_FUNCTION_TASK();
+    static_assert(std::is_integral_v<IndexType>, "parallel for index type must be integral");
+    META_CHECK_ARG_NOT_ZERO(chunk_size);
+    if (begin_index >= end_index)
+        return;
+
+    using State = Internal::ParallelForState<IndexType>;
+    const auto state_ptr = std::make_shared<State>(begin_index, end_index, chunk_size);
+    if (state_ptr->chunks_count > 1)
+    {
+        // Helper tasks share state ownership, because they may start after the calling thread has finished all chunks
+        const size_t helpers_count = std::min(static_cast<size_t>(state_ptr->chunks_count - 1), static_cast<size_t>(executor.num_workers()));
+        for(size_t helper_index = 0U; helper_index < helpers_count; ++helper_index)
+        {
+            executor.silent_async([state_ptr, &func]() { state_ptr->ProcessChunks(func); });
+        }
+    }
+
+    state_ptr->ProcessChunks(func);
+
+    // Remaining chunks are being processed by helper threads at this point, so waiting is short
+    while(state_ptr->completed_chunks_count.load(std::memory_order_acquire) < state_ptr->chunks_count)
+    {
+        std::this_thread::yield();
+    }
+
+    if (state_ptr->is_exception_captured.load(std::memory_order_acquire))
+        std::rethrow_exception(state_ptr->exception_ptr);
+}
+
+} // namespace Methane::Data
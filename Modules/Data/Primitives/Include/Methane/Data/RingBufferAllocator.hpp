@@ -0,0 +1,124 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/RingBufferAllocator.hpp
+Ring allocator of aligned offset ranges in memory buffer of fixed size,
+which are freed in the same order as they were allocated.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <deque>
+#include <optional>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+template<typename SizeType>
+class RingBufferAllocator
+{
+    static_assert(std::is_unsigned_v<SizeType>, "ring buffer allocator size type must be unsigned integer");
+
+public:
+    explicit RingBufferAllocator(SizeType buffer_size) noexcept
+        : m_buffer_size(buffer_size)
+    { }
+
+    // Returns offset of the contiguous allocated range aligned to the given alignment, which wraps to the buffer beginning
+    // when there is not enough space left at the buffer end, or empty optional when the buffer has not enough free space
+    [[nodiscard]] std::optional<SizeType> Allocate(SizeType size, SizeType alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO_DESCR(size, "ring buffer allocation size can not be zero");
+        META_CHECK_ARG_NOT_ZERO_DESCR(alignment, "allocation alignment can not be zero");
+        if (size > m_buffer_size)
+            return std::nullopt;
+
+        if (m_allocations.empty())
+        {
+            m_allocations.push_back({ 0U, size });
+            return SizeType{ 0U };
+        }
+
+        const SizeType head_offset = AlignOffset(m_allocations.back().end, alignment);
+        const SizeType tail_offset = m_allocations.front().begin;
+        const bool     is_wrapped  = m_allocations.back().begin < tail_offset;
+
+        std::optional<SizeType> offset_opt;
+        if (is_wrapped)
+        {
+            if (head_offset <= tail_offset && size <= tail_offset - head_offset)
+                offset_opt = head_offset;
+        }
+        else if (head_offset <= m_buffer_size && size <= m_buffer_size - head_offset)
+            offset_opt = head_offset;
+        else if (size <= tail_offset)
+            offset_opt = SizeType{ 0U };
+
+        if (offset_opt)
+            m_allocations.push_back({ *offset_opt, *offset_opt + size });
+
+        return offset_opt;
+    }
+
+    // Frees the oldest allocated range
+    void Free()
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_EMPTY_DESCR(m_allocations, "ring buffer has no allocations to free");
+        m_allocations.pop_front();
+    }
+
+    [[nodiscard]] SizeType GetBufferSize() const noexcept       { return m_buffer_size; }
+    [[nodiscard]] uint32_t GetAllocationsCount() const noexcept { return static_cast<uint32_t>(m_allocations.size()); }
+
+    // Used size includes padding between allocations and unused space at the buffer end skipped by wrapped allocations
+    [[nodiscard]] SizeType GetUsedSize() const noexcept
+    {
+        if (m_allocations.empty())
+            return 0U;
+
+        const SizeType head_offset = m_allocations.back().end;
+        const SizeType tail_offset = m_allocations.front().begin;
+        return m_allocations.back().begin < tail_offset
+             ? m_buffer_size - tail_offset + head_offset
+             : head_offset - tail_offset;
+    }
+
+private:
+    struct Allocation
+    {
+        SizeType begin;
+        SizeType end;
+    };
+
+    static SizeType AlignOffset(SizeType offset, SizeType alignment) noexcept
+    {
+        return (offset + alignment - 1U) / alignment * alignment;
+    }
+
+    const SizeType         m_buffer_size;
+    std::deque<Allocation> m_allocations;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,126 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FrameMemoryPool.cpp
+Pool of per-thread linear memory resources for short-lived allocations of frame code paths,
+which are reset at frame boundaries instead of returning memory to the general heap.
+
+******************************************************************************/
+
+#include <Methane/Data/FrameMemoryPool.h>
+
+#include <Methane/Instrumentation.h>
+
+namespace Methane::Data
+{
+
+static uint64_t GenerateFrameMemoryPoolId() noexcept
+{
+    static std::atomic<uint64_t> s_pool_id{ 0U };
+    return ++s_pool_id;
+}
+
+FrameMemoryPool::ThreadResources::ThreadResources(size_t block_size, std::pmr::memory_resource* upstream_ptr)
+{
+    META_FUNCTION_TASK();
+    for(UniquePtr<LinearMemoryResource>& frame_resource_ptr : frame_resources)
+    {
+        frame_resource_ptr = std::make_unique<LinearMemoryResource>(block_size, upstream_ptr);
+    }
+}
+
+FrameMemoryPool::FrameMemoryPool(size_t block_size, std::pmr::memory_resource* upstream_ptr)
+    : m_pool_id(GenerateFrameMemoryPoolId())
+    , m_block_size(block_size)
+    , m_upstream_ptr(upstream_ptr)
+{ }
+
+std::pmr::memory_resource& FrameMemoryPool::GetMemoryResource()
+{
+    META_FUNCTION_TASK();
+    ThreadResources& thread_resources = GetThreadResources();
+    const uint64_t frame_index = m_frame_index.load(std::memory_order_acquire);
+    LinearMemoryResource& frame_resource = *thread_resources.frame_resources[frame_index % g_frame_slots_count];
+    if (thread_resources.frame_index != frame_index)
+    {
+        // Frame slot was last used two or more frames ago, so its allocations are not alive anymore
+        frame_resource.Reset();
+        thread_resources.frame_index = frame_index;
+    }
+    return frame_resource;
+}
+
+void FrameMemoryPool::AdvanceFrame() noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_index.fetch_add(1U, std::memory_order_acq_rel);
+}
+
+FrameMemoryPool::Statistics FrameMemoryPool::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    const uint64_t frame_index = m_frame_index.load(std::memory_order_acquire);
+    Statistics statistics;
+    statistics.frame_index = frame_index;
+
+    std::scoped_lock lock(m_mutex);
+    statistics.threads_count = m_thread_resources.size();
+    for(const auto& [thread_id, thread_resources_ptr] : m_thread_resources)
+    {
+        for(const UniquePtr<LinearMemoryResource>& frame_resource_ptr : thread_resources_ptr->frame_resources)
+        {
+            const LinearMemoryResource::Statistics& resource_stats = frame_resource_ptr->GetStatistics();
+            statistics.upstream_allocations_count += resource_stats.upstream_allocations_count;
+            statistics.reserved_bytes             += resource_stats.reserved_bytes;
+        }
+        if (thread_resources_ptr->frame_index != frame_index)
+            continue;
+
+        const LinearMemoryResource::Statistics& frame_stats = thread_resources_ptr->frame_resources[frame_index % g_frame_slots_count]->GetStatistics();
+        statistics.allocations_count += frame_stats.allocations_count;
+        statistics.allocated_bytes   += frame_stats.allocated_bytes;
+    }
+    return statistics;
+}
+
+FrameMemoryPool::ThreadResources& FrameMemoryPool::GetThreadResources()
+{
+    META_FUNCTION_TASK();
+    // Last used pool resources are cached per thread to skip map lookup under mutex in the common case
+    struct ThreadCache
+    {
+        uint64_t         pool_id = 0U;
+        ThreadResources* resources_ptr = nullptr;
+    };
+    thread_local ThreadCache s_thread_cache;
+    if (s_thread_cache.pool_id == m_pool_id)
+        return *s_thread_cache.resources_ptr;
+
+    std::scoped_lock lock(m_mutex);
+    UniquePtr<ThreadResources>& thread_resources_ptr = m_thread_resources[std::this_thread::get_id()];
+    if (!thread_resources_ptr)
+    {
+        thread_resources_ptr = std::make_unique<ThreadResources>(m_block_size, m_upstream_ptr);
+        // New thread resources start from the current frame, so that the first use does not reset them
+        thread_resources_ptr->frame_index = m_frame_index.load(std::memory_order_acquire);
+    }
+    s_thread_cache = ThreadCache{ m_pool_id, thread_resources_ptr.get() };
+    return *thread_resources_ptr;
+}
+
+} // namespace Methane::Data
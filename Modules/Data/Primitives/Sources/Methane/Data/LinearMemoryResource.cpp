@@ -0,0 +1,113 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/LinearMemoryResource.cpp
+Linear (bump) memory resource allocating from chunked blocks,
+which are rewound all at once with Reset instead of per-allocation deallocation.
+
+******************************************************************************/
+
+#include <Methane/Data/LinearMemoryResource.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Methane::Data
+{
+
+static constexpr size_t g_max_block_alignment = alignof(std::max_align_t);
+
+LinearMemoryResource::LinearMemoryResource(size_t block_size, std::pmr::memory_resource* upstream_ptr)
+    : m_block_size(block_size)
+    , m_upstream_ptr(upstream_ptr)
+{
+    META_CHECK_ARG_NOT_ZERO(block_size);
+    META_CHECK_ARG_NOT_NULL(upstream_ptr);
+}
+
+LinearMemoryResource::~LinearMemoryResource()
+{
+    Release();
+}
+
+void LinearMemoryResource::Reset()
+{
+    META_FUNCTION_TASK();
+    if (m_blocks.size() > 1U)
+    {
+        // Merge all blocks into a single one of the total size, so that the next frame fits without upstream allocations
+        const size_t total_size = m_statistics.reserved_bytes;
+        Release();
+        AllocateBlock(total_size);
+    }
+    m_block_index  = 0U;
+    m_block_offset = 0U;
+    m_statistics.allocations_count = 0U;
+    m_statistics.allocated_bytes   = 0U;
+}
+
+void LinearMemoryResource::Release() noexcept
+{
+    META_FUNCTION_TASK();
+    for(const Block& block : m_blocks)
+    {
+        m_upstream_ptr->deallocate(block.data_ptr, block.size, g_max_block_alignment);
+    }
+    m_blocks.clear();
+    m_block_index  = 0U;
+    m_block_offset = 0U;
+    m_statistics.reserved_bytes = 0U;
+}
+
+void* LinearMemoryResource::do_allocate(size_t bytes, size_t alignment)
+{
+    META_FUNCTION_TASK();
+    while(m_block_index < m_blocks.size())
+    {
+        const Block& block = m_blocks[m_block_index];
+        const auto   block_address   = reinterpret_cast<uintptr_t>(block.data_ptr);
+        const size_t aligned_offset  = ((block_address + m_block_offset + alignment - 1U) & ~(alignment - 1U)) - block_address;
+        if (aligned_offset + bytes <= block.size)
+        {
+            m_statistics.allocations_count++;
+            m_statistics.allocated_bytes += aligned_offset + bytes - m_block_offset;
+            m_block_offset = aligned_offset + bytes;
+            return block.data_ptr + aligned_offset;
+        }
+        m_block_index++;
+        m_block_offset = 0U;
+    }
+
+    AllocateBlock(bytes + (alignment > g_max_block_alignment ? alignment : 0U));
+    m_block_index = m_blocks.size() - 1U;
+    return do_allocate(bytes, alignment);
+}
+
+void LinearMemoryResource::AllocateBlock(size_t min_size)
+{
+    META_FUNCTION_TASK();
+    const size_t block_size = std::max(m_block_size, min_size);
+    m_blocks.push_back({ static_cast<std::byte*>(m_upstream_ptr->allocate(block_size, g_max_block_alignment)), block_size });
+    m_statistics.upstream_allocations_count++;
+    m_statistics.reserved_bytes += block_size;
+}
+
+} // namespace Methane::Data
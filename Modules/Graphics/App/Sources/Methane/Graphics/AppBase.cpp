@@ -56,6 +56,10 @@ AppBase::AppBase(const CombinedAppSettings& settings, Data::IProvider& textures_
     add_option("-d,--device", m_settings.default_device_index, "Render at adapter index, use -1 for software adapter");
     add_option("-v,--vsync", m_initial_context_settings.vsync_enabled, "Vertical synchronization");
     add_option("-b,--frame-buffers", m_initial_context_settings.frame_buffers_count, "Frame buffers count in swap-chain");
+    add_option("-l,--frames-in-flight", m_initial_context_settings.frames_in_flight_count, "Frames count rendered on GPU while CPU encodes next frame (0 - frame buffers count)");
+    add_flag("-y,--async-uploads",
+             [this](int64_t is_async) { m_initial_context_settings.options_mask.SetBit(Rhi::ContextOption::AsyncResourceUploads, is_async); },
+             "Resource uploads are synchronized with rendering only on first use of uploaded resources");
 
 #ifdef _WIN32
     add_flag("-e,--emulated-render-pass",
@@ -219,16 +223,8 @@ bool AppBase::Update()
     META_LOG("\n========================== FRAME {} UPDATING =========================",
              m_context.IsInitialized() ? m_context.GetFrameIndex() : 0U);
 
-    Rhi::ISystem::Get().CheckForChanges();
-
-    // Update HUD info in window title
-    if (m_settings.show_hud_in_window_title &&
-        m_title_update_timer.GetElapsedSecondsD() >= g_title_update_interval_sec)
-    {
-        UpdateWindowTitle();
-        m_title_update_timer.Reset();
-    }
-
+    // Update may run on worker thread with pipelined update enabled,
+    // so system changes and window title are processed on main thread in Render
     GetAnimations().Update();
     return true;
 }
@@ -245,12 +241,23 @@ bool AppBase::Render()
     }
 
     META_CHECK_ARG_TRUE_DESCR(m_context.IsInitialized(), "RenderContext is not initialized before rendering.");
+    Rhi::ISystem::Get().CheckForChanges();
+
+    // Update HUD info in window title
+    if (m_settings.show_hud_in_window_title &&
+        m_title_update_timer.GetElapsedSecondsD() >= g_title_update_interval_sec)
+    {
+        UpdateWindowTitle();
+        m_title_update_timer.Reset();
+    }
+
     if (!m_context.ReadyToRender())
         return false;
 
     META_LOG("\n========================= FRAME {} RENDERING =========================", m_context.GetFrameIndex());
 
-    // Wait for previous frame rendering is completed and switch to next frame
+    // Wait for GPU to complete rendering of the frame submitted frames-in-flight count ago,
+    // so that encoding of this frame overlaps GPU execution of the previous frames
     m_context.WaitForGpu(Rhi::IContext::WaitFor::FramePresented);
     return true;
 }
@@ -0,0 +1,146 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrustumCuller.h
+Batch frustum culling of bounding spheres, axis-aligned boxes and normal cones of clusters
+stored in structure-of-arrays layout with compacted visible indices output.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+
+#include <array>
+#include <vector>
+#include <memory_resource>
+
+namespace tf
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+class Camera;
+
+struct BoundingSpheres
+{
+    std::vector<float> center_x;
+    std::vector<float> center_y;
+    std::vector<float> center_z;
+    std::vector<float> radius;
+
+    void Resize(Data::Size count);
+    void Set(Data::Index index, const hlslpp::float3& center, float sphere_radius);
+
+    [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(radius.size()); }
+};
+
+struct BoundingBoxes
+{
+    std::vector<float> min_x;
+    std::vector<float> min_y;
+    std::vector<float> min_z;
+    std::vector<float> max_x;
+    std::vector<float> max_y;
+    std::vector<float> max_z;
+
+    void Resize(Data::Size count);
+    void Set(Data::Index index, const hlslpp::float3& min, const hlslpp::float3& max);
+
+    [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(min_x.size()); }
+};
+
+// Normal cones of triangle clusters: all cluster triangles are back-facing
+// when dot(normalize(apex - view_position), axis) >= cutoff, cone test is disabled with cutoff equal to 1
+struct BoundingCones
+{
+    std::vector<float> apex_x;
+    std::vector<float> apex_y;
+    std::vector<float> apex_z;
+    std::vector<float> axis_x;
+    std::vector<float> axis_y;
+    std::vector<float> axis_z;
+    std::vector<float> cutoff;
+
+    void Resize(Data::Size count);
+    void Set(Data::Index index, const hlslpp::float3& apex, const hlslpp::float3& axis, float cone_cutoff);
+
+    [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(cutoff.size()); }
+};
+
+using VisibleIndices = std::vector<Data::Index>;
+
+class FrustumCuller
+{
+public:
+    // Normalized plane equation: dot(normal, point) + distance >= 0 for points inside frustum
+    struct Plane
+    {
+        float normal_x = 0.F;
+        float normal_y = 0.F;
+        float normal_z = 0.F;
+        float distance = 0.F;
+    };
+
+    using Planes = std::array<Plane, 6>;
+
+    static constexpr Data::Size g_default_chunk_size = 4096U;
+
+    // Temporary memory resource is used for per-call allocations of parallel culling, like the frame memory of render context
+    explicit FrustumCuller(const Camera& camera, std::pmr::memory_resource* temp_memory_ptr = nullptr);
+    explicit FrustumCuller(const hlslpp::float4x4& view_proj_matrix, std::pmr::memory_resource* temp_memory_ptr = nullptr);
+
+    [[nodiscard]] const Planes& GetPlanes() const noexcept { return m_planes; }
+
+    [[nodiscard]] bool IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept;
+    [[nodiscard]] bool IsBoxVisible(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept;
+
+    // Writes indices of visible items in range [begin_index, end_index) to the output pointer and returns visible items count
+    Data::Size CullSpheres(const BoundingSpheres& spheres, Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr) const noexcept;
+    Data::Size CullBoxes(const BoundingBoxes& boxes, Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr) const noexcept;
+    Data::Size CullClusters(const BoundingSpheres& spheres, const BoundingCones& cones, const hlslpp::float3& view_position,
+                            Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr) const noexcept;
+
+    // Fills compacted list of visible item indices in ascending order, culling chunks in parallel when executor is provided
+    void CullSpheres(const BoundingSpheres& spheres, VisibleIndices& visible_indices,
+                     tf::Executor* parallel_executor_ptr = nullptr, Data::Size chunk_size = g_default_chunk_size) const;
+    void CullBoxes(const BoundingBoxes& boxes, VisibleIndices& visible_indices,
+                   tf::Executor* parallel_executor_ptr = nullptr, Data::Size chunk_size = g_default_chunk_size) const;
+
+    // Clusters are visible when their bounding sphere intersects frustum and normal cone is not back-facing from view position
+    void CullClusters(const BoundingSpheres& spheres, const BoundingCones& cones, const hlslpp::float3& view_position,
+                      VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr = nullptr,
+                      Data::Size chunk_size = g_default_chunk_size) const;
+
+private:
+    template<typename CullRangeFunc>
+    void CullParallel(Data::Size items_count, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr,
+                      Data::Size chunk_size, const CullRangeFunc& cull_range) const;
+
+    Planes                     m_planes;
+    std::pmr::memory_resource* m_temp_memory_ptr;
+};
+
+} // namespace Methane::Graphics
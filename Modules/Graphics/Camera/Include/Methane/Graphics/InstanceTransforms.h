@@ -0,0 +1,86 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/InstanceTransforms.h
+Batch transformation of instances stored in structure-of-arrays layout
+to model-view-projection matrices of instance uniforms.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+
+#include <vector>
+
+namespace tf
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+// Rotations are unit quaternions (x, y, z, w) rotating row-vectors like matrices of 'hlslpp::float4x4::rotation_*'
+[[nodiscard]] hlslpp::float4 GetAxisRotation(const hlslpp::float3& axis, float angle_rad) noexcept;
+
+// Returns rotation equal to the first rotation followed by the second rotation
+[[nodiscard]] hlslpp::float4 CombineRotations(const hlslpp::float4& first, const hlslpp::float4& second) noexcept;
+
+// Instance model matrix is composed of scale, rotation and translation applied in this order
+struct InstanceTransforms
+{
+    std::vector<float> translation_x;
+    std::vector<float> translation_y;
+    std::vector<float> translation_z;
+    std::vector<float> rotation_x;
+    std::vector<float> rotation_y;
+    std::vector<float> rotation_z;
+    std::vector<float> rotation_w;
+    std::vector<float> scale_x;
+    std::vector<float> scale_y;
+    std::vector<float> scale_z;
+
+    static constexpr Data::Size g_default_chunk_size = 4096U;
+
+    // New instances are initialized with identity transformation
+    void Resize(Data::Size count);
+    void Set(Data::Index index, const hlslpp::float3& translation, const hlslpp::float4& rotation, const hlslpp::float3& scale);
+
+    // Applies rotation in instance local space before its current rotation
+    void Rotate(Data::Index index, const hlslpp::float4& local_rotation);
+
+    [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(scale_x.size()); }
+    [[nodiscard]] hlslpp::float4x4 GetModelMatrix(Data::Index index) const;
+
+    // Writes transposed model-view-projection matrices 'transpose(mul(model_matrix, view_proj_matrix))' of instances
+    // in range [begin_index, end_index) to the output, where matrix of every instance is located by 'index * matrix_stride' offset,
+    // so that matrices can be written directly to the array of instance uniform structures
+    void WriteMvpMatrices(const hlslpp::float4x4& view_proj_matrix, Data::Index begin_index, Data::Index end_index,
+                          Data::RawPtr matrices_ptr, Data::Size matrix_stride) const noexcept;
+
+    // Writes matrices of all instances, processing chunks in parallel when executor is provided
+    void WriteMvpMatrices(const hlslpp::float4x4& view_proj_matrix, Data::RawPtr matrices_ptr, Data::Size matrix_stride,
+                          tf::Executor* parallel_executor_ptr = nullptr, Data::Size chunk_size = g_default_chunk_size) const;
+};
+
+} // namespace Methane::Graphics
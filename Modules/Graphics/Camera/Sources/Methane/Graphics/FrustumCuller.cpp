@@ -0,0 +1,363 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrustumCuller.cpp
+Batch frustum culling of bounding spheres, axis-aligned boxes and normal cones of clusters
+stored in structure-of-arrays layout with compacted visible indices output.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCuller.h>
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Data/ParallelFor.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+// Items are culled in blocks: visibility flags of the block are computed first
+// in branch-less loops over SoA arrays which are vectorized by compiler, then block indices are compacted
+static constexpr Data::Size g_cull_block_size = 64U;
+
+using VisibilityFlags = std::array<uint8_t, g_cull_block_size>;
+
+static FrustumCuller::Plane MakeNormalizedPlane(float x, float y, float z, float w) noexcept
+{
+    const float inv_length = 1.F / std::sqrt(x * x + y * y + z * z);
+    return FrustumCuller::Plane{ x * inv_length, y * inv_length, z * inv_length, w * inv_length };
+}
+
+static Data::Size CompactVisibleIndices(const VisibilityFlags& visibility_flags, Data::Index block_begin_index, Data::Size block_size,
+                                        Data::Index* visible_indices_ptr) noexcept
+{
+    Data::Size visible_count = 0U;
+    for(Data::Size i = 0U; i < block_size; ++i)
+    {
+        visible_indices_ptr[visible_count] = block_begin_index + i;
+        visible_count += visibility_flags[i];
+    }
+    return visible_count;
+}
+
+static void CullSpheresBlock(const FrustumCuller::Planes& planes, const BoundingSpheres& spheres,
+                             Data::Index block_begin, Data::Size block_size, VisibilityFlags& visibility_flags) noexcept
+{
+    const float* center_x = spheres.center_x.data();
+    const float* center_y = spheres.center_y.data();
+    const float* center_z = spheres.center_z.data();
+    const float* radius   = spheres.radius.data();
+
+    for(const FrustumCuller::Plane& plane : planes)
+    {
+        for(Data::Size i = 0U; i < block_size; ++i)
+        {
+            const Data::Index index = block_begin + i;
+            const float distance = plane.normal_x * center_x[index] + plane.normal_y * center_y[index]
+                                 + plane.normal_z * center_z[index] + plane.distance;
+            visibility_flags[i] &= static_cast<uint8_t>(distance >= -radius[index]);
+        }
+    }
+}
+
+void BoundingSpheres::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    center_x.resize(count);
+    center_y.resize(count);
+    center_z.resize(count);
+    radius.resize(count);
+}
+
+void BoundingSpheres::Set(Data::Index index, const hlslpp::float3& center, float sphere_radius)
+{
+    META_CHECK_ARG_LESS(index, GetCount());
+    center_x[index] = center.x;
+    center_y[index] = center.y;
+    center_z[index] = center.z;
+    radius[index]   = sphere_radius;
+}
+
+void BoundingBoxes::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    min_x.resize(count);
+    min_y.resize(count);
+    min_z.resize(count);
+    max_x.resize(count);
+    max_y.resize(count);
+    max_z.resize(count);
+}
+
+void BoundingBoxes::Set(Data::Index index, const hlslpp::float3& min, const hlslpp::float3& max)
+{
+    META_CHECK_ARG_LESS(index, GetCount());
+    min_x[index] = min.x;
+    min_y[index] = min.y;
+    min_z[index] = min.z;
+    max_x[index] = max.x;
+    max_y[index] = max.y;
+    max_z[index] = max.z;
+}
+
+void BoundingCones::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    apex_x.resize(count);
+    apex_y.resize(count);
+    apex_z.resize(count);
+    axis_x.resize(count);
+    axis_y.resize(count);
+    axis_z.resize(count);
+    cutoff.resize(count);
+}
+
+void BoundingCones::Set(Data::Index index, const hlslpp::float3& apex, const hlslpp::float3& axis, float cone_cutoff)
+{
+    META_CHECK_ARG_LESS(index, GetCount());
+    apex_x[index] = apex.x;
+    apex_y[index] = apex.y;
+    apex_z[index] = apex.z;
+    axis_x[index] = axis.x;
+    axis_y[index] = axis.y;
+    axis_z[index] = axis.z;
+    cutoff[index] = cone_cutoff;
+}
+
+FrustumCuller::FrustumCuller(const Camera& camera, std::pmr::memory_resource* temp_memory_ptr)
+    : FrustumCuller(camera.GetViewProjMatrix(), temp_memory_ptr)
+{ }
+
+FrustumCuller::FrustumCuller(const hlslpp::float4x4& view_proj_matrix, std::pmr::memory_resource* temp_memory_ptr)
+    : m_temp_memory_ptr(temp_memory_ptr ? temp_memory_ptr : std::pmr::get_default_resource())
+{
+    META_FUNCTION_TASK();
+    // Camera matrices transform row-vectors (clip_pos = mul(world_pos, view_proj_matrix)),
+    // so frustum planes are combinations of view-projection matrix columns (Gribb-Hartmann method)
+    // with depth range [0, 1] of the projection clipping mode 'hlslpp::zclip::zero'
+    const hlslpp::float4 r0 = hlslpp::mul(hlslpp::float4(1.F, 0.F, 0.F, 0.F), view_proj_matrix);
+    const hlslpp::float4 r1 = hlslpp::mul(hlslpp::float4(0.F, 1.F, 0.F, 0.F), view_proj_matrix);
+    const hlslpp::float4 r2 = hlslpp::mul(hlslpp::float4(0.F, 0.F, 1.F, 0.F), view_proj_matrix);
+    const hlslpp::float4 r3 = hlslpp::mul(hlslpp::float4(0.F, 0.F, 0.F, 1.F), view_proj_matrix);
+    const hlslpp::float4 col_x(r0.x, r1.x, r2.x, r3.x);
+    const hlslpp::float4 col_y(r0.y, r1.y, r2.y, r3.y);
+    const hlslpp::float4 col_z(r0.z, r1.z, r2.z, r3.z);
+    const hlslpp::float4 col_w(r0.w, r1.w, r2.w, r3.w);
+
+    const std::array<hlslpp::float4, 6> plane_vectors{
+        col_w + col_x, // left
+        col_w - col_x, // right
+        col_w + col_y, // bottom
+        col_w - col_y, // top
+        col_z,         // near
+        col_w - col_z, // far
+    };
+
+    for(size_t plane_index = 0; plane_index < plane_vectors.size(); ++plane_index)
+    {
+        const hlslpp::float4& plane = plane_vectors[plane_index];
+        m_planes[plane_index] = MakeNormalizedPlane(plane.x, plane.y, plane.z, plane.w);
+    }
+}
+
+bool FrustumCuller::IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept
+{
+    META_FUNCTION_TASK();
+    const float x = center.x;
+    const float y = center.y;
+    const float z = center.z;
+    return std::all_of(m_planes.begin(), m_planes.end(),
+                       [x, y, z, radius](const Plane& plane)
+                       { return plane.normal_x * x + plane.normal_y * y + plane.normal_z * z + plane.distance >= -radius; });
+}
+
+bool FrustumCuller::IsBoxVisible(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept
+{
+    META_FUNCTION_TASK();
+    const float min_x = min.x;
+    const float min_y = min.y;
+    const float min_z = min.z;
+    const float max_x = max.x;
+    const float max_y = max.y;
+    const float max_z = max.z;
+    return std::all_of(m_planes.begin(), m_planes.end(),
+                       [=](const Plane& plane)
+                       {
+                           // Test box corner which is the farthest along the plane normal
+                           const float x = plane.normal_x >= 0.F ? max_x : min_x;
+                           const float y = plane.normal_y >= 0.F ? max_y : min_y;
+                           const float z = plane.normal_z >= 0.F ? max_z : min_z;
+                           return plane.normal_x * x + plane.normal_y * y + plane.normal_z * z + plane.distance >= 0.F;
+                       });
+}
+
+Data::Size FrustumCuller::CullSpheres(const BoundingSpheres& spheres, Data::Index begin_index, Data::Index end_index,
+                                      Data::Index* visible_indices_ptr) const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Size visible_count = 0U;
+    VisibilityFlags visibility_flags{};
+    for(Data::Index block_begin = begin_index; block_begin < end_index; block_begin += g_cull_block_size)
+    {
+        const Data::Size block_size = std::min(g_cull_block_size, end_index - block_begin);
+        std::fill_n(visibility_flags.begin(), block_size, uint8_t(1U));
+        CullSpheresBlock(m_planes, spheres, block_begin, block_size, visibility_flags);
+        visible_count += CompactVisibleIndices(visibility_flags, block_begin, block_size, visible_indices_ptr + visible_count);
+    }
+    return visible_count;
+}
+
+Data::Size FrustumCuller::CullBoxes(const BoundingBoxes& boxes, Data::Index begin_index, Data::Index end_index,
+                                    Data::Index* visible_indices_ptr) const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Size visible_count = 0U;
+    VisibilityFlags visibility_flags{};
+    for(Data::Index block_begin = begin_index; block_begin < end_index; block_begin += g_cull_block_size)
+    {
+        const Data::Size block_size = std::min(g_cull_block_size, end_index - block_begin);
+        std::fill_n(visibility_flags.begin(), block_size, uint8_t(1U));
+
+        for(const Plane& plane : m_planes)
+        {
+            // Select box corner coordinates which are the farthest along the plane normal once per plane
+            const float* x = plane.normal_x >= 0.F ? boxes.max_x.data() : boxes.min_x.data();
+            const float* y = plane.normal_y >= 0.F ? boxes.max_y.data() : boxes.min_y.data();
+            const float* z = plane.normal_z >= 0.F ? boxes.max_z.data() : boxes.min_z.data();
+            for(Data::Size i = 0U; i < block_size; ++i)
+            {
+                const Data::Index index = block_begin + i;
+                const float distance = plane.normal_x * x[index] + plane.normal_y * y[index]
+                                     + plane.normal_z * z[index] + plane.distance;
+                visibility_flags[i] &= static_cast<uint8_t>(distance >= 0.F);
+            }
+        }
+
+        visible_count += CompactVisibleIndices(visibility_flags, block_begin, block_size, visible_indices_ptr + visible_count);
+    }
+    return visible_count;
+}
+
+Data::Size FrustumCuller::CullClusters(const BoundingSpheres& spheres, const BoundingCones& cones, const hlslpp::float3& view_position,
+                                       Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr) const noexcept
+{
+    META_FUNCTION_TASK();
+    const float view_x = view_position.x;
+    const float view_y = view_position.y;
+    const float view_z = view_position.z;
+    const float* apex_x = cones.apex_x.data();
+    const float* apex_y = cones.apex_y.data();
+    const float* apex_z = cones.apex_z.data();
+    const float* axis_x = cones.axis_x.data();
+    const float* axis_y = cones.axis_y.data();
+    const float* axis_z = cones.axis_z.data();
+    const float* cutoff = cones.cutoff.data();
+
+    Data::Size visible_count = 0U;
+    VisibilityFlags visibility_flags{};
+    for(Data::Index block_begin = begin_index; block_begin < end_index; block_begin += g_cull_block_size)
+    {
+        const Data::Size block_size = std::min(g_cull_block_size, end_index - block_begin);
+        std::fill_n(visibility_flags.begin(), block_size, uint8_t(1U));
+        CullSpheresBlock(m_planes, spheres, block_begin, block_size, visibility_flags);
+
+        for(Data::Size i = 0U; i < block_size; ++i)
+        {
+            // Cone test is done without normalization of the view direction: dot(dir, axis) < cutoff * length(dir)
+            const Data::Index index = block_begin + i;
+            const float dir_x = apex_x[index] - view_x;
+            const float dir_y = apex_y[index] - view_y;
+            const float dir_z = apex_z[index] - view_z;
+            const float dir_length = std::sqrt(dir_x * dir_x + dir_y * dir_y + dir_z * dir_z);
+            const float axis_dot = dir_x * axis_x[index] + dir_y * axis_y[index] + dir_z * axis_z[index];
+            visibility_flags[i] &= static_cast<uint8_t>((axis_dot < cutoff[index] * dir_length) | (cutoff[index] >= 1.F));
+        }
+
+        visible_count += CompactVisibleIndices(visibility_flags, block_begin, block_size, visible_indices_ptr + visible_count);
+    }
+    return visible_count;
+}
+
+void FrustumCuller::CullSpheres(const BoundingSpheres& spheres, VisibleIndices& visible_indices,
+                                tf::Executor* parallel_executor_ptr, Data::Size chunk_size) const
+{
+    META_FUNCTION_TASK();
+    CullParallel(spheres.GetCount(), visible_indices, parallel_executor_ptr, chunk_size,
+        [this, &spheres](Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr)
+        { return CullSpheres(spheres, begin_index, end_index, visible_indices_ptr); });
+}
+
+void FrustumCuller::CullBoxes(const BoundingBoxes& boxes, VisibleIndices& visible_indices,
+                              tf::Executor* parallel_executor_ptr, Data::Size chunk_size) const
+{
+    META_FUNCTION_TASK();
+    CullParallel(boxes.GetCount(), visible_indices, parallel_executor_ptr, chunk_size,
+        [this, &boxes](Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr)
+        { return CullBoxes(boxes, begin_index, end_index, visible_indices_ptr); });
+}
+
+void FrustumCuller::CullClusters(const BoundingSpheres& spheres, const BoundingCones& cones, const hlslpp::float3& view_position,
+                                 VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr, Data::Size chunk_size) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(cones.GetCount(), spheres.GetCount(), "count of cluster bounding cones and spheres should be equal");
+    CullParallel(spheres.GetCount(), visible_indices, parallel_executor_ptr, chunk_size,
+        [this, &spheres, &cones, &view_position](Data::Index begin_index, Data::Index end_index, Data::Index* visible_indices_ptr)
+        { return CullClusters(spheres, cones, view_position, begin_index, end_index, visible_indices_ptr); });
+}
+
+template<typename CullRangeFunc>
+void FrustumCuller::CullParallel(Data::Size items_count, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr,
+                                 Data::Size chunk_size, const CullRangeFunc& cull_range) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(chunk_size);
+    visible_indices.resize(items_count);
+    if (!parallel_executor_ptr || items_count <= chunk_size)
+    {
+        visible_indices.resize(cull_range(0U, items_count, visible_indices.data()));
+        return;
+    }
+
+    // Each chunk writes visible indices to its own region of the output vector, which are compacted afterwards
+    const Data::Size chunks_count = Data::DivCeil(items_count, chunk_size);
+    std::pmr::vector<Data::Size> chunk_visible_counts(chunks_count, 0U, m_temp_memory_ptr);
+    Data::ParallelFor(*parallel_executor_ptr, 0U, chunks_count,
+        [&visible_indices, &chunk_visible_counts, &cull_range, items_count, chunk_size](const Data::Index chunk_index)
+        {
+            const Data::Index begin_index = chunk_index * chunk_size;
+            const Data::Index end_index   = std::min(begin_index + chunk_size, items_count);
+            chunk_visible_counts[chunk_index] = cull_range(begin_index, end_index, visible_indices.data() + begin_index);
+        });
+
+    Data::Size visible_count = chunk_visible_counts[0];
+    for(Data::Index chunk_index = 1U; chunk_index < chunks_count; ++chunk_index)
+    {
+        const auto chunk_begin_it = visible_indices.begin() + chunk_index * chunk_size;
+        std::copy(chunk_begin_it, chunk_begin_it + chunk_visible_counts[chunk_index], visible_indices.begin() + visible_count);
+        visible_count += chunk_visible_counts[chunk_index];
+    }
+    visible_indices.resize(visible_count);
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,343 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/InstanceTransforms.cpp
+Batch transformation of instances stored in structure-of-arrays layout
+to model-view-projection matrices of instance uniforms.
+
+******************************************************************************/
+
+#include <Methane/Graphics/InstanceTransforms.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Data/ParallelFor.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+
+#if defined(__x86_64__) || defined(_M_X64)
+// AVX kernel is compiled for its own target and selected in runtime when it is not enabled for the whole build,
+// so that binaries still run on CPUs without AVX support with SSE2 kernel, which also processes remaining instances
+#define METHANE_INSTANCE_TRANSFORMS_AVX
+#define METHANE_INSTANCE_TRANSFORMS_SSE2
+#include <immintrin.h>
+#if defined(__AVX__)
+#define METHANE_AVX_TARGET
+#elif defined(_MSC_VER)
+#define METHANE_AVX_TARGET
+#include <intrin.h>
+#else
+#define METHANE_AVX_TARGET __attribute__((target("avx")))
+#endif
+#elif defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define METHANE_INSTANCE_TRANSFORMS_SSE2
+#include <xmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define METHANE_INSTANCE_TRANSFORMS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Methane::Graphics
+{
+
+// Transformations are computed for several instances at once with every SIMD lane processing its own instance,
+// lanes are loaded directly from SoA arrays and transposed to matrix rows of every instance when stored.
+// Lanes traits have the same interface for scalar and vector types, so that the same kernel is used for all of them.
+struct ScalarLanes
+{
+    using Vector = float;
+    static constexpr Data::Size g_width = 1U;
+
+    static Vector Load(const float* ptr) noexcept            { return *ptr; }
+    static Vector Broadcast(float value) noexcept            { return value; }
+    static Vector Add(Vector left, Vector right) noexcept    { return left + right; }
+    static Vector Sub(Vector left, Vector right) noexcept    { return left - right; }
+    static Vector Mul(Vector left, Vector right) noexcept    { return left * right; }
+
+    static void StoreRows(Vector v0, Vector v1, Vector v2, Vector v3, Data::RawPtr dst_ptr, Data::Size) noexcept
+    {
+        auto* dst_row_ptr = reinterpret_cast<float*>(dst_ptr); // NOSONAR
+        dst_row_ptr[0] = v0;
+        dst_row_ptr[1] = v1;
+        dst_row_ptr[2] = v2;
+        dst_row_ptr[3] = v3;
+    }
+};
+
+#if defined(METHANE_INSTANCE_TRANSFORMS_AVX)
+
+[[nodiscard]]
+static bool IsAvxSupported() noexcept
+{
+#if defined(__AVX__)
+    return true;
+#elif defined(_MSC_VER)
+    // AVX instructions and saving of YMM registers by operating system are both required
+    std::array<int, 4> cpu_info{};
+    __cpuid(cpu_info.data(), 1);
+    const bool is_avx_supported = (cpu_info[2] & (1 << 28)) != 0;
+    const bool is_xsave_enabled = (cpu_info[2] & (1 << 27)) != 0;
+    return is_avx_supported && is_xsave_enabled && (_xgetbv(0) & 0x6U) == 0x6U;
+#else
+    return __builtin_cpu_supports("avx");
+#endif
+}
+
+struct AvxLanes
+{
+    using Vector = __m256;
+    static constexpr Data::Size g_width = 8U;
+
+    METHANE_AVX_TARGET static Vector Load(const float* ptr) noexcept            { return _mm256_loadu_ps(ptr); }
+    METHANE_AVX_TARGET static Vector Broadcast(float value) noexcept            { return _mm256_set1_ps(value); }
+    METHANE_AVX_TARGET static Vector Add(Vector left, Vector right) noexcept    { return _mm256_add_ps(left, right); }
+    METHANE_AVX_TARGET static Vector Sub(Vector left, Vector right) noexcept    { return _mm256_sub_ps(left, right); }
+    METHANE_AVX_TARGET static Vector Mul(Vector left, Vector right) noexcept    { return _mm256_mul_ps(left, right); }
+
+    METHANE_AVX_TARGET
+    static void StoreRows(Vector v0, Vector v1, Vector v2, Vector v3, Data::RawPtr dst_ptr, Data::Size dst_stride) noexcept
+    {
+        // 4x4 transpose is done in each 128-bit half, so that lower halves contain rows of instances 0-3 and higher halves of instances 4-7
+        const __m256 t0 = _mm256_unpacklo_ps(v0, v1);
+        const __m256 t1 = _mm256_unpackhi_ps(v0, v1);
+        const __m256 t2 = _mm256_unpacklo_ps(v2, v3);
+        const __m256 t3 = _mm256_unpackhi_ps(v2, v3);
+        const __m256 rows[4]{ // NOSONAR - std::array ignores attributes of vector types
+            _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)),
+            _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2)),
+            _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)),
+            _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)),
+        };
+        for(size_t lane = 0U; lane < std::size(rows); ++lane)
+        {
+            _mm_storeu_ps(reinterpret_cast<float*>(dst_ptr + lane * dst_stride), _mm256_castps256_ps128(rows[lane])); // NOSONAR
+            _mm_storeu_ps(reinterpret_cast<float*>(dst_ptr + (lane + 4U) * dst_stride), _mm256_extractf128_ps(rows[lane], 1)); // NOSONAR
+        }
+    }
+};
+
+#endif // defined(METHANE_INSTANCE_TRANSFORMS_AVX)
+
+#if defined(METHANE_INSTANCE_TRANSFORMS_SSE2)
+
+struct VectorLanes
+{
+    using Vector = __m128;
+    static constexpr Data::Size g_width = 4U;
+
+    static Vector Load(const float* ptr) noexcept            { return _mm_loadu_ps(ptr); }
+    static Vector Broadcast(float value) noexcept            { return _mm_set1_ps(value); }
+    static Vector Add(Vector left, Vector right) noexcept    { return _mm_add_ps(left, right); }
+    static Vector Sub(Vector left, Vector right) noexcept    { return _mm_sub_ps(left, right); }
+    static Vector Mul(Vector left, Vector right) noexcept    { return _mm_mul_ps(left, right); }
+
+    static void StoreRows(Vector v0, Vector v1, Vector v2, Vector v3, Data::RawPtr dst_ptr, Data::Size dst_stride) noexcept
+    {
+        _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+        _mm_storeu_ps(reinterpret_cast<float*>(dst_ptr), v0); // NOSONAR
+        _mm_storeu_ps(reinterpret_cast<float*>(dst_ptr + dst_stride), v1); // NOSONAR
+        _mm_storeu_ps(reinterpret_cast<float*>(dst_ptr + 2U * dst_stride), v2); // NOSONAR
+        _mm_storeu_ps(reinterpret_cast<float*>(dst_ptr + 3U * dst_stride), v3); // NOSONAR
+    }
+};
+
+#elif defined(METHANE_INSTANCE_TRANSFORMS_NEON)
+
+struct VectorLanes
+{
+    using Vector = float32x4_t;
+    static constexpr Data::Size g_width = 4U;
+
+    static Vector Load(const float* ptr) noexcept            { return vld1q_f32(ptr); }
+    static Vector Broadcast(float value) noexcept            { return vdupq_n_f32(value); }
+    static Vector Add(Vector left, Vector right) noexcept    { return vaddq_f32(left, right); }
+    static Vector Sub(Vector left, Vector right) noexcept    { return vsubq_f32(left, right); }
+    static Vector Mul(Vector left, Vector right) noexcept    { return vmulq_f32(left, right); }
+
+    static void StoreRows(Vector v0, Vector v1, Vector v2, Vector v3, Data::RawPtr dst_ptr, Data::Size dst_stride) noexcept
+    {
+        const float32x4x2_t t01 = vtrnq_f32(v0, v1);
+        const float32x4x2_t t23 = vtrnq_f32(v2, v3);
+        vst1q_f32(reinterpret_cast<float*>(dst_ptr), vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]))); // NOSONAR
+        vst1q_f32(reinterpret_cast<float*>(dst_ptr + dst_stride), vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]))); // NOSONAR
+        vst1q_f32(reinterpret_cast<float*>(dst_ptr + 2U * dst_stride), vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]))); // NOSONAR
+        vst1q_f32(reinterpret_cast<float*>(dst_ptr + 3U * dst_stride), vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]))); // NOSONAR
+    }
+};
+
+#endif
+
+// Generic kernel is defined for default target with SSE2, NEON or scalar lanes and for AVX target with its own lanes
+namespace DefaultTarget
+{
+#define METHANE_INSTANCE_KERNEL_TARGET
+#include "InstanceTransformsKernel.hpp"
+#undef METHANE_INSTANCE_KERNEL_TARGET
+} // namespace DefaultTarget
+
+#if defined(METHANE_INSTANCE_TRANSFORMS_AVX)
+
+namespace AvxTarget
+{
+#define METHANE_INSTANCE_KERNEL_TARGET METHANE_AVX_TARGET
+#include "InstanceTransformsKernel.hpp"
+#undef METHANE_INSTANCE_KERNEL_TARGET
+} // namespace AvxTarget
+
+#endif // defined(METHANE_INSTANCE_TRANSFORMS_AVX)
+
+hlslpp::float4 GetAxisRotation(const hlslpp::float3& axis, float angle_rad) noexcept
+{
+    META_FUNCTION_TASK();
+    const float half_angle_sin = std::sin(angle_rad / 2.F);
+    const hlslpp::float3 rotation_axis = hlslpp::normalize(axis) * half_angle_sin;
+    return hlslpp::float4(rotation_axis.x, rotation_axis.y, rotation_axis.z, std::cos(angle_rad / 2.F));
+}
+
+hlslpp::float4 CombineRotations(const hlslpp::float4& first, const hlslpp::float4& second) noexcept
+{
+    META_FUNCTION_TASK();
+    // Quaternion product 'second * first' rotates by the first quaternion and then by the second one
+    const float ax = second.x;
+    const float ay = second.y;
+    const float az = second.z;
+    const float aw = second.w;
+    const float bx = first.x;
+    const float by = first.y;
+    const float bz = first.z;
+    const float bw = first.w;
+    return hlslpp::float4(aw * bx + ax * bw + ay * bz - az * by,
+                          aw * by - ax * bz + ay * bw + az * bx,
+                          aw * bz + ax * by - ay * bx + az * bw,
+                          aw * bw - ax * bx - ay * by - az * bz);
+}
+
+void InstanceTransforms::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    translation_x.resize(count, 0.F);
+    translation_y.resize(count, 0.F);
+    translation_z.resize(count, 0.F);
+    rotation_x.resize(count, 0.F);
+    rotation_y.resize(count, 0.F);
+    rotation_z.resize(count, 0.F);
+    rotation_w.resize(count, 1.F);
+    scale_x.resize(count, 1.F);
+    scale_y.resize(count, 1.F);
+    scale_z.resize(count, 1.F);
+}
+
+void InstanceTransforms::Set(Data::Index index, const hlslpp::float3& translation, const hlslpp::float4& rotation, const hlslpp::float3& scale)
+{
+    META_CHECK_ARG_LESS(index, GetCount());
+    translation_x[index] = translation.x;
+    translation_y[index] = translation.y;
+    translation_z[index] = translation.z;
+    rotation_x[index]    = rotation.x;
+    rotation_y[index]    = rotation.y;
+    rotation_z[index]    = rotation.z;
+    rotation_w[index]    = rotation.w;
+    scale_x[index]       = scale.x;
+    scale_y[index]       = scale.y;
+    scale_z[index]       = scale.z;
+}
+
+void InstanceTransforms::Rotate(Data::Index index, const hlslpp::float4& local_rotation)
+{
+    META_CHECK_ARG_LESS(index, GetCount());
+    // Rotation is normalized to prevent accumulation of errors in quaternion length with repeated rotations
+    const hlslpp::float4 rotation = hlslpp::normalize(CombineRotations(local_rotation,
+        hlslpp::float4(rotation_x[index], rotation_y[index], rotation_z[index], rotation_w[index])));
+    rotation_x[index] = rotation.x;
+    rotation_y[index] = rotation.y;
+    rotation_z[index] = rotation.z;
+    rotation_w[index] = rotation.w;
+}
+
+hlslpp::float4x4 InstanceTransforms::GetModelMatrix(Data::Index index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(index, GetCount());
+    const DefaultTarget::ModelMatrixRows<ScalarLanes> model = DefaultTarget::GetModelMatrixRows<ScalarLanes>(*this, index);
+    return hlslpp::float4x4(model.rows[0][0], model.rows[0][1], model.rows[0][2], 0.F,
+                            model.rows[1][0], model.rows[1][1], model.rows[1][2], 0.F,
+                            model.rows[2][0], model.rows[2][1], model.rows[2][2], 0.F,
+                            model.rows[3][0], model.rows[3][1], model.rows[3][2], 1.F);
+}
+
+void InstanceTransforms::WriteMvpMatrices(const hlslpp::float4x4& view_proj_matrix, Data::Index begin_index, Data::Index end_index,
+                                          Data::RawPtr matrices_ptr, Data::Size matrix_stride) const noexcept
+{
+    META_FUNCTION_TASK();
+    // Rows of view-projection matrix are extracted with multiplication of basis row-vectors
+    const std::array<hlslpp::float4, 4> basis_vectors{
+        hlslpp::float4(1.F, 0.F, 0.F, 0.F),
+        hlslpp::float4(0.F, 1.F, 0.F, 0.F),
+        hlslpp::float4(0.F, 0.F, 1.F, 0.F),
+        hlslpp::float4(0.F, 0.F, 0.F, 1.F),
+    };
+    std::array<float, 16> view_proj_elements{};
+    for(size_t row = 0U; row < basis_vectors.size(); ++row)
+    {
+        const hlslpp::float4 view_proj_row = hlslpp::mul(basis_vectors[row], view_proj_matrix);
+        view_proj_elements[row * 4U]      = view_proj_row.x;
+        view_proj_elements[row * 4U + 1U] = view_proj_row.y;
+        view_proj_elements[row * 4U + 2U] = view_proj_row.z;
+        view_proj_elements[row * 4U + 3U] = view_proj_row.w;
+    }
+
+    Data::Index index = begin_index;
+#if defined(METHANE_INSTANCE_TRANSFORMS_AVX)
+    static const bool s_is_avx_supported = IsAvxSupported();
+    if (s_is_avx_supported)
+        index = AvxTarget::WriteMvpMatricesOfLanes<AvxLanes>(*this, view_proj_elements, index, end_index, matrices_ptr, matrix_stride);
+#endif
+#if defined(METHANE_INSTANCE_TRANSFORMS_SSE2) || defined(METHANE_INSTANCE_TRANSFORMS_NEON)
+    index = DefaultTarget::WriteMvpMatricesOfLanes<VectorLanes>(*this, view_proj_elements, index, end_index, matrices_ptr, matrix_stride);
+#endif
+    DefaultTarget::WriteMvpMatricesOfLanes<ScalarLanes>(*this, view_proj_elements, index, end_index, matrices_ptr, matrix_stride);
+}
+
+void InstanceTransforms::WriteMvpMatrices(const hlslpp::float4x4& view_proj_matrix, Data::RawPtr matrices_ptr, Data::Size matrix_stride,
+                                          tf::Executor* parallel_executor_ptr, Data::Size chunk_size) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(chunk_size);
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(matrix_stride, static_cast<Data::Size>(sizeof(float) * 16U),
+                                          "instance matrices can not overlap in output memory");
+    const Data::Size instances_count = GetCount();
+    if (!parallel_executor_ptr || instances_count <= chunk_size)
+    {
+        WriteMvpMatrices(view_proj_matrix, 0U, instances_count, matrices_ptr, matrix_stride);
+        return;
+    }
+
+    Data::ParallelFor(*parallel_executor_ptr, 0U, Data::DivCeil(instances_count, chunk_size),
+        [this, &view_proj_matrix, matrices_ptr, matrix_stride, instances_count, chunk_size](const Data::Index chunk_index)
+        {
+            const Data::Index begin_index = chunk_index * chunk_size;
+            const Data::Index end_index   = std::min(begin_index + chunk_size, instances_count);
+            WriteMvpMatrices(view_proj_matrix, begin_index, end_index, matrices_ptr, matrix_stride);
+        });
+}
+
+} // namespace Methane::Graphics
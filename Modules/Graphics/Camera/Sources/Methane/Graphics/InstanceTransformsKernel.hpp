@@ -0,0 +1,107 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/InstanceTransformsKernel.hpp
+Kernel of instance MVP matrices batch transformation generic to SIMD lanes traits.
+Header is included in a separate namespace for each instruction set target
+defined with METHANE_INSTANCE_KERNEL_TARGET function attribute, so it has no include guard.
+
+******************************************************************************/
+
+// NOSONAR - include guard is omitted intentionally
+
+// Rows of model matrix with first 3 columns, while the last column is always (0, 0, 0, 1)
+template<typename Lanes>
+struct ModelMatrixRows
+{
+    typename Lanes::Vector rows[4][3]; // NOSONAR - std::array ignores attributes of vector types
+};
+
+template<typename Lanes>
+METHANE_INSTANCE_KERNEL_TARGET
+static ModelMatrixRows<Lanes> GetModelMatrixRows(const InstanceTransforms& transforms, Data::Index index) noexcept
+{
+    using L = Lanes;
+    const typename L::Vector qx = L::Load(transforms.rotation_x.data() + index);
+    const typename L::Vector qy = L::Load(transforms.rotation_y.data() + index);
+    const typename L::Vector qz = L::Load(transforms.rotation_z.data() + index);
+    const typename L::Vector qw = L::Load(transforms.rotation_w.data() + index);
+    const typename L::Vector sx = L::Load(transforms.scale_x.data() + index);
+    const typename L::Vector sy = L::Load(transforms.scale_y.data() + index);
+    const typename L::Vector sz = L::Load(transforms.scale_z.data() + index);
+    const typename L::Vector one = L::Broadcast(1.F);
+
+    const typename L::Vector x2 = L::Add(qx, qx);
+    const typename L::Vector y2 = L::Add(qy, qy);
+    const typename L::Vector z2 = L::Add(qz, qz);
+    const typename L::Vector xx = L::Mul(qx, x2);
+    const typename L::Vector yy = L::Mul(qy, y2);
+    const typename L::Vector zz = L::Mul(qz, z2);
+    const typename L::Vector xy = L::Mul(qx, y2);
+    const typename L::Vector xz = L::Mul(qx, z2);
+    const typename L::Vector yz = L::Mul(qy, z2);
+    const typename L::Vector wx = L::Mul(qw, x2);
+    const typename L::Vector wy = L::Mul(qw, y2);
+    const typename L::Vector wz = L::Mul(qw, z2);
+
+    // Rows of rotation matrix are scaled, which is equivalent to multiplication of scale and rotation matrices
+    return ModelMatrixRows<Lanes>{ {
+        { L::Mul(sx, L::Sub(one, L::Add(yy, zz))), L::Mul(sx, L::Add(xy, wz)),             L::Mul(sx, L::Sub(xz, wy)) },
+        { L::Mul(sy, L::Sub(xy, wz)),             L::Mul(sy, L::Sub(one, L::Add(xx, zz))), L::Mul(sy, L::Add(yz, wx)) },
+        { L::Mul(sz, L::Add(xz, wy)),             L::Mul(sz, L::Sub(yz, wx)),             L::Mul(sz, L::Sub(one, L::Add(xx, yy))) },
+        { L::Load(transforms.translation_x.data() + index), L::Load(transforms.translation_y.data() + index), L::Load(transforms.translation_z.data() + index) },
+    } };
+}
+
+// Writes matrices of instances starting from begin index while all lanes are filled and returns index of the first unprocessed instance
+template<typename Lanes>
+METHANE_INSTANCE_KERNEL_TARGET
+static Data::Index WriteMvpMatricesOfLanes(const InstanceTransforms& transforms, const std::array<float, 16>& view_proj_elements,
+                                           Data::Index begin_index, Data::Index end_index,
+                                           Data::RawPtr matrices_ptr, Data::Size matrix_stride) noexcept
+{
+    using L = Lanes;
+    typename L::Vector view_proj[16]; // NOSONAR - std::array ignores attributes of vector types
+    for(size_t element_index = 0U; element_index < view_proj_elements.size(); ++element_index)
+    {
+        view_proj[element_index] = L::Broadcast(view_proj_elements[element_index]);
+    }
+
+    Data::Index index = begin_index;
+    for(; index + L::g_width <= end_index; index += L::g_width)
+    {
+        const ModelMatrixRows<Lanes> model = GetModelMatrixRows<Lanes>(transforms, index);
+        Data::RawPtr matrix_ptr = matrices_ptr + static_cast<size_t>(index) * matrix_stride;
+
+        // Column of MVP matrix is stored as a row of transposed matrix
+        for(size_t column = 0U; column < 4U; ++column)
+        {
+            typename L::Vector mvp_column[4]; // NOSONAR - std::array ignores attributes of vector types
+            for(size_t row = 0U; row < 4U; ++row)
+            {
+                mvp_column[row] = L::Add(L::Add(L::Mul(model.rows[row][0], view_proj[column]),
+                                                L::Mul(model.rows[row][1], view_proj[4U + column])),
+                                         L::Mul(model.rows[row][2], view_proj[8U + column]));
+            }
+            mvp_column[3] = L::Add(mvp_column[3], view_proj[12U + column]);
+            L::StoreRows(mvp_column[0], mvp_column[1], mvp_column[2], mvp_column[3],
+                         matrix_ptr + column * 4U * sizeof(float), matrix_stride);
+        }
+    }
+    return index;
+}
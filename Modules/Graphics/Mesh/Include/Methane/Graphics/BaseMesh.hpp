@@ -24,18 +24,28 @@ Base mesh implementation with customizable vertex types
 #pragma once
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <limits>
+#include <type_traits>
+
 namespace Methane::Graphics
 {
 
-template<typename VType>
+template<typename VType, typename IType = Mesh::Index>
 class BaseMesh
     : public Mesh
 {
+    static_assert(std::is_same_v<IType, uint16_t> || std::is_same_v<IType, uint32_t>, "mesh index type must be 16 or 32-bit unsigned integer");
+
 public:
     using Vertices = std::vector<VType>;
+    using Index    = IType;
+    using Indices  = std::vector<IType>;
+
+    static constexpr uint64_t g_max_vertex_count = static_cast<uint64_t>(std::numeric_limits<IType>::max()) + 1U;
 
     BaseMesh(Type type, const VertexLayout& vertex_layout)
         : Mesh(type, vertex_layout)
@@ -48,6 +58,12 @@ public:
     [[nodiscard]] Data::Size        GetVertexCount() const noexcept final    { return static_cast<Data::Size>(m_vertices.size()); }
     [[nodiscard]] Data::Size        GetVertexDataSize() const noexcept final { return static_cast<Data::Size>(m_vertices.size() * GetVertexSize()); }
     [[nodiscard]] Data::ConstRawPtr GetVertexData() const noexcept final     { return reinterpret_cast<Data::ConstRawPtr>(m_vertices.data()); } // NOSONAR
+    [[nodiscard]] const Indices&    GetIndices() const noexcept              { return m_indices; }
+    [[nodiscard]] Index             GetIndex(Data::Index i) const noexcept   { return i < m_indices.size() ? m_indices[i] : 0; }
+    [[nodiscard]] Data::Size        GetIndexCount() const noexcept final     { return static_cast<Data::Size>(m_indices.size()); }
+    [[nodiscard]] Data::Size        GetIndexDataSize() const noexcept final  { return static_cast<Data::Size>(m_indices.size() * sizeof(Index)); }
+    [[nodiscard]] Data::ConstRawPtr GetIndexData() const noexcept final      { return reinterpret_cast<Data::ConstRawPtr>(m_indices.data()); } // NOSONAR
+    [[nodiscard]] PixelFormat       GetIndexFormat() const noexcept final    { return Graphics::GetIndexFormat(Index{}); }
 
 protected:
     template<typename FType>
@@ -66,17 +82,10 @@ protected:
         return *reinterpret_cast<const FType*>(reinterpret_cast<const std::byte*>(&vertex) + field_offset); // NOSONAR
     }
 
-    using EdgeMidpoints = std::map<Mesh::Edge, Mesh::Index>;
-    Index AddEdgeMidpoint(const Edge& edge, EdgeMidpoints& edge_midpoints)
+    [[nodiscard]] VType GetEdgeMidpointVertex(const VType& v1, const VType& v2)
     {
         META_FUNCTION_TASK();
-        if (const auto edge_midpoint_it = edge_midpoints.find(edge);
-            edge_midpoint_it != edge_midpoints.end())
-            return edge_midpoint_it->second;
-
-        const VType& v1 = m_vertices[edge.first_index];
-        const VType& v2 = m_vertices[edge.second_index];
-        VType  v_mid{ };
+        VType v_mid{ };
 
         const HlslPosition v1_position = GetVertexField<Mesh::Position>(v1, Mesh::VertexField::Position).AsHlsl();
         const HlslPosition v2_position = GetVertexField<Mesh::Position>(v2, Mesh::VertexField::Position).AsHlsl();
@@ -107,10 +116,7 @@ protected:
             v_mid_texcoord = Mesh::TexCoord((v1_texcoord + v2_texcoord) / 2.F);
         }
 
-        const auto v_mid_index = static_cast<Mesh::Index>(m_vertices.size());
-        edge_midpoints.try_emplace(edge, v_mid_index);
-        m_vertices.push_back(v_mid);
-        return v_mid_index;
+        return v_mid;
     }
 
     void ComputeAverageNormals()
@@ -177,8 +183,22 @@ protected:
     void   AddVertex(VType&& vertex) noexcept            { m_vertices.emplace_back(std::move(vertex)); }
     void   AppendVertices(const Vertices& vertices)      { m_vertices.insert(m_vertices.end(), vertices.begin(), vertices.end()); }
 
+    void CheckVertexCountFitsIndex(uint64_t vertex_count) const
+    {
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(vertex_count, g_max_vertex_count,
+                                           "mesh vertices count exceeds range of {}-bit index type", sizeof(Index) * 8);
+    }
+
+    void ResizeIndices(size_t indices_count)                   { m_indices.resize(indices_count, 0); }
+    void SetIndex(Data::Index index, Data::Index vertex_index) { m_indices[index] = static_cast<Index>(vertex_index); }
+    void SetIndices(Indices&& indices) noexcept                { m_indices = std::move(indices); }
+    void SwapIndices(Indices& indices)                         { m_indices.swap(indices); }
+    void AppendIndices(const Indices& indices)                 { m_indices.insert(m_indices.end(), indices.begin(), indices.end()); }
+    auto GetIndicesBackInserter()                              { return std::back_inserter(m_indices); }
+
 private:
     Vertices m_vertices;
+    Indices  m_indices;
 };
 
 } // namespace Methane::Graphics
@@ -28,12 +28,12 @@ Cube mesh generator with customizable vertex type
 namespace Methane::Graphics
 {
 
-template<typename VType>
-class CubeMesh : public QuadMesh<VType>
+template<typename VType, typename IType = Mesh::Index>
+class CubeMesh : public QuadMesh<VType, IType>
 {
     using Positions = std::vector<Mesh::Position>;
-    using BaseMeshT = BaseMesh<VType>;
-    using QuadMeshT = QuadMesh<VType>;
+    using BaseMeshT = BaseMesh<VType, IType>;
+    using QuadMeshT = QuadMesh<VType, IType>;
 
 public:
     explicit CubeMesh(const Mesh::VertexLayout& vertex_layout, float width = 1.F, float height = 1.F, float depth = 1.F)
@@ -58,11 +58,11 @@ protected:
 
         BaseMeshT::AppendVertices(face_mesh.GetVertices());
 
-        const Mesh::Indices& face_indices = face_mesh.GetIndices();
-        std::transform(face_indices.begin(), face_indices.end(), Mesh::GetIndicesBackInserter(),
-            [initial_vertices_count](const Mesh::Index& index)
+        const typename BaseMeshT::Indices& face_indices = face_mesh.GetIndices();
+        std::transform(face_indices.begin(), face_indices.end(), BaseMeshT::GetIndicesBackInserter(),
+            [initial_vertices_count](const IType& index)
             {
-                return static_cast<Mesh::Index>(initial_vertices_count + index);
+                return static_cast<IType>(initial_vertices_count + index);
             }
        );
     }
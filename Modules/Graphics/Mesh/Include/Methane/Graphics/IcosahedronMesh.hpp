@@ -25,16 +25,22 @@ Icosahedron mesh generator with customizable vertex type
 
 #include "BaseMesh.hpp"
 
+#include <taskflow/taskflow.hpp>
+
 namespace Methane::Graphics
 {
 
-template<typename VType>
-class IcosahedronMesh : public BaseMesh<VType>
+template<typename VType, typename IType = Mesh::Index>
+class IcosahedronMesh : public BaseMesh<VType, IType>
 {
 public:
-    using BaseMeshT = BaseMesh<VType>;
+    using BaseMeshT = BaseMesh<VType, IType>;
+
+    static constexpr Data::Size g_parallel_chunk_size = 4096U;
 
-    explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false)
+    // Subdivision and spherification of large meshes is done in parallel with the given executor
+    explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false,
+                             tf::Executor* parallel_executor_ptr = nullptr)
         : BaseMeshT(Mesh::Type::Icosahedron, vertex_layout)
         , m_radius(radius)
     {
@@ -90,7 +96,7 @@ public:
             }
         }
 
-        Mesh::SetIndices({
+        BaseMeshT::SetIndices({
                              5, 0, 11,
                              1, 0, 5,
                              7, 0, 1,
@@ -115,73 +121,137 @@ public:
 
         for(uint32_t subdivision = 0; subdivision < subdivisions_count; ++subdivision)
         {
-            Subdivide();
+            Subdivide(parallel_executor_ptr);
         }
 
         if (spherify)
         {
-            Spherify();
+            Spherify(parallel_executor_ptr);
         }
     }
 
     float GetRadius() const noexcept  { return m_radius; }
 
-    void Subdivide()
+    void Subdivide(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
-        META_CHECK_ARG_DESCR(Mesh::GetIndexCount(), Mesh::GetIndexCount() % 3 == 0,
+        META_CHECK_ARG_DESCR(BaseMeshT::GetIndexCount(), BaseMeshT::GetIndexCount() % 3 == 0,
                              "icosahedron indices count should be a multiple of three representing triangles list");
 
-        Mesh::Indices new_indices;
-        new_indices.reserve(Mesh::GetIndexCount() * 4);
-        BaseMeshT::ReserveVertices(BaseMeshT::GetVertexCount() * 2);
+        const Data::Size triangles_count = BaseMeshT::GetIndexCount() / 3;
+        const Data::Size vertices_count  = BaseMeshT::GetVertexCount();
 
-        typename BaseMeshT::EdgeMidpoints edge_midpoints;
+        // Unique midpoint vertex indices are assigned to triangle edges sequentially,
+        // each edge of the closed mesh is shared by two triangles
+        Mesh::EdgeMidpoints      edge_midpoints(triangles_count * 3 / 2);
+        std::vector<Mesh::Edge>  midpoint_edges;
+        std::vector<Data::Index> triangle_midpoints(triangles_count * 3);
+        midpoint_edges.reserve(triangles_count * 3 / 2);
 
-        const Data::Size triangles_count = Mesh::GetIndexCount() / 3;
         for (Data::Index triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
         {
-            const Mesh::Index vi1 = Mesh::GetIndex(triangle_index * 3);
-            const Mesh::Index vi2 = Mesh::GetIndex(triangle_index * 3 + 1);
-            const Mesh::Index vi3 = Mesh::GetIndex(triangle_index * 3 + 2);
-
-            const Mesh::Index vm1 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi1, vi2), edge_midpoints);
-            const Mesh::Index vm2 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi2, vi3), edge_midpoints);
-            const Mesh::Index vm3 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi3, vi1), edge_midpoints);
-
-            std::array<Mesh::Index, 3 * 4> indices{
-                vi1, vm1, vm3,
-                vm1, vi2, vm2,
-                vm1, vm2, vm3,
-                vm3, vm2, vi3,
-            };
-            new_indices.insert(new_indices.end(), indices.begin(), indices.end());
+            for (Data::Index edge_index = 0; edge_index < 3; ++edge_index)
+            {
+                const Mesh::Edge edge(BaseMeshT::GetIndex(triangle_index * 3 + edge_index),
+                                      BaseMeshT::GetIndex(triangle_index * 3 + (edge_index + 1) % 3));
+                const auto [midpoint_index, is_new_edge] = edge_midpoints.TryEmplace(edge, vertices_count + static_cast<Data::Index>(midpoint_edges.size()));
+                if (is_new_edge)
+                    midpoint_edges.push_back(edge);
+
+                triangle_midpoints[triangle_index * 3 + edge_index] = midpoint_index;
+            }
         }
 
+        const auto midpoints_count = static_cast<Data::Size>(midpoint_edges.size());
+        BaseMeshT::CheckVertexCountFitsIndex(vertices_count + midpoints_count);
+        BaseMeshT::ResizeVertices(vertices_count + midpoints_count);
+
+        // Midpoint vertices and subdivided triangle indices are generated independently by ranges
+        ForEachRange(midpoints_count, parallel_executor_ptr,
+            [this, vertices_count, &midpoint_edges](Data::Index begin_index, Data::Index end_index)
+            {
+                for (Data::Index midpoint_index = begin_index; midpoint_index < end_index; ++midpoint_index)
+                {
+                    const Mesh::Edge& edge = midpoint_edges[midpoint_index];
+                    BaseMeshT::GetMutableVertex(vertices_count + midpoint_index) =
+                        BaseMeshT::GetEdgeMidpointVertex(BaseMeshT::GetVertices()[edge.first_index],
+                                                         BaseMeshT::GetVertices()[edge.second_index]);
+                }
+            });
+
+        typename BaseMeshT::Indices new_indices(BaseMeshT::GetIndexCount() * 4);
+        ForEachRange(triangles_count, parallel_executor_ptr,
+            [this, &new_indices, &triangle_midpoints](Data::Index begin_index, Data::Index end_index)
+            {
+                for (Data::Index triangle_index = begin_index; triangle_index < end_index; ++triangle_index)
+                {
+                    const IType vi1 = BaseMeshT::GetIndex(triangle_index * 3);
+                    const IType vi2 = BaseMeshT::GetIndex(triangle_index * 3 + 1);
+                    const IType vi3 = BaseMeshT::GetIndex(triangle_index * 3 + 2);
+
+                    const auto vm1 = static_cast<IType>(triangle_midpoints[triangle_index * 3]);
+                    const auto vm2 = static_cast<IType>(triangle_midpoints[triangle_index * 3 + 1]);
+                    const auto vm3 = static_cast<IType>(triangle_midpoints[triangle_index * 3 + 2]);
+
+                    const std::array<IType, 3 * 4> indices{
+                        vi1, vm1, vm3,
+                        vm1, vi2, vm2,
+                        vm1, vm2, vm3,
+                        vm3, vm2, vi3,
+                    };
+                    std::copy(indices.begin(), indices.end(), new_indices.begin() + triangle_index * indices.size());
+                }
+            });
+
         BaseMeshT::SwapIndices(new_indices);
     }
 
-    void Spherify()
+    void Spherify(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
         const bool has_normals = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
 
-        for(size_t vertex_index = 0; vertex_index < BaseMeshT::GetVertexCount(); ++vertex_index)
+        ForEachRange(BaseMeshT::GetVertexCount(), parallel_executor_ptr,
+            [this, has_normals](Data::Index begin_index, Data::Index end_index)
+            {
+                for(Data::Index vertex_index = begin_index; vertex_index < end_index; ++vertex_index)
+                {
+                    VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
+                    Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+                    const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
+                    vertex_position = Mesh::Position(vertex_position_norm * m_radius);
+
+                    if (has_normals)
+                    {
+                        Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+                        vertex_normal = Mesh::Normal(vertex_position_norm);
+                    }
+                }
+            });
+    }
+
+private:
+    template<typename RangeFunc>
+    static void ForEachRange(Data::Size items_count, tf::Executor* parallel_executor_ptr, const RangeFunc& range_func)
+    {
+        META_FUNCTION_TASK();
+        if (!parallel_executor_ptr || items_count <= g_parallel_chunk_size)
         {
-            VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
-            Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
-            const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
-            vertex_position = Mesh::Position(vertex_position_norm * m_radius);
+            range_func(0U, items_count);
+            return;
+        }
 
-            if (has_normals)
+        const Data::Size chunks_count = (items_count + g_parallel_chunk_size - 1U) / g_parallel_chunk_size;
+        tf::Taskflow task_flow;
+        task_flow.for_each_index(0U, chunks_count, 1U,
+            [items_count, &range_func](const Data::Index chunk_index)
             {
-                Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-                vertex_normal = Mesh::Normal(vertex_position_norm);
-            }
-        }
+                const Data::Index begin_index = chunk_index * g_parallel_chunk_size;
+                range_func(begin_index, std::min(begin_index + g_parallel_chunk_size, items_count));
+            });
+        parallel_executor_ptr->run(task_flow).get();
     }
 
-private:
     const float m_radius;
 };
 
@@ -23,13 +23,16 @@ Abstract mesh class
 
 #pragma once
 
+#include <Methane/Graphics/Types.h>
 #include <Methane/Data/Types.h>
 #include <Methane/Data/Vector.hpp>
+#include <Methane/Data/EnumMask.hpp>
 
 #include <vector>
 #include <array>
 #include <string_view>
-#include <map>
+#include <limits>
+#include <utility>
 
 namespace Methane::Graphics
 {
@@ -42,7 +45,7 @@ public:
     using Normal     = Data::RawVector3F;
     using Color      = Data::RawVector3F;
     using TexCoord   = Data::RawVector2F;
-    using Index      = uint16_t;
+    using Index      = uint16_t; // default mesh index type, 32-bit indices are enabled with BaseMesh template parameter
     using Indices    = std::vector<Index>;
 
     enum class Type
@@ -87,6 +90,9 @@ public:
         Count
     };
 
+    // Packed vertex fields: half-float positions, octahedral normals, unorm16 texture coordinates and unorm8 colors
+    using VertexFieldMask = Data::EnumMask<VertexField>;
+
     class VertexLayout : public std::vector<VertexField>
     {
     public:
@@ -102,10 +108,20 @@ public:
         };
 
         using std::vector<VertexField>::vector;
+        VertexLayout(std::initializer_list<VertexField> vertex_fields, VertexFieldMask packed_fields);
 
+        [[nodiscard]] VertexFieldMask               GetPackedFields() const noexcept                         { return m_packed_fields; }
+        [[nodiscard]] bool                          IsFieldPacked(VertexField vertex_field) const noexcept { return m_packed_fields.HasAnyBit(vertex_field); }
+        [[nodiscard]] VertexLayout                  GetPackedLayout(VertexFieldMask packed_fields) const;
+        [[nodiscard]] Data::Size                    GetVertexSize() const noexcept;
         [[nodiscard]] std::vector<std::string_view> GetSemantics() const;
+        [[nodiscard]] PixelFormats                  GetFormats() const;
+
+        [[nodiscard]] static std::string_view GetSemanticByVertexField(VertexField vertex_field, bool is_packed = false);
+        [[nodiscard]] static PixelFormat      GetFormatByVertexField(VertexField vertex_field, bool is_packed);
 
-        [[nodiscard]] static std::string_view GetSemanticByVertexField(VertexField vertex_field);
+    private:
+        VertexFieldMask m_packed_fields;
     };
 
     Mesh(Type type, const VertexLayout& vertex_layout);
@@ -114,15 +130,19 @@ public:
     [[nodiscard]] Type                GetType() const noexcept               { return m_type; }
     [[nodiscard]] const VertexLayout& GetVertexLayout() const noexcept       { return m_vertex_layout; }
     [[nodiscard]] Data::Size          GetVertexSize() const noexcept         { return m_vertex_size; }
-    [[nodiscard]] const Indices&      GetIndices() const noexcept            { return m_indices; }
-    [[nodiscard]] Index               GetIndex(Data::Index i) const noexcept { return i < m_indices.size() ? m_indices[i] : 0; }
-    [[nodiscard]] Data::Size          GetIndexCount() const noexcept         { return static_cast<Data::Size>(m_indices.size()); }
-    [[nodiscard]] Data::Size          GetIndexDataSize() const noexcept      { return static_cast<Data::Size>(m_indices.size() * sizeof(Index)); }
+    [[nodiscard]] const Position&     GetVertexPosition(Data::Index vertex_index) const;
+
+    // Converts mesh vertices with float fields to vertices of the packed layout with the same fields
+    [[nodiscard]] Data::Bytes GetPackedVertexData(const VertexLayout& packed_vertex_layout) const;
 
     // Mesh interface methods
     [[nodiscard]] virtual Data::Size        GetVertexCount() const noexcept = 0;
     [[nodiscard]] virtual Data::Size        GetVertexDataSize() const noexcept = 0;
     [[nodiscard]] virtual Data::ConstRawPtr GetVertexData() const noexcept = 0;
+    [[nodiscard]] virtual Data::Size        GetIndexCount() const noexcept = 0;
+    [[nodiscard]] virtual Data::Size        GetIndexDataSize() const noexcept = 0;
+    [[nodiscard]] virtual Data::ConstRawPtr GetIndexData() const noexcept = 0;
+    [[nodiscard]] virtual PixelFormat       GetIndexFormat() const noexcept = 0;
 
 protected:
     using HlslPosition   = Position::HlslVectorType;
@@ -133,12 +153,37 @@ protected:
 
     struct Edge
     {
-        const Mesh::Index first_index;
-        const Mesh::Index second_index;
+        const Data::Index first_index;
+        const Data::Index second_index;
         
-        Edge(Mesh::Index v1_index, Mesh::Index v2_index);
+        Edge(Data::Index v1_index, Data::Index v2_index);
 
-        [[nodiscard]] bool operator<(const Edge& other) const;
+        [[nodiscard]] bool     operator<(const Edge& other) const;
+        [[nodiscard]] uint64_t GetKey() const noexcept { return (static_cast<uint64_t>(first_index) << 32U) | second_index; }
+    };
+
+    // Flat open-addressing hash map from mesh edge to its midpoint vertex index
+    class EdgeMidpoints
+    {
+    public:
+        explicit EdgeMidpoints(Data::Size expected_edges_count = 0U);
+
+        // Returns midpoint index of the existing edge with false flag, or inserts the new edge midpoint and returns it with true flag
+        std::pair<Data::Index, bool> TryEmplace(const Edge& edge, Data::Index midpoint_index);
+
+        [[nodiscard]] Data::Size GetCount() const noexcept { return m_count; }
+
+    private:
+        struct Slot
+        {
+            uint64_t    edge_key       = std::numeric_limits<uint64_t>::max();
+            Data::Index midpoint_index = 0U;
+        };
+
+        void Rehash(size_t slots_count);
+
+        std::vector<Slot> m_slots;
+        Data::Size        m_count = 0U;
     };
     
     using VertexFieldOffsets = std::array<int32_t, static_cast<size_t>(VertexField::Count)>;
@@ -147,17 +192,10 @@ protected:
     [[nodiscard]] bool HasVertexField(VertexField field) const noexcept;
     [[nodiscard]] int32_t GetVertexFieldOffset(VertexField field) const { return m_vertex_field_offsets[static_cast<size_t>(field)]; }
 
-    void ResizeIndices(size_t indices_count)             { m_indices.resize(indices_count, 0); }
-    void SetIndex(Data::Index index, Index vertex_index) { m_indices[index] = vertex_index; }
-    void SetIndices(Indices&& indices) noexcept          { m_indices = std::move(indices); }
-    void SwapIndices(Indices& indices)                   { m_indices.swap(indices); }
-    void AppendIndices(const Mesh::Indices& indices)     { m_indices.insert(m_indices.end(), indices.begin(), indices.end()); }
-    auto GetIndicesBackInserter()                        { return std::back_inserter(m_indices); }
-
     [[nodiscard]] static VertexFieldOffsets GetVertexFieldOffsets(const VertexLayout& vertex_layout);
     [[nodiscard]] static Data::Size         GetVertexSize(const VertexLayout& vertex_layout) noexcept;
-    [[nodiscard]] static Data::Size         GetVertexFieldSize(VertexField vertex_field)   { return GetVertexFieldSize(static_cast<size_t>(vertex_field)); }
-    [[nodiscard]] static Data::Size         GetVertexFieldSize(size_t vertex_field_index);
+    [[nodiscard]] static Data::Size         GetVertexFieldSize(VertexField vertex_field, bool is_packed = false) { return GetVertexFieldSize(static_cast<size_t>(vertex_field), is_packed); }
+    [[nodiscard]] static Data::Size         GetVertexFieldSize(size_t vertex_field_index, bool is_packed = false);
     [[nodiscard]] static const Position2D&  GetFacePosition2D(size_t index);
     [[nodiscard]] static Data::Size         GetFacePositionCount() noexcept;
     [[nodiscard]] static const TexCoord&    GetFaceTexCoord(size_t index);
@@ -171,7 +209,6 @@ private:
     const VertexLayout       m_vertex_layout;
     const VertexFieldOffsets m_vertex_field_offsets;
     const Data::Size         m_vertex_size;
-    Indices                  m_indices;
 };
 
 } // namespace Methane::Graphics
@@ -0,0 +1,65 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshOptimizer.h
+Mesh optimization for post-transform vertex cache and vertex fetch locality
+with ACMR/ATVR metrics of the simulated vertex cache.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+namespace Methane::Graphics
+{
+
+static constexpr Data::Size g_default_vertex_cache_size = 16U;
+
+struct VertexCacheStatistics
+{
+    Data::Size triangles_count    = 0U;
+    Data::Size vertices_count     = 0U;
+    Data::Size cache_misses_count = 0U;
+
+    // Average cache miss ratio: transformed vertices per triangle, 0.5 is ideal for large regular meshes
+    [[nodiscard]] double GetAcmr() const noexcept { return triangles_count ? static_cast<double>(cache_misses_count) / triangles_count : 0.0; }
+
+    // Average transformed vertex ratio: transformed vertices per referenced vertex, 1.0 is ideal
+    [[nodiscard]] double GetAtvr() const noexcept { return vertices_count ? static_cast<double>(cache_misses_count) / vertices_count : 0.0; }
+
+    VertexCacheStatistics& operator+=(const VertexCacheStatistics& other) noexcept;
+};
+
+// Simulates FIFO post-transform vertex cache on triangle list indices
+template<typename IType>
+[[nodiscard]] VertexCacheStatistics AnalyzeVertexCache(const IType* indices, Data::Size index_count,
+                                                       Data::Size cache_size = g_default_vertex_cache_size);
+
+// Reorders triangles of the list with Tipsify algorithm to reduce vertex cache misses, vertex indices are not changed
+template<typename IType>
+void OptimizeVertexCache(IType* indices, Data::Size index_count,
+                         Data::Size cache_size = g_default_vertex_cache_size);
+
+// Reorders vertices in the range referenced by indices in order of their first use and remaps indices accordingly,
+// vertex with index value I is located in vertices data at position (base_vertex + I)
+template<typename IType>
+void OptimizeVertexFetch(Data::RawPtr vertices_data, Data::Size vertex_size,
+                         IType* indices, Data::Size index_count, Data::Index base_vertex = 0U);
+
+} // namespace Methane::Graphics
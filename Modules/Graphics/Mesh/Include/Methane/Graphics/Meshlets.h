@@ -0,0 +1,90 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Meshlets.h
+Meshlets built from mesh subsets: clusters of limited vertices and triangles count
+with bounding spheres and normal cones for cluster frustum and backface culling.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+class Meshlets
+{
+public:
+    static constexpr Data::Size g_max_vertex_count   = 64U;
+    static constexpr Data::Size g_max_triangle_count = 124U;
+
+    struct Meshlet
+    {
+        Data::Index subset_index    = 0U;
+        Data::Index vertex_offset   = 0U; // offset of the first meshlet vertex in vertices array
+        Data::Index triangle_offset = 0U; // offset of the first local vertex index in triangles array
+        Data::Size  vertex_count    = 0U;
+        Data::Size  triangle_count  = 0U;
+    };
+
+    // All meshlet triangles are back-facing when dot(normalize(cone_apex - view_position), cone_axis) >= cone_cutoff,
+    // cone culling is disabled with cutoff equal to 1 when triangle normals are spread too wide
+    struct Bounds
+    {
+        Mesh::Position center;
+        float          radius = 0.F;
+        Mesh::Position cone_apex;
+        Mesh::Normal   cone_axis;
+        float          cone_cutoff = 1.F;
+    };
+
+    // Triangles are clustered greedily in the index order, so vertex cache optimized meshes produce tighter meshlets
+    explicit Meshlets(const Mesh& mesh, const Mesh::Subsets& mesh_subsets = {},
+                      Data::Size max_vertex_count = g_max_vertex_count,
+                      Data::Size max_triangle_count = g_max_triangle_count);
+
+    [[nodiscard]] Data::Size                       GetCount() const noexcept        { return static_cast<Data::Size>(m_meshlets.size()); }
+    [[nodiscard]] const std::vector<Meshlet>&      GetMeshlets() const noexcept     { return m_meshlets; }
+    [[nodiscard]] const std::vector<Bounds>&       GetBounds() const noexcept       { return m_bounds; }
+    [[nodiscard]] const std::vector<Data::Index>&  GetVertices() const noexcept     { return m_vertices; }
+    [[nodiscard]] const std::vector<uint8_t>&      GetTriangles() const noexcept    { return m_triangles; }
+    [[nodiscard]] const Mesh::Subsets&             GetMeshSubsets() const noexcept  { return m_mesh_subsets; }
+    [[nodiscard]] const Mesh::Subset::Slice&       GetSubsetMeshlets(Data::Index subset_index) const;
+
+    // Returns mesh indices reordered by meshlets, so that each meshlet triangles are placed contiguously from its triangle offset
+    [[nodiscard]] std::vector<Data::Index> GetMeshletIndices() const;
+
+private:
+    template<typename IType>
+    void Build(const Mesh& mesh, const IType* indices, Data::Size max_vertex_count, Data::Size max_triangle_count);
+
+    void AddBounds(const Mesh& mesh, const Meshlet& meshlet);
+
+    const Mesh::Subsets              m_mesh_subsets;
+    std::vector<Mesh::Subset::Slice> m_subset_meshlets;
+    std::vector<Meshlet>             m_meshlets;
+    std::vector<Bounds>              m_bounds;
+    std::vector<Data::Index>         m_vertices;
+    std::vector<uint8_t>             m_triangles;
+};
+
+} // namespace Methane::Graphics
@@ -28,11 +28,11 @@ Quad mesh generator with customizable vertex type
 namespace Methane::Graphics
 {
 
-template<typename VType>
-class QuadMesh : public BaseMesh<VType>
+template<typename VType, typename IType = Mesh::Index>
+class QuadMesh : public BaseMesh<VType, IType>
 {
 public:
-    using BaseMeshT = BaseMesh<VType>;
+    using BaseMeshT = BaseMesh<VType, IType>;
 
     enum class FaceType
     {
@@ -81,10 +81,10 @@ public:
 #endif
 
         const Mesh::Index face_indices_count = BaseMeshT::GetFaceIndicesCount();
-        Mesh::ResizeIndices(face_indices_count);
+        BaseMeshT::ResizeIndices(face_indices_count);
         for(Mesh::Index index = 0; index < face_indices_count; ++index)
         {
-            Mesh::SetIndex(reverse_indices ? face_indices_count - index - 1 : index, Mesh::GetFaceIndex(index));
+            BaseMeshT::SetIndex(reverse_indices ? face_indices_count - index - 1 : index, Mesh::GetFaceIndex(index));
         }
     }
 
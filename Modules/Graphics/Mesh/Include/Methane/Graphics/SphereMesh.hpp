@@ -30,13 +30,13 @@ Sphere mesh generator with customizable vertex type
 namespace Methane::Graphics
 {
 
-template<typename VType>
-class SphereMesh : public BaseMesh<VType>
+template<typename VType, typename IType = Mesh::Index>
+class SphereMesh : public BaseMesh<VType, IType>
 {
 public:
-    using BaseMeshT = BaseMesh<VType>;
+    using BaseMeshT = BaseMesh<VType, IType>;
 
-    explicit SphereMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, Mesh::Index lat_lines_count = 10, Mesh::Index long_lines_count = 16)
+    explicit SphereMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, Data::Size lat_lines_count = 10, Data::Size long_lines_count = 16)
         : BaseMeshT(Mesh::Type::Sphere, vertex_layout)
         , m_radius(radius)
         , m_lat_lines_count(lat_lines_count)
@@ -44,25 +44,25 @@ public:
     {
         META_FUNCTION_TASK();
         META_CHECK_ARG_NAME_DESCR("vertex_layout", !Mesh::HasVertexField(Mesh::VertexField::Color), "colored vertices are not supported by sphere mesh");
-        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_lat_lines_count,  3, "latitude lines count should not be less than 3");
-        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_long_lines_count, 3, "longitude lines count should not be less than 3");
+        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_lat_lines_count,  3U, "latitude lines count should not be less than 3");
+        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_long_lines_count, 3U, "longitude lines count should not be less than 3");
 
         GenerateSphereVertices();
         GenerateSphereIndices();
     }
 
-    float       GetRadius() const noexcept         { return m_radius; }
-    Mesh::Index GetLongLinesCount() const noexcept { return m_long_lines_count; }
-    Mesh::Index GetLatLinesCount() const noexcept  { return m_lat_lines_count; }
+    float      GetRadius() const noexcept         { return m_radius; }
+    Data::Size GetLongLinesCount() const noexcept { return m_long_lines_count; }
+    Data::Size GetLatLinesCount() const noexcept  { return m_lat_lines_count; }
 
 private:
-    Mesh::Index GetActualLongLinesCount() const noexcept
+    Data::Size GetActualLongLinesCount() const noexcept
     {
         return Mesh::HasVertexField(Mesh::VertexField::TexCoord)
              ? m_long_lines_count + 1
              : m_long_lines_count;
     }
-    Mesh::Index GetSphereFacesCount() const noexcept
+    Data::Size GetSphereFacesCount() const noexcept
     {
         return (Mesh::HasVertexField(Mesh::VertexField::TexCoord)
              ? m_lat_lines_count
@@ -79,10 +79,12 @@ private:
 
         const bool        has_texcoord = BaseMeshT::HasVertexField(Mesh::VertexField::TexCoord);
         const bool        has_normals  = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
-        const Mesh::Index actual_long_lines_count = GetActualLongLinesCount();
-        const Mesh::Index cap_vertex_count = 2 * (has_texcoord ? actual_long_lines_count : 1);
+        const Data::Size  actual_long_lines_count = GetActualLongLinesCount();
+        const Data::Size  cap_vertex_count = 2 * (has_texcoord ? actual_long_lines_count : 1);
+        const Data::Size  vertex_count = (m_lat_lines_count - 2) * actual_long_lines_count + cap_vertex_count;
 
-        BaseMeshT::ResizeVertices((m_lat_lines_count - 2) * actual_long_lines_count + cap_vertex_count);
+        BaseMeshT::CheckVertexCountFitsIndex(vertex_count);
+        BaseMeshT::ResizeVertices(vertex_count);
 
         if (!has_texcoord)
         {
@@ -147,61 +149,61 @@ private:
     {
         META_FUNCTION_TASK();
         const bool        has_texcoord            = BaseMeshT::HasVertexField(Mesh::VertexField::TexCoord);
-        const Mesh::Index actual_long_lines_count = GetActualLongLinesCount();
-        const Mesh::Index sphere_faces_count      = GetSphereFacesCount();
+        const Data::Size  actual_long_lines_count = GetActualLongLinesCount();
+        const Data::Size  sphere_faces_count      = GetSphereFacesCount();
         Data::Index       index_offset            = 0;
 
-        Mesh::ResizeIndices(sphere_faces_count * 3);
+        BaseMeshT::ResizeIndices(sphere_faces_count * 3);
 
         if (!has_texcoord)
         {
             // Top cap triangles reuse single pole vertex
 
-            for (Mesh::Index long_line_index = 0; long_line_index < actual_long_lines_count - 1; ++long_line_index)
+            for (Data::Index long_line_index = 0; long_line_index < actual_long_lines_count - 1; ++long_line_index)
             {
-                Mesh::SetIndex(index_offset, 0);
-                Mesh::SetIndex(index_offset + 1, long_line_index + 2);
-                Mesh::SetIndex(index_offset + 2, long_line_index + 1);
+                BaseMeshT::SetIndex(index_offset, 0);
+                BaseMeshT::SetIndex(index_offset + 1, long_line_index + 2);
+                BaseMeshT::SetIndex(index_offset + 2, long_line_index + 1);
 
                 index_offset += 3;
             }
 
-            Mesh::SetIndex(index_offset, 0);
-            Mesh::SetIndex(index_offset + 1, 1);
-            Mesh::SetIndex(index_offset + 2, m_long_lines_count);
+            BaseMeshT::SetIndex(index_offset, 0);
+            BaseMeshT::SetIndex(index_offset + 1, 1);
+            BaseMeshT::SetIndex(index_offset + 2, m_long_lines_count);
 
             index_offset += 3;
         }
 
-        const auto        vertices_count         = static_cast<Mesh::Index>(BaseMeshT::GetVertexCount());
-        const Mesh::Index index_lat_lines_count  = has_texcoord ? m_lat_lines_count - 1 : m_lat_lines_count - 3;
-        const Mesh::Index index_long_lines_count = has_texcoord ? m_long_lines_count    : m_long_lines_count - 1;
-        const Mesh::Index first_vertex_index     = has_texcoord ? 0 : 1;
+        const Data::Size  vertices_count         = BaseMeshT::GetVertexCount();
+        const Data::Size  index_lat_lines_count  = has_texcoord ? m_lat_lines_count - 1 : m_lat_lines_count - 3;
+        const Data::Size  index_long_lines_count = has_texcoord ? m_long_lines_count    : m_long_lines_count - 1;
+        const Data::Index first_vertex_index     = has_texcoord ? 0 : 1;
 
-        for (Mesh::Index lat_line_index = 0; lat_line_index < index_lat_lines_count; ++lat_line_index)
+        for (Data::Index lat_line_index = 0; lat_line_index < index_lat_lines_count; ++lat_line_index)
         {
-            for (Mesh::Index long_line_index = 0; long_line_index < index_long_lines_count; ++long_line_index)
+            for (Data::Index long_line_index = 0; long_line_index < index_long_lines_count; ++long_line_index)
             {
-                Mesh::SetIndex(index_offset,     (lat_line_index * actual_long_lines_count) + long_line_index + first_vertex_index);
-                Mesh::SetIndex(index_offset + 1, (lat_line_index * actual_long_lines_count) + long_line_index + first_vertex_index + 1);
-                Mesh::SetIndex(index_offset + 2, (lat_line_index + 1) * actual_long_lines_count + long_line_index + first_vertex_index);
+                BaseMeshT::SetIndex(index_offset,     (lat_line_index * actual_long_lines_count) + long_line_index + first_vertex_index);
+                BaseMeshT::SetIndex(index_offset + 1, (lat_line_index * actual_long_lines_count) + long_line_index + first_vertex_index + 1);
+                BaseMeshT::SetIndex(index_offset + 2, (lat_line_index + 1) * actual_long_lines_count + long_line_index + first_vertex_index);
 
-                Mesh::SetIndex(index_offset + 3, (lat_line_index + 1) * actual_long_lines_count + long_line_index + first_vertex_index);
-                Mesh::SetIndex(index_offset + 4, (lat_line_index * actual_long_lines_count) + long_line_index + first_vertex_index + 1);
-                Mesh::SetIndex(index_offset + 5, (lat_line_index + 1) * actual_long_lines_count + long_line_index + first_vertex_index + 1);
+                BaseMeshT::SetIndex(index_offset + 3, (lat_line_index + 1) * actual_long_lines_count + long_line_index + first_vertex_index);
+                BaseMeshT::SetIndex(index_offset + 4, (lat_line_index * actual_long_lines_count) + long_line_index + first_vertex_index + 1);
+                BaseMeshT::SetIndex(index_offset + 5, (lat_line_index + 1) * actual_long_lines_count + long_line_index + first_vertex_index + 1);
 
                 index_offset += 6;
             }
 
             if (!has_texcoord)
             {
-                Mesh::SetIndex(index_offset,     (lat_line_index * actual_long_lines_count) + actual_long_lines_count);
-                Mesh::SetIndex(index_offset + 1, (lat_line_index * actual_long_lines_count) + 1);
-                Mesh::SetIndex(index_offset + 2, (lat_line_index + 1) * actual_long_lines_count + actual_long_lines_count);
+                BaseMeshT::SetIndex(index_offset,     (lat_line_index * actual_long_lines_count) + actual_long_lines_count);
+                BaseMeshT::SetIndex(index_offset + 1, (lat_line_index * actual_long_lines_count) + 1);
+                BaseMeshT::SetIndex(index_offset + 2, (lat_line_index + 1) * actual_long_lines_count + actual_long_lines_count);
 
-                Mesh::SetIndex(index_offset + 3, (lat_line_index + 1) * actual_long_lines_count + actual_long_lines_count);
-                Mesh::SetIndex(index_offset + 4, (lat_line_index * actual_long_lines_count) + 1);
-                Mesh::SetIndex(index_offset + 5, (lat_line_index + 1) * actual_long_lines_count + 1);
+                BaseMeshT::SetIndex(index_offset + 3, (lat_line_index + 1) * actual_long_lines_count + actual_long_lines_count);
+                BaseMeshT::SetIndex(index_offset + 4, (lat_line_index * actual_long_lines_count) + 1);
+                BaseMeshT::SetIndex(index_offset + 5, (lat_line_index + 1) * actual_long_lines_count + 1);
 
                 index_offset += 6;
             }
@@ -211,24 +213,24 @@ private:
         {
             // Bottom cap triangles reuse single pole vertex
 
-            for (Mesh::Index long_line_index = 0; long_line_index < index_long_lines_count; ++long_line_index)
+            for (Data::Index long_line_index = 0; long_line_index < index_long_lines_count; ++long_line_index)
             {
-                Mesh::SetIndex(index_offset,     vertices_count - 1);
-                Mesh::SetIndex(index_offset + 1, vertices_count - 1 - long_line_index + 2);
-                Mesh::SetIndex(index_offset + 2, vertices_count - 1 - long_line_index + 1);
+                BaseMeshT::SetIndex(index_offset,     vertices_count - 1);
+                BaseMeshT::SetIndex(index_offset + 1, vertices_count - 1 - long_line_index - 2);
+                BaseMeshT::SetIndex(index_offset + 2, vertices_count - 1 - long_line_index - 1);
 
                 index_offset += 3;
             }
 
-            Mesh::SetIndex(index_offset,     vertices_count - 1);
-            Mesh::SetIndex(index_offset + 1, vertices_count - 2);
-            Mesh::SetIndex(index_offset + 2, vertices_count - 1 - actual_long_lines_count);
+            BaseMeshT::SetIndex(index_offset,     vertices_count - 1);
+            BaseMeshT::SetIndex(index_offset + 1, vertices_count - 2);
+            BaseMeshT::SetIndex(index_offset + 2, vertices_count - 1 - actual_long_lines_count);
         }
     }
 
-    const float       m_radius;
-    const Mesh::Index m_lat_lines_count;
-    const Mesh::Index m_long_lines_count;
+    const float      m_radius;
+    const Data::Size m_lat_lines_count;
+    const Data::Size m_long_lines_count;
 };
 
 } // namespace Methane::Graphics
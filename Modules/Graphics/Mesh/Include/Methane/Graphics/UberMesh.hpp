@@ -28,11 +28,11 @@ Uber mesh generator with customizable vertex type
 namespace Methane::Graphics
 {
 
-template<typename VType>
-class UberMesh : public BaseMesh<VType>
+template<typename VType, typename IType = Mesh::Index>
+class UberMesh : public BaseMesh<VType, IType>
 {
 public:
-    using BaseMeshT = BaseMesh<VType>;
+    using BaseMeshT = BaseMesh<VType, IType>;
 
     explicit UberMesh(const Mesh::VertexLayout& vertex_layout)
         : BaseMeshT(Mesh::Type::Uber, vertex_layout)
@@ -42,24 +42,24 @@ public:
     {
         META_FUNCTION_TASK();
         const typename BaseMeshT::Vertices& sub_vertices = sub_mesh.GetVertices();
-        const Mesh::Indices& sub_indices = sub_mesh.GetIndices();
+        const typename BaseMeshT::Indices& sub_indices = sub_mesh.GetIndices();
 
         m_subsets.emplace_back(sub_mesh.GetType(),
                                Mesh::Subset::Slice(BaseMeshT::GetVertexCount(), static_cast<Data::Size>(sub_vertices.size())),
-                               Mesh::Subset::Slice(Mesh::GetIndexCount(),       static_cast<Data::Size>(sub_indices.size())),
+                               Mesh::Subset::Slice(BaseMeshT::GetIndexCount(),       static_cast<Data::Size>(sub_indices.size())),
                                adjust_indices);
 
         if (adjust_indices)
         {
             const Data::Size vertex_count = BaseMeshT::GetVertexCount();
-            META_CHECK_ARG_LESS(vertex_count, std::numeric_limits<Mesh::Index>::max());
+            META_CHECK_ARG_LESS(vertex_count, std::numeric_limits<IType>::max());
 
-            const auto index_offset = static_cast<Mesh::Index>(vertex_count);
+            const auto index_offset = static_cast<IType>(vertex_count);
             std::transform(sub_indices.begin(), sub_indices.end(), BaseMeshT::GetIndicesBackInserter(),
-                           [index_offset](const Mesh::Index& index)
+                           [index_offset](const IType& index)
                            {
-                               META_CHECK_ARG_LESS(index_offset, std::numeric_limits<Mesh::Index>::max() - index);
-                               return static_cast<Mesh::Index>(index_offset + index);
+                               META_CHECK_ARG_LESS(index_offset, std::numeric_limits<IType>::max() - index);
+                               return static_cast<IType>(index_offset + index);
                            });
         }
         else
@@ -86,11 +86,11 @@ public:
         return { BaseMeshT::GetVertices().data() + subset.vertices.offset, subset.vertices.count };
     }
 
-    std::pair<const Mesh::Index*, size_t> GetSubsetIndices(size_t subset_index) const
+    std::pair<const IType*, size_t> GetSubsetIndices(size_t subset_index) const
     {
         META_FUNCTION_TASK();
         const Mesh::Subset& subset = GetSubset(subset_index);
-        return { Mesh::GetIndices().data() + subset.indices.offset, subset.indices.count };
+        return { BaseMeshT::GetIndices().data() + subset.indices.offset, subset.indices.count };
     }
 
 private:
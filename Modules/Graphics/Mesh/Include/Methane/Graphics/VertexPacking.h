@@ -0,0 +1,52 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/VertexPacking.h
+Vertex field packing kernels converting float vertex fields to compact encodings,
+vectorized with SSE2, F16C (selected in runtime) or NEON instructions when available.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Vector.hpp>
+
+namespace Methane::Graphics
+{
+
+// Kernels convert fields of interleaved vertices with the given strides, source and target memory must not overlap
+
+// Packs float3 positions to half4 positions with w = 1, since 3-component 16-bit vertex formats are not supported by all APIs
+void PackHalfPositions(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept;
+
+// Packs normalized float3 normals to octahedral encoding with two snorm16 components
+void PackOctahedralNormals(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept;
+
+// Packs float2 texture coordinates in [0, 1] range to unorm16 components
+void PackUnormTexCoords(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept;
+
+// Packs float3 colors in [0, 1] range to unorm8 RGBA components with opaque alpha
+void PackUnormColors(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept;
+
+// Scalar conversions of single values, used for unpacking on CPU
+[[nodiscard]] uint16_t          PackHalf(float value) noexcept;
+[[nodiscard]] float             UnpackHalf(uint16_t half_value) noexcept;
+[[nodiscard]] Data::RawVector3F UnpackOctahedralNormal(int16_t x, int16_t y) noexcept;
+
+} // namespace Methane::Graphics
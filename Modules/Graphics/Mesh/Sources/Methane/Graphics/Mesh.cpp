@@ -22,11 +22,14 @@ Abstract mesh class
 ******************************************************************************/
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/VertexPacking.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <magic_enum.hpp>
 #include <array>
+#include <algorithm>
+#include <cstring>
 
 namespace Methane::Graphics
 {
@@ -35,7 +38,7 @@ static constexpr Data::Size g_face_positions_count = 4;
 static constexpr Data::Size g_face_indices_count = 6;
 static constexpr Data::Size g_colors_count = 6;
 
-Data::Size Mesh::GetVertexFieldSize(size_t vertex_field_index)
+Data::Size Mesh::GetVertexFieldSize(size_t vertex_field_index, bool is_packed)
 {
     static const std::array<Data::Size, magic_enum::enum_count<VertexField>()> s_vertex_field_sizes {{
         sizeof(Position),
@@ -43,7 +46,13 @@ Data::Size Mesh::GetVertexFieldSize(size_t vertex_field_index)
         sizeof(TexCoord),
         sizeof(Color),
     }};
-    return s_vertex_field_sizes[vertex_field_index];
+    static const std::array<Data::Size, magic_enum::enum_count<VertexField>()> s_packed_vertex_field_sizes {{
+        sizeof(uint16_t) * 4, // half-float position with w = 1
+        sizeof(int16_t) * 2,  // octahedral normal with snorm16 components
+        sizeof(uint16_t) * 2, // unorm16 texture coordinates
+        sizeof(uint8_t) * 4,  // unorm8 color with opaque alpha
+    }};
+    return is_packed ? s_packed_vertex_field_sizes[vertex_field_index] : s_vertex_field_sizes[vertex_field_index];
 }
 
 const Mesh::Position2D& Mesh::GetFacePosition2D(size_t index)
@@ -107,20 +116,57 @@ Mesh::Index Mesh::GetFaceIndicesCount() noexcept
     return g_face_indices_count;
 }
 
-std::string_view Mesh::VertexLayout::GetSemanticByVertexField(VertexField vertex_field)
+std::string_view Mesh::VertexLayout::GetSemanticByVertexField(VertexField vertex_field, bool is_packed)
 {
     META_FUNCTION_TASK();
 
+    // Octahedral normals have to be decoded in shader, so they are bound to a separate semantic,
+    // while other packed fields are converted to float shader inputs on vertex fetch
     switch(vertex_field)
     {
     case VertexField::Position: return "POSITION";
-    case VertexField::Normal:   return "NORMAL";
+    case VertexField::Normal:   return is_packed ? "OCTNORMAL" : "NORMAL";
     case VertexField::TexCoord: return "TEXCOORD";
     case VertexField::Color:    return "COLOR";
     default:                    META_UNEXPECTED_ARG_RETURN(vertex_field, "");
     }
 }
 
+PixelFormat Mesh::VertexLayout::GetFormatByVertexField(VertexField vertex_field, bool is_packed)
+{
+    META_FUNCTION_TASK();
+    if (!is_packed)
+        return PixelFormat::Unknown; // float field format is deduced from shader input type
+
+    switch(vertex_field)
+    {
+    case VertexField::Position: return PixelFormat::RGBA16Float;
+    case VertexField::Normal:   return PixelFormat::RG16Snorm;
+    case VertexField::TexCoord: return PixelFormat::RG16Unorm;
+    case VertexField::Color:    return PixelFormat::RGBA8Unorm;
+    default:                    META_UNEXPECTED_ARG_RETURN(vertex_field, PixelFormat::Unknown);
+    }
+}
+
+Mesh::VertexLayout::VertexLayout(std::initializer_list<VertexField> vertex_fields, VertexFieldMask packed_fields)
+    : std::vector<VertexField>(vertex_fields)
+    , m_packed_fields(packed_fields)
+{ }
+
+Mesh::VertexLayout Mesh::VertexLayout::GetPackedLayout(VertexFieldMask packed_fields) const
+{
+    META_FUNCTION_TASK();
+    VertexLayout packed_layout(*this);
+    packed_layout.m_packed_fields = packed_fields;
+    return packed_layout;
+}
+
+Data::Size Mesh::VertexLayout::GetVertexSize() const noexcept
+{
+    META_FUNCTION_TASK();
+    return Mesh::GetVertexSize(*this);
+}
+
 Mesh::VertexLayout::IncompatibleException::IncompatibleException(VertexField missing_field)
     : std::logic_error(fmt::format("Mesh vertex layout is incompatible, field {} is missing.", VertexLayout::GetSemanticByVertexField(missing_field)))
     , m_missing_field(missing_field)
@@ -134,11 +180,23 @@ std::vector<std::string_view> Mesh::VertexLayout::GetSemantics() const
     semantic_names.reserve(size());
     for(VertexField vertex_field : *this)
     {
-        semantic_names.emplace_back(GetSemanticByVertexField(vertex_field));
+        semantic_names.emplace_back(GetSemanticByVertexField(vertex_field, IsFieldPacked(vertex_field)));
     }
     return semantic_names;
 }
 
+PixelFormats Mesh::VertexLayout::GetFormats() const
+{
+    META_FUNCTION_TASK();
+    PixelFormats formats;
+    formats.reserve(size());
+    for(VertexField vertex_field : *this)
+    {
+        formats.emplace_back(GetFormatByVertexField(vertex_field, IsFieldPacked(vertex_field)));
+    }
+    return formats;
+}
+
 Mesh::Subset::Subset(Type in_mesh_type, const Slice& in_vertices, const Slice& in_indices, bool in_indices_adjusted)
     : mesh_type(in_mesh_type)
     , vertices(in_vertices)
@@ -157,7 +215,7 @@ Mesh::VertexFieldOffsets Mesh::GetVertexFieldOffsets(const VertexLayout& vertex_
     {
         const auto vertex_field_index = static_cast<size_t>(vertex_field);
         field_offsets[vertex_field_index] = static_cast<int32_t>(current_offset);
-        current_offset += GetVertexFieldSize(vertex_field_index);
+        current_offset += GetVertexFieldSize(vertex_field_index, vertex_layout.IsFieldPacked(vertex_field));
     }
 
     META_CHECK_ARG_NAME_DESCR("vertex_layout", field_offsets[static_cast<size_t>(VertexField::Position)] >= 0, "position field must be specified in vertex layout");
@@ -170,7 +228,7 @@ Data::Size Mesh::GetVertexSize(const VertexLayout& vertex_layout) noexcept
     Data::Size vertex_size = 0;
     for (VertexField vertex_field : vertex_layout)
     {
-        vertex_size += GetVertexFieldSize(vertex_field);
+        vertex_size += GetVertexFieldSize(vertex_field, vertex_layout.IsFieldPacked(vertex_field));
     }
     return vertex_size;
 }
@@ -183,6 +241,54 @@ Mesh::Mesh(Type type, const VertexLayout& vertex_layout)
 {
     META_FUNCTION_TASK();
     CheckLayoutHasVertexField(VertexField::Position);
+    META_CHECK_ARG_NAME_DESCR("vertex_layout", !m_vertex_layout.GetPackedFields(),
+                              "mesh vertices are generated with float fields, packed vertex data has to be requested with GetPackedVertexData");
+}
+
+const Mesh::Position& Mesh::GetVertexPosition(Data::Index vertex_index) const
+{
+    META_CHECK_ARG_LESS(vertex_index, GetVertexCount());
+    const size_t position_offset = static_cast<size_t>(vertex_index) * m_vertex_size + GetVertexFieldOffset(VertexField::Position);
+    return *reinterpret_cast<const Position*>(GetVertexData() + position_offset); // NOSONAR
+}
+
+Data::Bytes Mesh::GetPackedVertexData(const VertexLayout& packed_vertex_layout) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NAME_DESCR("packed_vertex_layout", std::equal(packed_vertex_layout.begin(), packed_vertex_layout.end(), m_vertex_layout.begin(), m_vertex_layout.end()),
+                              "packed vertex layout must have the same fields as the mesh vertex layout");
+
+    const VertexFieldOffsets packed_field_offsets = GetVertexFieldOffsets(packed_vertex_layout);
+    const Data::Size         packed_vertex_size   = GetVertexSize(packed_vertex_layout);
+    const Data::Size         vertex_count         = GetVertexCount();
+    Data::Bytes packed_vertex_data(static_cast<size_t>(packed_vertex_size) * vertex_count);
+
+    // Each field is converted for all vertices at once to let packing kernels process several vertices per iteration
+    for(VertexField vertex_field : packed_vertex_layout)
+    {
+        const Data::ConstRawPtr src_ptr = GetVertexData() + GetVertexFieldOffset(vertex_field);
+        const Data::RawPtr      dst_ptr = packed_vertex_data.data() + packed_field_offsets[static_cast<size_t>(vertex_field)];
+        if (!packed_vertex_layout.IsFieldPacked(vertex_field))
+        {
+            const Data::Size field_size = GetVertexFieldSize(vertex_field);
+            for(Data::Index vertex_index = 0U; vertex_index < vertex_count; ++vertex_index)
+            {
+                std::memcpy(dst_ptr + static_cast<size_t>(vertex_index) * packed_vertex_size,
+                            src_ptr + static_cast<size_t>(vertex_index) * m_vertex_size, field_size);
+            }
+            continue;
+        }
+
+        switch(vertex_field)
+        {
+        case VertexField::Position: PackHalfPositions(src_ptr, m_vertex_size, dst_ptr, packed_vertex_size, vertex_count); break;
+        case VertexField::Normal:   PackOctahedralNormals(src_ptr, m_vertex_size, dst_ptr, packed_vertex_size, vertex_count); break;
+        case VertexField::TexCoord: PackUnormTexCoords(src_ptr, m_vertex_size, dst_ptr, packed_vertex_size, vertex_count); break;
+        case VertexField::Color:    PackUnormColors(src_ptr, m_vertex_size, dst_ptr, packed_vertex_size, vertex_count); break;
+        default:                    META_UNEXPECTED_ARG(vertex_field);
+        }
+    }
+    return packed_vertex_data;
 }
 
 bool Mesh::HasVertexField(VertexField field) const noexcept
@@ -199,7 +305,7 @@ void Mesh::CheckLayoutHasVertexField(VertexField field) const
 }
 
 
-Mesh::Edge::Edge(Mesh::Index v1_index, Mesh::Index v2_index)
+Mesh::Edge::Edge(Data::Index v1_index, Data::Index v2_index)
     : first_index( v1_index < v2_index ? v1_index : v2_index)
     , second_index(v1_index < v2_index ? v2_index : v1_index)
 {
@@ -211,4 +317,64 @@ bool Mesh::Edge::operator<(const Edge& other) const
           (first_index == other.first_index && second_index < other.second_index);
 }
 
+static size_t GetEdgeKeyHash(uint64_t edge_key) noexcept
+{
+    // Fibonacci hashing mixes both vertex indices of the edge key into the upper bits
+    return static_cast<size_t>((edge_key * 0x9E3779B97F4A7C15ULL) >> 32U);
+}
+
+Mesh::EdgeMidpoints::EdgeMidpoints(Data::Size expected_edges_count)
+{
+    META_FUNCTION_TASK();
+    size_t slots_count = 16U;
+    while (slots_count < static_cast<size_t>(expected_edges_count) * 2U)
+        slots_count <<= 1U;
+
+    m_slots.resize(slots_count);
+}
+
+std::pair<Data::Index, bool> Mesh::EdgeMidpoints::TryEmplace(const Edge& edge, Data::Index midpoint_index)
+{
+    // Keep load factor below 1/2 for short linear probing sequences
+    if ((m_count + 1U) * 2U > m_slots.size())
+        Rehash(m_slots.size() * 2U);
+
+    const uint64_t edge_key   = edge.GetKey();
+    const size_t   slots_mask = m_slots.size() - 1U;
+    for (size_t slot_index = GetEdgeKeyHash(edge_key) & slots_mask;; slot_index = (slot_index + 1U) & slots_mask)
+    {
+        Slot& slot = m_slots[slot_index];
+        if (slot.edge_key == edge_key)
+            return { slot.midpoint_index, false };
+
+        if (slot.edge_key == std::numeric_limits<uint64_t>::max())
+        {
+            slot.edge_key       = edge_key;
+            slot.midpoint_index = midpoint_index;
+            m_count++;
+            return { midpoint_index, true };
+        }
+    }
+}
+
+void Mesh::EdgeMidpoints::Rehash(size_t slots_count)
+{
+    META_FUNCTION_TASK();
+    std::vector<Slot> old_slots(slots_count);
+    m_slots.swap(old_slots);
+
+    const size_t slots_mask = m_slots.size() - 1U;
+    for (const Slot& old_slot : old_slots)
+    {
+        if (old_slot.edge_key == std::numeric_limits<uint64_t>::max())
+            continue;
+
+        size_t slot_index = GetEdgeKeyHash(old_slot.edge_key) & slots_mask;
+        while (m_slots[slot_index].edge_key != std::numeric_limits<uint64_t>::max())
+            slot_index = (slot_index + 1U) & slots_mask;
+
+        m_slots[slot_index] = old_slot;
+    }
+}
+
 } // namespace Methane::Graphics
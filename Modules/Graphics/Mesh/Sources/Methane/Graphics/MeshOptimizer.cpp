@@ -0,0 +1,244 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshOptimizer.cpp
+Mesh optimization for post-transform vertex cache and vertex fetch locality
+with ACMR/ATVR metrics of the simulated vertex cache.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+static constexpr Data::Index g_no_vertex = std::numeric_limits<Data::Index>::max();
+
+template<typename IType>
+static std::pair<Data::Index, Data::Index> GetIndexRange(const IType* indices, Data::Size index_count)
+{
+    const auto [min_index_it, max_index_it] = std::minmax_element(indices, indices + index_count);
+    return { static_cast<Data::Index>(*min_index_it), static_cast<Data::Index>(*max_index_it) };
+}
+
+static void CheckTriangleListIndices(Data::Size index_count, Data::Size cache_size)
+{
+    META_CHECK_ARG_DESCR(index_count, index_count % 3 == 0, "mesh indices count should be a multiple of three representing triangles list");
+    META_CHECK_ARG_NOT_ZERO_DESCR(cache_size, "vertex cache size can not be zero");
+}
+
+VertexCacheStatistics& VertexCacheStatistics::operator+=(const VertexCacheStatistics& other) noexcept
+{
+    triangles_count    += other.triangles_count;
+    vertices_count     += other.vertices_count;
+    cache_misses_count += other.cache_misses_count;
+    return *this;
+}
+
+template<typename IType>
+VertexCacheStatistics AnalyzeVertexCache(const IType* indices, Data::Size index_count, Data::Size cache_size)
+{
+    META_FUNCTION_TASK();
+    CheckTriangleListIndices(index_count, cache_size);
+
+    VertexCacheStatistics statistics;
+    statistics.triangles_count = index_count / 3U;
+    if (!index_count)
+        return statistics;
+
+    // Vertex is in FIFO cache while less than cache size of other vertices were loaded after it
+    const auto [min_index, max_index] = GetIndexRange(indices, index_count);
+    std::vector<Data::Index> load_timestamps(max_index - min_index + 1U, 0U);
+    Data::Index timestamp = cache_size;
+
+    for (Data::Index i = 0U; i < index_count; ++i)
+    {
+        Data::Index& load_timestamp = load_timestamps[indices[i] - min_index];
+        if (!load_timestamp)
+            statistics.vertices_count++;
+
+        if (load_timestamp && timestamp - load_timestamp < cache_size)
+            continue;
+
+        load_timestamp = timestamp++;
+        statistics.cache_misses_count++;
+    }
+    return statistics;
+}
+
+template<typename IType>
+void OptimizeVertexCache(IType* indices, Data::Size index_count, Data::Size cache_size)
+{
+    META_FUNCTION_TASK();
+    CheckTriangleListIndices(index_count, cache_size);
+    if (!index_count)
+        return;
+
+    const auto [min_index, max_index] = GetIndexRange(indices, index_count);
+    const Data::Size vertex_count     = max_index - min_index + 1U;
+
+    // Vertex to adjacent triangles mapping in compressed rows
+    std::vector<Data::Index> live_triangles(vertex_count, 0U);
+    for (Data::Index i = 0U; i < index_count; ++i)
+    {
+        live_triangles[indices[i] - min_index]++;
+    }
+
+    std::vector<Data::Index> adjacency_offsets(vertex_count + 1U, 0U);
+    for (Data::Index v = 0U; v < vertex_count; ++v)
+    {
+        adjacency_offsets[v + 1U] = adjacency_offsets[v] + live_triangles[v];
+    }
+
+    std::vector<Data::Index> adjacent_triangles(index_count);
+    std::vector<Data::Index> adjacency_fill(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+    for (Data::Index i = 0U; i < index_count; ++i)
+    {
+        adjacent_triangles[adjacency_fill[indices[i] - min_index]++] = i / 3U;
+    }
+
+    std::vector<Data::Index> cache_timestamps(vertex_count, 0U);
+    std::vector<uint8_t>     emitted_triangles(index_count / 3U, 0U);
+    std::vector<Data::Index> dead_end_stack;
+    std::vector<Data::Index> candidate_vertices;
+    std::vector<IType>       optimized_indices;
+    dead_end_stack.reserve(index_count);
+    optimized_indices.reserve(index_count);
+
+    Data::Index timestamp = cache_size + 1U;
+    Data::Index cursor    = 1U;
+
+    const auto get_next_fanning_vertex = [&]() -> Data::Index
+    {
+        // Prefer candidate vertex which stays in cache after emitting all its remaining triangles, the oldest one first
+        Data::Index next_vertex   = g_no_vertex;
+        int64_t     best_priority = -1;
+        for (Data::Index v : candidate_vertices)
+        {
+            if (!live_triangles[v])
+                continue;
+
+            const Data::Index cache_age = timestamp - cache_timestamps[v];
+            const int64_t     priority  = cache_age + 2U * live_triangles[v] <= cache_size ? cache_age : 0;
+            if (priority > best_priority)
+            {
+                best_priority = priority;
+                next_vertex   = v;
+            }
+        }
+        if (next_vertex != g_no_vertex)
+            return next_vertex;
+
+        // Dead-end is resolved with the most recently referenced vertex having live triangles or by sweeping input vertices
+        while (!dead_end_stack.empty())
+        {
+            const Data::Index v = dead_end_stack.back();
+            dead_end_stack.pop_back();
+            if (live_triangles[v])
+                return v;
+        }
+        for (; cursor < vertex_count; ++cursor)
+        {
+            if (live_triangles[cursor])
+                return cursor;
+        }
+        return g_no_vertex;
+    };
+
+    Data::Index fanning_vertex = 0U;
+    while (fanning_vertex != g_no_vertex)
+    {
+        candidate_vertices.clear();
+        for (Data::Index adjacency_index = adjacency_offsets[fanning_vertex]; adjacency_index < adjacency_offsets[fanning_vertex + 1U]; ++adjacency_index)
+        {
+            const Data::Index triangle_index = adjacent_triangles[adjacency_index];
+            if (emitted_triangles[triangle_index])
+                continue;
+
+            for (Data::Index i = triangle_index * 3U; i < triangle_index * 3U + 3U; ++i)
+            {
+                const Data::Index v = indices[i] - min_index;
+                optimized_indices.push_back(indices[i]);
+                dead_end_stack.push_back(v);
+                candidate_vertices.push_back(v);
+                live_triangles[v]--;
+
+                if (timestamp - cache_timestamps[v] > cache_size)
+                    cache_timestamps[v] = timestamp++;
+            }
+            emitted_triangles[triangle_index] = 1U;
+        }
+        fanning_vertex = get_next_fanning_vertex();
+    }
+
+    META_CHECK_ARG_EQUAL(optimized_indices.size(), index_count);
+    std::copy(optimized_indices.begin(), optimized_indices.end(), indices);
+}
+
+template<typename IType>
+void OptimizeVertexFetch(Data::RawPtr vertices_data, Data::Size vertex_size, IType* indices, Data::Size index_count, Data::Index base_vertex)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(vertices_data);
+    META_CHECK_ARG_NOT_ZERO(vertex_size);
+    if (!index_count)
+        return;
+
+    const auto [min_index, max_index] = GetIndexRange(indices, index_count);
+    const Data::Size vertex_count     = max_index - min_index + 1U;
+
+    // Vertices are renumbered in order of first use, unreferenced vertices are moved to the end of range
+    std::vector<Data::Index> vertex_remap(vertex_count, g_no_vertex);
+    Data::Index next_vertex = 0U;
+    for (Data::Index i = 0U; i < index_count; ++i)
+    {
+        Data::Index& new_vertex = vertex_remap[indices[i] - min_index];
+        if (new_vertex == g_no_vertex)
+            new_vertex = next_vertex++;
+
+        indices[i] = static_cast<IType>(min_index + new_vertex);
+    }
+    for (Data::Index& new_vertex : vertex_remap)
+    {
+        if (new_vertex == g_no_vertex)
+            new_vertex = next_vertex++;
+    }
+
+    Data::RawPtr      range_data = vertices_data + static_cast<size_t>(base_vertex + min_index) * vertex_size;
+    const Data::Bytes original_data(range_data, range_data + static_cast<size_t>(vertex_count) * vertex_size);
+    for (Data::Index v = 0U; v < vertex_count; ++v)
+    {
+        std::copy_n(original_data.data() + static_cast<size_t>(v) * vertex_size, vertex_size,
+                    range_data + static_cast<size_t>(vertex_remap[v]) * vertex_size);
+    }
+}
+
+template VertexCacheStatistics AnalyzeVertexCache<uint16_t>(const uint16_t*, Data::Size, Data::Size);
+template VertexCacheStatistics AnalyzeVertexCache<uint32_t>(const uint32_t*, Data::Size, Data::Size);
+template void OptimizeVertexCache<uint16_t>(uint16_t*, Data::Size, Data::Size);
+template void OptimizeVertexCache<uint32_t>(uint32_t*, Data::Size, Data::Size);
+template void OptimizeVertexFetch<uint16_t>(Data::RawPtr, Data::Size, uint16_t*, Data::Size, Data::Index);
+template void OptimizeVertexFetch<uint32_t>(Data::RawPtr, Data::Size, uint32_t*, Data::Size, Data::Index);
+
+} // namespace Methane::Graphics
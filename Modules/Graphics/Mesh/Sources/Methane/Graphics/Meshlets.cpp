@@ -0,0 +1,253 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Meshlets.cpp
+Meshlets built from mesh subsets: clusters of limited vertices and triangles count
+with bounding spheres and normal cones for cluster frustum and backface culling.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <hlsl++_vector_float.h>
+
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+// Cone culling is disabled for meshlets with triangle normals deviating from cone axis by more than ~84 degrees
+static constexpr float g_min_cone_axis_dot = 0.1F;
+
+Meshlets::Meshlets(const Mesh& mesh, const Mesh::Subsets& mesh_subsets, Data::Size max_vertex_count, Data::Size max_triangle_count)
+    : m_mesh_subsets(!mesh_subsets.empty()
+                    ? mesh_subsets
+                    : Mesh::Subsets{
+                        Mesh::Subset(mesh.GetType(),
+                                     { 0, mesh.GetVertexCount() },
+                                     { 0, mesh.GetIndexCount()  }, true)
+                      })
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_RANGE_INC_DESCR(max_vertex_count, 3U, 256U, "meshlet vertices count should fit into 8-bit local indices");
+    META_CHECK_ARG_NOT_ZERO_DESCR(max_triangle_count, "meshlet triangles count can not be zero");
+
+    switch (const PixelFormat index_format = mesh.GetIndexFormat(); index_format)
+    {
+    case PixelFormat::R16Uint:
+        Build(mesh, reinterpret_cast<const uint16_t*>(mesh.GetIndexData()), max_vertex_count, max_triangle_count); // NOSONAR
+        break;
+    case PixelFormat::R32Uint:
+        Build(mesh, reinterpret_cast<const uint32_t*>(mesh.GetIndexData()), max_vertex_count, max_triangle_count); // NOSONAR
+        break;
+    default:
+        META_UNEXPECTED_ARG_DESCR(index_format, "mesh index format is not supported by meshlets builder");
+    }
+}
+
+const Mesh::Subset::Slice& Meshlets::GetSubsetMeshlets(Data::Index subset_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(subset_index, m_subset_meshlets.size());
+    return m_subset_meshlets[subset_index];
+}
+
+std::vector<Data::Index> Meshlets::GetMeshletIndices() const
+{
+    META_FUNCTION_TASK();
+    std::vector<Data::Index> meshlet_indices;
+    meshlet_indices.reserve(m_triangles.size());
+    for (const Meshlet& meshlet : m_meshlets)
+    {
+        for (Data::Index i = meshlet.triangle_offset; i < meshlet.triangle_offset + meshlet.triangle_count * 3U; ++i)
+        {
+            meshlet_indices.push_back(m_vertices[meshlet.vertex_offset + m_triangles[i]]);
+        }
+    }
+    return meshlet_indices;
+}
+
+template<typename IType>
+void Meshlets::Build(const Mesh& mesh, const IType* indices, Data::Size max_vertex_count, Data::Size max_triangle_count)
+{
+    META_FUNCTION_TASK();
+    constexpr Data::Index no_local_index = std::numeric_limits<Data::Index>::max();
+    const Data::Size mesh_vertex_count = mesh.GetVertexCount();
+    std::vector<Data::Index> local_vertex_indices(mesh_vertex_count, no_local_index);
+
+    Meshlet meshlet;
+    const auto start_meshlet = [this, &meshlet](Data::Index subset_index)
+    {
+        meshlet = Meshlet{ subset_index, static_cast<Data::Index>(m_vertices.size()), static_cast<Data::Index>(m_triangles.size()), 0U, 0U };
+    };
+    const auto finish_meshlet = [this, &mesh, &meshlet, &local_vertex_indices]()
+    {
+        if (!meshlet.triangle_count)
+            return;
+
+        for (Data::Index v = meshlet.vertex_offset; v < meshlet.vertex_offset + meshlet.vertex_count; ++v)
+        {
+            local_vertex_indices[m_vertices[v]] = no_local_index;
+        }
+        AddBounds(mesh, meshlet);
+        m_meshlets.push_back(meshlet);
+    };
+
+    for (Data::Index subset_index = 0U; subset_index < m_mesh_subsets.size(); ++subset_index)
+    {
+        const Mesh::Subset& subset = m_mesh_subsets[subset_index];
+        META_CHECK_ARG_DESCR(subset.indices.count, subset.indices.count % 3 == 0,
+                             "mesh subset indices count should be a multiple of three representing triangles list");
+
+        const Data::Index base_vertex   = subset.indices_adjusted ? 0U : subset.vertices.offset;
+        const auto        first_meshlet = static_cast<Data::Index>(m_meshlets.size());
+        start_meshlet(subset_index);
+
+        for (Data::Index i = subset.indices.offset; i < subset.indices.offset + subset.indices.count; i += 3U)
+        {
+            const std::array<Data::Index, 3> triangle{
+                base_vertex + indices[i],
+                base_vertex + indices[i + 1],
+                base_vertex + indices[i + 2]
+            };
+
+            Data::Size new_vertex_count = 0U;
+            for (Data::Index vertex_index : triangle)
+            {
+                META_CHECK_ARG_LESS_DESCR(vertex_index, mesh_vertex_count, "mesh index at position {} is out of vertex buffer bounds", i);
+                new_vertex_count += local_vertex_indices[vertex_index] == no_local_index ? 1U : 0U;
+            }
+
+            if (meshlet.vertex_count + new_vertex_count > max_vertex_count || meshlet.triangle_count + 1U > max_triangle_count)
+            {
+                finish_meshlet();
+                start_meshlet(subset_index);
+            }
+
+            for (Data::Index vertex_index : triangle)
+            {
+                Data::Index& local_vertex_index = local_vertex_indices[vertex_index];
+                if (local_vertex_index == no_local_index)
+                {
+                    local_vertex_index = meshlet.vertex_count++;
+                    m_vertices.push_back(vertex_index);
+                }
+                m_triangles.push_back(static_cast<uint8_t>(local_vertex_index));
+            }
+            meshlet.triangle_count++;
+        }
+
+        finish_meshlet();
+        m_subset_meshlets.emplace_back(first_meshlet, static_cast<Data::Size>(m_meshlets.size()) - first_meshlet);
+    }
+}
+
+void Meshlets::AddBounds(const Mesh& mesh, const Meshlet& meshlet)
+{
+    META_FUNCTION_TASK();
+    const auto get_position = [this, &mesh, &meshlet](Data::Index local_index)
+    {
+        return mesh.GetVertexPosition(m_vertices[meshlet.vertex_offset + local_index]).AsHlsl();
+    };
+
+    // Bounding sphere is centered in the bounding box of meshlet vertices
+    hlslpp::float3 min_position = get_position(0U);
+    hlslpp::float3 max_position = min_position;
+    for (Data::Index v = 1U; v < meshlet.vertex_count; ++v)
+    {
+        const hlslpp::float3 position = get_position(v);
+        min_position = hlslpp::min(min_position, position);
+        max_position = hlslpp::max(max_position, position);
+    }
+
+    const hlslpp::float3 center = (min_position + max_position) * 0.5F;
+    float radius = 0.F;
+    for (Data::Index v = 0U; v < meshlet.vertex_count; ++v)
+    {
+        radius = std::max(radius, static_cast<float>(hlslpp::length(get_position(v) - center)));
+    }
+
+    // Normal cone axis is an average of triangle normals, cone cutoff is defined by the most deviating normal
+    std::vector<hlslpp::float3> triangle_normals;
+    triangle_normals.reserve(meshlet.triangle_count);
+    hlslpp::float3 normals_sum(0.F, 0.F, 0.F);
+    for (Data::Index t = 0U; t < meshlet.triangle_count; ++t)
+    {
+        const Data::Index    first_index = meshlet.triangle_offset + t * 3U;
+        const hlslpp::float3 p0 = get_position(m_triangles[first_index]);
+        const hlslpp::float3 p1 = get_position(m_triangles[first_index + 1]);
+        const hlslpp::float3 p2 = get_position(m_triangles[first_index + 2]);
+        const hlslpp::float3 normal = hlslpp::cross(p1 - p0, p2 - p0);
+        const auto normal_length = static_cast<float>(hlslpp::length(normal));
+        if (normal_length <= 0.F)
+            continue; // skip degenerate triangles
+
+        triangle_normals.push_back(normal / normal_length);
+        normals_sum += triangle_normals.back();
+    }
+
+    Bounds bounds;
+    bounds.center    = Mesh::Position(center);
+    bounds.radius    = radius;
+    bounds.cone_apex = bounds.center;
+    bounds.cone_axis = Mesh::Normal(0.F, 0.F, 0.F);
+
+    const auto normals_sum_length = static_cast<float>(hlslpp::length(normals_sum));
+    if (normals_sum_length > 0.F)
+    {
+        const hlslpp::float3 axis = normals_sum / normals_sum_length;
+        float min_axis_dot = 1.F;
+        for (const hlslpp::float3& normal : triangle_normals)
+        {
+            min_axis_dot = std::min(min_axis_dot, static_cast<float>(hlslpp::dot(normal, axis)));
+        }
+
+        if (min_axis_dot > g_min_cone_axis_dot)
+        {
+            // Cone apex is moved back along the axis so that the cone contains all triangle planes in front of it
+            float max_apex_offset = 0.F;
+            for (Data::Index t = 0U; t < meshlet.triangle_count; ++t)
+            {
+                const Data::Index    first_index = meshlet.triangle_offset + t * 3U;
+                const hlslpp::float3 p0 = get_position(m_triangles[first_index]);
+                const hlslpp::float3 normal = hlslpp::cross(get_position(m_triangles[first_index + 1]) - p0,
+                                                            get_position(m_triangles[first_index + 2]) - p0);
+                const auto normal_length = static_cast<float>(hlslpp::length(normal));
+                if (normal_length <= 0.F)
+                    continue;
+
+                const hlslpp::float3 unit_normal = normal / normal_length;
+                const auto apex_offset = static_cast<float>(hlslpp::dot(center - p0, unit_normal) / hlslpp::dot(axis, unit_normal));
+                max_apex_offset = std::max(max_apex_offset, apex_offset);
+            }
+
+            bounds.cone_apex   = Mesh::Position(center - axis * max_apex_offset);
+            bounds.cone_axis   = Mesh::Normal(axis);
+            bounds.cone_cutoff = std::sqrt(1.F - min_axis_dot * min_axis_dot);
+        }
+    }
+
+    m_bounds.push_back(bounds);
+}
+
+} // namespace Methane::Graphics
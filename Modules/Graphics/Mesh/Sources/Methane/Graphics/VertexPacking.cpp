@@ -0,0 +1,401 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/VertexPacking.cpp
+Vertex field packing kernels converting float vertex fields to compact encodings,
+vectorized with SSE2, F16C (selected in runtime) or NEON instructions when available.
+
+******************************************************************************/
+
+#include <Methane/Graphics/VertexPacking.h>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define METHANE_VERTEX_PACKING_SSE2
+#include <emmintrin.h>
+#if defined(__x86_64__) || defined(_M_X64) || defined(__F16C__)
+// F16C kernel is compiled for its own target and selected in runtime when it is not enabled for the whole build,
+// so that binaries still run on CPUs without F16C support
+#define METHANE_VERTEX_PACKING_F16C
+#include <immintrin.h>
+#if defined(__F16C__)
+#define METHANE_F16C_TARGET
+#elif defined(_MSC_VER)
+#define METHANE_F16C_TARGET
+#include <intrin.h>
+#else
+#define METHANE_F16C_TARGET __attribute__((target("f16c")))
+#include <cpuid.h>
+#endif
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define METHANE_VERTEX_PACKING_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Methane::Graphics
+{
+
+using Float3 = std::array<float, 3>;
+
+[[nodiscard]]
+static Float3 LoadFloat3(Data::ConstRawPtr src_ptr) noexcept
+{
+    Float3 value{};
+    std::memcpy(value.data(), src_ptr, sizeof(value));
+    return value;
+}
+
+[[nodiscard]]
+static int16_t PackSnorm16(float value) noexcept
+{
+    return static_cast<int16_t>(std::nearbyint(std::clamp(value, -1.F, 1.F) * 32767.F));
+}
+
+[[nodiscard]]
+static uint16_t PackUnorm16(float value) noexcept
+{
+    return static_cast<uint16_t>(std::nearbyint(std::clamp(value, 0.F, 1.F) * 65535.F));
+}
+
+[[nodiscard]]
+static uint8_t PackUnorm8(float value) noexcept
+{
+    return static_cast<uint8_t>(std::nearbyint(std::clamp(value, 0.F, 1.F) * 255.F));
+}
+
+static void PackHalfPosition(Data::ConstRawPtr src_ptr, Data::RawPtr dst_ptr) noexcept
+{
+    const Float3 position = LoadFloat3(src_ptr);
+    const std::array<uint16_t, 4> half_position{ PackHalf(position[0]), PackHalf(position[1]), PackHalf(position[2]), PackHalf(1.F) };
+    std::memcpy(dst_ptr, half_position.data(), sizeof(half_position));
+}
+
+static void PackOctahedralNormal(Data::ConstRawPtr src_ptr, Data::RawPtr dst_ptr) noexcept
+{
+    // Normal is projected on octahedron and its lower hemisphere is folded over diagonals to the upper one
+    const Float3 normal  = LoadFloat3(src_ptr);
+    const float  l1_norm = std::max(std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]), std::numeric_limits<float>::min());
+    float x = normal[0] / l1_norm;
+    float y = normal[1] / l1_norm;
+    if (normal[2] < 0.F)
+    {
+        const float folded_x = std::copysign(1.F - std::abs(y), x);
+        y = std::copysign(1.F - std::abs(x), y);
+        x = folded_x;
+    }
+    const std::array<int16_t, 2> packed_normal{ PackSnorm16(x), PackSnorm16(y) };
+    std::memcpy(dst_ptr, packed_normal.data(), sizeof(packed_normal));
+}
+
+static void PackUnormTexCoord(Data::ConstRawPtr src_ptr, Data::RawPtr dst_ptr) noexcept
+{
+    std::array<float, 2> texcoord{};
+    std::memcpy(texcoord.data(), src_ptr, sizeof(texcoord));
+    const std::array<uint16_t, 2> packed_texcoord{ PackUnorm16(texcoord[0]), PackUnorm16(texcoord[1]) };
+    std::memcpy(dst_ptr, packed_texcoord.data(), sizeof(packed_texcoord));
+}
+
+static void PackUnormColor(Data::ConstRawPtr src_ptr, Data::RawPtr dst_ptr) noexcept
+{
+    const Float3 color = LoadFloat3(src_ptr);
+    const std::array<uint8_t, 4> packed_color{ PackUnorm8(color[0]), PackUnorm8(color[1]), PackUnorm8(color[2]), uint8_t{ 255U } };
+    std::memcpy(dst_ptr, packed_color.data(), sizeof(packed_color));
+}
+
+#ifdef METHANE_VERTEX_PACKING_SSE2
+
+static constexpr size_t g_simd_vertices_count = 4U;
+
+// Loads float3 without reading memory past the field, w component is taken from the given value
+[[nodiscard]]
+static __m128 LoadFloat3(Data::ConstRawPtr src_ptr, __m128 w) noexcept
+{
+    const auto*  src_floats_ptr = reinterpret_cast<const float*>(src_ptr); // NOSONAR
+    const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(src_floats_ptr))); // NOSONAR
+    return _mm_movelh_ps(xy, _mm_unpacklo_ps(_mm_load_ss(src_floats_ptr + 2), w));
+}
+
+[[nodiscard]]
+static __m128 LoadFloat2Pair(Data::ConstRawPtr src_0_ptr, Data::ConstRawPtr src_1_ptr) noexcept
+{
+    const __m128 xy_0 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(src_0_ptr))); // NOSONAR
+    const __m128 xy_1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(src_1_ptr))); // NOSONAR
+    return _mm_movelh_ps(xy_0, xy_1);
+}
+
+// Stores 4 packed 32-bit vertex fields from vector lanes to interleaved vertices
+static void StoreStrided32(__m128i packed_fields, Data::RawPtr dst_ptr, size_t dst_stride) noexcept
+{
+    for(size_t lane_index = 0U; lane_index < g_simd_vertices_count; ++lane_index)
+    {
+        const int32_t packed_field = _mm_cvtsi128_si32(packed_fields);
+        std::memcpy(dst_ptr + lane_index * dst_stride, &packed_field, sizeof(packed_field));
+        packed_fields = _mm_srli_si128(packed_fields, 4);
+    }
+}
+
+#endif // METHANE_VERTEX_PACKING_SSE2
+
+#ifdef METHANE_VERTEX_PACKING_F16C
+
+[[nodiscard]]
+static bool IsF16cSupported() noexcept
+{
+#if defined(__F16C__)
+    return true;
+#elif defined(_MSC_VER)
+    // F16C instructions are VEX encoded, so they also require saving of AVX registers state by operating system
+    std::array<int, 4> cpu_info{};
+    __cpuid(cpu_info.data(), 1);
+    const bool is_f16c_supported = (cpu_info[2] & (1 << 29)) != 0;
+    const bool is_xsave_enabled  = (cpu_info[2] & (1 << 27)) != 0;
+    return is_f16c_supported && is_xsave_enabled && (_xgetbv(0) & 0x6U) == 0x6U;
+#else
+    // F16C instructions are VEX encoded, so they also require operating system support of AVX checked by compiler runtime
+    uint32_t eax = 0U;
+    uint32_t ebx = 0U;
+    uint32_t ecx = 0U;
+    uint32_t edx = 0U;
+    return __builtin_cpu_supports("avx") && __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_F16C) != 0U;
+#endif
+}
+
+// Returns count of packed vertices, which is equal to the vertex count
+METHANE_F16C_TARGET
+static size_t PackHalfPositionsF16c(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept
+{
+    const __m128 w_one = _mm_set1_ps(1.F);
+    for(size_t vertex_index = 0U; vertex_index < vertex_count; ++vertex_index)
+    {
+        const __m128i half_position = _mm_cvtps_ph(LoadFloat3(src_ptr + vertex_index * src_stride, w_one), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst_ptr + vertex_index * dst_stride), half_position); // NOSONAR
+    }
+    return vertex_count;
+}
+
+#endif // METHANE_VERTEX_PACKING_F16C
+
+void PackHalfPositions(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept
+{
+    META_FUNCTION_TASK();
+    size_t vertex_index = 0U;
+
+#if defined(METHANE_VERTEX_PACKING_F16C)
+    static const bool s_is_f16c_supported = IsF16cSupported();
+    if (s_is_f16c_supported)
+        vertex_index = PackHalfPositionsF16c(src_ptr, src_stride, dst_ptr, dst_stride, vertex_count);
+#elif defined(METHANE_VERTEX_PACKING_NEON)
+    for(; vertex_index < vertex_count; ++vertex_index)
+    {
+        const auto*       src_floats_ptr = reinterpret_cast<const float*>(src_ptr + vertex_index * src_stride); // NOSONAR
+        const float32x4_t position       = vcombine_f32(vld1_f32(src_floats_ptr), vset_lane_f32(1.F, vld1_dup_f32(src_floats_ptr + 2), 1));
+        vst1_u16(reinterpret_cast<uint16_t*>(dst_ptr + vertex_index * dst_stride), vreinterpret_u16_f16(vcvt_f16_f32(position))); // NOSONAR
+    }
+#endif
+
+    for(; vertex_index < vertex_count; ++vertex_index)
+    {
+        PackHalfPosition(src_ptr + vertex_index * src_stride, dst_ptr + vertex_index * dst_stride);
+    }
+}
+
+void PackOctahedralNormals(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept
+{
+    META_FUNCTION_TASK();
+    size_t vertex_index = 0U;
+
+#if defined(METHANE_VERTEX_PACKING_SSE2)
+    // 4 normals are transposed to separate component vectors, so that octahedral projection is computed with vertical operations
+    const __m128 zero      = _mm_setzero_ps();
+    const __m128 one       = _mm_set1_ps(1.F);
+    const __m128 abs_mask  = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000U)));
+    const __m128 min_norm  = _mm_set1_ps(std::numeric_limits<float>::min());
+    const __m128 snorm_max = _mm_set1_ps(32767.F);
+    for(; vertex_index + g_simd_vertices_count <= vertex_count; vertex_index += g_simd_vertices_count)
+    {
+        Data::ConstRawPtr src_vertex_ptr = src_ptr + vertex_index * src_stride;
+        __m128 x = LoadFloat3(src_vertex_ptr, zero);
+        __m128 y = LoadFloat3(src_vertex_ptr + src_stride, zero);
+        __m128 z = LoadFloat3(src_vertex_ptr + src_stride * 2U, zero);
+        __m128 w = LoadFloat3(src_vertex_ptr + src_stride * 3U, zero);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        const __m128 l1_norm = _mm_max_ps(_mm_add_ps(_mm_add_ps(_mm_and_ps(x, abs_mask), _mm_and_ps(y, abs_mask)), _mm_and_ps(z, abs_mask)), min_norm);
+        const __m128 oct_x   = _mm_div_ps(x, l1_norm);
+        const __m128 oct_y   = _mm_div_ps(y, l1_norm);
+        const __m128 fold_x  = _mm_or_ps(_mm_sub_ps(one, _mm_and_ps(oct_y, abs_mask)), _mm_and_ps(oct_x, sign_mask));
+        const __m128 fold_y  = _mm_or_ps(_mm_sub_ps(one, _mm_and_ps(oct_x, abs_mask)), _mm_and_ps(oct_y, sign_mask));
+        const __m128 is_fold = _mm_cmplt_ps(z, zero);
+        const __m128 res_x   = _mm_or_ps(_mm_and_ps(is_fold, fold_x), _mm_andnot_ps(is_fold, oct_x));
+        const __m128 res_y   = _mm_or_ps(_mm_and_ps(is_fold, fold_y), _mm_andnot_ps(is_fold, oct_y));
+
+        // Packed components [x0..x3, y0..y3] are interleaved to [x0, y0, .. x3, y3]
+        const __m128i packed_xy = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(res_x, snorm_max)), _mm_cvtps_epi32(_mm_mul_ps(res_y, snorm_max)));
+        StoreStrided32(_mm_unpacklo_epi16(packed_xy, _mm_srli_si128(packed_xy, 8)), dst_ptr + vertex_index * dst_stride, dst_stride);
+    }
+#endif
+
+    for(; vertex_index < vertex_count; ++vertex_index)
+    {
+        PackOctahedralNormal(src_ptr + vertex_index * src_stride, dst_ptr + vertex_index * dst_stride);
+    }
+}
+
+void PackUnormTexCoords(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept
+{
+    META_FUNCTION_TASK();
+    size_t vertex_index = 0U;
+
+#if defined(METHANE_VERTEX_PACKING_SSE2)
+    // Unsigned saturation of 32-bit integers is emulated with signed saturation of values biased to signed range
+    const __m128  zero        = _mm_setzero_ps();
+    const __m128  one         = _mm_set1_ps(1.F);
+    const __m128  unorm_max   = _mm_set1_ps(65535.F);
+    const __m128i bias_32     = _mm_set1_epi32(32768);
+    const __m128i bias_16     = _mm_set1_epi16(static_cast<int16_t>(0x8000U));
+    for(; vertex_index + g_simd_vertices_count <= vertex_count; vertex_index += g_simd_vertices_count)
+    {
+        Data::ConstRawPtr src_vertex_ptr = src_ptr + vertex_index * src_stride;
+        const __m128 uv_01 = LoadFloat2Pair(src_vertex_ptr, src_vertex_ptr + src_stride);
+        const __m128 uv_23 = LoadFloat2Pair(src_vertex_ptr + src_stride * 2U, src_vertex_ptr + src_stride * 3U);
+        const __m128i unorm_01 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(uv_01, zero), one), unorm_max));
+        const __m128i unorm_23 = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(uv_23, zero), one), unorm_max));
+        const __m128i packed_uv = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(unorm_01, bias_32), _mm_sub_epi32(unorm_23, bias_32)), bias_16);
+        StoreStrided32(packed_uv, dst_ptr + vertex_index * dst_stride, dst_stride);
+    }
+#endif
+
+    for(; vertex_index < vertex_count; ++vertex_index)
+    {
+        PackUnormTexCoord(src_ptr + vertex_index * src_stride, dst_ptr + vertex_index * dst_stride);
+    }
+}
+
+void PackUnormColors(Data::ConstRawPtr src_ptr, size_t src_stride, Data::RawPtr dst_ptr, size_t dst_stride, size_t vertex_count) noexcept
+{
+    META_FUNCTION_TASK();
+    size_t vertex_index = 0U;
+
+#if defined(METHANE_VERTEX_PACKING_SSE2)
+    // Alpha is loaded as 1.0 in w component, so that all 4 channels are converted uniformly
+    const __m128 zero      = _mm_setzero_ps();
+    const __m128 one       = _mm_set1_ps(1.F);
+    const __m128 unorm_max = _mm_set1_ps(255.F);
+    for(; vertex_index + g_simd_vertices_count <= vertex_count; vertex_index += g_simd_vertices_count)
+    {
+        __m128i colors[g_simd_vertices_count]; // NOSONAR - std::array ignores attributes of vector types
+        for(size_t lane_index = 0U; lane_index < g_simd_vertices_count; ++lane_index)
+        {
+            const __m128 color = LoadFloat3(src_ptr + (vertex_index + lane_index) * src_stride, one);
+            colors[lane_index] = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(color, zero), one), unorm_max));
+        }
+        const __m128i packed_colors = _mm_packus_epi16(_mm_packs_epi32(colors[0], colors[1]), _mm_packs_epi32(colors[2], colors[3]));
+        StoreStrided32(packed_colors, dst_ptr + vertex_index * dst_stride, dst_stride);
+    }
+#endif
+
+    for(; vertex_index < vertex_count; ++vertex_index)
+    {
+        PackUnormColor(src_ptr + vertex_index * src_stride, dst_ptr + vertex_index * dst_stride);
+    }
+}
+
+uint16_t PackHalf(float value) noexcept
+{
+    uint32_t float_bits = 0U;
+    std::memcpy(&float_bits, &value, sizeof(float_bits));
+    const auto     sign     = static_cast<uint16_t>((float_bits >> 16U) & 0x8000U);
+    const uint32_t abs_bits = float_bits & 0x7FFFFFFFU;
+
+    if (abs_bits >= 0x7F800000U) // infinity or NaN
+        return static_cast<uint16_t>(sign | 0x7C00U | (abs_bits > 0x7F800000U ? 0x200U : 0U));
+
+    if (abs_bits >= 0x477FF000U) // values rounded above maximum half 65504 overflow to infinity
+        return static_cast<uint16_t>(sign | 0x7C00U);
+
+    // Mantissa is rounded to nearest even value in both denormal and normal half ranges
+    uint32_t half_bits = 0U;
+    uint32_t remainder = 0U;
+    uint32_t halfway   = 0U;
+    if (abs_bits < 0x38800000U) // denormal half values below 2^-14
+    {
+        if (abs_bits < 0x33000000U) // values below 2^-25 are rounded to zero
+            return sign;
+
+        const uint32_t shift    = 126U - (abs_bits >> 23U);
+        const uint32_t mantissa = (abs_bits & 0x7FFFFFU) | 0x800000U;
+        half_bits = mantissa >> shift;
+        remainder = mantissa & ((1U << shift) - 1U);
+        halfway   = 1U << (shift - 1U);
+    }
+    else
+    {
+        half_bits = (abs_bits - 0x38000000U) >> 13U;
+        remainder = abs_bits & 0x1FFFU;
+        halfway   = 0x1000U;
+    }
+
+    if (remainder > halfway || (remainder == halfway && (half_bits & 1U)))
+        half_bits++;
+
+    return static_cast<uint16_t>(sign | half_bits);
+}
+
+float UnpackHalf(uint16_t half_value) noexcept
+{
+    const uint32_t sign     = static_cast<uint32_t>(half_value & 0x8000U) << 16U;
+    const uint32_t exponent = (half_value >> 10U) & 0x1FU;
+    const uint32_t mantissa = half_value & 0x3FFU;
+
+    uint32_t float_bits = sign;
+    if (exponent == 0x1FU)
+        float_bits |= 0x7F800000U | (mantissa << 13U);
+    else if (exponent)
+        float_bits |= ((exponent + 112U) << 23U) | (mantissa << 13U);
+    else if (mantissa)
+        return std::copysign(std::ldexp(static_cast<float>(mantissa), -24), sign ? -1.F : 1.F);
+
+    float value = 0.F;
+    std::memcpy(&value, &float_bits, sizeof(value));
+    return value;
+}
+
+Data::RawVector3F UnpackOctahedralNormal(int16_t x, int16_t y) noexcept
+{
+    float oct_x = std::max(static_cast<float>(x) / 32767.F, -1.F);
+    float oct_y = std::max(static_cast<float>(y) / 32767.F, -1.F);
+    const float oct_z = 1.F - std::abs(oct_x) - std::abs(oct_y);
+    if (oct_z < 0.F)
+    {
+        const float unfolded_x = std::copysign(1.F - std::abs(oct_y), oct_x);
+        oct_y = std::copysign(1.F - std::abs(oct_x), oct_y);
+        oct_x = unfolded_x;
+    }
+    const float length = std::sqrt(oct_x * oct_x + oct_y * oct_y + oct_z * oct_z);
+    return Data::RawVector3F(oct_x / length, oct_y / length, oct_z / length);
+}
+
+} // namespace Methane::Graphics
@@ -31,6 +31,13 @@ by decoding them from popular image formats.
 
 #include <string>
 #include <array>
+#include <vector>
+
+namespace tf
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
 
 namespace Methane::Graphics
 {
@@ -54,6 +61,38 @@ private:
     const bool  m_pixels_release_required;
 };
 
+// Image data of KTX2 container with prebuilt MIP levels, which are referenced by texture sub-resources without copy
+class Ktx2ImageData // NOSONAR
+{
+public:
+    explicit Ktx2ImageData(Data::Chunk&& data);
+    Ktx2ImageData(Ktx2ImageData&& other) noexcept = default;
+    Ktx2ImageData(const Ktx2ImageData& other) = delete;
+
+    [[nodiscard]] static bool IsKtx2Data(const Data::Chunk& data) noexcept;
+
+    // Serializes tightly packed MIP levels of 2D image in RGBA8 pixel format to KTX2 container data
+    [[nodiscard]] static Data::Bytes Write(PixelFormat pixel_format, const Dimensions& dimensions, const std::vector<Data::Bytes>& mip_levels);
+
+    [[nodiscard]] PixelFormat              GetPixelFormat() const noexcept     { return m_pixel_format; }
+    [[nodiscard]] const Dimensions&        GetDimensions() const noexcept      { return m_dimensions; }
+    [[nodiscard]] uint32_t                 GetArrayLength() const noexcept     { return m_array_length; }
+    [[nodiscard]] bool                     IsArray() const noexcept            { return m_is_array; }
+    [[nodiscard]] bool                     IsCube() const noexcept             { return m_is_cube; }
+    [[nodiscard]] uint32_t                 GetMipLevelsCount() const noexcept  { return m_mip_levels_count; }
+    [[nodiscard]] const Rhi::SubResources& GetSubResources() const noexcept    { return m_sub_resources; }
+
+private:
+    Data::Chunk       m_data;
+    PixelFormat       m_pixel_format = PixelFormat::Unknown;
+    Dimensions        m_dimensions;
+    uint32_t          m_array_length = 1U;
+    bool              m_is_array = false;
+    bool              m_is_cube = false;
+    uint32_t          m_mip_levels_count = 1U;
+    Rhi::SubResources m_sub_resources;
+};
+
 enum class ImageOption : uint32_t
 {
     Mipmapped,
@@ -82,13 +121,38 @@ public:
 
     using CubeFaceResources = std::array<std::string, static_cast<size_t>(CubeFace::Count)>;
 
+    struct ImageInfo
+    {
+        Dimensions dimensions;
+        uint32_t   channels_count = 0U;
+    };
+
+    static constexpr Data::Size g_rgba8_pixel_size = 4U;
+
     explicit ImageLoader(Data::IProvider& data_provider);
 
-    [[nodiscard]] ImageData    LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const;
+    [[nodiscard]] ImageInfo     GetImageInfo(const std::string& image_path) const;
+    [[nodiscard]] ImageData     LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const;
+    [[nodiscard]] Ktx2ImageData LoadKtx2ImageData(const std::string& image_path) const;
+
+    // Decodes image to tightly packed RGBA8 pixels in preallocated memory without intermediate copies,
+    // expansion of decoded RGB rows to RGBA is split in tiles of rows between executor workers
+    void DecodeImageToRgba8(const std::string& image_path, Data::Byte* target_pixels_ptr, Data::Size target_pixels_size,
+                            tf::Executor* parallel_executor_ptr = nullptr) const;
+
+    // Images with '.ktx2' extension are loaded with all prebuilt MIP levels in original pixel format
     [[nodiscard]] Rhi::Texture LoadImageToTexture2D(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path, ImageOptionMask options = {}, const std::string& texture_name = "") const;
     [[nodiscard]] Rhi::Texture LoadImagesToTextureCube(const Rhi::CommandQueue& target_cmd_queue, const CubeFaceResources& image_paths, ImageOptionMask options = {}, const std::string& texture_name = "") const;
+    [[nodiscard]] Rhi::Texture LoadKtx2ImageToTexture(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path, ImageOptionMask options = {}, const std::string& texture_name = "") const;
 
 private:
+    [[nodiscard]] static ImageInfo GetImageInfo(const std::string& image_path, const Data::Chunk& raw_image_data);
+    [[nodiscard]] static ImageData LoadImageData(const std::string& image_path, const Data::Chunk& raw_image_data,
+                                                 Data::Size channels_count, bool create_copy);
+    static void DecodeImageToRgba8(const std::string& image_path, const Data::Chunk& raw_image_data,
+                                   Data::Byte* target_pixels_ptr, Data::Size target_pixels_size,
+                                   tf::Executor* parallel_executor_ptr);
+
     Data::IProvider& m_data_provider;
 };
 
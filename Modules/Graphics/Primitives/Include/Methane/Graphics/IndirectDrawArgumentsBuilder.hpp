@@ -0,0 +1,170 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/IndirectDrawArgumentsBuilder.hpp
+Builder of indirect draw arguments from visible instance indices of culling results,
+merging consecutive instances in one draw, filled in parallel chunks.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/FrustumCuller.h>
+#include <Methane/Graphics/RHI/IRenderCommandList.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Data/ParallelFor.hpp>
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/taskflow.hpp>
+#include <type_traits>
+#include <numeric>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+template<typename DrawArgumentsType>
+class IndirectDrawArgumentsBuilder
+{
+    static_assert(std::is_same_v<DrawArgumentsType, Rhi::DrawIndirectArguments> ||
+                  std::is_same_v<DrawArgumentsType, Rhi::DrawIndexedIndirectArguments>,
+                  "indirect draw arguments builder supports only Rhi::DrawIndirectArguments and Rhi::DrawIndexedIndirectArguments types");
+
+public:
+    using Arguments = std::vector<DrawArgumentsType>;
+
+    static constexpr Data::Size g_default_chunk_size = 4096U;
+
+    // Instance draw arguments are used as a template of each draw, where instance_count and start_instance are overridden.
+    // Visible indices are split in chunks processed in parallel with the given executor, when their count exceeds one chunk size.
+    explicit IndirectDrawArgumentsBuilder(const DrawArgumentsType& instance_draw_arguments, tf::Executor* parallel_executor_ptr = nullptr,
+                                          Data::Size chunk_size = g_default_chunk_size)
+        : m_instance_draw_arguments(instance_draw_arguments)
+        , m_parallel_executor_ptr(parallel_executor_ptr)
+        , m_chunk_size(chunk_size)
+    {
+        META_CHECK_ARG_NOT_ZERO(chunk_size);
+    }
+
+    [[nodiscard]] const Arguments& GetArguments() const noexcept { return m_arguments; }
+    [[nodiscard]] uint32_t         GetDrawCount() const noexcept { return static_cast<uint32_t>(m_arguments.size()); }
+
+    // Builds one instanced draw for each range of consecutive instance indices from the visible indices sorted in ascending order,
+    // so that start_instance is the first instance index in range and instance_count is the range length
+    const Arguments& Build(const VisibleIndices& visible_instances)
+    {
+        META_FUNCTION_TASK();
+        const auto visible_count = static_cast<Data::Size>(visible_instances.size());
+        if (!m_parallel_executor_ptr || visible_count <= m_chunk_size)
+        {
+            m_arguments.resize(CountRanges(visible_instances, 0U, visible_count));
+            WriteRanges(visible_instances, 0U, visible_count, 0U);
+            return m_arguments;
+        }
+
+        // Ranges are counted per chunk first to get the output offset of each chunk, then written in parallel;
+        // range crossing the chunk boundary belongs to the chunk where it begins
+        const Data::Size chunks_count = (visible_count + m_chunk_size - 1U) / m_chunk_size;
+        m_chunk_offsets.resize(chunks_count + 1U);
+        m_chunk_offsets[0] = 0U;
+        Data::ParallelFor(*m_parallel_executor_ptr, 0U, chunks_count,
+            [this, &visible_instances, visible_count](const Data::Index chunk_index)
+            {
+                const Data::Index begin_index = chunk_index * m_chunk_size;
+                m_chunk_offsets[chunk_index + 1U] = CountRanges(visible_instances, begin_index, std::min(begin_index + m_chunk_size, visible_count));
+            });
+
+        std::partial_sum(m_chunk_offsets.begin(), m_chunk_offsets.end(), m_chunk_offsets.begin());
+        m_arguments.resize(m_chunk_offsets.back());
+
+        Data::ParallelFor(*m_parallel_executor_ptr, 0U, chunks_count,
+            [this, &visible_instances, visible_count](const Data::Index chunk_index)
+            {
+                const Data::Index begin_index = chunk_index * m_chunk_size;
+                WriteRanges(visible_instances, begin_index, std::min(begin_index + m_chunk_size, visible_count), m_chunk_offsets[chunk_index]);
+            });
+        return m_arguments;
+    }
+
+    // Uploads built arguments to the indirect arguments buffer and draw count to the optional draw count buffer
+    void SetData(const Rhi::Buffer& arguments_buffer, const Rhi::Buffer* draw_count_buffer_ptr, const Rhi::CommandQueue& target_cmd_queue) const
+    {
+        META_FUNCTION_TASK();
+        if (!m_arguments.empty())
+        {
+            arguments_buffer.SetData({
+                Rhi::SubResource(reinterpret_cast<Data::ConstRawPtr>(m_arguments.data()), // NOSONAR
+                                 static_cast<Data::Size>(sizeof(DrawArgumentsType) * m_arguments.size()))
+            }, target_cmd_queue);
+        }
+
+        if (!draw_count_buffer_ptr)
+            return;
+
+        const uint32_t draw_count = GetDrawCount();
+        draw_count_buffer_ptr->SetData({
+            Rhi::SubResource(reinterpret_cast<Data::ConstRawPtr>(&draw_count), static_cast<Data::Size>(sizeof(draw_count))) // NOSONAR
+        }, target_cmd_queue);
+    }
+
+private:
+    static bool IsRangeBegin(const VisibleIndices& visible_instances, Data::Index visible_index) noexcept
+    {
+        return !visible_index || visible_instances[visible_index] != visible_instances[visible_index - 1U] + 1U;
+    }
+
+    static Data::Size CountRanges(const VisibleIndices& visible_instances, Data::Index begin_index, Data::Index end_index) noexcept
+    {
+        Data::Size ranges_count = 0U;
+        for(Data::Index visible_index = begin_index; visible_index < end_index; ++visible_index)
+        {
+            if (IsRangeBegin(visible_instances, visible_index))
+                ++ranges_count;
+        }
+        return ranges_count;
+    }
+
+    void WriteRanges(const VisibleIndices& visible_instances, Data::Index begin_index, Data::Index end_index, Data::Index arguments_offset) noexcept
+    {
+        const auto visible_count = static_cast<Data::Index>(visible_instances.size());
+        for(Data::Index range_begin = begin_index; range_begin < end_index; ++range_begin)
+        {
+            if (!IsRangeBegin(visible_instances, range_begin))
+                continue;
+
+            Data::Index range_end = range_begin + 1U;
+            while (range_end < visible_count && !IsRangeBegin(visible_instances, range_end))
+                ++range_end;
+
+            DrawArgumentsType& draw_arguments = m_arguments[arguments_offset++];
+            draw_arguments = m_instance_draw_arguments;
+            draw_arguments.instance_count = range_end - range_begin;
+            draw_arguments.start_instance = visible_instances[range_begin];
+        }
+    }
+
+    const DrawArgumentsType m_instance_draw_arguments;
+    tf::Executor*           m_parallel_executor_ptr;
+    const Data::Size        m_chunk_size;
+    Arguments               m_arguments;
+    std::vector<Data::Size> m_chunk_offsets;
+};
+
+} // namespace Methane::Graphics
@@ -49,18 +49,20 @@ private:
     Rhi::SubResources m_final_pass_instance_uniforms_subresources;
 
 public:
-    template<typename VertexType>
-    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VertexType>& mesh_data,
-                std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = Mesh::Subsets())
-        : MeshBuffersBase(render_cmd_queue, mesh_data, mesh_name, mesh_subsets)
+    template<typename VertexType, typename IndexType>
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VertexType, IndexType>& mesh_data,
+                std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = Mesh::Subsets(), bool optimize_mesh = false,
+                Mesh::VertexFieldMask packed_vertex_fields = {})
+        : MeshBuffersBase(render_cmd_queue, mesh_data, mesh_name, mesh_subsets, optimize_mesh, packed_vertex_fields)
     {
         META_FUNCTION_TASK();
         SetInstanceCount(GetSubsetsCount());
     }
 
-    template<typename VertexType>
-    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType>& uber_mesh_data, std::string_view mesh_name)
-        : MeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets())
+    template<typename VertexType, typename IndexType>
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType, IndexType>& uber_mesh_data, std::string_view mesh_name,
+                bool optimize_mesh = false, Mesh::VertexFieldMask packed_vertex_fields = {})
+        : MeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets(), optimize_mesh, packed_vertex_fields)
     { }
 
     [[nodiscard]] Data::Size GetInstanceCount() const noexcept
@@ -88,6 +90,12 @@ public:
         m_final_pass_instance_uniforms[instance_index] = std::move(uniforms);
     }
 
+    // Uniforms of all instances are contiguous with 'sizeof(UniformsType)' stride, which allows batch updates without per-instance checks
+    [[nodiscard]] UniformsType* GetFinalPassUniformsData() noexcept
+    {
+        return m_final_pass_instance_uniforms.data();
+    }
+
     [[nodiscard]]
     static constexpr Data::Size GetAlignedUniformSize() noexcept
     {
@@ -137,17 +145,19 @@ private:
     Textures m_subset_textures;
 
 public:
-    template<typename VType>
-    TexturedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VType>& mesh_data, const std::string& mesh_name)
-        : MeshBuffers<UniformsType>(render_cmd_queue, mesh_data, mesh_name)
+    template<typename VType, typename IType>
+    TexturedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VType, IType>& mesh_data, const std::string& mesh_name,
+                        bool optimize_mesh = false, Mesh::VertexFieldMask packed_vertex_fields = {})
+        : MeshBuffers<UniformsType>(render_cmd_queue, mesh_data, mesh_name, Mesh::Subsets(), optimize_mesh, packed_vertex_fields)
     {
         META_FUNCTION_TASK();
         m_subset_textures.resize(1);
     }
 
-    template<typename VType>
-    TexturedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VType>& uber_mesh_data, const std::string& mesh_name)
-        : MeshBuffers<UniformsType>(render_cmd_queue, uber_mesh_data, mesh_name)
+    template<typename VType, typename IType>
+    TexturedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VType, IType>& uber_mesh_data, const std::string& mesh_name,
+                        bool optimize_mesh = false, Mesh::VertexFieldMask packed_vertex_fields = {})
+        : MeshBuffers<UniformsType>(render_cmd_queue, uber_mesh_data, mesh_name, optimize_mesh, packed_vertex_fields)
     {
         META_FUNCTION_TASK();
         m_subset_textures.resize(MeshBuffers<UniformsType>::GetSubsetsCount());
@@ -29,6 +29,7 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/MeshOptimizer.h>
 
 #include <vector>
 #include <string>
@@ -59,9 +60,13 @@ class MeshBuffersBase
 {
 public:
     using ProgramBindingsIteratorType = std::vector<Rhi::ProgramBindings>::const_iterator;
+    using InstanceIndices = std::vector<Data::Index>;
 
+    // Optimized mesh has triangles reordered for vertex cache and vertices reordered for fetch locality in each subset,
+    // packed vertex fields are uploaded to vertex buffer with layout returned by Mesh::VertexLayout::GetPackedLayout
     MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
-                    std::string_view mesh_name, const Mesh::Subsets& mesh_subsets);
+                    std::string_view mesh_name, const Mesh::Subsets& mesh_subsets,
+                    bool optimize_mesh = false, Mesh::VertexFieldMask packed_vertex_fields = {});
 
     virtual ~MeshBuffersBase() = default;
 
@@ -71,6 +76,10 @@ public:
     [[nodiscard]] const Rhi::BufferSet& GetVertexBuffers() const noexcept  { return m_vertex_buffer_set; }
     [[nodiscard]] const Rhi::Buffer&    GetIndexBuffer() const noexcept    { return m_index_buffer; }
 
+    // Vertex cache statistics of the mesh before and after optimization, both are empty when mesh was not optimized
+    [[nodiscard]] const VertexCacheStatistics& GetInitialVertexCacheStatistics() const noexcept   { return m_initial_vertex_cache_stats; }
+    [[nodiscard]] const VertexCacheStatistics& GetOptimizedVertexCacheStatistics() const noexcept { return m_optimized_vertex_cache_stats; }
+
     Rhi::ResourceBarriers CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr = nullptr) const;
 
     void Draw(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
@@ -86,8 +95,21 @@ public:
               Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
               uint32_t first_instance_index = 0U, bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    // Draws only instances from the list of indices, for example visible instances produced by FrustumCuller
+    void Draw(const Rhi::RenderCommandList& cmd_list,
+              const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+              const Data::Index* instance_indices_begin, const Data::Index* instance_indices_end,
+              Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+              bool retain_bindings_once = false, bool set_resource_barriers = true) const;
+
+    void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
+                      const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                      Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                      bool retain_bindings_once = false, bool set_resource_barriers = true) const;
+
     void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
                       const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                      const InstanceIndices& instance_indices,
                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
                       bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
@@ -96,11 +118,13 @@ protected:
     virtual Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const { return instance_index; }
 
 private:
-    const Rhi::IContext& m_context;
-    const std::string    m_mesh_name;
-    const Mesh::Subsets  m_mesh_subsets;
-    Rhi::BufferSet       m_vertex_buffer_set;
-    Rhi::Buffer          m_index_buffer;
+    const Rhi::IContext&  m_context;
+    const std::string     m_mesh_name;
+    const Mesh::Subsets   m_mesh_subsets;
+    Rhi::BufferSet        m_vertex_buffer_set;
+    Rhi::Buffer           m_index_buffer;
+    VertexCacheStatistics m_initial_vertex_cache_stats;
+    VertexCacheStatistics m_optimized_vertex_cache_stats;
 };
 
 } // namespace Methane::Graphics
\ No newline at end of file
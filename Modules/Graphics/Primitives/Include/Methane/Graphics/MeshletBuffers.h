@@ -0,0 +1,70 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshletBuffers.h
+Mesh buffers with indices reordered by meshlets and cluster bounding volumes
+used for CPU frustum and backface culling of meshlets before drawing.
+
+******************************************************************************/
+
+#pragma once
+
+#include "MeshBuffersBase.h"
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/FrustumCuller.h>
+
+namespace Methane::Graphics
+{
+
+class MeshletBuffers
+    : public MeshBuffersBase
+{
+public:
+    // Mesh subsets are split into meshlets, each mesh subset is still drawable with MeshBuffersBase::Draw
+    MeshletBuffers(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
+                   std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = {});
+
+    template<typename VertexType, typename IndexType>
+    MeshletBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType, IndexType>& uber_mesh_data, std::string_view mesh_name)
+        : MeshletBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets())
+    { }
+
+    [[nodiscard]] const Meshlets&        GetMeshlets() const noexcept        { return m_meshlets; }
+    [[nodiscard]] const BoundingSpheres& GetBoundingSpheres() const noexcept { return m_bounding_spheres; }
+    [[nodiscard]] const BoundingCones&   GetBoundingCones() const noexcept   { return m_bounding_cones; }
+
+    // Meshlet bounds are in mesh object space, so the frustum culler should be created from model-view-projection matrix
+    // and view position should be transformed to object space with inverse model matrix
+    void Cull(const FrustumCuller& frustum_culler, const hlslpp::float3& view_position, VisibleIndices& visible_meshlets,
+              tf::Executor* parallel_executor_ptr = nullptr) const;
+
+    // Draws visible meshlets, merging consecutive meshlets in one draw call, and returns the count of issued draw calls
+    uint32_t DrawMeshlets(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                          const VisibleIndices& visible_meshlets, uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+
+private:
+    MeshletBuffers(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
+                   std::string_view mesh_name, Meshlets&& meshlets);
+
+    const Meshlets  m_meshlets;
+    BoundingSpheres m_bounding_spheres;
+    BoundingCones   m_bounding_cones;
+};
+
+} // namespace Methane::Graphics
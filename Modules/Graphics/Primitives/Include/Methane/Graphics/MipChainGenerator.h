@@ -0,0 +1,78 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MipChainGenerator.h
+CPU generator of full MIP chain for RGBA8 images used for offline baking of textures,
+filtering pixels in linear color space with SIMD vectors.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Volume.hpp>
+#include <Methane/Data/Chunk.hpp>
+
+#include <vector>
+
+namespace tf
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+enum class MipFilter : uint32_t
+{
+    Box,    // average of 2x2 pixels
+    Kaiser, // Kaiser-windowed sinc: sharper than box with less aliasing
+};
+
+class MipChainGenerator
+{
+public:
+    struct Settings
+    {
+        MipFilter filter           = MipFilter::Kaiser;
+        bool      srgb_color_space = true; // color channels are decoded from sRGB before filtering and encoded back after
+    };
+
+    using MipLevels = std::vector<Data::Bytes>;
+
+    static constexpr Data::Size g_pixel_size = 4U;
+
+    // Rows of each MIP level are filtered in parallel with the given executor
+    explicit MipChainGenerator(const Settings& settings, tf::Executor* parallel_executor_ptr = nullptr);
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+
+    [[nodiscard]] static uint32_t GetMipLevelsCount(const Dimensions& base_dimensions);
+
+    // Returns tightly packed RGBA8 pixels of all MIP levels down to 1x1 size, starting from the copy of base level
+    [[nodiscard]] MipLevels Generate(const Dimensions& base_dimensions, const Data::Chunk& base_pixels) const;
+
+private:
+    template<typename RowFuncType>
+    void ForEachRow(uint32_t rows_count, const RowFuncType& row_func) const;
+
+    Settings      m_settings;
+    tf::Executor* m_parallel_executor_ptr;
+};
+
+} // namespace Methane::Graphics
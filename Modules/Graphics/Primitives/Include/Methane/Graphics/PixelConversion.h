@@ -0,0 +1,42 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/PixelConversion.h
+Pixel format conversion kernels used in image decoding pipeline,
+vectorized with SSSE3 (selected in runtime) or NEON instructions when available.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+namespace Methane::Graphics
+{
+
+// Expands tightly packed RGB8 pixels to RGBA8 pixels with opaque alpha, source and target memory must not overlap
+void ExpandRgbToRgba(const Data::Byte* rgb_pixels_ptr, Data::Byte* rgba_pixels_ptr, size_t pixels_count) noexcept;
+
+// Converts RGBA8 pixels with sRGB encoded color channels to RGBA pixels of 32-bit floats in linear color space,
+// while alpha channel is always linear
+void ConvertSrgbToLinear(const Data::Byte* srgb_pixels_ptr, float* linear_pixels_ptr, size_t pixels_count) noexcept;
+
+// Converts RGBA8 pixels with unorm channels to RGBA pixels of 32-bit floats without color space conversion
+void ConvertUnormToFloat(const Data::Byte* unorm_pixels_ptr, float* float_pixels_ptr, size_t pixels_count) noexcept;
+
+} // namespace Methane::Graphics
@@ -24,7 +24,11 @@ Methane graphics extensions: all headers under one umbrella.
 #pragma once
 
 #include "ImageLoader.h"
+#include "MipChainGenerator.h"
+#include "PixelConversion.h"
 #include "MeshBuffers.hpp"
+#include "MeshletBuffers.h"
+#include "IndirectDrawArgumentsBuilder.hpp"
 #include "SkyBox.h"
 #include "ScreenQuad.h"
 #include "ScreenQuad.h"
\ No newline at end of file
@@ -23,16 +23,23 @@ by decoding them from popular image formats.
 ******************************************************************************/
 
 #include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/PixelConversion.h>
 #include <Methane/Graphics/TypeFormatters.hpp>
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/IContext.h>
 #include <Methane/Platform/Utils.h>
 #include <Methane/Data/Math.hpp>
+#include <Methane/Data/ParallelFor.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <taskflow/taskflow.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <memory>
+
 #ifdef USE_OPEN_IMAGE_IO
 
 #include <OpenImageIO/imagebuf.h>
@@ -55,6 +62,222 @@ static PixelFormat GetDefaultImageFormat(bool srgb)
     return srgb ? PixelFormat::RGBA8Unorm_sRGB : PixelFormat::RGBA8Unorm;
 }
 
+// Decoded image rows are converted to RGBA8 pixels in tiles processed in parallel
+static constexpr uint32_t g_decoded_rows_tile_size = 32U;
+
+// KTX2 file layout is described in specification: https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+static constexpr std::array<uint8_t, 12> g_ktx2_identifier{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+struct Ktx2Header
+{
+    uint32_t vk_format;
+    uint32_t type_size;
+    uint32_t pixel_width;
+    uint32_t pixel_height;
+    uint32_t pixel_depth;
+    uint32_t layer_count;
+    uint32_t face_count;
+    uint32_t level_count;
+    uint32_t supercompression_scheme;
+    uint32_t dfd_byte_offset;
+    uint32_t dfd_byte_length;
+    uint32_t kvd_byte_offset;
+    uint32_t kvd_byte_length;
+    std::array<uint32_t, 2> sgd_byte_offset; // 64-bit values are split to avoid structure padding after 32-bit fields
+    std::array<uint32_t, 2> sgd_byte_length;
+};
+
+struct Ktx2LevelIndex
+{
+    uint64_t byte_offset;
+    uint64_t byte_length;
+    uint64_t uncompressed_byte_length;
+};
+
+static_assert(sizeof(Ktx2Header) == 68U);
+static_assert(sizeof(Ktx2LevelIndex) == 24U);
+
+[[nodiscard]]
+static PixelFormat GetPixelFormatFromVulkanFormat(uint32_t vk_format)
+{
+    META_FUNCTION_TASK();
+    // Values of VkFormat enumeration from Vulkan specification
+    switch(vk_format)
+    {
+    case 9U:   return PixelFormat::R8Unorm;
+    case 37U:  return PixelFormat::RGBA8Unorm;
+    case 43U:  return PixelFormat::RGBA8Unorm_sRGB;
+    case 44U:  return PixelFormat::BGRA8Unorm;
+    case 50U:  return PixelFormat::BGRA8Unorm_sRGB;
+    case 76U:  return PixelFormat::R16Float;
+    case 100U: return PixelFormat::R32Float;
+    case 133U: return PixelFormat::BC1Unorm;
+    case 134U: return PixelFormat::BC1Unorm_sRGB;
+    case 137U: return PixelFormat::BC3Unorm;
+    case 138U: return PixelFormat::BC3Unorm_sRGB;
+    case 139U: return PixelFormat::BC4Unorm;
+    case 140U: return PixelFormat::BC4Snorm;
+    case 141U: return PixelFormat::BC5Unorm;
+    case 142U: return PixelFormat::BC5Snorm;
+    case 145U: return PixelFormat::BC7Unorm;
+    case 146U: return PixelFormat::BC7Unorm_sRGB;
+    case 157U: return PixelFormat::ASTC4x4Unorm;
+    case 158U: return PixelFormat::ASTC4x4Unorm_sRGB;
+    case 165U: return PixelFormat::ASTC6x6Unorm;
+    case 166U: return PixelFormat::ASTC6x6Unorm_sRGB;
+    case 171U: return PixelFormat::ASTC8x8Unorm;
+    case 172U: return PixelFormat::ASTC8x8Unorm_sRGB;
+    default:   META_UNEXPECTED_ARG_DESCR_RETURN(vk_format, PixelFormat::Unknown, "KTX2 image has unsupported Vulkan format");
+    }
+}
+
+[[nodiscard]]
+static uint32_t GetFullMipLevelsCount(const Dimensions& dimensions)
+{
+    return 1U + static_cast<uint32_t>(std::floor(std::log2(static_cast<double>(std::max(dimensions.GetWidth(), dimensions.GetHeight())))));
+}
+
+Ktx2ImageData::Ktx2ImageData(Data::Chunk&& data)
+    : m_data(std::move(data))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(IsKtx2Data(m_data), "data does not contain KTX2 image identifier");
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_data.GetDataSize(), g_ktx2_identifier.size() + sizeof(Ktx2Header), "KTX2 image data is too small");
+
+    const Data::Byte* const data_ptr = m_data.GetDataPtr();
+    const Data::Size        data_size = m_data.GetDataSize();
+
+    Ktx2Header header{};
+    std::memcpy(&header, data_ptr + g_ktx2_identifier.size(), sizeof(Ktx2Header));
+    META_CHECK_ARG_EQUAL_DESCR(header.supercompression_scheme, 0U, "KTX2 images with supercompression are not supported");
+    META_CHECK_ARG_NOT_ZERO_DESCR(header.pixel_width, "KTX2 image width can not be zero");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(header.pixel_depth, 1U, "KTX2 images with 3D dimensions are not supported");
+    META_CHECK_ARG_DESCR(header.face_count, header.face_count == 1U || header.face_count == 6U, "KTX2 image faces count must be 1 or 6");
+
+    m_pixel_format     = GetPixelFormatFromVulkanFormat(header.vk_format);
+    m_is_cube          = header.face_count == 6U;
+    m_is_array         = header.layer_count > 0U;
+    m_array_length     = std::max(1U, header.layer_count);
+    m_dimensions       = Dimensions(header.pixel_width, std::max(1U, header.pixel_height), header.face_count);
+    m_mip_levels_count = std::max(1U, header.level_count);
+
+    const uint32_t full_mip_levels_count = GetFullMipLevelsCount(m_dimensions);
+    META_CHECK_ARG_DESCR(m_mip_levels_count, m_mip_levels_count == 1U || m_mip_levels_count == full_mip_levels_count,
+                         "KTX2 image must contain either one or full chain of {} MIP levels", full_mip_levels_count);
+
+    const Data::Size levels_index_offset = static_cast<Data::Size>(g_ktx2_identifier.size() + sizeof(Ktx2Header));
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(levels_index_offset + m_mip_levels_count * sizeof(Ktx2LevelIndex), data_size,
+                                       "KTX2 image levels index is out of data bounds");
+
+    const Rhi::SubResource::Count sub_resource_count(header.face_count, m_array_length, m_mip_levels_count);
+    m_sub_resources.reserve(sub_resource_count.GetRawCount());
+
+    for(uint32_t mip_level = 0U; mip_level < m_mip_levels_count; ++mip_level)
+    {
+        Ktx2LevelIndex level_index{};
+        std::memcpy(&level_index, data_ptr + levels_index_offset + mip_level * sizeof(Ktx2LevelIndex), sizeof(Ktx2LevelIndex));
+
+        // Level data contains images of all array layers and cube faces with tightly packed rows of pixel blocks
+        const Data::Size image_size = GetSlicePitch(m_pixel_format,
+                                                    GetMipLevelSize(m_dimensions.GetWidth(), mip_level),
+                                                    GetMipLevelSize(m_dimensions.GetHeight(), mip_level));
+        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(level_index.byte_length, static_cast<uint64_t>(image_size) * sub_resource_count.GetBaseLayerCount(),
+                                              "KTX2 image level {} data is smaller than expected", mip_level);
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(level_index.byte_offset, static_cast<uint64_t>(data_size),
+                                           "KTX2 image level {} data offset is out of bounds", mip_level);
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(level_index.byte_length, static_cast<uint64_t>(data_size) - level_index.byte_offset,
+                                           "KTX2 image level {} data is out of bounds", mip_level);
+
+        Data::Size image_offset = static_cast<Data::Size>(level_index.byte_offset);
+        for(uint32_t layer_index = 0U; layer_index < m_array_length; ++layer_index)
+        {
+            for(uint32_t face_index = 0U; face_index < header.face_count; ++face_index)
+            {
+                m_sub_resources.emplace_back(data_ptr + image_offset, image_size,
+                                             Rhi::SubResource::Index(face_index, layer_index, mip_level));
+                image_offset += image_size;
+            }
+        }
+    }
+}
+
+bool Ktx2ImageData::IsKtx2Data(const Data::Chunk& data) noexcept
+{
+    META_FUNCTION_TASK();
+    return data.GetDataSize() >= g_ktx2_identifier.size() &&
+           std::equal(g_ktx2_identifier.begin(), g_ktx2_identifier.end(), data.GetDataPtr<uint8_t>());
+}
+
+Data::Bytes Ktx2ImageData::Write(PixelFormat pixel_format, const Dimensions& dimensions, const std::vector<Data::Bytes>& mip_levels)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(pixel_format, pixel_format == PixelFormat::RGBA8Unorm || pixel_format == PixelFormat::RGBA8Unorm_sRGB,
+                         "KTX2 image writing is supported only for RGBA8 pixel formats");
+    META_CHECK_ARG_NOT_ZERO_DESCR(dimensions.GetPixelsCount(), "KTX2 image dimensions can not be zero");
+    META_CHECK_ARG_EQUAL_DESCR(dimensions.GetDepth(), 1U, "KTX2 image writing is supported only for 2D images");
+    const auto mip_levels_count = static_cast<uint32_t>(mip_levels.size());
+    const uint32_t full_mip_levels_count = GetFullMipLevelsCount(dimensions);
+    META_CHECK_ARG_DESCR(mip_levels_count, mip_levels_count == 1U || mip_levels_count == full_mip_levels_count,
+                         "KTX2 image must contain either one or full chain of {} MIP levels", full_mip_levels_count);
+
+    // Basic data format descriptor block with 4 samples of 8-bit RGBA channels in BT.709 color primaries
+    const bool     is_srgb = pixel_format == PixelFormat::RGBA8Unorm_sRGB;
+    const uint32_t alpha_channel_type = is_srgb ? 0x1FU : 0x0FU; // alpha is marked with linear qualifier in sRGB transfer function
+    const std::array<uint32_t, 23> dfd_words{
+        92U,                                  // dfdTotalSize
+        0U,                                   // vendorId = Khronos, descriptorType = basic
+        (88U << 16U) | 2U,                    // descriptorBlockSize, versionNumber
+        1U | (1U << 8U) | ((is_srgb ? 2U : 1U) << 16U), // colorModel = RGBSDA, colorPrimaries = BT709, transferFunction
+        0U,                                   // texelBlockDimension = 1x1x1x1
+        4U,                                   // bytesPlane0
+        0U,
+        0U  | (7U << 16U) | (0U << 24U),  0U, 0U, 255U,
+        8U  | (7U << 16U) | (1U << 24U),  0U, 0U, 255U,
+        16U | (7U << 16U) | (2U << 24U),  0U, 0U, 255U,
+        24U | (7U << 16U) | (alpha_channel_type << 24U), 0U, 0U, 255U,
+    };
+
+    const Data::Size levels_index_offset = static_cast<Data::Size>(g_ktx2_identifier.size() + sizeof(Ktx2Header));
+    const Data::Size dfd_offset          = levels_index_offset + mip_levels_count * static_cast<Data::Size>(sizeof(Ktx2LevelIndex));
+    const Data::Size dfd_size            = static_cast<Data::Size>(dfd_words.size() * sizeof(uint32_t));
+
+    Ktx2Header header{};
+    header.vk_format       = is_srgb ? 43U : 37U;
+    header.type_size       = 1U;
+    header.pixel_width     = dimensions.GetWidth();
+    header.pixel_height    = dimensions.GetHeight();
+    header.face_count      = 1U;
+    header.level_count     = mip_levels_count;
+    header.dfd_byte_offset = dfd_offset;
+    header.dfd_byte_length = dfd_size;
+
+    // MIP levels data is stored from the smallest to the largest level with offsets aligned to pixel size
+    std::vector<Ktx2LevelIndex> levels_index(mip_levels_count);
+    Data::Size data_size = dfd_offset + dfd_size;
+    for(uint32_t mip_level = mip_levels_count; mip_level-- > 0U;)
+    {
+        const Data::Size level_size = GetSlicePitch(pixel_format, GetMipLevelSize(dimensions.GetWidth(), mip_level),
+                                                    GetMipLevelSize(dimensions.GetHeight(), mip_level));
+        META_CHECK_ARG_EQUAL_DESCR(static_cast<Data::Size>(mip_levels[mip_level].size()), level_size,
+                                   "KTX2 image MIP level {} data size does not match its dimensions", mip_level);
+        data_size = Data::DivCeil(data_size, 4U) * 4U;
+        levels_index[mip_level] = Ktx2LevelIndex{ data_size, level_size, level_size };
+        data_size += level_size;
+    }
+
+    Data::Bytes data(data_size, Data::Byte{});
+    Data::Byte* const data_ptr = data.data();
+    std::memcpy(data_ptr, g_ktx2_identifier.data(), g_ktx2_identifier.size());
+    std::memcpy(data_ptr + g_ktx2_identifier.size(), &header, sizeof(Ktx2Header));
+    std::memcpy(data_ptr + levels_index_offset, levels_index.data(), levels_index.size() * sizeof(Ktx2LevelIndex));
+    std::memcpy(data_ptr + dfd_offset, dfd_words.data(), dfd_size);
+    for(uint32_t mip_level = 0U; mip_level < mip_levels_count; ++mip_level)
+    {
+        std::memcpy(data_ptr + levels_index[mip_level].byte_offset, mip_levels[mip_level].data(), mip_levels[mip_level].size());
+    }
+    return data;
+}
+
 ImageData::ImageData(const Dimensions& dimensions, uint32_t channels_count, Data::Chunk&& pixels) noexcept
     : m_dimensions(dimensions)
     , m_channels_count(channels_count)
@@ -89,11 +312,19 @@ ImageLoader::ImageLoader(Data::IProvider& data_provider)
 ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const
 {
     META_FUNCTION_TASK();
+    return LoadImageData(image_path, m_data_provider.GetData(image_path), channels_count, create_copy);
+}
 
-    Data::Chunk raw_image_data = m_data_provider.GetData(image_path);
+ImageData ImageLoader::LoadImageData(const std::string& image_path, const Data::Chunk& raw_image_data,
+                                     Data::Size channels_count, bool create_copy)
+{
+    META_FUNCTION_TASK();
 
 #ifdef USE_OPEN_IMAGE_IO
 
+    META_UNUSED(raw_image_data);
+    META_UNUSED(create_copy);
+
 #if 0
     OIIO::Filesystem::IOMemReader image_reader(const_cast<char*>(raw_image_data.GetDataPtr()), raw_image_data.size);
     OIIO::ImageSpec init_spec;
@@ -123,6 +354,8 @@ ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size c
                                 Data::Chunk(std::move(texture_data)));
 
 #else
+
+    META_UNUSED(image_path);
     int image_width = 0;
     int image_height = 0;
     int image_channels_count = 0;
@@ -159,19 +392,165 @@ ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size c
 #endif
 }
 
+ImageLoader::ImageInfo ImageLoader::GetImageInfo(const std::string& image_path) const
+{
+    META_FUNCTION_TASK();
+    return GetImageInfo(image_path, m_data_provider.GetData(image_path));
+}
+
+void ImageLoader::DecodeImageToRgba8(const std::string& image_path, Data::Byte* target_pixels_ptr, Data::Size target_pixels_size,
+                                     tf::Executor* parallel_executor_ptr) const
+{
+    META_FUNCTION_TASK();
+    DecodeImageToRgba8(image_path, m_data_provider.GetData(image_path), target_pixels_ptr, target_pixels_size, parallel_executor_ptr);
+}
+
+ImageLoader::ImageInfo ImageLoader::GetImageInfo(const std::string& image_path, const Data::Chunk& raw_image_data)
+{
+    META_FUNCTION_TASK();
+
+#ifdef USE_OPEN_IMAGE_IO
+
+    META_UNUSED(raw_image_data);
+    const std::string image_file_path = Platform::GetResourceDir() + "/" + image_path;
+    OIIO::ImageBuf image_buf(image_file_path.c_str());
+    const OIIO::ImageSpec& image_spec = image_buf.spec();
+    META_CHECK_ARG_DESCR(image_path, !image_spec.undefined(), "failed to load image specification");
+    return ImageInfo{ Dimensions(static_cast<uint32_t>(image_spec.width), static_cast<uint32_t>(image_spec.height)),
+                      static_cast<uint32_t>(image_spec.nchannels) };
+
+#else
+
+    // Only image header is parsed without decoding pixels
+    int image_width = 0;
+    int image_height = 0;
+    int image_channels_count = 0;
+    const int info_result = stbi_info_from_memory(reinterpret_cast<const stbi_uc*>(raw_image_data.GetDataPtr()), // NOSONAR
+                                                  static_cast<int>(raw_image_data.GetDataSize()),
+                                                  &image_width, &image_height, &image_channels_count);
+    META_CHECK_ARG_DESCR(image_path, info_result != 0, "failed to read image information from memory");
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(image_width, 1, "invalid image width");
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(image_height, 1, "invalid image height");
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(image_channels_count, 1, "invalid image channels count");
+    return ImageInfo{ Dimensions(static_cast<uint32_t>(image_width), static_cast<uint32_t>(image_height)),
+                      static_cast<uint32_t>(image_channels_count) };
+
+#endif
+}
+
+void ImageLoader::DecodeImageToRgba8(const std::string& image_path, const Data::Chunk& raw_image_data,
+                                     Data::Byte* target_pixels_ptr, Data::Size target_pixels_size,
+                                     tf::Executor* parallel_executor_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(target_pixels_ptr);
+
+#ifdef USE_OPEN_IMAGE_IO
+
+    META_UNUSED(raw_image_data);
+    META_UNUSED(parallel_executor_ptr);
+    const std::string image_file_path = Platform::GetResourceDir() + "/" + image_path;
+    OIIO::ImageBuf image_buf(image_file_path.c_str());
+    const OIIO::ImageSpec& image_spec = image_buf.spec();
+    META_CHECK_ARG_DESCR(image_path, !image_spec.undefined(), "failed to load image specification");
+    META_CHECK_ARG_EQUAL_DESCR(static_cast<size_t>(target_pixels_size), static_cast<size_t>(image_spec.width) * image_spec.height * g_rgba8_pixel_size,
+                               "target pixels size does not match decoded image size");
+
+    const bool read_success = image_buf.read();
+    META_CHECK_ARG_DESCR(image_path, read_success, "failed to read image data from file, error: {}", image_buf.geterror());
+
+    std::fill_n(target_pixels_ptr, target_pixels_size, Data::Byte{ 255U });
+    const OIIO::TypeDesc texture_format(OIIO::TypeDesc::BASETYPE::UCHAR);
+    const bool decode_success = image_buf.get_pixels(OIIO::get_roi(image_spec), texture_format, target_pixels_ptr, g_rgba8_pixel_size);
+    META_CHECK_ARG_DESCR(image_path, decode_success, "failed to decode image pixels, error: {}", image_buf.geterror());
+
+#else
+
+    // Entropy decoding of PNG and JPEG streams is sequential in STB, so decoder outputs native RGB pixels
+    // which are expanded to RGBA in tiles of rows in parallel; grey images are expanded to RGBA by decoder itself
+    const ImageInfo  image_info = GetImageInfo(image_path, raw_image_data);
+    const uint32_t   image_width  = image_info.dimensions.GetWidth();
+    const uint32_t   image_height = image_info.dimensions.GetHeight();
+    META_CHECK_ARG_EQUAL_DESCR(static_cast<size_t>(target_pixels_size), static_cast<size_t>(image_width) * image_height * g_rgba8_pixel_size,
+                               "target pixels size does not match decoded image size");
+
+    const int decoded_channels_count = image_info.channels_count == 3U ? 3 : 4;
+    int image_width_decoded = 0;
+    int image_height_decoded = 0;
+    int image_channels_count = 0;
+    const std::unique_ptr<stbi_uc, void(*)(void*)> decoded_pixels_ptr(
+        stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(raw_image_data.GetDataPtr()), // NOSONAR
+                              static_cast<int>(raw_image_data.GetDataSize()),
+                              &image_width_decoded, &image_height_decoded, &image_channels_count,
+                              decoded_channels_count),
+        &stbi_image_free);
+    META_CHECK_ARG_DESCR(image_path, decoded_pixels_ptr != nullptr, "failed to decode image data from memory");
+
+    const auto* decoded_pixels = reinterpret_cast<const Data::Byte*>(decoded_pixels_ptr.get()); // NOSONAR
+    const auto decode_rows_tile = [=](uint32_t tile_index)
+    {
+        const uint32_t begin_row   = tile_index * g_decoded_rows_tile_size;
+        const size_t   begin_pixel = static_cast<size_t>(begin_row) * image_width;
+        const size_t   tile_pixels = static_cast<size_t>(std::min(g_decoded_rows_tile_size, image_height - begin_row)) * image_width;
+        if (decoded_channels_count == 3)
+            ExpandRgbToRgba(decoded_pixels + begin_pixel * 3U, target_pixels_ptr + begin_pixel * g_rgba8_pixel_size, tile_pixels);
+        else
+            std::memcpy(target_pixels_ptr + begin_pixel * g_rgba8_pixel_size, decoded_pixels + begin_pixel * g_rgba8_pixel_size,
+                        tile_pixels * g_rgba8_pixel_size);
+    };
+
+    const uint32_t tiles_count = Data::DivCeil(image_height, g_decoded_rows_tile_size);
+    if (parallel_executor_ptr && tiles_count > 1U)
+    {
+        Data::ParallelFor(*parallel_executor_ptr, 0U, tiles_count, decode_rows_tile);
+        return;
+    }
+    for(uint32_t tile_index = 0U; tile_index < tiles_count; ++tile_index)
+    {
+        decode_rows_tile(tile_index);
+    }
+
+#endif
+}
+
+Ktx2ImageData ImageLoader::LoadKtx2ImageData(const std::string& image_path) const
+{
+    META_FUNCTION_TASK();
+    return Ktx2ImageData(m_data_provider.GetData(image_path));
+}
+
 Rhi::Texture ImageLoader::LoadImageToTexture2D(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path,
                                                ImageOptionMask options, const std::string& texture_name) const
 {
     META_FUNCTION_TASK();
-    const ImageData    image_data   = LoadImageData(image_path, 4, false);
-    const PixelFormat  image_format = GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
+    static constexpr std::string_view s_ktx2_extension = ".ktx2";
+    if (image_path.size() > s_ktx2_extension.size() &&
+        image_path.compare(image_path.size() - s_ktx2_extension.size(), s_ktx2_extension.size(), s_ktx2_extension) == 0)
+        return LoadKtx2ImageToTexture(target_cmd_queue, image_path, options, texture_name);
+
+    const Data::Chunk raw_image_data = m_data_provider.GetData(image_path);
+    const ImageInfo   image_info     = GetImageInfo(image_path, raw_image_data);
+    const PixelFormat image_format   = GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
 
     Rhi::Texture texture(target_cmd_queue.GetContext(),
                          Rhi::TextureSettings::ForImage(
-                             image_data.GetDimensions(), std::nullopt, image_format,
+                             image_info.dimensions, std::nullopt, image_format,
                              options.HasAnyBit(ImageOption::Mipmapped)));
     texture.SetName(texture_name);
-    texture.SetData({ { image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize() } }, target_cmd_queue);
+
+    if (image_info.channels_count != 3U)
+    {
+        // Decoder outputs RGBA pixels for images with other channels count itself, so its buffer is used as texture data without copy
+        const ImageData image_data = LoadImageData(image_path, raw_image_data, g_rgba8_pixel_size, false);
+        texture.SetData({ { image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize() } }, target_cmd_queue);
+        return texture;
+    }
+
+    // RGB image is decoded with native channels and expanded to RGBA with rows tiles split between context parallel executor workers
+    Data::Bytes image_pixels(static_cast<size_t>(image_info.dimensions.GetWidth()) * image_info.dimensions.GetHeight() * g_rgba8_pixel_size);
+    DecodeImageToRgba8(image_path, raw_image_data, image_pixels.data(), static_cast<Data::Size>(image_pixels.size()),
+                       &target_cmd_queue.GetContext().GetParallelExecutor());
+    texture.SetData({ Rhi::SubResource(std::move(image_pixels)) }, target_cmd_queue);
 
     return texture;
 }
@@ -181,47 +560,51 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
 {
     META_FUNCTION_TASK();
 
-    // Load face image data in parallel
-    TracyLockable(std::mutex, data_mutex);
-    std::vector<std::pair<Data::Index, ImageData>> face_images_data;
-    face_images_data.reserve(image_paths.size());
+    // Face images are decoded in parallel to the slices of single preallocated buffer, which is used as texture data source
+    const size_t faces_count = image_paths.size();
+    std::vector<Data::Chunk> face_raw_data;
+    face_raw_data.reserve(faces_count);
+    for(const std::string& image_path : image_paths)
+    {
+        face_raw_data.emplace_back(m_data_provider.GetData(image_path));
+    }
+
+    // Verify cube textures
+    const ImageInfo face_info = GetImageInfo(image_paths.front(), face_raw_data.front());
+    META_CHECK_ARG_EQUAL_DESCR(face_info.dimensions.GetWidth(), face_info.dimensions.GetHeight(), "all images of cube texture faces must have equal width and height");
+    for(size_t face_index = 1U; face_index < faces_count; ++face_index)
+    {
+        META_CHECK_ARG_EQUAL_DESCR(face_info.dimensions, GetImageInfo(image_paths[face_index], face_raw_data[face_index]).dimensions,
+                                   "all face image of cube texture must have equal dimensions");
+    }
+
+    const auto  face_data_size = static_cast<Data::Size>(face_info.dimensions.GetPixelsCount() * g_rgba8_pixel_size);
+    Data::Bytes faces_pixels(static_cast<size_t>(face_data_size) * faces_count);
 
     tf::Taskflow load_task_flow;
-    load_task_flow.for_each_index(0U, static_cast<uint32_t>(image_paths.size()), 1U,
-        [this, &image_paths, &face_images_data, &data_mutex](const uint32_t face_index)
+    load_task_flow.for_each_index(0U, static_cast<uint32_t>(faces_count), 1U,
+        [&image_paths, &face_raw_data, &faces_pixels, face_data_size](const uint32_t face_index)
         {
             META_FUNCTION_TASK();
-            // We create a copy of the loaded image data (via 3-rd argument of LoadImageData)
-            // to resolve a problem of STB image loader which requires an image data to be freed before next image is loaded
-            constexpr uint32_t desired_channels_count = 4;
-            ImageData image_data = LoadImageData(image_paths[face_index], desired_channels_count, true);
-
-            std::scoped_lock data_lock(data_mutex);
-            face_images_data.emplace_back(face_index, std::move(image_data));
+            DecodeImageToRgba8(image_paths[face_index], face_raw_data[face_index],
+                               faces_pixels.data() + static_cast<size_t>(face_data_size) * face_index, face_data_size, nullptr);
         }
     );
     target_cmd_queue.GetContext().GetParallelExecutor().run(load_task_flow).get();
 
-    // Verify cube textures
-    META_CHECK_ARG_EQUAL_DESCR(face_images_data.size(), image_paths.size(), "some faces of cube texture have failed to load");
-    const Dimensions face_dimensions     = face_images_data.front().second.GetDimensions();
-    const uint32_t   face_channels_count = face_images_data.front().second.GetChannelsCount();
-    META_CHECK_ARG_EQUAL_DESCR(face_dimensions.GetWidth(), face_dimensions.GetHeight(), "all images of cube texture faces must have equal width and height");
-
     Rhi::IResource::SubResources face_resources;
-    face_resources.reserve(face_images_data.size());
-    for(const auto& [face_index, image_data] : face_images_data)
+    face_resources.reserve(faces_count);
+    for(uint32_t face_index = 0U; face_index < static_cast<uint32_t>(faces_count); ++face_index)
     {
-        META_CHECK_ARG_EQUAL_DESCR(face_dimensions,     image_data.GetDimensions(),    "all face image of cube texture must have equal dimensions");
-        META_CHECK_ARG_EQUAL_DESCR(face_channels_count, image_data.GetChannelsCount(), "all face image of cube texture must have equal channels count");
-        face_resources.emplace_back(image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize(), Rhi::IResource::SubResource::Index(face_index));
+        face_resources.emplace_back(faces_pixels.data() + static_cast<size_t>(face_data_size) * face_index, face_data_size,
+                                    Rhi::IResource::SubResource::Index(face_index));
     }
 
     // Load face images to cube texture
     const PixelFormat  image_format = GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
     Rhi::Texture texture(target_cmd_queue.GetContext(),
                          Rhi::TextureSettings::ForCubeImage(
-                             face_dimensions.GetWidth(), std::nullopt,
+                             face_info.dimensions.GetWidth(), std::nullopt,
                              image_format, options.HasAnyBit(Option::Mipmapped)));
     texture.SetName(texture_name);
     texture.SetData(face_resources, target_cmd_queue);
@@ -229,4 +612,27 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
     return texture;
 }
 
+Rhi::Texture ImageLoader::LoadKtx2ImageToTexture(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path,
+                                                 ImageOptionMask options, const std::string& texture_name) const
+{
+    META_FUNCTION_TASK();
+    const Ktx2ImageData image_data = LoadKtx2ImageData(image_path);
+
+    // Pixel format and color space are defined by the image, MIP levels are generated only for single level image of uncompressed format
+    const bool mipmapped = image_data.GetMipLevelsCount() > 1U ||
+                           (options.HasAnyBit(ImageOption::Mipmapped) && !IsBlockCompressedFormat(image_data.GetPixelFormat()));
+    const Opt<uint32_t> array_length_opt = image_data.IsArray() ? Opt<uint32_t>(image_data.GetArrayLength()) : std::nullopt;
+    const Dimensions&   dimensions       = image_data.GetDimensions();
+
+    Rhi::Texture texture(target_cmd_queue.GetContext(),
+                         image_data.IsCube()
+                             ? Rhi::TextureSettings::ForCubeImage(dimensions.GetWidth(), array_length_opt, image_data.GetPixelFormat(), mipmapped)
+                             : Rhi::TextureSettings::ForImage(Dimensions(dimensions.GetWidth(), dimensions.GetHeight()), array_length_opt,
+                                                              image_data.GetPixelFormat(), mipmapped));
+    texture.SetName(texture_name);
+    texture.SetData(image_data.GetSubResources(), target_cmd_queue);
+
+    return texture;
+}
+
 } // namespace Methane::Graphics
@@ -25,17 +25,66 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/RenderCommandList.h>
 #include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
-#include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <taskflow/taskflow.hpp>
 #include <fmt/format.h>
+#include <algorithm>
+#include <vector>
 
 namespace Methane::Graphics
 {
 
+template<typename IType>
+static void OptimizeMeshSubsets(const Mesh::Subsets& mesh_subsets, Data::Size vertex_size, Data::Bytes& vertex_data, Data::Bytes& index_data,
+                                VertexCacheStatistics& initial_stats, VertexCacheStatistics& optimized_stats)
+{
+    META_FUNCTION_TASK();
+    // Vertex fetch optimization reorders vertices of each subset range, so subset vertex ranges must not overlap
+    std::vector<std::pair<Data::Index, Data::Index>> subset_vertex_ranges;
+    subset_vertex_ranges.reserve(mesh_subsets.size());
+    for (const Mesh::Subset& mesh_subset : mesh_subsets)
+        subset_vertex_ranges.emplace_back(mesh_subset.vertices.offset, mesh_subset.vertices.offset + mesh_subset.vertices.count);
+    std::sort(subset_vertex_ranges.begin(), subset_vertex_ranges.end());
+    for (size_t range_index = 1U; range_index < subset_vertex_ranges.size(); ++range_index)
+    {
+        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(subset_vertex_ranges[range_index].first, subset_vertex_ranges[range_index - 1U].second,
+                                              "optimized mesh subsets must not overlap in vertex buffer");
+    }
+
+    auto* indices = reinterpret_cast<IType*>(index_data.data()); // NOSONAR
+    Data::Index subset_indices_end = 0U;
+    for (const Mesh::Subset& mesh_subset : mesh_subsets)
+    {
+        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(mesh_subset.indices.offset, subset_indices_end,
+                                              "optimized mesh subsets must not overlap in index buffer");
+        subset_indices_end = mesh_subset.indices.offset + mesh_subset.indices.count;
+
+        IType* subset_indices = indices + mesh_subset.indices.offset;
+        if (mesh_subset.indices.count)
+        {
+            // Subset indices must reference only vertices of the subset range, which is reordered by fetch optimization
+            const auto [min_index_it, max_index_it] = std::minmax_element(subset_indices, subset_indices + mesh_subset.indices.count);
+            const auto        min_vertex_index = static_cast<Data::Index>(*min_index_it);
+            const auto        max_vertex_index = static_cast<Data::Index>(*max_index_it);
+            const Data::Index base_vertex      = mesh_subset.indices_adjusted ? mesh_subset.vertices.offset : 0U;
+            META_CHECK_ARG_RANGE_DESCR(min_vertex_index, base_vertex, base_vertex + mesh_subset.vertices.count,
+                                       "optimized mesh subset indices must reference vertices of the subset only");
+            META_CHECK_ARG_RANGE_DESCR(max_vertex_index, base_vertex, base_vertex + mesh_subset.vertices.count,
+                                       "optimized mesh subset indices must reference vertices of the subset only");
+        }
+
+        initial_stats += AnalyzeVertexCache(subset_indices, mesh_subset.indices.count);
+        OptimizeVertexCache(subset_indices, mesh_subset.indices.count);
+        OptimizeVertexFetch(vertex_data.data(), vertex_size, subset_indices, mesh_subset.indices.count,
+                            mesh_subset.indices_adjusted ? 0U : mesh_subset.vertices.offset);
+        optimized_stats += AnalyzeVertexCache(subset_indices, mesh_subset.indices.count);
+    }
+}
+
 MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
-                                 std::string_view mesh_name, const Mesh::Subsets& mesh_subsets)
+                                 std::string_view mesh_name, const Mesh::Subsets& mesh_subsets,
+                                 bool optimize_mesh, Mesh::VertexFieldMask packed_vertex_fields)
     : m_context(render_cmd_queue.GetContext())
     , m_mesh_name(mesh_name)
     , m_mesh_subsets(!mesh_subsets.empty()
@@ -48,15 +97,58 @@ MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, cons
 {
     META_FUNCTION_TASK();
 
+    Data::ConstRawPtr vertex_data_ptr  = mesh_data.GetVertexData();
+    Data::Size        vertex_data_size = mesh_data.GetVertexDataSize();
+    Data::Size        vertex_size      = mesh_data.GetVertexSize();
+    Data::ConstRawPtr index_data_ptr   = mesh_data.GetIndexData();
+    Data::Bytes       converted_vertex_data;
+    Data::Bytes       optimized_index_data;
+    if (packed_vertex_fields)
+    {
+        // Vertices are packed before optimization, so that fetch optimizer moves smaller vertices
+        const Mesh::VertexLayout packed_vertex_layout = mesh_data.GetVertexLayout().GetPackedLayout(packed_vertex_fields);
+        converted_vertex_data = mesh_data.GetPackedVertexData(packed_vertex_layout);
+        vertex_data_ptr       = converted_vertex_data.data();
+        vertex_data_size      = static_cast<Data::Size>(converted_vertex_data.size());
+        vertex_size           = packed_vertex_layout.GetVertexSize();
+    }
+
+    if (optimize_mesh)
+    {
+        if (!packed_vertex_fields)
+            converted_vertex_data.assign(vertex_data_ptr, vertex_data_ptr + vertex_data_size);
+        optimized_index_data.assign(index_data_ptr, index_data_ptr + mesh_data.GetIndexDataSize());
+
+        switch (const PixelFormat index_format = mesh_data.GetIndexFormat(); index_format)
+        {
+        case PixelFormat::R16Uint:
+            OptimizeMeshSubsets<uint16_t>(m_mesh_subsets, vertex_size, converted_vertex_data, optimized_index_data,
+                                          m_initial_vertex_cache_stats, m_optimized_vertex_cache_stats);
+            break;
+        case PixelFormat::R32Uint:
+            OptimizeMeshSubsets<uint32_t>(m_mesh_subsets, vertex_size, converted_vertex_data, optimized_index_data,
+                                          m_initial_vertex_cache_stats, m_optimized_vertex_cache_stats);
+            break;
+        default:
+            META_UNEXPECTED_ARG_DESCR(index_format, "mesh index format is not supported by optimizer");
+        }
+
+        vertex_data_ptr = converted_vertex_data.data();
+        index_data_ptr  = optimized_index_data.data();
+        META_LOG("Mesh '{}' optimized for vertex cache: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}", mesh_name,
+                 m_initial_vertex_cache_stats.GetAcmr(), m_optimized_vertex_cache_stats.GetAcmr(),
+                 m_initial_vertex_cache_stats.GetAtvr(), m_optimized_vertex_cache_stats.GetAtvr());
+    }
+
     Rhi::Buffer vertex_buffer(m_context,
         Rhi::BufferSettings::ForVertexBuffer(
-            mesh_data.GetVertexDataSize(),
-            mesh_data.GetVertexSize()));
+            vertex_data_size,
+            vertex_size));
     vertex_buffer.SetName(fmt::format("{} Vertex Buffer", mesh_name));
     vertex_buffer.SetData({
         {
-            mesh_data.GetVertexData(), // NOSONAR
-            mesh_data.GetVertexDataSize()
+            vertex_data_ptr,
+            vertex_data_size
         }
     }, render_cmd_queue);
     m_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
@@ -64,11 +156,11 @@ MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, cons
     m_index_buffer = Rhi::Buffer(m_context,
         Rhi::BufferSettings::ForIndexBuffer(
             mesh_data.GetIndexDataSize(),
-            GetIndexFormat(mesh_data.GetIndex(0))));
+            mesh_data.GetIndexFormat()));
     m_index_buffer.SetName(fmt::format("{} Index Buffer", mesh_name));
     m_index_buffer.SetData({
         {
-            reinterpret_cast<Data::ConstRawPtr>(mesh_data.GetIndices().data()), // NOSONAR
+            index_data_ptr,
             mesh_data.GetIndexDataSize()
         }
     }, render_cmd_queue);
@@ -165,6 +257,40 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
     }
 }
 
+void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
+                           const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                           const Data::Index* instance_indices_begin, const Data::Index* instance_indices_end,
+                           Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                           bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    cmd_list.SetVertexBuffers(GetVertexBuffers(), set_resource_barriers);
+    cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
+
+    for (const Data::Index* instance_index_ptr = instance_indices_begin; instance_index_ptr != instance_indices_end; ++instance_index_ptr)
+    {
+        const Data::Index instance_index = *instance_index_ptr;
+        META_CHECK_ARG_LESS(instance_index, instance_program_bindings.size());
+
+        const Rhi::ProgramBindings& program_bindings = instance_program_bindings[instance_index];
+        META_CHECK_ARG_TRUE(program_bindings.IsInitialized());
+
+        const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
+        META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
+        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
+
+        Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = bindings_apply_behavior;
+        apply_behavior.SetBit(Rhi::ProgramBindingsApplyBehavior::RetainResources,
+                              !retain_bindings_once || instance_index_ptr == instance_indices_begin);
+
+        cmd_list.SetProgramBindings(program_bindings, apply_behavior);
+        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
+                             mesh_subset.indices.count, mesh_subset.indices.offset,
+                             mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
+                             1, 0);
+    }
+}
+
 void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
                                    const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
@@ -174,8 +300,7 @@ void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& paralle
     const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
     const auto instances_count_per_command_list = static_cast<uint32_t>(Data::DivCeil(instance_program_bindings.size(), render_cmd_lists.size()));
 
-    tf::Taskflow render_task_flow;
-    render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
+    m_context.ParallelFor(0U, static_cast<uint32_t>(render_cmd_lists.size()),
         [this, &render_cmd_lists, instances_count_per_command_list, &instance_program_bindings,
         bindings_apply_behavior, retain_bindings_once, set_resource_barriers](const uint32_t cmd_list_index)
         {
@@ -191,7 +316,30 @@ void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& paralle
                  retain_bindings_once, set_resource_barriers);
         }
     );
-    m_context.GetParallelExecutor().run(render_task_flow).get();
+}
+
+void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
+                                   const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                                   const InstanceIndices& instance_indices,
+                                   Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                                   bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    const auto indices_count = static_cast<uint32_t>(instance_indices.size());
+    const auto indices_count_per_command_list = static_cast<uint32_t>(Data::DivCeil(instance_indices.size(), render_cmd_lists.size()));
+
+    m_context.ParallelFor(0U, static_cast<uint32_t>(render_cmd_lists.size()),
+        [this, &render_cmd_lists, indices_count, indices_count_per_command_list, &instance_indices, &instance_program_bindings,
+         bindings_apply_behavior, retain_bindings_once, set_resource_barriers](const uint32_t cmd_list_index)
+        {
+            const uint32_t begin_index = std::min(cmd_list_index * indices_count_per_command_list, indices_count);
+            const uint32_t end_index   = std::min(begin_index + indices_count_per_command_list, indices_count);
+            Draw(render_cmd_lists[cmd_list_index], instance_program_bindings,
+                 instance_indices.data() + begin_index, instance_indices.data() + end_index,
+                 bindings_apply_behavior, retain_bindings_once, set_resource_barriers);
+        }
+    );
 }
 
 } // namespace Methane::Graphics
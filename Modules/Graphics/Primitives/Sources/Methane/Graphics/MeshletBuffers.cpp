@@ -0,0 +1,143 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshletBuffers.cpp
+Mesh buffers with indices reordered by meshlets and cluster bounding volumes
+used for CPU frustum and backface culling of meshlets before drawing.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshletBuffers.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics
+{
+
+// Mesh adapter which shares vertices of the original mesh with 32-bit indices reordered by meshlets
+class MeshletIndexedMesh final
+    : public Mesh
+{
+public:
+    MeshletIndexedMesh(const Mesh& mesh, const Meshlets& meshlets)
+        : Mesh(mesh.GetType(), mesh.GetVertexLayout())
+        , m_mesh(mesh)
+        , m_indices(meshlets.GetMeshletIndices())
+    { }
+
+    // Mesh overrides
+    [[nodiscard]] Data::Size        GetVertexCount() const noexcept override    { return m_mesh.GetVertexCount(); }
+    [[nodiscard]] Data::Size        GetVertexDataSize() const noexcept override { return m_mesh.GetVertexDataSize(); }
+    [[nodiscard]] Data::ConstRawPtr GetVertexData() const noexcept override     { return m_mesh.GetVertexData(); }
+    [[nodiscard]] Data::Size        GetIndexCount() const noexcept override     { return static_cast<Data::Size>(m_indices.size()); }
+    [[nodiscard]] Data::Size        GetIndexDataSize() const noexcept override  { return static_cast<Data::Size>(m_indices.size() * sizeof(Data::Index)); }
+    [[nodiscard]] Data::ConstRawPtr GetIndexData() const noexcept override      { return reinterpret_cast<Data::ConstRawPtr>(m_indices.data()); } // NOSONAR
+    [[nodiscard]] PixelFormat       GetIndexFormat() const noexcept override    { return PixelFormat::R32Uint; }
+
+private:
+    const Mesh&                    m_mesh;
+    const std::vector<Data::Index> m_indices;
+};
+
+static Mesh::Subsets GetMeshletSubsets(const Meshlets& meshlets)
+{
+    META_FUNCTION_TASK();
+    const Mesh::Subsets& mesh_subsets = meshlets.GetMeshSubsets();
+    Mesh::Subsets meshlet_subsets;
+    meshlet_subsets.reserve(mesh_subsets.size());
+    for (Data::Index subset_index = 0U; subset_index < mesh_subsets.size(); ++subset_index)
+    {
+        // Meshlet indices reference vertices of the whole mesh, so subset indices are adjusted
+        const Mesh::Subset&        mesh_subset     = mesh_subsets[subset_index];
+        const Mesh::Subset::Slice& subset_meshlets = meshlets.GetSubsetMeshlets(subset_index);
+        const Data::Index indices_offset = subset_meshlets.count
+                                         ? meshlets.GetMeshlets()[subset_meshlets.offset].triangle_offset
+                                         : 0U;
+        meshlet_subsets.emplace_back(mesh_subset.mesh_type, mesh_subset.vertices,
+                                     Mesh::Subset::Slice(indices_offset, mesh_subset.indices.count), true);
+    }
+    return meshlet_subsets;
+}
+
+MeshletBuffers::MeshletBuffers(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
+                               std::string_view mesh_name, const Mesh::Subsets& mesh_subsets)
+    : MeshletBuffers(render_cmd_queue, mesh_data, mesh_name, Meshlets(mesh_data, mesh_subsets))
+{ }
+
+MeshletBuffers::MeshletBuffers(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
+                               std::string_view mesh_name, Meshlets&& meshlets)
+    : MeshBuffersBase(render_cmd_queue, MeshletIndexedMesh(mesh_data, meshlets), mesh_name, GetMeshletSubsets(meshlets))
+    , m_meshlets(std::move(meshlets))
+{
+    META_FUNCTION_TASK();
+    const std::vector<Meshlets::Bounds>& meshlet_bounds = m_meshlets.GetBounds();
+    const auto meshlets_count = static_cast<Data::Size>(meshlet_bounds.size());
+    m_bounding_spheres.Resize(meshlets_count);
+    m_bounding_cones.Resize(meshlets_count);
+    for (Data::Index meshlet_index = 0U; meshlet_index < meshlets_count; ++meshlet_index)
+    {
+        const Meshlets::Bounds& bounds = meshlet_bounds[meshlet_index];
+        m_bounding_spheres.Set(meshlet_index, bounds.center.AsHlsl(), bounds.radius);
+        m_bounding_cones.Set(meshlet_index, bounds.cone_apex.AsHlsl(), bounds.cone_axis.AsHlsl(), bounds.cone_cutoff);
+    }
+}
+
+void MeshletBuffers::Cull(const FrustumCuller& frustum_culler, const hlslpp::float3& view_position, VisibleIndices& visible_meshlets,
+                          tf::Executor* parallel_executor_ptr) const
+{
+    META_FUNCTION_TASK();
+    frustum_culler.CullClusters(m_bounding_spheres, m_bounding_cones, view_position, visible_meshlets, parallel_executor_ptr);
+}
+
+uint32_t MeshletBuffers::DrawMeshlets(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                                      const VisibleIndices& visible_meshlets, uint32_t instance_count, uint32_t start_instance) const
+{
+    META_FUNCTION_TASK();
+    if (visible_meshlets.empty())
+        return 0U;
+
+    cmd_list.SetProgramBindings(program_bindings);
+    cmd_list.SetVertexBuffers(GetVertexBuffers());
+    cmd_list.SetIndexBuffer(GetIndexBuffer());
+
+    // Meshlet triangles are stored contiguously in meshlets order, so ranges of consecutive visible meshlets are drawn at once
+    const std::vector<Meshlets::Meshlet>& meshlets = m_meshlets.GetMeshlets();
+    uint32_t draws_count = 0U;
+    Data::Index range_begin = 0U;
+    while (range_begin < visible_meshlets.size())
+    {
+        Data::Index range_end = range_begin + 1U;
+        while (range_end < visible_meshlets.size() && visible_meshlets[range_end] == visible_meshlets[range_end - 1U] + 1U)
+            ++range_end;
+
+        META_CHECK_ARG_LESS(visible_meshlets[range_end - 1U], meshlets.size());
+        const Meshlets::Meshlet& first_meshlet = meshlets[visible_meshlets[range_begin]];
+        const Meshlets::Meshlet& last_meshlet  = meshlets[visible_meshlets[range_end - 1U]];
+        const Data::Index index_offset = first_meshlet.triangle_offset;
+        const Data::Size  index_count  = last_meshlet.triangle_offset + last_meshlet.triangle_count * 3U - index_offset;
+        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, index_count, index_offset, 0U, instance_count, start_instance);
+
+        ++draws_count;
+        range_begin = range_end;
+    }
+    return draws_count;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,257 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MipChainGenerator.cpp
+CPU generator of full MIP chain for RGBA8 images used for offline baking of textures,
+filtering pixels in linear color space with SIMD vectors.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/PixelConversion.h>
+#include <Methane/Data/ParallelFor.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <hlsl++_vector_float.h>
+#include <taskflow/taskflow.hpp>
+
+#include <array>
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+using LinearImage = std::vector<hlslpp::float4>;
+
+static constexpr uint32_t g_parallel_rows_chunk_size = 8U;
+static constexpr int32_t  g_kaiser_half_taps_count   = 6;   // taps count on each side of destination pixel center in source pixels
+static constexpr double   g_kaiser_support           = 3.0; // filter radius in destination pixels
+static constexpr double   g_kaiser_alpha             = 4.0;
+
+using KaiserWeights = std::array<float, static_cast<size_t>(g_kaiser_half_taps_count * 2)>;
+
+[[nodiscard]]
+static double GetBesselI0(double x)
+{
+    // Power series of zero order modified Bessel function of the first kind
+    double sum  = 1.0;
+    double term = 1.0;
+    for(int k = 1; k < 32; ++k)
+    {
+        const double half_x_by_k = x / (2.0 * k);
+        term *= half_x_by_k * half_x_by_k;
+        sum  += term;
+    }
+    return sum;
+}
+
+[[nodiscard]]
+static KaiserWeights GetKaiserWeights()
+{
+    META_FUNCTION_TASK();
+    // Source pixel centers of 2x down-sampling are located at half-pixel offsets from the destination pixel center
+    KaiserWeights weights{};
+    double weights_sum = 0.0;
+    for(size_t tap_index = 0; tap_index < weights.size(); ++tap_index)
+    {
+        const double distance      = (static_cast<double>(tap_index) - g_kaiser_half_taps_count + 0.5) / 2.0;
+        const double pi_distance   = distance * 3.14159265358979323846;
+        const double sinc          = pi_distance == 0.0 ? 1.0 : std::sin(pi_distance) / pi_distance;
+        const double window_arg    = distance / g_kaiser_support;
+        const double window        = GetBesselI0(g_kaiser_alpha * std::sqrt(std::max(0.0, 1.0 - window_arg * window_arg))) / GetBesselI0(g_kaiser_alpha);
+        const double weight        = sinc * window;
+        weights[tap_index] = static_cast<float>(weight);
+        weights_sum += weight;
+    }
+    for(float& weight : weights)
+    {
+        weight = static_cast<float>(weight / weights_sum);
+    }
+    return weights;
+}
+
+[[nodiscard]]
+static float ConvertLinearToSrgb(float value) noexcept
+{
+    return value <= 0.0031308F ? value * 12.92F : 1.055F * std::pow(value, 1.F / 2.4F) - 0.055F;
+}
+
+[[nodiscard]]
+static std::byte ConvertFloatToByte(float value) noexcept
+{
+    return static_cast<std::byte>(static_cast<uint8_t>(std::clamp(value, 0.F, 1.F) * 255.F + 0.5F));
+}
+
+template<typename RowFuncType>
+void MipChainGenerator::ForEachRow(uint32_t rows_count, const RowFuncType& row_func) const
+{
+    META_FUNCTION_TASK();
+    if (!m_parallel_executor_ptr || rows_count <= g_parallel_rows_chunk_size)
+    {
+        for(uint32_t row = 0U; row < rows_count; ++row)
+        {
+            row_func(row);
+        }
+        return;
+    }
+    Data::ParallelFor(*m_parallel_executor_ptr, 0U, rows_count, row_func, g_parallel_rows_chunk_size);
+}
+
+MipChainGenerator::MipChainGenerator(const Settings& settings, tf::Executor* parallel_executor_ptr)
+    : m_settings(settings)
+    , m_parallel_executor_ptr(parallel_executor_ptr)
+{ }
+
+uint32_t MipChainGenerator::GetMipLevelsCount(const Dimensions& base_dimensions)
+{
+    META_FUNCTION_TASK();
+    uint32_t max_size = std::max(base_dimensions.GetWidth(), base_dimensions.GetHeight());
+    uint32_t mip_levels_count = 1U;
+    while(max_size > 1U)
+    {
+        max_size >>= 1U;
+        mip_levels_count++;
+    }
+    return mip_levels_count;
+}
+
+MipChainGenerator::MipLevels MipChainGenerator::Generate(const Dimensions& base_dimensions, const Data::Chunk& base_pixels) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(base_dimensions.GetPixelsCount(), "image dimensions can not be zero");
+    META_CHECK_ARG_EQUAL_DESCR(base_dimensions.GetDepth(), 1U, "MIP chain can be generated only for 2D image");
+    META_CHECK_ARG_EQUAL_DESCR(base_pixels.GetDataSize(), base_dimensions.GetWidth() * base_dimensions.GetHeight() * g_pixel_size,
+                               "image pixels data size does not match RGBA8 image dimensions");
+
+    const uint32_t mip_levels_count = GetMipLevelsCount(base_dimensions);
+    MipLevels mip_levels;
+    mip_levels.reserve(mip_levels_count);
+    mip_levels.emplace_back(base_pixels.GetDataPtr(), base_pixels.GetDataPtr() + base_pixels.GetDataSize());
+
+    uint32_t src_width  = base_dimensions.GetWidth();
+    uint32_t src_height = base_dimensions.GetHeight();
+    LinearImage src_image(static_cast<size_t>(src_width) * src_height);
+
+    // Color channels are decoded to linear space with vectorized pixel conversion kernels, while alpha channel is always linear
+    static_assert(sizeof(hlslpp::float4) == 4U * sizeof(float), "linear image pixel must be a tightly packed vector of 4 floats");
+    const Data::Byte* base_pixels_ptr = base_pixels.GetDataPtr();
+    ForEachRow(src_height, [&](uint32_t row)
+    {
+        const size_t row_offset = static_cast<size_t>(row) * src_width;
+        auto* row_pixels_ptr = reinterpret_cast<float*>(src_image.data() + row_offset); // NOSONAR
+        if (m_settings.srgb_color_space)
+            ConvertSrgbToLinear(base_pixels_ptr + row_offset * g_pixel_size, row_pixels_ptr, src_width);
+        else
+            ConvertUnormToFloat(base_pixels_ptr + row_offset * g_pixel_size, row_pixels_ptr, src_width);
+    });
+
+    const KaiserWeights kaiser_weights = GetKaiserWeights();
+    LinearImage tmp_image;
+
+    for(uint32_t mip_level = 1U; mip_level < mip_levels_count; ++mip_level)
+    {
+        const uint32_t dst_width  = std::max(1U, src_width >> 1U);
+        const uint32_t dst_height = std::max(1U, src_height >> 1U);
+        LinearImage dst_image(static_cast<size_t>(dst_width) * dst_height);
+
+        switch(m_settings.filter)
+        {
+        case MipFilter::Box:
+            ForEachRow(dst_height, [&](uint32_t dst_y)
+            {
+                const size_t src_row_0 = static_cast<size_t>(std::min(dst_y * 2U, src_height - 1U)) * src_width;
+                const size_t src_row_1 = static_cast<size_t>(std::min(dst_y * 2U + 1U, src_height - 1U)) * src_width;
+                for(uint32_t dst_x = 0U; dst_x < dst_width; ++dst_x)
+                {
+                    const size_t src_x_0 = std::min(dst_x * 2U, src_width - 1U);
+                    const size_t src_x_1 = std::min(dst_x * 2U + 1U, src_width - 1U);
+                    dst_image[static_cast<size_t>(dst_y) * dst_width + dst_x] =
+                        (src_image[src_row_0 + src_x_0] + src_image[src_row_0 + src_x_1] +
+                         src_image[src_row_1 + src_x_0] + src_image[src_row_1 + src_x_1]) * 0.25F;
+                }
+            });
+            break;
+
+        case MipFilter::Kaiser:
+            // Separable filter: horizontal pass to temporary image followed by vertical pass
+            tmp_image.resize(static_cast<size_t>(dst_width) * src_height);
+            ForEachRow(src_height, [&](uint32_t src_y)
+            {
+                const size_t src_row = static_cast<size_t>(src_y) * src_width;
+                for(uint32_t dst_x = 0U; dst_x < dst_width; ++dst_x)
+                {
+                    hlslpp::float4 sum(0.F);
+                    for(int32_t tap_index = 0; tap_index < g_kaiser_half_taps_count * 2; ++tap_index)
+                    {
+                        const int32_t src_x = std::clamp(static_cast<int32_t>(dst_x * 2U) + tap_index - g_kaiser_half_taps_count + 1,
+                                                         0, static_cast<int32_t>(src_width) - 1);
+                        sum += src_image[src_row + src_x] * kaiser_weights[tap_index];
+                    }
+                    tmp_image[static_cast<size_t>(src_y) * dst_width + dst_x] = sum;
+                }
+            });
+            ForEachRow(dst_height, [&](uint32_t dst_y)
+            {
+                for(uint32_t dst_x = 0U; dst_x < dst_width; ++dst_x)
+                {
+                    hlslpp::float4 sum(0.F);
+                    for(int32_t tap_index = 0; tap_index < g_kaiser_half_taps_count * 2; ++tap_index)
+                    {
+                        const int32_t src_y = std::clamp(static_cast<int32_t>(dst_y * 2U) + tap_index - g_kaiser_half_taps_count + 1,
+                                                         0, static_cast<int32_t>(src_height) - 1);
+                        sum += tmp_image[static_cast<size_t>(src_y) * dst_width + dst_x] * kaiser_weights[tap_index];
+                    }
+                    // Ringing of negative filter lobes is clamped to prevent its accumulation in next MIP levels
+                    dst_image[static_cast<size_t>(dst_y) * dst_width + dst_x] = hlslpp::saturate(sum);
+                }
+            });
+            break;
+
+        default:
+            META_UNEXPECTED_ARG(m_settings.filter);
+        }
+
+        Data::Bytes& dst_pixels = mip_levels.emplace_back(static_cast<size_t>(dst_width) * dst_height * g_pixel_size);
+        ForEachRow(dst_height, [&](uint32_t row)
+        {
+            for(size_t index = static_cast<size_t>(row) * dst_width; index < static_cast<size_t>(row + 1U) * dst_width; ++index)
+            {
+                const hlslpp::float4& pixel = dst_image[index];
+                std::byte* pixel_ptr = dst_pixels.data() + index * g_pixel_size;
+                const auto encode_color = [this](float value)
+                {
+                    return ConvertFloatToByte(m_settings.srgb_color_space ? ConvertLinearToSrgb(std::max(value, 0.F)) : value);
+                };
+                pixel_ptr[0] = encode_color(static_cast<float>(pixel.x));
+                pixel_ptr[1] = encode_color(static_cast<float>(pixel.y));
+                pixel_ptr[2] = encode_color(static_cast<float>(pixel.z));
+                pixel_ptr[3] = ConvertFloatToByte(static_cast<float>(pixel.w));
+            }
+        });
+
+        src_image  = std::move(dst_image);
+        src_width  = dst_width;
+        src_height = dst_height;
+    }
+
+    return mip_levels;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,342 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/PixelConversion.cpp
+Pixel format conversion kernels used in image decoding pipeline,
+vectorized with SSSE3 (selected in runtime) or NEON instructions when available.
+
+******************************************************************************/
+
+#include <Methane/Graphics/PixelConversion.h>
+#include <Methane/Instrumentation.h>
+
+#include <array>
+#include <cmath>
+#include <iterator>
+
+#if defined(__x86_64__) || defined(_M_X64)
+// SSSE3 kernel is compiled for its own target and selected in runtime when it is not enabled for the whole build,
+// so that binaries still run on CPUs without SSSE3 support
+#define METHANE_PIXEL_CONVERSION_SSSE3
+#include <tmmintrin.h>
+#if defined(__SSSE3__) || defined(__AVX__)
+#define METHANE_SSSE3_TARGET
+#elif defined(_MSC_VER)
+#define METHANE_SSSE3_TARGET
+#include <intrin.h>
+#else
+#define METHANE_SSSE3_TARGET __attribute__((target("ssse3")))
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define METHANE_PIXEL_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Methane::Graphics
+{
+
+static constexpr size_t g_simd_pixels_count = 16U;
+
+// sRGB transfer function constants
+static constexpr float g_srgb_linear_threshold = 0.04045F;
+static constexpr float g_srgb_linear_scale     = 1.F / 12.92F;
+static constexpr float g_srgb_offset           = 0.055F;
+static constexpr float g_srgb_offset_scale     = 1.055F;
+static constexpr float g_srgb_gamma            = 2.4F;
+static constexpr float g_unorm_scale           = 1.F / 255.F;
+
+[[nodiscard]]
+static const std::array<float, 256>& GetSrgbToLinearTable()
+{
+    static const std::array<float, 256> s_srgb_to_linear_table = []()
+    {
+        std::array<float, 256> table{};
+        for(size_t value = 0; value < table.size(); ++value)
+        {
+            const float unorm_value = static_cast<float>(value) * g_unorm_scale;
+            table[value] = unorm_value <= g_srgb_linear_threshold
+                         ? unorm_value * g_srgb_linear_scale
+                         : std::pow((unorm_value + g_srgb_offset) / g_srgb_offset_scale, g_srgb_gamma);
+        }
+        return table;
+    }();
+    return s_srgb_to_linear_table;
+}
+
+#if defined(METHANE_PIXEL_CONVERSION_SSSE3)
+
+[[nodiscard]]
+static bool IsSsse3Supported() noexcept
+{
+#if defined(__SSSE3__) || defined(__AVX__)
+    return true;
+#elif defined(_MSC_VER)
+    std::array<int, 4> cpu_info{};
+    __cpuid(cpu_info.data(), 1);
+    return (cpu_info[2] & (1 << 9)) != 0;
+#else
+    return __builtin_cpu_supports("ssse3");
+#endif
+}
+
+// Returns count of expanded pixels, which is a multiple of SIMD pixels count
+METHANE_SSSE3_TARGET
+static size_t ExpandRgbToRgbaSsse3(const Data::Byte* rgb_pixels_ptr, Data::Byte* rgba_pixels_ptr, size_t pixels_count) noexcept
+{
+    // 16 pixels are loaded with 3 vectors, which are realigned and shuffled to 4 vectors of RGBA pixels
+    const __m128i rgb_to_rgba_shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha_mask          = _mm_set1_epi32(static_cast<int>(0xFF000000U));
+    size_t pixel_index = 0U;
+    for(; pixel_index + g_simd_pixels_count <= pixels_count; pixel_index += g_simd_pixels_count)
+    {
+        const auto* src_ptr = reinterpret_cast<const __m128i*>(rgb_pixels_ptr + pixel_index * 3U); // NOSONAR
+        auto*       dst_ptr = reinterpret_cast<__m128i*>(rgba_pixels_ptr + pixel_index * 4U); // NOSONAR
+        const __m128i src_0 = _mm_loadu_si128(src_ptr);
+        const __m128i src_1 = _mm_loadu_si128(src_ptr + 1);
+        const __m128i src_2 = _mm_loadu_si128(src_ptr + 2);
+        _mm_storeu_si128(dst_ptr,     _mm_or_si128(_mm_shuffle_epi8(src_0, rgb_to_rgba_shuffle), alpha_mask));
+        _mm_storeu_si128(dst_ptr + 1, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(src_1, src_0, 12), rgb_to_rgba_shuffle), alpha_mask));
+        _mm_storeu_si128(dst_ptr + 2, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(src_2, src_1, 8), rgb_to_rgba_shuffle), alpha_mask));
+        _mm_storeu_si128(dst_ptr + 3, _mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(src_2, 4), rgb_to_rgba_shuffle), alpha_mask));
+    }
+    return pixel_index;
+}
+
+// Logarithm of positive normal values: exponent bits plus series of 2/ln(2) * atanh((m - 1) / (m + 1)) for mantissa m in [1, 2)
+[[nodiscard]]
+static __m128 GetLog2Sse(__m128 value) noexcept
+{
+    const __m128  one        = _mm_set1_ps(1.F);
+    const __m128i value_bits = _mm_castps_si128(value);
+    const __m128  exponent   = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(value_bits, 23), _mm_set1_epi32(127)));
+    const __m128  mantissa   = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(value_bits, _mm_set1_epi32(0x007FFFFF)), _mm_castps_si128(one)));
+    const __m128  y          = _mm_div_ps(_mm_sub_ps(mantissa, one), _mm_add_ps(mantissa, one));
+    const __m128  y_sqr      = _mm_mul_ps(y, y);
+    __m128 series = _mm_set1_ps(1.F / 11.F);
+    for(const float coefficient : { 1.F / 9.F, 1.F / 7.F, 1.F / 5.F, 1.F / 3.F, 1.F })
+        series = _mm_add_ps(_mm_mul_ps(series, y_sqr), _mm_set1_ps(coefficient));
+    return _mm_add_ps(exponent, _mm_mul_ps(_mm_mul_ps(series, y), _mm_set1_ps(2.F / 0.69314718F)));
+}
+
+// Power of two: integer part is written to exponent bits, fractional part in [-0.5, 0.5] is evaluated with Taylor series of e^(f * ln(2))
+[[nodiscard]]
+static __m128 GetExp2Sse(__m128 value) noexcept
+{
+    const __m128i integer_part = _mm_cvtps_epi32(value);
+    const __m128  x = _mm_mul_ps(_mm_sub_ps(value, _mm_cvtepi32_ps(integer_part)), _mm_set1_ps(0.69314718F));
+    __m128 series = _mm_set1_ps(1.F / 720.F);
+    for(const float coefficient : { 1.F / 120.F, 1.F / 24.F, 1.F / 6.F, 1.F / 2.F, 1.F, 1.F })
+        series = _mm_add_ps(_mm_mul_ps(series, x), _mm_set1_ps(coefficient));
+    return _mm_mul_ps(series, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(integer_part, _mm_set1_epi32(127)), 23)));
+}
+
+// Converts vector of one RGBA pixel with unorm channels to linear color space, while alpha channel is kept linear
+[[nodiscard]]
+static __m128 ConvertSrgbToLinearSse(__m128 unorm_pixel) noexcept
+{
+    const __m128 alpha_lane_mask  = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+    const __m128 is_linear_mask   = _mm_or_ps(_mm_cmple_ps(unorm_pixel, _mm_set1_ps(g_srgb_linear_threshold)), alpha_lane_mask);
+    const __m128 linear_segment   = _mm_mul_ps(unorm_pixel, _mm_set1_ps(g_srgb_linear_scale));
+    const __m128 base             = _mm_mul_ps(_mm_add_ps(unorm_pixel, _mm_set1_ps(g_srgb_offset)), _mm_set1_ps(1.F / g_srgb_offset_scale));
+    const __m128 power_segment    = _mm_mul_ps(_mm_mul_ps(base, base), GetExp2Sse(_mm_mul_ps(GetLog2Sse(base), _mm_set1_ps(g_srgb_gamma - 2.F))));
+    const __m128 color_pixel      = _mm_or_ps(_mm_and_ps(is_linear_mask, linear_segment), _mm_andnot_ps(is_linear_mask, power_segment));
+    return _mm_or_ps(_mm_and_ps(alpha_lane_mask, unorm_pixel), _mm_andnot_ps(alpha_lane_mask, color_pixel));
+}
+
+// Returns count of converted pixels, which is a multiple of 4 pixels loaded with one vector
+template<bool is_srgb_color_space>
+METHANE_SSSE3_TARGET
+static size_t ConvertRgba8ToFloatSsse3(const Data::Byte* rgba_pixels_ptr, float* float_pixels_ptr, size_t pixels_count) noexcept
+{
+    // Each pixel of 4 loaded with one vector is shuffled to the vector of its zero-extended 32-bit channels
+    const __m128i pixel_shuffles[4]{ // NOSONAR - std::array ignores vector type attributes
+        _mm_setr_epi8(0, -1, -1, -1, 1, -1, -1, -1, 2, -1, -1, -1, 3, -1, -1, -1),
+        _mm_setr_epi8(4, -1, -1, -1, 5, -1, -1, -1, 6, -1, -1, -1, 7, -1, -1, -1),
+        _mm_setr_epi8(8, -1, -1, -1, 9, -1, -1, -1, 10, -1, -1, -1, 11, -1, -1, -1),
+        _mm_setr_epi8(12, -1, -1, -1, 13, -1, -1, -1, 14, -1, -1, -1, 15, -1, -1, -1)
+    };
+    const __m128 unorm_scale = _mm_set1_ps(g_unorm_scale);
+    size_t pixel_index = 0U;
+    for(; pixel_index + std::size(pixel_shuffles) <= pixels_count; pixel_index += std::size(pixel_shuffles))
+    {
+        const __m128i src_pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba_pixels_ptr + pixel_index * 4U)); // NOSONAR
+        for(size_t pixel_offset = 0U; pixel_offset < std::size(pixel_shuffles); ++pixel_offset)
+        {
+            const __m128 unorm_pixel = _mm_mul_ps(_mm_cvtepi32_ps(_mm_shuffle_epi8(src_pixels, pixel_shuffles[pixel_offset])), unorm_scale);
+            _mm_storeu_ps(float_pixels_ptr + (pixel_index + pixel_offset) * 4U,
+                          is_srgb_color_space ? ConvertSrgbToLinearSse(unorm_pixel) : unorm_pixel);
+        }
+    }
+    return pixel_index;
+}
+
+#elif defined(METHANE_PIXEL_CONVERSION_NEON)
+
+// Division by Newton-Raphson refined reciprocal estimate, which is available on all NEON targets
+[[nodiscard]]
+static float32x4_t DivideNeon(float32x4_t dividend, float32x4_t divisor) noexcept
+{
+    float32x4_t reciprocal = vrecpeq_f32(divisor);
+    reciprocal = vmulq_f32(vrecpsq_f32(divisor, reciprocal), reciprocal);
+    reciprocal = vmulq_f32(vrecpsq_f32(divisor, reciprocal), reciprocal);
+    return vmulq_f32(dividend, reciprocal);
+}
+
+// Logarithm of positive normal values: exponent bits plus series of 2/ln(2) * atanh((m - 1) / (m + 1)) for mantissa m in [1, 2)
+[[nodiscard]]
+static float32x4_t GetLog2Neon(float32x4_t value) noexcept
+{
+    const float32x4_t one        = vdupq_n_f32(1.F);
+    const int32x4_t   value_bits = vreinterpretq_s32_f32(value);
+    const float32x4_t exponent   = vcvtq_f32_s32(vsubq_s32(vshrq_n_s32(value_bits, 23), vdupq_n_s32(127)));
+    const float32x4_t mantissa   = vreinterpretq_f32_s32(vorrq_s32(vandq_s32(value_bits, vdupq_n_s32(0x007FFFFF)), vreinterpretq_s32_f32(one)));
+    const float32x4_t y          = DivideNeon(vsubq_f32(mantissa, one), vaddq_f32(mantissa, one));
+    const float32x4_t y_sqr      = vmulq_f32(y, y);
+    float32x4_t series = vdupq_n_f32(1.F / 11.F);
+    for(const float coefficient : { 1.F / 9.F, 1.F / 7.F, 1.F / 5.F, 1.F / 3.F, 1.F })
+        series = vmlaq_f32(vdupq_n_f32(coefficient), series, y_sqr);
+    return vmlaq_f32(exponent, vmulq_f32(series, y), vdupq_n_f32(2.F / 0.69314718F));
+}
+
+// Power of two: integer part is written to exponent bits, fractional part in [-0.5, 0.5] is evaluated with Taylor series of e^(f * ln(2))
+[[nodiscard]]
+static float32x4_t GetExp2Neon(float32x4_t value) noexcept
+{
+    const float32x4_t half_away_from_zero = vbslq_f32(vcltq_f32(value, vdupq_n_f32(0.F)), vdupq_n_f32(-0.5F), vdupq_n_f32(0.5F));
+    const int32x4_t   integer_part        = vcvtq_s32_f32(vaddq_f32(value, half_away_from_zero));
+    const float32x4_t x = vmulq_f32(vsubq_f32(value, vcvtq_f32_s32(integer_part)), vdupq_n_f32(0.69314718F));
+    float32x4_t series = vdupq_n_f32(1.F / 720.F);
+    for(const float coefficient : { 1.F / 120.F, 1.F / 24.F, 1.F / 6.F, 1.F / 2.F, 1.F, 1.F })
+        series = vmlaq_f32(vdupq_n_f32(coefficient), series, x);
+    return vmulq_f32(series, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(integer_part, vdupq_n_s32(127)), 23)));
+}
+
+// Converts vector of one RGBA pixel with unorm channels to linear color space, while alpha channel is kept linear
+[[nodiscard]]
+static float32x4_t ConvertSrgbToLinearNeon(float32x4_t unorm_pixel) noexcept
+{
+    static constexpr std::array<uint32_t, 4> s_alpha_lane{ 0U, 0U, 0U, ~0U };
+    const uint32x4_t  alpha_lane_mask = vld1q_u32(s_alpha_lane.data());
+    const uint32x4_t  is_linear_mask  = vorrq_u32(vcleq_f32(unorm_pixel, vdupq_n_f32(g_srgb_linear_threshold)), alpha_lane_mask);
+    const float32x4_t linear_segment  = vmulq_f32(unorm_pixel, vdupq_n_f32(g_srgb_linear_scale));
+    const float32x4_t base            = vmulq_f32(vaddq_f32(unorm_pixel, vdupq_n_f32(g_srgb_offset)), vdupq_n_f32(1.F / g_srgb_offset_scale));
+    const float32x4_t power_segment   = vmulq_f32(vmulq_f32(base, base), GetExp2Neon(vmulq_f32(GetLog2Neon(base), vdupq_n_f32(g_srgb_gamma - 2.F))));
+    return vbslq_f32(alpha_lane_mask, unorm_pixel, vbslq_f32(is_linear_mask, linear_segment, power_segment));
+}
+
+// Returns count of converted pixels, which is a multiple of 4 pixels loaded with one vector
+template<bool is_srgb_color_space>
+static size_t ConvertRgba8ToFloatNeon(const Data::Byte* rgba_pixels_ptr, float* float_pixels_ptr, size_t pixels_count) noexcept
+{
+    const float32x4_t unorm_scale = vdupq_n_f32(g_unorm_scale);
+    size_t pixel_index = 0U;
+    for(; pixel_index + 4U <= pixels_count; pixel_index += 4U)
+    {
+        // Channels of 4 loaded pixels are zero-extended to 16-bit vectors of pixel pairs and then to 32-bit vectors of one pixel
+        const uint8x16_t src_pixels = vld1q_u8(reinterpret_cast<const uint8_t*>(rgba_pixels_ptr + pixel_index * 4U)); // NOSONAR
+        const uint16x8_t low_pixels_pair  = vmovl_u8(vget_low_u8(src_pixels));
+        const uint16x8_t high_pixels_pair = vmovl_u8(vget_high_u8(src_pixels));
+        const uint32x4_t pixels[4]{ // NOSONAR - std::array ignores vector type attributes
+            vmovl_u16(vget_low_u16(low_pixels_pair)),  vmovl_u16(vget_high_u16(low_pixels_pair)),
+            vmovl_u16(vget_low_u16(high_pixels_pair)), vmovl_u16(vget_high_u16(high_pixels_pair))
+        };
+        for(size_t pixel_offset = 0U; pixel_offset < std::size(pixels); ++pixel_offset)
+        {
+            const float32x4_t unorm_pixel = vmulq_f32(vcvtq_f32_u32(pixels[pixel_offset]), unorm_scale);
+            vst1q_f32(float_pixels_ptr + (pixel_index + pixel_offset) * 4U,
+                      is_srgb_color_space ? ConvertSrgbToLinearNeon(unorm_pixel) : unorm_pixel);
+        }
+    }
+    return pixel_index;
+}
+
+#endif // defined(METHANE_PIXEL_CONVERSION_SSSE3) || defined(METHANE_PIXEL_CONVERSION_NEON)
+
+template<bool is_srgb_color_space>
+static void ConvertRgba8ToFloat(const Data::Byte* rgba_pixels_ptr, float* float_pixels_ptr, size_t pixels_count) noexcept
+{
+    size_t pixel_index = 0U;
+
+#if defined(METHANE_PIXEL_CONVERSION_SSSE3)
+    static const bool s_is_ssse3_supported = IsSsse3Supported();
+    if (s_is_ssse3_supported)
+        pixel_index = ConvertRgba8ToFloatSsse3<is_srgb_color_space>(rgba_pixels_ptr, float_pixels_ptr, pixels_count);
+#elif defined(METHANE_PIXEL_CONVERSION_NEON)
+    pixel_index = ConvertRgba8ToFloatNeon<is_srgb_color_space>(rgba_pixels_ptr, float_pixels_ptr, pixels_count);
+#endif
+
+    // Table lookup of color channels in scalar tail gives exact values of transfer function
+    const std::array<float, 256>& srgb_to_linear_table = GetSrgbToLinearTable();
+    for(; pixel_index < pixels_count; ++pixel_index)
+    {
+        const auto* src_pixel_ptr = reinterpret_cast<const uint8_t*>(rgba_pixels_ptr + pixel_index * 4U); // NOSONAR
+        float*      dst_pixel_ptr = float_pixels_ptr + pixel_index * 4U;
+        for(size_t channel = 0U; channel < 3U; ++channel)
+        {
+            dst_pixel_ptr[channel] = is_srgb_color_space
+                                   ? srgb_to_linear_table[src_pixel_ptr[channel]]
+                                   : static_cast<float>(src_pixel_ptr[channel]) * g_unorm_scale;
+        }
+        dst_pixel_ptr[3] = static_cast<float>(src_pixel_ptr[3]) * g_unorm_scale;
+    }
+}
+
+void ExpandRgbToRgba(const Data::Byte* rgb_pixels_ptr, Data::Byte* rgba_pixels_ptr, size_t pixels_count) noexcept
+{
+    META_FUNCTION_TASK();
+    size_t pixel_index = 0U;
+
+#if defined(METHANE_PIXEL_CONVERSION_SSSE3)
+    static const bool s_is_ssse3_supported = IsSsse3Supported();
+    if (s_is_ssse3_supported)
+        pixel_index = ExpandRgbToRgbaSsse3(rgb_pixels_ptr, rgba_pixels_ptr, pixels_count);
+#elif defined(METHANE_PIXEL_CONVERSION_NEON)
+    // 16 pixels are de-interleaved to separate channel vectors and interleaved back with alpha channel
+    const uint8x16_t alpha = vdupq_n_u8(255U);
+    for(; pixel_index + g_simd_pixels_count <= pixels_count; pixel_index += g_simd_pixels_count)
+    {
+        const uint8x16x3_t rgb = vld3q_u8(reinterpret_cast<const uint8_t*>(rgb_pixels_ptr + pixel_index * 3U)); // NOSONAR
+        const uint8x16x4_t rgba{ { rgb.val[0], rgb.val[1], rgb.val[2], alpha } };
+        vst4q_u8(reinterpret_cast<uint8_t*>(rgba_pixels_ptr + pixel_index * 4U), rgba); // NOSONAR
+    }
+#endif
+
+    for(; pixel_index < pixels_count; ++pixel_index)
+    {
+        const Data::Byte* src_pixel_ptr = rgb_pixels_ptr + pixel_index * 3U;
+        Data::Byte*       dst_pixel_ptr = rgba_pixels_ptr + pixel_index * 4U;
+        dst_pixel_ptr[0] = src_pixel_ptr[0];
+        dst_pixel_ptr[1] = src_pixel_ptr[1];
+        dst_pixel_ptr[2] = src_pixel_ptr[2];
+        dst_pixel_ptr[3] = Data::Byte{ 255U };
+    }
+}
+
+void ConvertSrgbToLinear(const Data::Byte* srgb_pixels_ptr, float* linear_pixels_ptr, size_t pixels_count) noexcept
+{
+    META_FUNCTION_TASK();
+    ConvertRgba8ToFloat<true>(srgb_pixels_ptr, linear_pixels_ptr, pixels_count);
+}
+
+void ConvertUnormToFloat(const Data::Byte* unorm_pixels_ptr, float* float_pixels_ptr, size_t pixels_count) noexcept
+{
+    META_FUNCTION_TASK();
+    ConvertRgba8ToFloat<false>(unorm_pixels_ptr, float_pixels_ptr, pixels_count);
+}
+
+} // namespace Methane::Graphics
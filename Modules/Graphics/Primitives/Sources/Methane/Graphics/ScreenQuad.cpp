@@ -113,7 +113,7 @@ public:
         static const QuadMesh<ScreenQuadVertex> s_quad_mesh(ScreenQuadVertex::layout, 2.F, 2.F);
         const Rhi::IShader::MacroDefinitions ps_macro_definitions = GetPixelShaderMacroDefinitions(m_settings.texture_mode);
         Rhi::ProgramArgumentAccessors program_argument_accessors {
-            { { Rhi::ShaderType::Pixel, "g_constants" }, Rhi::ProgramArgumentAccessType::Mutable }
+            { { Rhi::ShaderType::Pixel, "g_constants" }, Rhi::ProgramArgumentAccessType::Mutable, true }
         };
 
         if (m_settings.texture_mode != TextureMode::Disabled)
@@ -125,7 +125,7 @@ public:
         const std::string quad_name = GetQuadName(m_settings, ps_macro_definitions);
         const std::string state_name = fmt::format("{} Render State", quad_name);
 
-        if (const Ptr<Rhi::IRenderState> render_state_ptr = std::dynamic_pointer_cast<Rhi::IRenderState>(render_context.GetObjectRegistry().GetGraphicsObject(state_name));
+        if (const Ptr<Rhi::IRenderState> render_state_ptr = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::IRenderState>(state_name);
             render_state_ptr)
         {
             m_render_state = Rhi::RenderState(render_state_ptr);
@@ -178,7 +178,7 @@ public:
         if (m_settings.texture_mode != TextureMode::Disabled)
         {
             static const std::string s_sampler_name = "Screen-Quad Sampler";
-            if (Ptr<Rhi::ISampler> texture_sampler_ptr = std::dynamic_pointer_cast<Rhi::ISampler>(render_context.GetObjectRegistry().GetGraphicsObject(s_sampler_name));
+            if (Ptr<Rhi::ISampler> texture_sampler_ptr = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::ISampler>(s_sampler_name);
                 texture_sampler_ptr)
             {
                 m_texture_sampler = Rhi::Sampler(texture_sampler_ptr);
@@ -197,7 +197,7 @@ public:
         }
 
         static const std::string s_vertex_buffer_name = "Screen-Quad Vertex Buffer";
-        if (const Ptr<Rhi::IBuffer> vertex_buffer_ptr = std::dynamic_pointer_cast<Rhi::IBuffer>(render_context.GetObjectRegistry().GetGraphicsObject(s_vertex_buffer_name));
+        if (const Ptr<Rhi::IBuffer> vertex_buffer_ptr = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::IBuffer>(s_vertex_buffer_name);
             vertex_buffer_ptr)
         {
             Rhi::Buffer vertex_buffer(vertex_buffer_ptr);
@@ -223,7 +223,7 @@ public:
         }
 
         static const std::string s_index_buffer_name = "Screen-Quad Index Buffer";
-        if (const Ptr<Rhi::IBuffer> index_buffer_ptr = std::dynamic_pointer_cast<Rhi::IBuffer>(render_context.GetObjectRegistry().GetGraphicsObject(s_index_buffer_name));
+        if (const Ptr<Rhi::IBuffer> index_buffer_ptr = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::IBuffer>(s_index_buffer_name);
             index_buffer_ptr)
         {
             m_index_buffer = Rhi::Buffer(index_buffer_ptr);
@@ -245,8 +245,10 @@ public:
             render_context.GetObjectRegistry().AddGraphicsObject(m_index_buffer.GetInterface());
         }
 
-        m_const_buffer = render_context.CreateBuffer(
-            Rhi::BufferSettings::ForConstantBuffer(static_cast<Data::Size>(sizeof(hlslpp::ScreenQuadConstants))));
+        // Constants buffer is written by CPU directly without staging copy, when supported by RHI
+        Rhi::BufferSettings const_buffer_settings = Rhi::BufferSettings::ForConstantBuffer(static_cast<Data::Size>(sizeof(hlslpp::ScreenQuadConstants)), true);
+        const_buffer_settings.is_direct_cpu_write = true;
+        m_const_buffer = render_context.CreateBuffer(const_buffer_settings);
         m_const_buffer.SetName(fmt::format("{} Screen-Quad Constants Buffer", m_settings.name));
 
         Rhi::ProgramBindings::ResourceViewsByArgument program_binding_resource_views = {
@@ -46,6 +46,7 @@ namespace Methane::Graphics::Base
 
 class CommandQueue;
 class ProgramBindings;
+class Resource;
 class CommandListDebugGroup;
 
 class CommandList // NOSONAR - custom destructor is used for logging, class has more than 35 methods
@@ -99,6 +100,11 @@ public:
     inline void RetainResource(Object& resource)                  { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
     inline void ReleaseRetainedResources()                        { m_command_state.retained_resources.clear(); }
 
+    // Index of the last upload batch, which has to be synchronized with command queue before executing this command list
+    virtual uint64_t GetRequiredUploadBatchIndex() const noexcept { return m_required_upload_batch_index; }
+    void RequireResourceUpload(const Resource& resource);
+    void RequireResourceUpload(const ProgramBindings& program_bindings);
+
     template<typename T, typename = std::enable_if_t<std::is_base_of_v<Object, T>>>
     inline void RetainResources(const Ptrs<T>& resource_ptrs)
     {
@@ -137,6 +143,7 @@ private:
     DebugGroupStack   m_open_debug_groups;
     CompletedCallback m_completed_callback;
     State             m_state = State::Pending;
+    uint64_t          m_required_upload_batch_index = 0U;
 
     mutable TracyLockable(std::recursive_mutex, m_state_mutex);
     TracyLockable(std::mutex,   m_state_change_mutex);
@@ -66,6 +66,7 @@ public:
 
 protected:
     void InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings);
+    void SynchronizeResourceUploads(const Rhi::ICommandListSet& command_lists);
 
 private:
     const Context&               m_context;
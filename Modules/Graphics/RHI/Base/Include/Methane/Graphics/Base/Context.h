@@ -29,8 +29,12 @@ Base implementation of the context interface.
 #include <Methane/Graphics/RHI/IContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Data/FrameMemoryPool.h>
+
+#include <tracy/Tracy.hpp>
 
 #include <array>
+#include <mutex>
 #include <string>
 
 namespace tf
@@ -70,9 +74,11 @@ public:
     [[nodiscard]] Ptr<Rhi::ICommandKit> CreateCommandKit(Rhi::CommandListType type) const final;
     Type                        GetType() const noexcept override                       { return m_type; }
     tf::Executor&               GetParallelExecutor() const noexcept override           { return m_parallel_executor; }
+    Data::FrameMemoryPool&      GetFrameMemoryPool() const noexcept override            { return m_frame_memory_pool; }
     Rhi::IObjectRegistry&       GetObjectRegistry() noexcept override                   { return m_objects_cache; }
     const Rhi::IObjectRegistry& GetObjectRegistry() const noexcept override             { return m_objects_cache; }
     void                        RequestDeferredAction(DeferredAction action) const noexcept override;
+    void                        ExecuteResourceUploads() const override;
     void                        CompleteInitialization() override;
     bool                        IsCompletingInitialization() const noexcept override    { return m_is_completing_initialization; }
     void                        WaitForGpu(WaitFor wait_for) override;
@@ -95,12 +101,23 @@ public:
     const Device&       GetBaseDevice() const;
     Rhi::IDescriptorManager& GetDescriptorManager() const;
 
+    // Resource uploads are tracked with indices of upload batches, executed one after another in upload command queue
+    Rhi::ICommandList&  GetUploadCommandListForEncoding() const;
+    Rhi::ICommandList&  GetUploadCommandListForEncoding(uint64_t& encoding_upload_batch_index) const;
+    Rhi::CommandListId  GetPostUploadSyncCommandListId(uint64_t upload_batch_index) const noexcept;
+    uint64_t            GetEncodingUploadBatchIndex() const;
+    uint64_t            GetExecutedUploadBatchesCount() const;
+    uint64_t            GetSynchronizedUploadBatchIndex() const;
+    bool                HasUnsynchronizedUploads() const;
+    bool                IsAsyncResourceUploads() const noexcept;
+    void                SynchronizeResourceUploads(Rhi::ICommandQueue& target_cmd_queue, uint64_t upload_batch_index) const;
+
 protected:
     void PerformRequestedAction();
     void SetDevice(Device& device);
 
     // Context interface
-    virtual bool UploadResources();
+    virtual bool UploadResources() const;
     virtual void OnGpuWaitStart(WaitFor);
     virtual void OnGpuWaitComplete(WaitFor wait_for);
 
@@ -109,17 +126,24 @@ private:
     using CommandKitByQueue   = std::map<Rhi::ICommandQueue*, Ptr<Rhi::ICommandKit>>;
 
     template<Rhi::CommandListPurpose cmd_list_purpose>
-    void ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit) const;
+    void ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit,
+                                 Rhi::CommandListId cmd_list_id = static_cast<Rhi::CommandListId>(cmd_list_purpose)) const;
 
     const Type                         m_type;
     Ptr<Device>                        m_device_ptr;
     UniquePtr<Rhi::IDescriptorManager> m_descriptor_manager_ptr;
     tf::Executor&                      m_parallel_executor;
     ObjectRegistry                     m_objects_cache;
+    mutable Data::FrameMemoryPool      m_frame_memory_pool;
     mutable CommandKitPtrByType        m_default_command_kit_ptrs;
     mutable CommandKitByQueue          m_default_command_kit_ptr_by_queue;
     mutable DeferredAction             m_requested_action = DeferredAction::None;
     mutable bool                       m_is_completing_initialization = false;
+    mutable Rhi::CommandListId         m_upload_cmd_list_id = 0U;
+    mutable uint64_t                   m_encoded_upload_batch_index = 0U;
+    mutable uint64_t                   m_executed_upload_batches_count = 0U;
+    mutable uint64_t                   m_synchronized_upload_batch_index = 0U;
+    mutable TracyLockable(std::recursive_mutex, m_upload_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -46,10 +46,10 @@ public:
     void WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue) override;
     void FlushOnCpu() override;
     void FlushOnGpu(Rhi::ICommandQueue& wait_on_command_queue) override;
+    uint64_t GetValue() const noexcept override { return m_value; }
 
 protected:
     CommandQueue& GetCommandQueue() noexcept { return m_command_queue; }
-    uint64_t      GetValue() const noexcept  { return m_value; }
 
 private:
     CommandQueue& m_command_queue;
@@ -27,7 +27,7 @@ Base implementation of the named object interface.
 #include <Methane/Memory.hpp>
 #include <Methane/Data/Emitter.hpp>
 
-#include <map>
+#include <unordered_map>
 
 namespace Methane::Graphics::Base
 {
@@ -37,17 +37,52 @@ class ObjectRegistry final
     , private Data::Receiver<Rhi::IObjectCallback>
 {
 public:
-    void              AddGraphicsObject(Rhi::IObject& object) override;
+    using Rhi::IObjectRegistry::GetGraphicsObject;
+    using Rhi::IObjectRegistry::HasGraphicsObject;
+
+    template<typename T>
+    std::enable_if_t<std::is_base_of_v<Rhi::IObject, T>> AddGraphicsObject(T& object)
+    { Rhi::IObjectRegistry::AddGraphicsObject(object); }
+
+    // IObjectRegistry interface
     void              RemoveGraphicsObject(Rhi::IObject& object) override;
-    Ptr<Rhi::IObject> GetGraphicsObject(const std::string& object_name) const noexcept override;
-    bool              HasGraphicsObject(const std::string& object_name) const noexcept override;
+    Ptr<Rhi::IObject> GetGraphicsObject(const Rhi::ObjectName& object_name) const noexcept override;
+    bool              HasGraphicsObject(const Rhi::ObjectName& object_name) const noexcept override;
+
+    [[nodiscard]] size_t GetGraphicsObjectsCount() const noexcept { return m_object_by_name_id.size(); }
+
+protected:
+    // IObjectRegistry interface
+    void      AddGraphicsObject(Rhi::IObject& object, Rhi::ObjectTypeId object_type_id, const Ptr<void>& typed_object_ptr) override;
+    Ptr<void> GetTypedGraphicsObject(const Rhi::ObjectName& object_name, Rhi::ObjectTypeId object_type_id) const noexcept override;
 
 private:
+    struct Entry
+    {
+        std::string            name;       // compared on name identifier match to resolve hash collisions
+        const Rhi::IObject*    object_ptr; // used for identity checks of objects being destroyed
+        WeakPtr<Rhi::IObject>  object_wptr;
+        WeakPtr<void>          typed_object_wptr;
+        Rhi::ObjectTypeId      object_type_id;
+    };
+
+    // Name identifiers are hashes already, so they are used as hash values as is
+    struct NameIdHash
+    {
+        size_t operator()(Rhi::ObjectNameId name_id) const noexcept { return static_cast<size_t>(name_id); }
+    };
+
+    // Objects with colliding name identifiers are stored under the same key
+    using EntryByNameId = std::unordered_multimap<Rhi::ObjectNameId, Entry, NameIdHash>;
+
+    [[nodiscard]] EntryByNameId::iterator       FindEntry(const Rhi::ObjectName& object_name) noexcept;
+    [[nodiscard]] EntryByNameId::const_iterator FindEntry(const Rhi::ObjectName& object_name) const noexcept;
+
     // IObjectCallback callback
     void OnObjectNameChanged(Rhi::IObject& object, const std::string& old_name) override;
     void OnObjectDestroyed(Rhi::IObject& object) override;
 
-    std::map<std::string, WeakPtr<Rhi::IObject>, std::less<>> m_object_by_name;
+    EntryByNameId m_object_by_name_id;
 };
 
 class Object // NOSONAR - destructor is required
@@ -71,6 +106,7 @@ public:
     // IObject interface
     bool               SetName(std::string_view name) override;
     std::string_view   GetName() const noexcept override { return m_name; }
+    Rhi::ObjectNameId  GetNameId() const noexcept override { return m_name_id; }
     Ptr<Rhi::IObject>  GetPtr() override;
 
     Ptr<Object>        GetBasePtr()                { return shared_from_this(); }
@@ -81,7 +117,8 @@ public:
     { return std::static_pointer_cast<T>(GetBasePtr()); }
 
 private:
-    std::string m_name;
+    std::string       m_name;
+    Rhi::ObjectNameId m_name_id = Rhi::GetObjectNameId({});
 };
 
 } // namespace Methane::Graphics::Base
@@ -32,6 +32,12 @@ Base implementation of the parallel render command list interface.
 #include <string>
 #include <string_view>
 
+namespace tf
+{
+// TaskFlow Taskflow class forward declaration from <taskflow/core/taskflow.hpp>
+class Taskflow;
+}
+
 namespace Methane::Graphics::Rhi
 {
 
@@ -48,7 +54,8 @@ class ParallelRenderCommandList
 {
 public:
     ParallelRenderCommandList(CommandQueue& command_queue, RenderPass& render_pass);
-    
+    ~ParallelRenderCommandList() override;
+
     using CommandList::Reset;
 
     // IParallelRenderCommandList interface
@@ -64,6 +71,7 @@ public:
     void SetResourceBarriers(const Rhi::IResourceBarriers&) override { META_FUNCTION_NOT_IMPLEMENTED_DESCR("Can not set resource barriers on parallel render command list."); }
     void Execute(const ICommandList::CompletedCallback& completed_callback) override;
     void Complete() override;
+    uint64_t GetRequiredUploadBatchIndex() const noexcept override;
 
     // ICommandList interface
     void PushDebugGroup(IDebugGroup&) override  { META_FUNCTION_NOT_IMPLEMENTED_DESCR("Can not use debug groups on parallel render command list."); }
@@ -91,6 +99,8 @@ private:
     Ptrs<RenderCommandList>       m_parallel_command_lists;
     Refs<Rhi::IRenderCommandList> m_parallel_command_lists_refs;
     bool                          m_is_validation_enabled = true;
+    UniquePtr<tf::Taskflow>       m_commit_task_flow_ptr;   // re-runnable commit graph for current count of command lists
+    Data::Size                    m_commit_task_flow_size = 0U;
 };
 
 } // namespace Methane::Graphics::Base
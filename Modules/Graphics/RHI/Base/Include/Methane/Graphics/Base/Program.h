@@ -72,6 +72,7 @@ protected:
 
     Rhi::IShader& GetShaderRef(Rhi::ShaderType shader_type) const;
     uint32_t GetInputBufferIndexByArgumentSemantic(const std::string& argument_semantic) const;
+    PixelFormat GetInputArgumentFormatBySemantic(const std::string& argument_semantic) const;
 
     using ShadersByType = std::array<Ptr<Rhi::IShader>, magic_enum::enum_count<Rhi::ShaderType>() - 1>;
     static ShadersByType CreateShadersByType(const Ptrs<Rhi::IShader>& shaders);
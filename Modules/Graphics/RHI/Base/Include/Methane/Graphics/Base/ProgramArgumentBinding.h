@@ -59,10 +59,11 @@ public:
 
 protected:
     const Context& GetContext() const noexcept { return m_context; }
+    void SetResourceType(Rhi::IResource::Type resource_type) noexcept { m_settings.resource_type = resource_type; }
 
 private:
     const Context&     m_context;
-    const Settings     m_settings;
+    Settings           m_settings;
     Rhi::ResourceViews m_resource_views;
 };
 
@@ -70,6 +70,7 @@ public:
     virtual void Apply(CommandList& command_list, ApplyBehaviorMask apply_behavior = ApplyBehaviorMask(~0U)) const = 0;
 
     Rhi::IProgram::Arguments GetUnboundArguments() const;
+    uint64_t GetUploadBatchIndex() const;
 
     template<typename CommandListType>
     void ApplyResourceTransitionBarriers(CommandListType& command_list,
@@ -45,6 +45,7 @@ class ParallelRenderCommandList;
 class ViewState;
 class RenderState;
 class RenderPass;
+class RenderCommandSequence;
 class BufferSet;
 class Buffer;
 class Texture;
@@ -96,6 +97,11 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void ReplayCommandSequence(Rhi::IRenderCommandSequence& command_sequence) override;
+    void DrawIndexedIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+    void DrawIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
 
     bool        HasPass() const noexcept     { return !!m_render_pass_ptr; }
     RenderPass* GetPassPtr() const noexcept  { return m_render_pass_ptr.get(); }
@@ -105,12 +111,25 @@ protected:
     // CommandList overrides
     void ResetCommandState() override;
 
+    // Commands of the sequence are replayed on CPU by default, RHI backends override it to execute native command bundles
+    virtual void ExecuteCommandSequence(RenderCommandSequence& command_sequence);
+
+    // Resource barriers can not be encoded in native bundles, so they are set in command list before bundle execution
+    void SetCommandSequenceResourceStates(const RenderCommandSequence& command_sequence);
+
+    // Encoder state is undefined after native bundle execution, so render and view states are applied again,
+    // while buffers and program bindings have to be set again before next draws
+    void RestoreDrawingStateAfterBundle();
+
     DrawingState&       GetDrawingState()       { return m_drawing_state; }
     const DrawingState& GetDrawingState() const { return m_drawing_state; }
     bool                IsParallel() const      { return m_is_parallel; }
 
     inline void UpdateDrawingState(Primitive primitive_type);
     inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count = 0) const;
+    void ValidateDrawIndirectBuffers(const Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, Data::Size arguments_size,
+                                     uint32_t max_draw_count, const Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) const;
+    void RetainDrawIndirectBuffers(Rhi::IBuffer& arguments_buffer, Rhi::IBuffer* draw_count_buffer_ptr);
 
 private:
     const bool            m_is_parallel = false;
@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/RenderCommandSequence.h
+Base implementation of the render command sequence interface,
+which records commands on CPU side and replays them to render command list.
+NOTE: RHI backends with native command bundles (Vulkan secondary command buffers, DirectX 12 bundles)
+      encode recorded commands once and cache the native bundle in the sequence until it is reset or invalidated,
+      while other backends (Null, Metal) fall back to encoding commands again in every command list on replay.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Object.h"
+
+#include <Methane/Graphics/RHI/IRenderCommandSequence.h>
+#include <Methane/Graphics/RHI/IProgramBindings.h>
+#include <Methane/Data/Emitter.hpp>
+#include <Methane/Data/Receiver.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include <variant>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+namespace Methane::Graphics::Base
+{
+
+class RenderPattern;
+class RenderState;
+class ProgramBindings;
+class BufferSet;
+class Buffer;
+class RenderCommandList;
+
+class RenderCommandSequence final
+    : public Rhi::IRenderCommandSequence
+    , public Object
+    , public Data::Emitter<Rhi::IRenderCommandSequenceCallback>
+    , public Data::Receiver<Rhi::IProgramArgumentBindingCallback>
+{
+public:
+    struct SetRenderStateCommand
+    {
+        Ptr<RenderState>          render_state_ptr;
+        Rhi::RenderStateGroupMask state_groups;
+    };
+
+    struct SetProgramBindingsCommand
+    {
+        Ptr<ProgramBindings>                  program_bindings_ptr;
+        Rhi::ProgramBindingsApplyBehaviorMask apply_behavior;
+    };
+
+    struct SetVertexBuffersCommand
+    {
+        Ptr<BufferSet> vertex_buffers_ptr;
+        bool           set_resource_barriers;
+    };
+
+    struct SetIndexBufferCommand
+    {
+        Ptr<Buffer> index_buffer_ptr;
+        bool        set_resource_barriers;
+    };
+
+    struct DrawIndexedCommand
+    {
+        Primitive primitive;
+        uint32_t  index_count;
+        uint32_t  start_index;
+        uint32_t  start_vertex;
+        uint32_t  instance_count;
+        uint32_t  start_instance;
+    };
+
+    struct DrawCommand
+    {
+        Primitive primitive;
+        uint32_t  vertex_count;
+        uint32_t  start_vertex;
+        uint32_t  instance_count;
+        uint32_t  start_instance;
+    };
+
+    using Command = std::variant<SetRenderStateCommand, SetProgramBindingsCommand, SetVertexBuffersCommand,
+                                 SetIndexBufferCommand, DrawIndexedCommand, DrawCommand>;
+    using Commands = std::vector<Command>;
+
+    explicit RenderCommandSequence(RenderPattern& render_pattern);
+
+    // IRenderCommandSequence interface
+    Rhi::IRenderPattern& GetRenderPattern() const noexcept final;
+    State      GetState() const noexcept final         { return m_state; }
+    Data::Size GetCommandsCount() const noexcept final { return static_cast<Data::Size>(m_commands.size()); }
+    void Reset() override;
+    void SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups) override;
+    void SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) override;
+    void SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers) override;
+    void SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers) override;
+    void DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                     uint32_t instance_count, uint32_t start_instance) override;
+    void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+              uint32_t instance_count, uint32_t start_instance) override;
+    void Commit() override;
+
+    void Replay(RenderCommandList& render_command_list) const;
+
+    const Commands& GetCommands() const noexcept { return m_commands; }
+
+    // Native bundle is encoded from recorded commands by RHI backend and is dropped on sequence reset or invalidation
+    Ptr<Object> GetNativeBundle() const;
+    void        SetNativeBundle(const Ptr<Object>& native_bundle_ptr);
+
+private:
+    // IProgramArgumentBindingCallback
+    void OnProgramArgumentBindingResourceViewsChanged(const Rhi::IProgramArgumentBinding&, const Rhi::IResource::Views&, const Rhi::IResource::Views&) override;
+
+    void VerifyRecordingState() const;
+    void Invalidate();
+
+    const Ptr<RenderPattern> m_render_pattern_ptr;
+    Commands                 m_commands;
+    const ProgramBindings*   m_last_program_bindings_ptr = nullptr;
+    std::atomic<State>       m_state{ State::Empty };
+    Ptr<Object>              m_native_bundle_ptr;
+    mutable TracyLockable(std::mutex, m_native_bundle_mutex);
+};
+
+} // namespace Methane::Graphics::Base
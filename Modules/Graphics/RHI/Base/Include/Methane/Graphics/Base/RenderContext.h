@@ -50,6 +50,7 @@ public:
     const Settings&         GetSettings() const noexcept final            { return m_settings; }
     uint32_t                GetFrameBufferIndex() const noexcept final    { return m_frame_buffer_index;  }
     uint32_t                GetFrameIndex() const noexcept final          { return m_frame_index; }
+    uint32_t                GetFramesInFlightCount() const noexcept final;
     const Rhi::IFpsCounter& GetFpsCounter() const noexcept final          { return m_fps_counter; }
     bool                    SetVSyncEnabled(bool vsync_enabled) override;
     bool                    SetFrameBuffersCount(uint32_t frame_buffers_count) override;
@@ -71,7 +72,7 @@ protected:
     Rhi::IFence& GetRenderFence() const;
 
     // Context overrides
-    bool UploadResources() override;
+    bool UploadResources() const override;
     void OnGpuWaitStart(WaitFor wait_for) override;
     void OnGpuWaitComplete(WaitFor wait_for) override;
 
@@ -82,10 +83,11 @@ private:
     void WaitForGpuRenderComplete();
     void WaitForGpuFramePresented();
 
-    Settings   m_settings;
-    uint32_t   m_frame_buffer_index = 0U;
-    uint32_t   m_frame_index = 0U;
-    FpsCounter m_fps_counter;
+    Settings              m_settings;
+    uint32_t              m_frame_buffer_index = 0U;
+    uint32_t              m_frame_index = 0U;
+    std::vector<uint32_t> m_in_flight_frame_buffer_indices; // frame buffer indices of the frames in flight by frame index
+    FpsCounter            m_fps_counter;
 };
 
 } // namespace Methane::Graphics::Base
@@ -32,6 +32,13 @@ Base implementation of the resource interface.
 #include <map>
 #include <mutex>
 
+namespace Methane::Graphics::Rhi
+{
+
+struct ICommandList;
+
+} // namespace Methane::Graphics::Rhi
+
 namespace Methane::Graphics::Base
 {
 
@@ -65,11 +72,14 @@ public:
     void SetData(const SubResources& sub_resources, Rhi::ICommandQueue&) override;
 
     [[nodiscard]] Ptr<IBarriers>& GetSetupTransitionBarriers() noexcept  { return m_setup_transition_barriers_ptr; }
+    [[nodiscard]] uint64_t        GetUploadBatchIndex() const noexcept   { return m_upload_batch_index; }
 
 protected:
     [[nodiscard]] const Context& GetBaseContext() const noexcept         { return m_context; }
     [[nodiscard]] Data::Size     GetInitializedDataSize() const noexcept { return m_initialized_data_size; }
 
+    [[nodiscard]] Rhi::ICommandList& GetUploadCommandListForEncoding();
+
     void  SetSubResourceCount(const SubResource::Count& sub_resource_count);
     void  ValidateSubResource(const SubResource& sub_resource) const;
     void  ValidateSubResource(const SubResource::Index& sub_resource_index, const std::optional<BytesRange>& sub_resource_data_range) const;
@@ -93,6 +103,7 @@ private:
     Ptr<IBarriers>     m_setup_transition_barriers_ptr;
     Opt<uint32_t>      m_owner_queue_family_index_opt;
     bool               m_is_state_change_updates_barriers = true;
+    uint64_t           m_upload_batch_index = 0U;
     TracyLockable(std::mutex, m_state_mutex);
 };
 
@@ -41,6 +41,9 @@ public:
     // ITexture interface
     const Settings& GetSettings() const override { return m_settings; }
     Data::Size      GetDataSize(Data::MemoryState size_type = Data::MemoryState::Reserved) const noexcept override;
+    Data::Size      GetStagingDataSize(const SubResources& sub_resources) const override;
+    void            SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                                          Rhi::IBuffer& staging_buffer, Data::Size staging_offset) override;
 
     static Data::Size GetRequiredMipLevelsCount(const Dimensions& dimensions);
 
@@ -48,6 +51,15 @@ protected:
     // Resource overrides
     Data::Size CalculateSubResourceDataSize(const SubResource::Index& sub_resource_index) const override;
 
+    // Data range of texture sub-resource selects a slice of whole rows of pixel blocks, returns range of block rows
+    Data::Range<Data::Index> GetSubResourceBlockRows(const SubResource& sub_resource) const;
+
+    // Sub-resources data is packed in staging buffer one after another, each sub-resource starts at aligned offset
+    static Data::Size AlignStagingDataOffset(Data::Size staging_offset) noexcept;
+
+    // MIP levels are generated on GPU when some levels are missing in uploaded data, except sliced data uploads with data ranges
+    bool IsMipLevelsGenerationRequired(const SubResources& sub_resources) const;
+
     static void ValidateDimensions(DimensionType dimension_type, const Dimensions& dimensions, bool mipmapped);
 
 private:
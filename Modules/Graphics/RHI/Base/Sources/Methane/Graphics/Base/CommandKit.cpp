@@ -30,6 +30,7 @@ Methane command kit implementation.
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Graphics/RHI/ICommandListDebugGroup.h>
 #include <Methane/Graphics/RHI/ITransferCommandList.h>
+#include <Methane/Graphics/RHI/IComputeCommandList.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
@@ -119,6 +120,7 @@ Rhi::ICommandList& CommandKit::GetList(Rhi::CommandListId cmd_list_id = 0U) cons
     {
     case Rhi::CommandListType::Transfer: cmd_list_ptr = Rhi::ITransferCommandList::Create(GetQueue()); break;
     case Rhi::CommandListType::Render:   cmd_list_ptr = RenderCommandList::CreateForSynchronization(GetQueue()); break;
+    case Rhi::CommandListType::Compute:  cmd_list_ptr = Rhi::IComputeCommandList::Create(GetQueue()); break;
     default: META_UNEXPECTED_ARG(m_cmd_list_type);
     }
 
@@ -23,6 +23,7 @@ Base implementation of the command list interface.
 
 #include <Methane/Graphics/Base/CommandList.h>
 #include <Methane/Graphics/Base/CommandListDebugGroup.h>
+#include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
@@ -33,6 +34,8 @@ Base implementation of the command list interface.
 
 #include <magic_enum.hpp>
 
+#include <algorithm>
+
 // Disable debug groups instrumentation with discontinuous CPU frames in Tracy,
 // because it is not working for parallel render command lists by some reason
 //#define METHANE_DEBUG_GROUP_FRAMES_ENABLED
@@ -104,6 +107,7 @@ void CommandList::Reset(IDebugGroup* debug_group_ptr)
 
     ResetCommandState();
     SetCommandListStateNoLock(State::Encoding);
+    m_required_upload_batch_index = 0U;
 
     const bool debug_group_changed = GetTopOpenDebugGroup() != debug_group_ptr;
     if (!m_open_debug_groups.empty() && debug_group_changed)
@@ -143,6 +147,7 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
 
     auto& program_bindings_base = static_cast<ProgramBindings&>(program_bindings);
     ApplyProgramBindings(program_bindings_base, apply_behavior);
+    RequireResourceUpload(program_bindings_base);
 
 
     if (constexpr Rhi::ProgramBindingsApplyBehaviorMask constant_once_and_changes_only({
@@ -354,6 +359,25 @@ Rhi::ICommandQueue& CommandList::GetCommandQueue()
     return *m_command_queue_ptr;
 }
 
+void CommandList::RequireResourceUpload(const Resource& resource)
+{
+    META_FUNCTION_TASK();
+    // Upload batches are tracked only when asynchronous uploads were not synchronized yet
+    if (!GetBaseCommandQueue().GetBaseContext().HasUnsynchronizedUploads())
+        return;
+
+    m_required_upload_batch_index = std::max(m_required_upload_batch_index, resource.GetUploadBatchIndex());
+}
+
+void CommandList::RequireResourceUpload(const ProgramBindings& program_bindings)
+{
+    META_FUNCTION_TASK();
+    if (!GetBaseCommandQueue().GetBaseContext().HasUnsynchronizedUploads())
+        return;
+
+    m_required_upload_batch_index = std::max(m_required_upload_batch_index, program_bindings.GetUploadBatchIndex());
+}
+
 void CommandList::ResetCommandState()
 {
     META_FUNCTION_TASK();
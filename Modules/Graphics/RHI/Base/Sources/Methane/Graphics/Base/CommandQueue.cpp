@@ -28,6 +28,8 @@ Base implementation of the command queue interface.
 
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -67,6 +69,7 @@ void CommandQueue::Execute(Rhi::ICommandListSet& command_lists, const Rhi::IComm
     META_FUNCTION_TASK();
     META_LOG("Command queue '{}' is executing", GetName());
 
+    SynchronizeResourceUploads(command_lists);
     static_cast<CommandListSet&>(command_lists).Execute(completed_callback);
 }
 
@@ -77,6 +80,22 @@ Tracy::GpuContext& CommandQueue::GetTracyContext() const
     return *m_tracy_gpu_context_ptr;
 }
 
+void CommandQueue::SynchronizeResourceUploads(const Rhi::ICommandListSet& command_lists)
+{
+    META_FUNCTION_TASK();
+    if (!m_context.HasUnsynchronizedUploads())
+        return;
+
+    uint64_t required_upload_batch_index = 0U;
+    for(const Ref<CommandList>& command_list_ref : static_cast<const CommandListSet&>(command_lists).GetBaseRefs())
+    {
+        required_upload_batch_index = std::max(required_upload_batch_index, command_list_ref.get().GetRequiredUploadBatchIndex());
+    }
+
+    if (required_upload_batch_index)
+        m_context.SynchronizeResourceUploads(*this, required_upload_batch_index);
+}
+
 void CommandQueue::InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings)
 {
     META_FUNCTION_TASK();
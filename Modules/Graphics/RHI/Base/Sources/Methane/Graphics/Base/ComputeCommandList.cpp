@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ComputeCommandList.cpp
+Base implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/ComputeCommandList.h>
+#include <Methane/Graphics/Base/ComputeState.h>
+#include <Methane/Graphics/Base/CommandQueue.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Graphics/Base/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <magic_enum.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+ComputeCommandList::ComputeCommandList(CommandQueue& command_queue)
+    : CommandList(command_queue, Type::Compute)
+{ }
+
+void ComputeCommandList::ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    CommandList::Reset(debug_group_ptr);
+    SetComputeState(compute_state);
+}
+
+void ComputeCommandList::ResetWithStateOnce(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    if (GetState() == State::Encoding && m_compute_state_ptr.get() == std::addressof(compute_state))
+    {
+        META_LOG("{} Command list '{}' was already RESET with the same compute state '{}'", magic_enum::enum_name(GetType()), GetName(), compute_state.GetName());
+        return;
+    }
+    ResetWithState(compute_state, debug_group_ptr);
+}
+
+void ComputeCommandList::SetComputeState(Rhi::IComputeState& compute_state)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' SET COMPUTE STATE '{}':\n{}", magic_enum::enum_name(GetType()), GetName(), compute_state.GetName(), static_cast<std::string>(compute_state.GetSettings()));
+
+    VerifyEncodingState();
+
+    if (m_compute_state_ptr.get() == std::addressof(compute_state))
+        return;
+
+    auto& compute_state_base = static_cast<ComputeState&>(compute_state);
+    compute_state_base.Apply(*this);
+
+    Ptr<Object> compute_state_object_ptr = compute_state_base.GetBasePtr();
+    m_compute_state_ptr = std::static_pointer_cast<ComputeState>(compute_state_object_ptr);
+    RetainResource(compute_state_object_ptr);
+}
+
+void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+    ValidateDispatchState();
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(thread_groups_count), "can not dispatch zero thread groups count");
+
+    META_LOG("{} Command list '{}' DISPATCH {} thread groups of {} threads with compute state '{}'",
+             magic_enum::enum_name(GetType()), GetName(), static_cast<std::string>(thread_groups_count),
+             static_cast<std::string>(m_compute_state_ptr->GetSettings().thread_group_size), m_compute_state_ptr->GetName());
+}
+
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+    ValidateDispatchState();
+    META_CHECK_ARG_NAME_DESCR("arguments_buffer", arguments_buffer.GetSettings().type == Rhi::BufferType::Indirect,
+                              "can not dispatch with arguments buffer of type '{}' where 'Indirect' buffer is required",
+                              magic_enum::enum_name(arguments_buffer.GetSettings().type));
+    META_CHECK_ARG_DESCR(arguments_offset, arguments_offset % 4U == 0U, "indirect arguments offset must be aligned to 4 bytes");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(arguments_offset + static_cast<Data::Size>(sizeof(Rhi::DispatchIndirectArguments)), arguments_buffer.GetSettings().size,
+                                       "indirect dispatch arguments are out of arguments buffer '{}' bounds", arguments_buffer.GetName());
+
+    META_LOG("{} Command list '{}' DISPATCH INDIRECT from arguments buffer '{}' at offset {} with compute state '{}'",
+             magic_enum::enum_name(GetType()), GetName(), arguments_buffer.GetName(), arguments_offset, m_compute_state_ptr->GetName());
+
+    RetainResource(static_cast<Buffer&>(arguments_buffer));
+    RequireResourceUpload(static_cast<Buffer&>(arguments_buffer));
+}
+
+void ComputeCommandList::ResetCommandState()
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' reset command state", magic_enum::enum_name(GetType()), GetName());
+
+    CommandList::ResetCommandState();
+    m_compute_state_ptr.reset();
+}
+
+void ComputeCommandList::ValidateDispatchState() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL_DESCR(m_compute_state_ptr, "compute state must be set before dispatch");
+
+    const ProgramBindings* program_bindings_ptr = GetProgramBindingsPtr();
+    META_CHECK_ARG_TRUE_DESCR(!program_bindings_ptr ||
+                              std::addressof(program_bindings_ptr->GetProgram()) == m_compute_state_ptr->GetSettings().program_ptr.get(),
+                              "program bindings must be created for the program of compute state '{}'", m_compute_state_ptr->GetName());
+}
+
+} // namespace Methane::Graphics::Base
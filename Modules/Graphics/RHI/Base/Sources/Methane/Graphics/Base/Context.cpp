@@ -33,15 +33,25 @@ Base implementation of the context interface.
 #include <fmt/format.h>
 #include <magic_enum.hpp>
 
+#include <algorithm>
+#include <limits>
+
 namespace Methane::Graphics::Base
 {
 
 static const std::array<std::string, magic_enum::enum_count<Rhi::CommandListType>()> g_default_command_kit_names = { {
     "Upload",
     "Render",
-    "Parallel Render"
+    "Parallel Render",
+    "Compute"
 } };
 
+// Asynchronous uploads are encoded to the next command list, while previous upload batches are still executing
+static constexpr Rhi::CommandListId g_async_upload_cmd_lists_count = 3U;
+static_assert(static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync) + g_async_upload_cmd_lists_count - 1U
+              <= std::numeric_limits<Rhi::CommandListId>::max(),
+              "post-upload sync command list identifiers of asynchronous upload batches are out of range");
+
 #ifdef METHANE_LOGGING_ENABLED
 static const std::array<std::string, magic_enum::enum_count<Rhi::IContext::WaitFor>()> g_wait_for_names = {{
     "Render Complete",
@@ -72,6 +82,12 @@ void Context::RequestDeferredAction(DeferredAction action) const noexcept
     m_requested_action = std::max(m_requested_action, action);
 }
 
+void Context::ExecuteResourceUploads() const
+{
+    META_FUNCTION_TASK();
+    UploadResources();
+}
+
 void Context::CompleteInitialization()
 {
     META_FUNCTION_TASK();
@@ -240,10 +256,9 @@ bool Context::SetName(std::string_view name)
 }
 
 template<Rhi::CommandListPurpose cmd_list_purpose>
-void Context::ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit) const
+void Context::ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit, Rhi::CommandListId cmd_list_id) const
 {
     META_FUNCTION_TASK();
-    constexpr auto cmd_list_id = static_cast<Rhi::CommandListId>(cmd_list_purpose);
     const std::vector<Rhi::CommandListId> cmd_list_ids = { cmd_list_id };
 
     for (const auto& [cmd_queue_ptr, cmd_kit_ptr] : m_default_command_kit_ptr_by_queue)
@@ -273,23 +288,26 @@ void Context::ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit) co
         }
         if constexpr (cmd_list_purpose == Rhi::CommandListPurpose::PostUploadSync)
         {
-            // Wait for upload execution on other queue and execute post-upload synchronization commands on that queue
+            // Wait for upload execution on other queue and execute post-upload synchronization commands on that queue,
+            // fence of asynchronous upload batch is signalled right after its execution
             Rhi::IFence& upload_fence = upload_cmd_kit.GetFence(cmd_list_id);
-            upload_fence.Signal();
+            if (!IsAsyncResourceUploads())
+                upload_fence.Signal();
             upload_fence.WaitOnGpu(cmd_queue);
             cmd_queue.Execute(cmd_kit_ptr->GetListSet(cmd_list_ids));
         }
     }
 }
 
-bool Context::UploadResources()
+bool Context::UploadResources() const
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
     const Rhi::ICommandKit& upload_cmd_kit = GetUploadCommandKit();
-    if (!upload_cmd_kit.HasList())
+    if (!upload_cmd_kit.HasList(m_upload_cmd_list_id))
         return false;
 
-    Rhi::ICommandList& upload_cmd_list = upload_cmd_kit.GetList();
+    Rhi::ICommandList& upload_cmd_list = upload_cmd_kit.GetList(m_upload_cmd_list_id);
     const Rhi::CommandListState upload_cmd_state = upload_cmd_list.GetState();
     if (upload_cmd_state == Rhi::CommandListState::Pending)
         return false;
@@ -307,15 +325,127 @@ bool Context::UploadResources()
     ExecuteSyncCommandLists<Rhi::CommandListPurpose::PreUploadSync>(upload_cmd_kit);
 
     // Execute resource upload command lists
-    upload_cmd_kit.GetQueue().Execute(upload_cmd_kit.GetListSet());
+    upload_cmd_kit.GetQueue().Execute(upload_cmd_kit.GetListSet({ m_upload_cmd_list_id }));
+    m_executed_upload_batches_count++;
+
+    if (IsAsyncResourceUploads())
+    {
+        // Post-upload synchronization is deferred until uploaded resources are used in other command queues,
+        // so that next upload batch is encoded to another command list while this one is executing
+        upload_cmd_kit.GetFence(GetPostUploadSyncCommandListId(m_executed_upload_batches_count)).Signal();
+        m_upload_cmd_list_id = (m_upload_cmd_list_id + 1U) % g_async_upload_cmd_lists_count;
+        return true;
+    }
 
     // Execute post-upload synchronization command lists for all queues except the upload command queue
     // and set post-upload command queue fences to wait for upload command command queue completion
     ExecuteSyncCommandLists<Rhi::CommandListPurpose::PostUploadSync>(upload_cmd_kit);
+    m_synchronized_upload_batch_index = m_executed_upload_batches_count;
 
     return true;
 }
 
+Rhi::ICommandList& Context::GetUploadCommandListForEncoding() const
+{
+    META_FUNCTION_TASK();
+    uint64_t encoding_upload_batch_index = 0U;
+    return GetUploadCommandListForEncoding(encoding_upload_batch_index);
+}
+
+Rhi::ICommandList& Context::GetUploadCommandListForEncoding(uint64_t& encoding_upload_batch_index) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
+    encoding_upload_batch_index = m_executed_upload_batches_count + 1U;
+    if (IsAsyncResourceUploads())
+        m_encoded_upload_batch_index = encoding_upload_batch_index;
+
+    return GetUploadCommandKit().GetListForEncoding(m_upload_cmd_list_id);
+}
+
+Rhi::CommandListId Context::GetPostUploadSyncCommandListId(uint64_t upload_batch_index) const noexcept
+{
+    META_FUNCTION_TASK();
+    // Each asynchronous upload batch has its own post-upload sync command list, rotating along with upload command lists
+    constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+    if (!upload_batch_index || !IsAsyncResourceUploads())
+        return post_upload_cmd_list_id;
+
+    return post_upload_cmd_list_id + static_cast<Rhi::CommandListId>((upload_batch_index - 1U) % g_async_upload_cmd_lists_count);
+}
+
+uint64_t Context::GetEncodingUploadBatchIndex() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
+    return m_executed_upload_batches_count + 1U;
+}
+
+uint64_t Context::GetExecutedUploadBatchesCount() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
+    return m_executed_upload_batches_count;
+}
+
+uint64_t Context::GetSynchronizedUploadBatchIndex() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
+    return m_synchronized_upload_batch_index;
+}
+
+bool Context::HasUnsynchronizedUploads() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
+    return m_encoded_upload_batch_index > m_synchronized_upload_batch_index;
+}
+
+bool Context::IsAsyncResourceUploads() const noexcept
+{
+    META_FUNCTION_TASK();
+    return GetOptions().HasBit(Rhi::ContextOption::AsyncResourceUploads);
+}
+
+void Context::SynchronizeResourceUploads(Rhi::ICommandQueue& target_cmd_queue, uint64_t upload_batch_index) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_upload_mutex);
+    if (upload_batch_index <= m_synchronized_upload_batch_index)
+        return;
+
+    META_LOG("Context '{}' SYNCHRONIZING upload batch {} with command queue '{}'",
+             GetName(), upload_batch_index, target_cmd_queue.GetName());
+
+    // Upload batch required by command queue is executed right away, if it is still encoding
+    if (upload_batch_index > m_executed_upload_batches_count)
+        UploadResources();
+
+    upload_batch_index = std::min(upload_batch_index, m_executed_upload_batches_count);
+    if (upload_batch_index <= m_synchronized_upload_batch_index)
+        return;
+
+    // Ownership and state transitions of uploaded resources are executed in other queues
+    // only on first use of resources, which also makes these queues wait for upload completion.
+    // Only batches up to the required one are synchronized, later batches may still be executing.
+    const Rhi::ICommandKit& upload_cmd_kit = GetUploadCommandKit();
+    for(uint64_t batch_index = m_synchronized_upload_batch_index + 1U; batch_index <= upload_batch_index; ++batch_index)
+    {
+        ExecuteSyncCommandLists<Rhi::CommandListPurpose::PostUploadSync>(upload_cmd_kit, GetPostUploadSyncCommandListId(batch_index));
+    }
+
+    if (std::addressof(target_cmd_queue) != std::addressof(upload_cmd_kit.GetQueue()))
+    {
+        if (IsAsyncResourceUploads())
+            upload_cmd_kit.GetFence(GetPostUploadSyncCommandListId(upload_batch_index)).WaitOnGpu(target_cmd_queue);
+        else
+            upload_cmd_kit.GetFence().FlushOnGpu(target_cmd_queue);
+    }
+
+    m_synchronized_upload_batch_index = upload_batch_index;
+}
+
 void Context::PerformRequestedAction()
 {
     META_FUNCTION_TASK();
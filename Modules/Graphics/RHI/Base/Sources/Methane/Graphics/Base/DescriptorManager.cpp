@@ -62,9 +62,11 @@ void DescriptorManager::CompleteInitialization()
 
     if (m_is_parallel_bindings_processing_enabled)
     {
-        tf::Taskflow task_flow;
-        task_flow.for_each(m_program_bindings.begin(), m_program_bindings.end(), binding_initialization_completer);
-        m_context.GetParallelExecutor().run(task_flow).get();
+        constexpr Data::Index program_bindings_chunk_size = 16U;
+        m_context.ParallelFor(0U, static_cast<Data::Index>(m_program_bindings.size()),
+            [this](const Data::Index program_bindings_index)
+            { binding_initialization_completer(m_program_bindings[program_bindings_index]); },
+            program_bindings_chunk_size);
     }
     else
     {
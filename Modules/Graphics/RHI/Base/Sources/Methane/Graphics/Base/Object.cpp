@@ -27,77 +27,132 @@ Base implementation of the named object interface.
 #include <Methane/Checks.hpp>
 
 #include <stdexcept>
+#include <utility>
+#include <algorithm>
 #include <cassert>
 
 namespace Methane::Graphics::Base
 {
 
-void ObjectRegistry::AddGraphicsObject(Rhi::IObject& object)
+static Rhi::ObjectName GetObjectName(const Rhi::IObject& object) noexcept
+{
+    return Rhi::ObjectName(object.GetNameId(), object.GetName());
+}
+
+template<typename EntryByNameIdType>
+static auto FindEntryByName(EntryByNameIdType& object_by_name_id, const Rhi::ObjectName& object_name) noexcept
+{
+    const auto [begin_it, end_it] = object_by_name_id.equal_range(object_name.id);
+    const auto entry_it = std::find_if(begin_it, end_it,
+                                       [&object_name](const auto& name_and_entry) { return name_and_entry.second.name == object_name.name; });
+    return entry_it == end_it ? object_by_name_id.end() : entry_it;
+}
+
+ObjectRegistry::EntryByNameId::iterator ObjectRegistry::FindEntry(const Rhi::ObjectName& object_name) noexcept
+{
+    return FindEntryByName(m_object_by_name_id, object_name);
+}
+
+ObjectRegistry::EntryByNameId::const_iterator ObjectRegistry::FindEntry(const Rhi::ObjectName& object_name) const noexcept
+{
+    return FindEntryByName(m_object_by_name_id, object_name);
+}
+
+void ObjectRegistry::AddGraphicsObject(Rhi::IObject& object, Rhi::ObjectTypeId object_type_id, const Ptr<void>& typed_object_ptr)
 {
     META_FUNCTION_TASK();
-    META_CHECK_ARG_NOT_EMPTY_DESCR(object.GetName(), "Can not add graphics object without name to the objects registry.");
+    const std::string_view object_name = object.GetName();
+    META_CHECK_ARG_NOT_EMPTY_DESCR(object_name, "Can not add graphics object without name to the objects registry.");
 
-    const auto& obj = dynamic_cast<Object&>(object);
-    const auto [name_and_object_it, object_added] = m_object_by_name.try_emplace(obj.GetNameRef(), object.GetPtr());
-    if (!object_added &&
-        !name_and_object_it->second.expired() &&
-         name_and_object_it->second.lock().get() != std::addressof(object))
-        throw NameConflictException(object.GetName());
+    Entry object_entry{ std::string(object_name), std::addressof(object), object.GetPtr(), typed_object_ptr, object_type_id };
+    if (const auto object_by_name_it = FindEntry(GetObjectName(object));
+        object_by_name_it != m_object_by_name_id.end())
+    {
+        // Different live object is registered with the same name
+        if (const Ptr<Rhi::IObject> registered_object_ptr = object_by_name_it->second.object_wptr.lock();
+            registered_object_ptr && registered_object_ptr.get() != std::addressof(object))
+            throw NameConflictException(object_name);
 
-    name_and_object_it->second = object.GetPtr();
+        object_by_name_it->second = std::move(object_entry);
+    }
+    else
+    {
+        m_object_by_name_id.emplace(object.GetNameId(), std::move(object_entry));
+    }
     object.Connect(*this);
 }
 
 void ObjectRegistry::RemoveGraphicsObject(Rhi::IObject& object)
 {
     META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY_DESCR(object.GetName(), "Can not remove graphics object without name to the objects registry.");
 
-    const auto& obj = dynamic_cast<Object&>(object);
-    const std::string& object_name = obj.GetNameRef();
-    META_CHECK_ARG_NOT_EMPTY_DESCR(object_name, "Can not remove graphics object without name to the objects registry.");
+    const auto object_by_name_it = FindEntry(GetObjectName(object));
+    if (object_by_name_it == m_object_by_name_id.end() ||
+        object_by_name_it->second.object_ptr != std::addressof(object))
+        return;
 
-    if (m_object_by_name.erase(object_name))
-    {
-        object.Disconnect(*this);
-    }
+    m_object_by_name_id.erase(object_by_name_it);
+    object.Disconnect(*this);
+}
+
+Ptr<Rhi::IObject> ObjectRegistry::GetGraphicsObject(const Rhi::ObjectName& object_name) const noexcept
+{
+    META_FUNCTION_TASK();
+    const auto object_by_name_it = FindEntry(object_name);
+    return object_by_name_it == m_object_by_name_id.end() ? nullptr : object_by_name_it->second.object_wptr.lock();
 }
 
-Ptr<Rhi::IObject> ObjectRegistry::GetGraphicsObject(const std::string& object_name) const noexcept
+bool ObjectRegistry::HasGraphicsObject(const Rhi::ObjectName& object_name) const noexcept
 {
     META_FUNCTION_TASK();
-    const auto object_by_name_it = m_object_by_name.find(object_name);
-    return object_by_name_it == m_object_by_name.end() ? nullptr : object_by_name_it->second.lock();
+    const auto object_by_name_it = FindEntry(object_name);
+    return object_by_name_it != m_object_by_name_id.end() && !object_by_name_it->second.object_wptr.expired();
 }
 
-bool ObjectRegistry::HasGraphicsObject(const std::string& object_name) const noexcept
+Ptr<void> ObjectRegistry::GetTypedGraphicsObject(const Rhi::ObjectName& object_name, Rhi::ObjectTypeId object_type_id) const noexcept
 {
     META_FUNCTION_TASK();
-    const auto object_by_name_it = m_object_by_name.find(object_name);
-    return object_by_name_it != m_object_by_name.end() && !object_by_name_it->second.expired();
+    const auto object_by_name_it = FindEntry(object_name);
+    if (object_by_name_it == m_object_by_name_id.end() ||
+        object_by_name_it->second.object_type_id != object_type_id)
+        return nullptr;
+
+    return object_by_name_it->second.typed_object_wptr.lock();
 }
 
 void ObjectRegistry::OnObjectNameChanged(Rhi::IObject& object, const std::string& old_name)
 {
     META_FUNCTION_TASK();
-    const auto object_by_name_it = m_object_by_name.find(old_name);
-    META_CHECK_ARG_TRUE_DESCR(object_by_name_it != m_object_by_name.end(),
+    const auto object_by_name_it = FindEntry(Rhi::ObjectName(old_name));
+    META_CHECK_ARG_TRUE_DESCR(object_by_name_it != m_object_by_name_id.end(),
                               "renamed object was not found in the objects registry by its old name '{}'", old_name);
-    META_CHECK_ARG_TRUE_DESCR(object_by_name_it->second.expired(),
-                              "object pointer stored in registry by old name '{}' has expired", old_name);
-    META_CHECK_ARG_TRUE_DESCR(std::addressof(*object_by_name_it->second.lock()) == std::addressof(object),
+    META_CHECK_ARG_TRUE_DESCR(object_by_name_it->second.object_ptr == std::addressof(object),
                               "object stored in the registry by old name '{}' differs from the renamed object", old_name);
 
+    auto object_node = m_object_by_name_id.extract(object_by_name_it);
     const std::string_view new_name = object.GetName();
     if (new_name.empty())
     {
-        m_object_by_name.erase(object_by_name_it);
         object.Disconnect(*this);
         return;
     }
 
-    auto object_node = m_object_by_name.extract(object_by_name_it);
-    object_node.key() = new_name;
-    m_object_by_name.insert(std::move(object_node));
+    if (const auto conflict_it = FindEntry(GetObjectName(object));
+        conflict_it != m_object_by_name_id.end())
+    {
+        // Renamed object can not be registered by its new name, which is taken by another live object
+        if (!conflict_it->second.object_wptr.expired())
+        {
+            object.Disconnect(*this);
+            throw NameConflictException(new_name);
+        }
+        m_object_by_name_id.erase(conflict_it);
+    }
+
+    object_node.key() = object.GetNameId();
+    object_node.mapped().name = std::string(new_name);
+    m_object_by_name_id.insert(std::move(object_node));
 }
 
 void ObjectRegistry::OnObjectDestroyed(Rhi::IObject& object)
@@ -108,11 +163,15 @@ void ObjectRegistry::OnObjectDestroyed(Rhi::IObject& object)
 
 Object::Object(std::string_view name)
     : m_name(name)
+    , m_name_id(Rhi::GetObjectNameId(name))
 { }
 
 Object::~Object()
 {
     META_FUNCTION_TASK();
+    if (!GetConnectedReceiversCount())
+        return;
+
     try
     {
         Emit(&Rhi::IObjectCallback::OnObjectDestroyed, *this);
@@ -137,10 +196,14 @@ bool Object::SetName(std::string_view name)
     if (m_name == name)
         return false;
 
-    const std::string old_name = m_name;
-    m_name = name;
+    std::string old_name = std::exchange(m_name, std::string(name));
+    m_name_id = Rhi::GetObjectNameId(m_name);
 
-    Emit(&Rhi::IObjectCallback::OnObjectNameChanged, *this, old_name);
+    // Skip callback dispatch for objects which are not registered anywhere and have no other receivers
+    if (GetConnectedReceiversCount())
+    {
+        Emit(&Rhi::IObjectCallback::OnObjectNameChanged, *this, old_name);
+    }
     return true;
 }
 
@@ -38,6 +38,7 @@ Base implementation of the parallel render command list interface.
 #include <fmt/format.h>
 
 #include <string_view>
+#include <algorithm>
 
 namespace Methane::Graphics::Base
 {
@@ -47,6 +48,8 @@ ParallelRenderCommandList::ParallelRenderCommandList(CommandQueue& command_queue
     , m_render_pass_ptr(render_pass.GetPtr<RenderPass>())
 { }
 
+ParallelRenderCommandList::~ParallelRenderCommandList() = default;
+
 void ParallelRenderCommandList::SetValidationEnabled(bool is_validation_enabled)
 {
     META_FUNCTION_TASK();
@@ -96,29 +99,31 @@ void ParallelRenderCommandList::ResetImpl(IDebugGroup* debug_group_ptr, const Re
         }
     }
 
-    // Per-thread render command lists can be reset in parallel only with DirectX 12 on Windows
-#ifdef _WIN32
-    tf::Taskflow reset_task_flow;
-    reset_task_flow.for_each_index(0U, static_cast<uint32_t>(m_parallel_command_lists.size()), 1U, reset_command_list_fn);
-    GetCommandQueue().GetContext().GetParallelExecutor().run(reset_task_flow).get();
-#else
-    for(Data::Index command_list_index = 0U; command_list_index < static_cast<Data::Index>(m_parallel_command_lists.size()); ++command_list_index)
-        reset_command_list_fn(command_list_index);
-#endif
+    // Per-thread render command lists are reset in parallel: each of them owns native command allocator (DirectX)
+    // or command pool (Vulkan), while Metal render encoders are created in order of command lists before this reset
+    GetCommandQueue().GetContext().ParallelFor(0U, static_cast<Data::Index>(m_parallel_command_lists.size()), reset_command_list_fn);
 }
 
 void ParallelRenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
-    tf::Taskflow commit_task_flow;
-    commit_task_flow.for_each(m_parallel_command_lists.begin(), m_parallel_command_lists.end(),
-        [](const Ptr<RenderCommandList>& render_command_list_ptr)
+    // Commit task graph is built once and re-run every frame until the count of parallel command lists changes
+    const auto command_lists_count = static_cast<Data::Size>(m_parallel_command_lists.size());
+    if (!m_commit_task_flow_ptr || m_commit_task_flow_size != command_lists_count)
+    {
+        m_commit_task_flow_ptr = std::make_unique<tf::Taskflow>();
+        for(Data::Index command_list_index = 0U; command_list_index < command_lists_count; ++command_list_index)
         {
-            META_CHECK_ARG_NOT_NULL(render_command_list_ptr);
-            render_command_list_ptr->Commit();
+            m_commit_task_flow_ptr->emplace([this, command_list_index]()
+            {
+                const Ptr<RenderCommandList>& render_command_list_ptr = m_parallel_command_lists[command_list_index];
+                META_CHECK_ARG_NOT_NULL(render_command_list_ptr);
+                render_command_list_ptr->Commit();
+            });
         }
-    );
-    GetCommandQueue().GetContext().GetParallelExecutor().run(commit_task_flow).get();
+        m_commit_task_flow_size = command_lists_count;
+    }
+    GetCommandQueue().GetContext().GetParallelExecutor().run(*m_commit_task_flow_ptr).get();
     CommandList::Commit();
 }
 
@@ -138,8 +143,8 @@ void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
     const auto initial_count = static_cast<uint32_t>(m_parallel_command_lists.size());
     if (count < initial_count)
     {
-        m_parallel_command_lists.erase(m_parallel_command_lists.begin() + count);
-        m_parallel_command_lists_refs.erase(m_parallel_command_lists_refs.begin() + count);
+        m_parallel_command_lists.erase(m_parallel_command_lists.begin() + count, m_parallel_command_lists.end());
+        m_parallel_command_lists_refs.erase(m_parallel_command_lists_refs.begin() + count, m_parallel_command_lists_refs.end());
         return;
     }
 
@@ -183,6 +188,18 @@ void ParallelRenderCommandList::Complete()
     CommandList::Complete();
 }
 
+uint64_t ParallelRenderCommandList::GetRequiredUploadBatchIndex() const noexcept
+{
+    META_FUNCTION_TASK();
+    uint64_t required_upload_batch_index = CommandList::GetRequiredUploadBatchIndex();
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    {
+        if (render_command_list_ptr)
+            required_upload_batch_index = std::max(required_upload_batch_index, render_command_list_ptr->GetRequiredUploadBatchIndex());
+    }
+    return required_upload_batch_index;
+}
+
 bool ParallelRenderCommandList::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
@@ -61,7 +61,17 @@ Program::Program(const Context& context, const Settings& settings)
     , m_settings(settings)
     , m_shaders_by_type(CreateShadersByType(settings.shaders))
     , m_shader_types(CreateShaderTypes(settings.shaders))
-{ }
+{
+    META_FUNCTION_TASK();
+    for (const InputBufferLayout& input_buffer_layout : m_settings.input_buffer_layouts)
+    {
+        if (input_buffer_layout.argument_formats.empty())
+            continue;
+
+        META_CHECK_ARG_EQUAL_DESCR(input_buffer_layout.argument_formats.size(), input_buffer_layout.argument_semantics.size(),
+                                   "program input buffer layout formats count must be equal to argument semantics count");
+    }
+}
 
 const Ptr<Rhi::IShader>& Program::GetShader(Rhi::ShaderType shader_type) const
 {
@@ -193,4 +203,15 @@ uint32_t Program::GetInputBufferIndexByArgumentSemantic(const std::string& argum
 #endif
 }
 
+PixelFormat Program::GetInputArgumentFormatBySemantic(const std::string& argument_semantic) const
+{
+    META_FUNCTION_TASK();
+    const InputBufferLayout& input_buffer_layout = m_settings.input_buffer_layouts[GetInputBufferIndexByArgumentSemantic(argument_semantic)];
+    if (input_buffer_layout.argument_formats.empty())
+        return PixelFormat::Unknown;
+
+    const auto argument_it = std::find(input_buffer_layout.argument_semantics.begin(), input_buffer_layout.argument_semantics.end(), argument_semantic);
+    return input_buffer_layout.argument_formats[static_cast<size_t>(std::distance(input_buffer_layout.argument_semantics.begin(), argument_it))];
+}
+
 } // namespace Methane::Graphics::Base
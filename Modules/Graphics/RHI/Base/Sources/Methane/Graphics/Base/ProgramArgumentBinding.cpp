@@ -100,6 +100,10 @@ bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resou
                              "resource usage mask {} does not have addressable flag", Data::GetEnumMaskName(resource_usage_mask));
         META_CHECK_ARG_NAME_DESCR("resource_view", is_addressable_binding || !resource_view.GetOffset(),
                                   "can not set resource view_id with non-zero offset to non-addressable resource binding");
+        META_CHECK_ARG_NAME_DESCR("resource_view", m_settings.shader_access != Rhi::ProgramArgumentShaderAccess::ReadWrite ||
+                                                   resource_usage_mask.HasAnyBit(Rhi::ResourceUsage::ShaderWrite),
+                                  "resource '{}' with usage mask {} can not be bound to read-write argument '{}' without shader write usage",
+                                  resource_view.GetResource().GetName(), Data::GetEnumMaskName(resource_usage_mask), m_settings.argument.GetName());
     }
 
     Data::Emitter<Rhi::IProgramBindings::IArgumentBindingCallback>::Emit(&Rhi::IProgramBindings::IArgumentBindingCallback::OnProgramArgumentBindingResourceViewsChanged, std::cref(*this), std::cref(m_resource_views), std::cref(resource_views));
@@ -36,25 +36,30 @@ Base implementation of the program bindings interface.
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <array>
+#include <algorithm>
 
 namespace Methane::Graphics::Base
 {
 
-static Rhi::ResourceState GetBoundResourceTargetState(const Rhi::IResource& resource, Rhi::IResource::Type resource_type, bool is_constant_binding)
+static Rhi::ResourceState GetBoundResourceTargetState(const Rhi::IResource& resource, const Rhi::IProgramArgumentBinding::Settings& binding_settings)
 {
     META_FUNCTION_TASK();
-    switch (resource_type)
+    switch (binding_settings.resource_type)
     {
     case Rhi::IResource::Type::Buffer:
         // FIXME: state transition of DX upload heap resources should be reworked properly and made friendly with Vulkan
         // DX resource in upload heap can not be transitioned to any other state but initial GenericRead state
         if (dynamic_cast<const Rhi::IBuffer&>(resource).GetSettings().storage_mode != Rhi::IBuffer::StorageMode::Private)
             return resource.GetState();
-        else if (is_constant_binding)
+        else if (binding_settings.shader_access == Rhi::ProgramArgumentShaderAccess::ReadWrite)
+            return Rhi::ResourceState::UnorderedAccess;
+        else if (binding_settings.argument.IsConstant())
             return Rhi::ResourceState::ConstantBuffer;
         break;
 
     case Rhi::IResource::Type::Texture:
+        if (binding_settings.shader_access == Rhi::ProgramArgumentShaderAccess::ReadWrite)
+            return Rhi::ResourceState::UnorderedAccess;
         if (dynamic_cast<const Rhi::ITexture&>(resource).GetSettings().type == Rhi::ITexture::Type::DepthStencil)
             return Rhi::ResourceState::DepthRead;
         break;
@@ -294,7 +299,7 @@ void ProgramBindings::AddTransitionResourceState(const Rhi::IProgramBindings::IA
         return;
 
     const Rhi::IProgramBindings::IArgumentBinding::Settings& argument_binding_settings = argument_binding.GetSettings();
-    const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+    const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings);
     ResourceStates& transition_resource_states = m_transition_resource_states_by_access[argument_binding_settings.argument.GetAccessorIndex()];
     transition_resource_states.emplace_back(resource.GetDerivedPtr<Resource>(), target_resource_state);
 }
@@ -314,7 +319,7 @@ void ProgramBindings::AddTransitionResourceStates(const Rhi::IProgramBindings::I
         if (resource.GetResourceType() == Rhi::IResource::Type::Sampler)
             continue;
 
-        const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+        const Rhi::ResourceState target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings);
         transition_resource_states.emplace_back(std::dynamic_pointer_cast<Resource>(resource_view.GetResourcePtr()), target_resource_state);
     }
 }
@@ -364,6 +369,20 @@ void ProgramBindings::InitResourceRefsByAccess()
     }
 }
 
+uint64_t ProgramBindings::GetUploadBatchIndex() const
+{
+    META_FUNCTION_TASK();
+    uint64_t upload_batch_index = 0U;
+    for(const Refs<Rhi::IResource>& resource_refs : m_resource_refs_by_access)
+    {
+        for(const Ref<Rhi::IResource>& resource_ref : resource_refs)
+        {
+            upload_batch_index = std::max(upload_batch_index, dynamic_cast<const Resource&>(resource_ref.get()).GetUploadBatchIndex());
+        }
+    }
+    return upload_batch_index;
+}
+
 const Refs<Rhi::IResource>& ProgramBindings::GetResourceRefsByAccess(Rhi::ProgramArgumentAccessType access_type) const
 {
     META_FUNCTION_TASK();
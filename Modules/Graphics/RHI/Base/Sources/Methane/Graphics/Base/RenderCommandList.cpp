@@ -25,11 +25,14 @@ Base implementation of the render command list interface.
 #include <Methane/Graphics/Base/ParallelRenderCommandList.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/RenderPass.h>
+#include <Methane/Graphics/Base/RenderPattern.h>
+#include <Methane/Graphics/Base/RenderCommandSequence.h>
 #include <Methane/Graphics/Base/RenderState.h>
 #include <Methane/Graphics/Base/ViewState.h>
 #include <Methane/Graphics/Base/Buffer.h>
 #include <Methane/Graphics/Base/BufferSet.h>
 #include <Methane/Graphics/Base/Program.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Texture.h>
 
 #include <Methane/Instrumentation.h>
@@ -169,6 +172,11 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
     Ptr<Object> vertex_buffer_set_object_ptr = static_cast<BufferSet&>(vertex_buffers).GetBasePtr();
     drawing_state.vertex_buffer_set_ptr = std::static_pointer_cast<BufferSet>(vertex_buffer_set_object_ptr);
     RetainResource(vertex_buffer_set_object_ptr);
+
+    for(const Ref<Rhi::IBuffer>& vertex_buffer_ref : vertex_buffers.GetRefs())
+    {
+        RequireResourceUpload(static_cast<Buffer&>(vertex_buffer_ref.get()));
+    }
     return true;
 }
 
@@ -197,6 +205,7 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
     Ptr<Object> index_buffer_object_ptr = static_cast<Buffer&>(index_buffer).GetBasePtr();
     drawing_state.index_buffer_ptr = std::static_pointer_cast<Buffer>(index_buffer_object_ptr);
     RetainResource(index_buffer_object_ptr);
+    RequireResourceUpload(*drawing_state.index_buffer_ptr);
     return true;
 }
 
@@ -259,6 +268,77 @@ void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, ui
     UpdateDrawingState(primitive_type);
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        const DrawingState& drawing_state = GetDrawingState();
+        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.index_buffer_ptr, "index buffer must be set before indexed draw call");
+        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.vertex_buffer_set_ptr, "vertex buffers must be set before draw call");
+        ValidateDrawIndirectBuffers(arguments_buffer, arguments_offset, static_cast<Data::Size>(sizeof(Rhi::DrawIndexedIndirectArguments)),
+                                    max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDEXED INDIRECT with vertex buffers {} and index buffer '{}' using {} primitive type, up to {} draws from arguments buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(), GetDrawingState().vertex_buffer_set_ptr->GetNames(), GetDrawingState().index_buffer_ptr->GetName(),
+             magic_enum::enum_name(primitive_type), max_draw_count, arguments_buffer.GetName(), arguments_offset,
+             draw_count_buffer_ptr ? fmt::format(" with draw count buffer '{}' at offset {}", draw_count_buffer_ptr->GetName(), draw_count_offset) : "");
+
+    RetainDrawIndirectBuffers(arguments_buffer, draw_count_buffer_ptr);
+    UpdateDrawingState(primitive_type);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive_type, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        const DrawingState& drawing_state = GetDrawingState();
+        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before draw call");
+        const size_t input_buffers_count = drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts.size();
+        META_CHECK_ARG_TRUE_DESCR(!input_buffers_count || drawing_state.vertex_buffer_set_ptr,
+                                  "vertex buffers must be set when program has non empty input buffer layouts");
+        ValidateDrawIndirectBuffers(arguments_buffer, arguments_offset, static_cast<Data::Size>(sizeof(Rhi::DrawIndirectArguments)),
+                                    max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDIRECT with vertex buffers {} using {} primitive type, up to {} draws from arguments buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             magic_enum::enum_name(primitive_type), max_draw_count, arguments_buffer.GetName(), arguments_offset,
+             draw_count_buffer_ptr ? fmt::format(" with draw count buffer '{}' at offset {}", draw_count_buffer_ptr->GetName(), draw_count_offset) : "");
+
+    RetainDrawIndirectBuffers(arguments_buffer, draw_count_buffer_ptr);
+    UpdateDrawingState(primitive_type);
+}
+
+void RenderCommandList::ReplayCommandSequence(Rhi::IRenderCommandSequence& command_sequence)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled && m_render_pass_ptr)
+    {
+        META_CHECK_ARG_TRUE_DESCR(std::addressof(command_sequence.GetRenderPattern()) == std::addressof(m_render_pass_ptr->GetPattern()),
+                                  "render command sequence must be recorded for the same render pattern as command list render pass");
+    }
+
+    META_LOG("{} Command list '{}' REPLAY COMMAND SEQUENCE '{}' with {} commands",
+             magic_enum::enum_name(GetType()), GetName(), command_sequence.GetName(), command_sequence.GetCommandsCount());
+
+    // Sequence is retained by command list until its execution is completed
+    auto& command_sequence_base = static_cast<RenderCommandSequence&>(command_sequence);
+    ExecuteCommandSequence(command_sequence_base);
+    RetainResource(command_sequence_base);
+}
+
 void RenderCommandList::ResetCommandState()
 {
     META_FUNCTION_TASK();
@@ -276,6 +356,80 @@ void RenderCommandList::ResetCommandState()
     m_drawing_state.changes = DrawingState::ChangeMask{};
 }
 
+void RenderCommandList::ExecuteCommandSequence(RenderCommandSequence& command_sequence)
+{
+    META_FUNCTION_TASK();
+    command_sequence.Replay(*this);
+}
+
+void RenderCommandList::SetCommandSequenceResourceStates(const RenderCommandSequence& command_sequence)
+{
+    META_FUNCTION_TASK();
+    for(const RenderCommandSequence::Command& command : command_sequence.GetCommands())
+    {
+        if (const auto* bindings_cmd_ptr = std::get_if<RenderCommandSequence::SetProgramBindingsCommand>(&command))
+        {
+            const ProgramBindings& program_bindings = *bindings_cmd_ptr->program_bindings_ptr;
+            RequireResourceUpload(program_bindings);
+            if (bindings_cmd_ptr->apply_behavior.HasAnyBit(Rhi::ProgramBindingsApplyBehavior::StateBarriers))
+            {
+                program_bindings.ApplyResourceTransitionBarriers(*this, Rhi::ProgramArgumentAccessMask{ ~0U }, &GetCommandQueue());
+            }
+        }
+        else if (const auto* vertex_cmd_ptr = std::get_if<RenderCommandSequence::SetVertexBuffersCommand>(&command))
+        {
+            BufferSet& vertex_buffer_set = *vertex_cmd_ptr->vertex_buffers_ptr;
+            for(const Ref<Rhi::IBuffer>& vertex_buffer_ref : vertex_buffer_set.GetRefs())
+            {
+                RequireResourceUpload(static_cast<Buffer&>(vertex_buffer_ref.get()));
+            }
+            if (const Ptr<Rhi::IResourceBarriers>& buffer_set_setup_barriers_ptr = vertex_buffer_set.GetSetupTransitionBarriers();
+                vertex_cmd_ptr->set_resource_barriers && vertex_buffer_set.SetState(Rhi::ResourceState::VertexBuffer) && buffer_set_setup_barriers_ptr)
+            {
+                SetResourceBarriers(*buffer_set_setup_barriers_ptr);
+            }
+        }
+        else if (const auto* index_cmd_ptr = std::get_if<RenderCommandSequence::SetIndexBufferCommand>(&command))
+        {
+            Buffer& index_buffer = *index_cmd_ptr->index_buffer_ptr;
+            RequireResourceUpload(index_buffer);
+            if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = index_buffer.GetSetupTransitionBarriers();
+                index_cmd_ptr->set_resource_barriers && index_buffer.SetState(Rhi::ResourceState::IndexBuffer, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+            {
+                SetResourceBarriers(*buffer_setup_barriers_ptr);
+            }
+        }
+    }
+}
+
+void RenderCommandList::RestoreDrawingStateAfterBundle()
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' restore drawing state after native bundle", magic_enum::enum_name(GetType()), GetName());
+
+    CommandList::ResetCommandState();
+
+    const Ptr<RenderState>          render_state_ptr    = std::move(m_drawing_state.render_state_ptr);
+    const Rhi::RenderStateGroupMask render_state_groups = m_drawing_state.render_state_groups;
+    ViewState*                      view_state_ptr      = m_drawing_state.view_state_ptr;
+
+    m_drawing_state.vertex_buffer_set_ptr.reset();
+    m_drawing_state.index_buffer_ptr.reset();
+    m_drawing_state.primitive_type_opt.reset();
+    m_drawing_state.view_state_ptr = nullptr;
+    m_drawing_state.render_state_groups = {};
+    m_drawing_state.changes = DrawingState::ChangeMask{};
+
+    if (render_state_ptr)
+    {
+        SetRenderState(*render_state_ptr, render_state_groups);
+    }
+    if (view_state_ptr)
+    {
+        SetViewState(*view_state_ptr);
+    }
+}
+
 void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
 {
     META_FUNCTION_TASK();
@@ -307,6 +461,41 @@ void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, ui
     }
 }
 
+void RenderCommandList::ValidateDrawIndirectBuffers(const Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, Data::Size arguments_size,
+                                                    uint32_t max_draw_count, const Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(max_draw_count, "can not draw zero indirect draws count");
+    META_CHECK_ARG_NAME_DESCR("arguments_buffer", arguments_buffer.GetSettings().type == Rhi::BufferType::Indirect,
+                              "can not draw with arguments buffer of type '{}' where 'Indirect' buffer is required",
+                              magic_enum::enum_name(arguments_buffer.GetSettings().type));
+    META_CHECK_ARG_DESCR(arguments_offset, arguments_offset % 4U == 0U, "indirect arguments offset must be aligned to 4 bytes");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(arguments_offset + arguments_size * max_draw_count, arguments_buffer.GetSettings().size,
+                                       "indirect draw arguments are out of arguments buffer '{}' bounds", arguments_buffer.GetName());
+    if (!draw_count_buffer_ptr)
+        return;
+
+    META_CHECK_ARG_NAME_DESCR("draw_count_buffer", draw_count_buffer_ptr->GetSettings().type == Rhi::BufferType::Indirect,
+                              "can not draw with draw count buffer of type '{}' where 'Indirect' buffer is required",
+                              magic_enum::enum_name(draw_count_buffer_ptr->GetSettings().type));
+    META_CHECK_ARG_DESCR(draw_count_offset, draw_count_offset % 4U == 0U, "indirect draw count offset must be aligned to 4 bytes");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(draw_count_offset + static_cast<Data::Size>(sizeof(uint32_t)), draw_count_buffer_ptr->GetSettings().size,
+                                       "indirect draw count is out of draw count buffer '{}' bounds", draw_count_buffer_ptr->GetName());
+}
+
+void RenderCommandList::RetainDrawIndirectBuffers(Rhi::IBuffer& arguments_buffer, Rhi::IBuffer* draw_count_buffer_ptr)
+{
+    META_FUNCTION_TASK();
+    // Indirect buffers are read by GPU during command list execution, so they are retained until it is completed
+    RetainResource(static_cast<Buffer&>(arguments_buffer));
+    RequireResourceUpload(static_cast<Buffer&>(arguments_buffer));
+    if (draw_count_buffer_ptr && draw_count_buffer_ptr != std::addressof(arguments_buffer))
+    {
+        RetainResource(static_cast<Buffer&>(*draw_count_buffer_ptr));
+        RequireResourceUpload(static_cast<Buffer&>(*draw_count_buffer_ptr));
+    }
+}
+
 RenderPass& RenderCommandList::GetPass()
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,247 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/RenderCommandSequence.cpp
+Base implementation of the render command sequence interface,
+which records commands on CPU side and replays them to render command list.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/RenderCommandSequence.h>
+#include <Methane/Graphics/Base/RenderCommandList.h>
+#include <Methane/Graphics/Base/RenderPattern.h>
+#include <Methane/Graphics/Base/RenderState.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Graphics/Base/BufferSet.h>
+#include <Methane/Graphics/Base/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+
+namespace Methane::Graphics::Rhi
+{
+
+Ptr<IRenderCommandSequence> IRenderCommandSequence::Create(IRenderPattern& render_pattern)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<Base::RenderCommandSequence>(dynamic_cast<Base::RenderPattern&>(render_pattern));
+}
+
+} // namespace Methane::Graphics::Rhi
+
+namespace Methane::Graphics::Base
+{
+
+// Constant arguments can not be changed after program bindings creation, so only mutable argument bindings are tracked
+template<typename FuncType>
+static void ForEachMutableArgumentBinding(const Rhi::IProgramBindings& program_bindings, const FuncType& func)
+{
+    META_FUNCTION_TASK();
+    for(const Rhi::IProgram::Argument& argument : program_bindings.GetArguments())
+    {
+        Rhi::IProgramArgumentBinding& argument_binding = program_bindings.Get(argument);
+        if (!argument_binding.GetSettings().argument.IsConstant())
+        {
+            func(argument_binding);
+        }
+    }
+}
+
+class RenderCommandExecutor
+{
+public:
+    explicit RenderCommandExecutor(RenderCommandList& render_command_list)
+        : m_cmd_list(render_command_list)
+    { }
+
+    void operator()(const RenderCommandSequence::SetRenderStateCommand& cmd) const
+    {
+        m_cmd_list.SetRenderState(*cmd.render_state_ptr, cmd.state_groups);
+    }
+
+    void operator()(const RenderCommandSequence::SetProgramBindingsCommand& cmd) const
+    {
+        m_cmd_list.SetProgramBindings(*cmd.program_bindings_ptr, cmd.apply_behavior);
+    }
+
+    void operator()(const RenderCommandSequence::SetVertexBuffersCommand& cmd) const
+    {
+        m_cmd_list.SetVertexBuffers(*cmd.vertex_buffers_ptr, cmd.set_resource_barriers);
+    }
+
+    void operator()(const RenderCommandSequence::SetIndexBufferCommand& cmd) const
+    {
+        m_cmd_list.SetIndexBuffer(*cmd.index_buffer_ptr, cmd.set_resource_barriers);
+    }
+
+    void operator()(const RenderCommandSequence::DrawIndexedCommand& cmd) const
+    {
+        m_cmd_list.DrawIndexed(cmd.primitive, cmd.index_count, cmd.start_index, cmd.start_vertex, cmd.instance_count, cmd.start_instance);
+    }
+
+    void operator()(const RenderCommandSequence::DrawCommand& cmd) const
+    {
+        m_cmd_list.Draw(cmd.primitive, cmd.vertex_count, cmd.start_vertex, cmd.instance_count, cmd.start_instance);
+    }
+
+private:
+    RenderCommandList& m_cmd_list;
+};
+
+RenderCommandSequence::RenderCommandSequence(RenderPattern& render_pattern)
+    : m_render_pattern_ptr(render_pattern.GetPtr<RenderPattern>())
+{ }
+
+Rhi::IRenderPattern& RenderCommandSequence::GetRenderPattern() const noexcept
+{
+    return *m_render_pattern_ptr;
+}
+
+void RenderCommandSequence::Reset()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EQUAL_DESCR(m_state.load(), State::Recording, "render command sequence is already being recorded");
+    META_LOG("Render command sequence '{}' RESET recording", GetName());
+
+    for(const Command& command : m_commands)
+    {
+        if (const auto* bindings_cmd_ptr = std::get_if<SetProgramBindingsCommand>(&command))
+        {
+            ForEachMutableArgumentBinding(*bindings_cmd_ptr->program_bindings_ptr,
+                [this](Rhi::IProgramArgumentBinding& argument_binding) { argument_binding.Disconnect(*this); });
+        }
+    }
+
+    m_commands.clear();
+    m_last_program_bindings_ptr = nullptr;
+    SetNativeBundle({});
+    m_state = State::Recording;
+}
+
+void RenderCommandSequence::SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups)
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    m_commands.emplace_back(SetRenderStateCommand{ static_cast<RenderState&>(render_state).GetPtr<RenderState>(), state_groups });
+}
+
+void RenderCommandSequence::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    auto& program_bindings_base = static_cast<ProgramBindings&>(program_bindings);
+    if (m_last_program_bindings_ptr != &program_bindings_base)
+    {
+        ForEachMutableArgumentBinding(program_bindings,
+            [this](Rhi::IProgramArgumentBinding& argument_binding) { argument_binding.Connect(*this); });
+        m_last_program_bindings_ptr = &program_bindings_base;
+    }
+    m_commands.emplace_back(SetProgramBindingsCommand{ program_bindings_base.GetPtr<ProgramBindings>(), apply_behavior });
+}
+
+void RenderCommandSequence::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    m_commands.emplace_back(SetVertexBuffersCommand{ static_cast<BufferSet&>(vertex_buffers).GetPtr<BufferSet>(), set_resource_barriers });
+}
+
+void RenderCommandSequence::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers)
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    m_commands.emplace_back(SetIndexBufferCommand{ static_cast<Buffer&>(index_buffer).GetPtr<Buffer>(), set_resource_barriers });
+}
+
+void RenderCommandSequence::DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
+                                      uint32_t instance_count, uint32_t start_instance)
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    m_commands.emplace_back(DrawIndexedCommand{ primitive, index_count, start_index, start_vertex, instance_count, start_instance });
+}
+
+void RenderCommandSequence::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
+                               uint32_t instance_count, uint32_t start_instance)
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    META_CHECK_ARG_NOT_ZERO_DESCR(vertex_count, "can not draw zero vertices");
+    m_commands.emplace_back(DrawCommand{ primitive, vertex_count, start_vertex, instance_count, start_instance });
+}
+
+void RenderCommandSequence::Commit()
+{
+    META_FUNCTION_TASK();
+    VerifyRecordingState();
+    META_LOG("Render command sequence '{}' COMMIT {} commands", GetName(), m_commands.size());
+    m_state = State::Recorded;
+}
+
+void RenderCommandSequence::Replay(RenderCommandList& render_command_list) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(m_state.load(), State::Recorded, "only recorded render command sequence can be replayed");
+
+    const RenderCommandExecutor command_executor(render_command_list);
+    for(const Command& command : m_commands)
+    {
+        std::visit(command_executor, command);
+    }
+}
+
+Ptr<Object> RenderCommandSequence::GetNativeBundle() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_native_bundle_mutex);
+    return m_native_bundle_ptr;
+}
+
+void RenderCommandSequence::SetNativeBundle(const Ptr<Object>& native_bundle_ptr)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_native_bundle_mutex);
+    m_native_bundle_ptr = native_bundle_ptr;
+}
+
+void RenderCommandSequence::OnProgramArgumentBindingResourceViewsChanged(const Rhi::IProgramArgumentBinding&, const Rhi::IResource::Views&, const Rhi::IResource::Views&)
+{
+    META_FUNCTION_TASK();
+    Invalidate();
+}
+
+void RenderCommandSequence::VerifyRecordingState() const
+{
+    META_CHECK_ARG_EQUAL_DESCR(m_state.load(), State::Recording, "render command sequence is not in recording state");
+}
+
+void RenderCommandSequence::Invalidate()
+{
+    META_FUNCTION_TASK();
+    if (State expected_state = State::Recorded;
+        !m_state.compare_exchange_strong(expected_state, State::Invalidated))
+        return;
+
+    META_LOG("Render command sequence '{}' was INVALIDATED", GetName());
+    SetNativeBundle({});
+    Data::Emitter<Rhi::IRenderCommandSequenceCallback>::Emit(&Rhi::IRenderCommandSequenceCallback::OnRenderCommandSequenceInvalidated, *this);
+}
+
+} // namespace Methane::Graphics::Base
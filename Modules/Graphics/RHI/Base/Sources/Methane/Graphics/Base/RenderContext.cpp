@@ -29,6 +29,9 @@ Base implementation of the render context interface.
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace Methane::Graphics::Base
 {
 
@@ -74,6 +77,19 @@ void RenderContext::WaitForGpuFramePresented()
 
     OnGpuWaitStart(WaitFor::FramePresented);
     GetCurrentFrameFence().WaitOnCpu();
+
+    // When less frames are in flight than frame buffers in swap-chain, CPU also waits for GPU completion
+    // of the frame submitted frames-in-flight count ago, which was presented to another frame buffer
+    if (const uint32_t frames_in_flight_count = GetFramesInFlightCount();
+        frames_in_flight_count < m_settings.frame_buffers_count &&
+        m_in_flight_frame_buffer_indices.size() == frames_in_flight_count)
+    {
+        const uint32_t in_flight_frame_buffer_index = m_in_flight_frame_buffer_indices[m_frame_index % frames_in_flight_count];
+        if (in_flight_frame_buffer_index < m_settings.frame_buffers_count && in_flight_frame_buffer_index != m_frame_buffer_index)
+        {
+            GetRenderCommandKit().GetFence(in_flight_frame_buffer_index + 1).WaitOnCpu();
+        }
+    }
     OnGpuWaitComplete(WaitFor::FramePresented);
 }
 
@@ -101,6 +117,14 @@ void RenderContext::OnCpuPresentComplete(bool signal_frame_fence)
     {
         // Schedule a signal command in the queue for a currently finished frame
         GetCurrentFrameFence().Signal();
+
+        // Frame buffer index of the presented frame is kept to wait for its completion in frames-in-flight count
+        if (const uint32_t frames_in_flight_count = GetFramesInFlightCount();
+            m_in_flight_frame_buffer_indices.size() != frames_in_flight_count)
+        {
+            m_in_flight_frame_buffer_indices.assign(frames_in_flight_count, std::numeric_limits<uint32_t>::max());
+        }
+        m_in_flight_frame_buffer_indices[m_frame_index % m_in_flight_frame_buffer_indices.size()] = m_frame_buffer_index;
     }
 
     META_CPU_FRAME_DELIMITER(m_frame_buffer_index, m_frame_index);
@@ -109,6 +133,13 @@ void RenderContext::OnCpuPresentComplete(bool signal_frame_fence)
     m_fps_counter.OnCpuFramePresented();
 }
 
+uint32_t RenderContext::GetFramesInFlightCount() const noexcept
+{
+    return m_settings.frames_in_flight_count
+         ? std::min(m_settings.frames_in_flight_count, m_settings.frame_buffers_count)
+         : m_settings.frame_buffers_count;
+}
+
 Rhi::IFence& RenderContext::GetCurrentFrameFence() const
 {
     META_FUNCTION_TASK();
@@ -141,6 +172,7 @@ void RenderContext::Initialize(Device& device, bool is_callback_emitted)
     Context::Initialize(device, false);
 
     m_frame_index = 0U;
+    m_in_flight_frame_buffer_indices.clear();
 
     if (is_callback_emitted)
     {
@@ -148,12 +180,16 @@ void RenderContext::Initialize(Device& device, bool is_callback_emitted)
     }
 }
 
-bool RenderContext::UploadResources()
+bool RenderContext::UploadResources() const
 {
     META_FUNCTION_TASK();
     if (!Context::UploadResources())
         return false;
 
+    // Render commands wait for asynchronous uploads only when uploaded resources are used
+    if (IsAsyncResourceUploads())
+        return true;
+
     // Render commands will wait for resources uploading completion in upload queue
     GetUploadCommandKit().GetFence().FlushOnGpu(GetRenderCommandKit().GetQueue());
     return true;
@@ -190,6 +226,7 @@ void RenderContext::UpdateFrameBufferIndex()
     m_frame_buffer_index = GetNextFrameBufferIndex();
     META_CHECK_ARG_LESS(m_frame_buffer_index, GetSettings().frame_buffers_count);
     m_frame_index++;
+    GetFrameMemoryPool().AdvanceFrame();
 }
 
 void RenderContext::InvalidateFrameBuffersCount(uint32_t frame_buffers_count)
@@ -211,6 +211,13 @@ bool Resource::SetOwnerQueueFamily(uint32_t family_index)
     return true;
 }
 
+Rhi::ICommandList& Resource::GetUploadCommandListForEncoding()
+{
+    META_FUNCTION_TASK();
+    // Resource remembers upload batch, which has to be synchronized with command queues using this resource
+    return m_context.GetUploadCommandListForEncoding(m_upload_batch_index);
+}
+
 void Resource::SetSubResourceCount(const SubResource::Count& sub_resource_count)
 {
     META_FUNCTION_TASK();
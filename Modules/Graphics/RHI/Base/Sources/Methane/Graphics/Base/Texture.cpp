@@ -23,11 +23,14 @@ Base implementation of the texture interface.
 
 #include <Methane/Graphics/Base/Texture.h>
 #include <Methane/Graphics/Base/RenderContext.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
 
 #include <Methane/Graphics/TypeFormatters.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -89,9 +92,19 @@ Data::Size Texture::GetRequiredMipLevelsCount(const Dimensions& dimensions)
 Data::Size Texture::GetDataSize(Data::MemoryState size_type) const noexcept
 {
     META_FUNCTION_TASK();
-    return size_type == Data::MemoryState::Reserved
-            ? m_settings.dimensions.GetPixelsCount() * GetPixelSize(m_settings.pixel_format) * m_settings.array_length
-            : GetInitializedDataSize();
+    if (size_type != Data::MemoryState::Reserved)
+        return GetInitializedDataSize();
+
+    // Reserved data size includes all MIP levels of all depth slices and array items
+    const SubResource::Count& sub_resource_count = GetSubresourceCount();
+    Data::Size mip_levels_data_size = 0U;
+    for(Data::Index mip_level = 0U; mip_level < sub_resource_count.GetMipLevelsCount(); ++mip_level)
+    {
+        mip_levels_data_size += GetSlicePitch(m_settings.pixel_format,
+                                              GetMipLevelSize(m_settings.dimensions.GetWidth(), mip_level),
+                                              GetMipLevelSize(m_settings.dimensions.GetHeight(), mip_level));
+    }
+    return mip_levels_data_size * sub_resource_count.GetBaseLayerCount();
 }
 
 Data::Size Texture::CalculateSubResourceDataSize(const SubResource::Index& sub_resource_index) const
@@ -99,18 +112,69 @@ Data::Size Texture::CalculateSubResourceDataSize(const SubResource::Index& sub_r
     META_FUNCTION_TASK();
     ValidateSubResource(sub_resource_index, {});
 
-    const Data::Size pixel_size = GetPixelSize(m_settings.pixel_format);
-    if (sub_resource_index.GetMipLevel() == 0U)
+    const Data::Index mip_level = sub_resource_index.GetMipLevel();
+    return GetSlicePitch(m_settings.pixel_format,
+                         GetMipLevelSize(m_settings.dimensions.GetWidth(), mip_level),
+                         GetMipLevelSize(m_settings.dimensions.GetHeight(), mip_level));
+}
+
+Data::Range<Data::Index> Texture::GetSubResourceBlockRows(const SubResource& sub_resource) const
+{
+    META_FUNCTION_TASK();
+    const Data::Index mip_level        = sub_resource.GetIndex().GetMipLevel();
+    const Data::Size  row_pitch        = GetRowPitch(m_settings.pixel_format, GetMipLevelSize(m_settings.dimensions.GetWidth(), mip_level));
+    const Data::Size  block_rows_count = GetBlockRowsCount(m_settings.pixel_format, GetMipLevelSize(m_settings.dimensions.GetHeight(), mip_level));
+    if (!sub_resource.HasDataRange())
+        return Data::Range<Data::Index>(0U, block_rows_count);
+
+    const BytesRange& data_range = sub_resource.GetDataRange();
+    META_CHECK_ARG_DESCR(data_range, data_range.GetStart() % row_pitch == 0U && data_range.GetLength() % row_pitch == 0U,
+                         "sub-resource {} data range must be aligned to the row pitch {} of pixel blocks", static_cast<std::string>(sub_resource.GetIndex()), row_pitch);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(data_range.GetEnd() / row_pitch, block_rows_count,
+                                       "sub-resource {} data range is out of texture rows", static_cast<std::string>(sub_resource.GetIndex()));
+    return Data::Range<Data::Index>(data_range.GetStart() / row_pitch, data_range.GetEnd() / row_pitch);
+}
+
+Data::Size Texture::GetStagingDataSize(const SubResources& sub_resources) const
+{
+    META_FUNCTION_TASK();
+    Data::Size staging_data_size = 0U;
+    for(const SubResource& sub_resource : sub_resources)
     {
-        return pixel_size * static_cast<const Data::FrameSize&>(m_settings.dimensions).GetPixelsCount();
+        staging_data_size = AlignStagingDataOffset(staging_data_size) + sub_resource.GetDataSize();
     }
+    return staging_data_size;
+}
 
-    const double mip_divider = std::pow(2.0, sub_resource_index.GetMipLevel());
-    const Data::FrameSize mip_frame_size(
-        static_cast<uint32_t>(std::ceil(static_cast<double>(m_settings.dimensions.GetWidth()) / mip_divider)),
-        static_cast<uint32_t>(std::ceil(static_cast<double>(m_settings.dimensions.GetHeight()) / mip_divider))
-    );
-    return pixel_size * mip_frame_size.GetPixelsCount();
+void Texture::SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                                    Rhi::IBuffer& staging_buffer, Data::Size staging_offset)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(m_settings.type, Rhi::TextureType::Image, "only image textures support data upload from CPU");
+    META_CHECK_ARG_EQUAL_DESCR(staging_buffer.GetSettings().storage_mode, Rhi::BufferStorageMode::Managed,
+                               "staging buffer must have managed storage, which is writable from CPU");
+    META_CHECK_ARG_DESCR(staging_offset, staging_offset % s_staging_data_alignment == 0U,
+                         "staging data offset must be aligned by {} bytes", s_staging_data_alignment);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(staging_offset + GetStagingDataSize(sub_resources), staging_buffer.GetSettings().size,
+                                       "texture staging data is out of staging buffer bounds");
+    META_CHECK_ARG_FALSE_DESCR(IsMipLevelsGenerationRequired(sub_resources),
+                               "MIP levels are not generated for texture data uploaded through staging buffer, all levels must be uploaded");
+    Resource::SetData(sub_resources, target_cmd_queue);
+}
+
+Data::Size Texture::AlignStagingDataOffset(Data::Size staging_offset) noexcept
+{
+    return (staging_offset + s_staging_data_alignment - 1U) / s_staging_data_alignment * s_staging_data_alignment;
+}
+
+bool Texture::IsMipLevelsGenerationRequired(const SubResources& sub_resources) const
+{
+    META_FUNCTION_TASK();
+    if (!m_settings.mipmapped || sub_resources.size() >= GetSubresourceCount().GetRawCount())
+        return false;
+
+    return std::none_of(sub_resources.begin(), sub_resources.end(),
+                        [](const SubResource& sub_resource) { return sub_resource.HasDataRange(); });
 }
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
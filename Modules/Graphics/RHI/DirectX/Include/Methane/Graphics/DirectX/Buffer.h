@@ -46,11 +46,14 @@ public:
     SubResource GetData(const SubResource::Index& sub_resource_index = SubResource::Index(), const std::optional<BytesRange>& data_range = {}) override;
     Opt<Descriptor> InitializeNativeViewDescriptor(const View::Id& view_id) override;
 
-    D3D12_VERTEX_BUFFER_VIEW        GetNativeVertexBufferView() const;
-    D3D12_INDEX_BUFFER_VIEW         GetNativeIndexBufferView() const;
-    D3D12_CONSTANT_BUFFER_VIEW_DESC GetNativeConstantBufferViewDesc() const;
+    D3D12_VERTEX_BUFFER_VIEW         GetNativeVertexBufferView() const;
+    D3D12_INDEX_BUFFER_VIEW          GetNativeIndexBufferView() const;
+    D3D12_CONSTANT_BUFFER_VIEW_DESC  GetNativeConstantBufferViewDesc() const;
+    D3D12_UNORDERED_ACCESS_VIEW_DESC GetNativeUnorderedAccessViewDesc() const;
 
 private:
+    Opt<Descriptor> InitializeNativeUnorderedAccessViewDescriptor(const View::Id& view_id);
+
     wrl::ComPtr<ID3D12Resource> m_cp_upload_resource;
 };
 
@@ -30,6 +30,8 @@ DirectX 12 implementation of the device interface.
 #include <directx/d3d12.h>
 
 #include <optional>
+#include <array>
+#include <mutex>
 
 // NOTE: Adapters change handling breaks many frame capture tools, like VS or RenderDoc
 //#define ADAPTERS_CHANGE_HANDLING
@@ -58,11 +60,18 @@ public:
     const wrl::ComPtr<ID3D12Device>&    GetNativeDevice() const;
     void ReleaseNativeDevice();
 
+    // Command signatures of indirect draws and dispatches are created on first use and shared by all command lists of the device
+    ID3D12CommandSignature& GetNativeDrawCommandSignature(bool is_indexed) const;
+    ID3D12CommandSignature& GetNativeDispatchCommandSignature() const;
+
 private:
     const wrl::ComPtr<IDXGIAdapter>     m_cp_adapter;
     const D3D_FEATURE_LEVEL             m_feature_level;
     mutable NativeFeatureOptions5       m_feature_options_5;
     mutable wrl::ComPtr<ID3D12Device>   m_cp_device;
+    mutable std::array<wrl::ComPtr<ID3D12CommandSignature>, 2> m_cp_draw_command_signatures;
+    mutable wrl::ComPtr<ID3D12CommandSignature> m_cp_dispatch_command_signature;
+    mutable std::mutex                  m_draw_command_signatures_mutex;
 };
 
 bool IsSoftwareAdapterDxgi(IDXGIAdapter1& adapter);
@@ -51,6 +51,7 @@ public:
     void Signal() override;
     void WaitOnCpu() override;
     void WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue) override;
+    uint64_t GetCompletedValue() const override;
 
     // IObject override
     bool SetName(std::string_view name) override;
@@ -45,6 +45,7 @@ enum class ProgramArgumentBindingType : uint32_t
     DescriptorTable = 0,
     ConstantBufferView,
     ShaderResourceView,
+    UnorderedAccessView,
 };
 
 struct ProgramArgumentBindingSettings
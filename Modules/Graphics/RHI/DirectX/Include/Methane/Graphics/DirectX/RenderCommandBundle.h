@@ -0,0 +1,80 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DirectX/RenderCommandBundle.h
+DirectX 12 native bundle of the render command sequence encoded once
+in the bundle command list, which is executed by render command lists.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ICommandList.h"
+
+#include <Methane/Graphics/Base/Object.h>
+#include <Methane/Graphics/Base/RenderCommandSequence.h>
+
+#include <wrl.h>
+#include <directx/d3d12.h>
+
+#include <vector>
+
+namespace Methane::Graphics::DirectX
+{
+
+namespace wrl = Microsoft::WRL;
+
+class CommandQueue;
+
+class RenderCommandBundle final
+    : public Base::Object
+    , public ICommandList
+{
+public:
+    using DescriptorHeaps = std::vector<ID3D12DescriptorHeap*>;
+
+    // Bundle can set only the same root signature as the calling command list has,
+    // so sequences changing render state to the one with another program are not supported
+    [[nodiscard]] static bool IsSupported(const Base::RenderCommandSequence& command_sequence, const Base::RenderState* inherited_render_state_ptr);
+
+    // Bundle does not inherit pipeline state from the calling command list, so render state set in command list
+    // before sequence replay is encoded in bundle along with recorded commands
+    RenderCommandBundle(Base::RenderCommandSequence& command_sequence, CommandQueue& command_queue,
+                        const Ptr<Base::RenderState>& inherited_render_state_ptr, const DescriptorHeaps& descriptor_heaps);
+
+    [[nodiscard]] bool IsEncodedFor(const Base::RenderState* inherited_render_state_ptr, const DescriptorHeaps& descriptor_heaps) const;
+
+    // ICommandList interface
+    CommandQueue&               GetDirectCommandQueue() override;
+    ID3D12GraphicsCommandList&  GetNativeCommandList() const override;
+    ID3D12GraphicsCommandList4* GetNativeCommandList4() const override { return nullptr; }
+    void                        SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) override;
+
+private:
+    void EncodeCommands();
+
+    const Ptr<CommandQueue>                     m_command_queue_ptr;
+    const Base::RenderCommandSequence::Commands m_commands; // copied to keep resources alive while bundle is executed
+    const Ptr<Base::RenderState>                m_inherited_render_state_ptr;
+    ID3D12PipelineState*                        m_inherited_pipeline_state_ptr = nullptr;
+    const DescriptorHeaps                       m_descriptor_heaps;
+    wrl::ComPtr<ID3D12CommandAllocator>         m_cp_command_allocator;
+    wrl::ComPtr<ID3D12GraphicsCommandList>      m_cp_command_list;
+};
+
+} // namespace Methane::Graphics::DirectX
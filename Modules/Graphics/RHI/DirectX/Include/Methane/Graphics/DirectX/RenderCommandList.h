@@ -33,6 +33,8 @@ namespace Methane::Graphics::DirectX
 class RenderPass;
 class RenderState;
 
+D3D12_PRIMITIVE_TOPOLOGY PrimitiveToDXTopology(Rhi::RenderPrimitive primitive);
+
 class RenderCommandList final // NOSONAR - inheritance hierarchy greater than 5
     : public CommandList<Base::RenderCommandList>
 {
@@ -53,11 +55,22 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
 
     void ResetNative(const Ptr<RenderState>& render_state_ptr = nullptr);
 
+protected:
+    // Base::RenderCommandList overrides
+    void ExecuteCommandSequence(Base::RenderCommandSequence& command_sequence) override;
+
 private:
     void ResetRenderPass();
+    void ExecuteNativeIndirectDraws(bool is_indexed, Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset,
+                                    uint32_t max_draw_count, Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset);
+    void SetIndirectBufferState(Rhi::IBuffer& indirect_buffer);
 
     RenderPass& GetDirectPass();
 };
@@ -47,6 +47,7 @@ public:
     [[nodiscard]] Ptr<Rhi::IBuffer>       CreateBuffer(const Rhi::BufferSettings& settings) const override;
     [[nodiscard]] Ptr<Rhi::ITexture>      CreateTexture(const Rhi::TextureSettings& settings) const override;
     [[nodiscard]] Ptr<Rhi::ISampler>      CreateSampler(const Rhi::SamplerSettings& settings) const override;
+    [[nodiscard]] Ptr<Rhi::IComputeState> CreateComputeState(const Rhi::ComputeStateSettings& settings) const override;
     void WaitForGpu(WaitFor wait_for) override;
 
     // IRenderContext interface
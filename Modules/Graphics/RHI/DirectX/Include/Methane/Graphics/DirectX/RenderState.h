@@ -60,6 +60,10 @@ public:
 
     void InitializeNativePipelineState();
     wrl::ComPtr<ID3D12PipelineState>& GetNativePipelineState();
+    ID3D12RootSignature* GetNativeRootSignature() const;
+
+    // Render state is applied to native command list directly when encoding native render command bundle
+    void Apply(ID3D12GraphicsCommandList& d3d12_command_list, Groups state_groups);
 
 private:
     Program& GetDirectProgram();
@@ -165,7 +165,7 @@ protected:
     TransferCommandList& PrepareResourceUpload(Rhi::ICommandQueue& target_cmd_queue)
     {
         META_FUNCTION_TASK();
-        auto& upload_cmd_list = dynamic_cast<TransferCommandList&>(GetContext().GetUploadCommandKit().GetListForEncoding());
+        auto& upload_cmd_list = dynamic_cast<TransferCommandList&>(Base::Resource::GetUploadCommandListForEncoding());
         upload_cmd_list.RetainResource(*this);
 
         // When upload command list has COPY type, before transitioning resource to CopyDest state prior copying,
@@ -58,7 +58,8 @@ private:
     void OnResourceReleased(Rhi::IResource& resource) override;
 
     void AddNativeResourceBarrier(const Barrier::Id& id, const Barrier::StateChange& state_change);
-    void UpdateNativeResourceBarrier(const Barrier::Id& id, const Barrier::StateChange& state_change);
+    void UpdateNativeResourceBarrier(const Barrier::Id& id, D3D12_RESOURCE_BARRIER_TYPE native_barrier_type,
+                                     const Barrier::StateChange& state_change);
 
     std::vector<D3D12_RESOURCE_BARRIER> m_native_resource_barriers;
 };
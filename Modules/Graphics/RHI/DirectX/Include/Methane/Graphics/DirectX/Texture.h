@@ -60,6 +60,11 @@ public:
     // IResource override
     void SetData(const SubResources&, Rhi::ICommandQueue&) override;
 
+    // ITexture overrides
+    Data::Size GetStagingDataSize(const SubResources& sub_resources) const override;
+    void SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                               Rhi::IBuffer& staging_buffer, Data::Size staging_offset) override;
+
     // IResource override
     Opt<Descriptor> InitializeNativeViewDescriptor(const View::Id& view_id) override;
 
@@ -75,8 +80,12 @@ private:
     void CreateRenderTargetView(const Descriptor& descriptor, const View::Id& view_id) const;
     void CreateDepthStencilView(const Descriptor& descriptor) const;
     void GenerateMipLevels(std::vector<D3D12_SUBRESOURCE_DATA>& dx_sub_resources, ::DirectX::ScratchImage& scratch_image) const;
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT GetSliceFootprint(const SubResource& sub_resource, Data::Size upload_offset) const;
+    ID3D12Resource& GetUploadResource();
+    void UploadSubResourceSlices(const SubResources& sub_resources, const TransferCommandList& upload_cmd_list,
+                                 ID3D12Resource& upload_resource, Data::Size upload_offset) const;
 
-    // Upload resource is created for TextureType::Image only
+    // Upload resource is created for TextureType::Image only on first upload of data without shared staging buffer
     wrl::ComPtr<ID3D12Resource> m_cp_upload_resource;
 };
 
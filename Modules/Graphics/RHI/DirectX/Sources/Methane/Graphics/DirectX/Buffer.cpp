@@ -47,13 +47,16 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
     const Rhi::ResourceState resource_state = is_read_back_buffer || is_private_storage
                                               ? Rhi::ResourceState::CopyDest
                                               : Rhi::ResourceState::GenericRead;
-    const CD3DX12_RESOURCE_DESC resource_desc = CD3DX12_RESOURCE_DESC::Buffer(settings.size);
+    const D3D12_RESOURCE_FLAGS resource_flags = settings.usage_mask.HasAnyBit(Usage::ShaderWrite)
+                                              ? D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS
+                                              : D3D12_RESOURCE_FLAG_NONE;
+    const CD3DX12_RESOURCE_DESC resource_desc = CD3DX12_RESOURCE_DESC::Buffer(settings.size, resource_flags);
 
     InitializeCommittedResource(resource_desc, heap_type, resource_state);
 
     if (is_private_storage)
     {
-        m_cp_upload_resource = CreateCommittedResource(resource_desc, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ);
+        m_cp_upload_resource = CreateCommittedResource(CD3DX12_RESOURCE_DESC::Buffer(settings.size), D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ);
     }
 
     // Resources on D3D12_HEAP_TYPE_UPLOAD heaps requires D3D12_RESOURCE_STATE_GENERIC_READ or D3D12_RESOURCE_STATE_RESOLVE_SOURCE, which can not be changed.
@@ -191,9 +194,28 @@ D3D12_CONSTANT_BUFFER_VIEW_DESC Buffer::GetNativeConstantBufferViewDesc() const
     return buffer_view_desc;
 }
 
+D3D12_UNORDERED_ACCESS_VIEW_DESC Buffer::GetNativeUnorderedAccessViewDesc() const
+{
+    META_FUNCTION_TASK();
+    const Rhi::BufferSettings& settings = GetSettings();
+    META_CHECK_ARG_EQUAL(settings.type, Rhi::BufferType::Storage);
+    META_CHECK_ARG_NOT_ZERO_DESCR(settings.item_stride_size, "storage buffer with unordered access requires item stride size");
+
+    D3D12_UNORDERED_ACCESS_VIEW_DESC view_desc{};
+    view_desc.Format                     = DXGI_FORMAT_UNKNOWN;
+    view_desc.ViewDimension              = D3D12_UAV_DIMENSION_BUFFER;
+    view_desc.Buffer.FirstElement        = 0U;
+    view_desc.Buffer.NumElements         = GetDataSize() / settings.item_stride_size;
+    view_desc.Buffer.StructureByteStride = settings.item_stride_size;
+    return view_desc;
+}
+
 Opt<Rhi::IResource::Descriptor> Buffer::InitializeNativeViewDescriptor(const View::Id& view_id)
 {
     META_FUNCTION_TASK();
+    if (GetSettings().type == Rhi::BufferType::Storage)
+        return InitializeNativeUnorderedAccessViewDescriptor(view_id);
+
     if (GetSettings().type != Rhi::BufferType::Constant)
         return std::nullopt;
 
@@ -209,4 +231,19 @@ Opt<Rhi::IResource::Descriptor> Buffer::InitializeNativeViewDescriptor(const Vie
     return descriptor;
 }
 
+Opt<Rhi::IResource::Descriptor> Buffer::InitializeNativeUnorderedAccessViewDescriptor(const View::Id& view_id)
+{
+    META_FUNCTION_TASK();
+    // NOTE: Addressable storage buffers are bound to pipeline as root UAV using GPU Address
+    if (const UsageMask usage_mask = GetUsage();
+        !usage_mask.HasAnyBit(Usage::ShaderWrite) || usage_mask.HasAnyBit(Usage::Addressable))
+        return std::nullopt;
+
+    const Rhi::IResource::Descriptor& descriptor = GetDescriptorByViewId(view_id);
+    const D3D12_UNORDERED_ACCESS_VIEW_DESC view_desc = GetNativeUnorderedAccessViewDesc();
+    GetDirectContext().GetDirectDevice().GetNativeDevice()->CreateUnorderedAccessView(GetNativeResource(), nullptr, &view_desc,
+                                                                                       GetNativeCpuDescriptorHandle(descriptor));
+    return descriptor;
+}
+
 } // namespace Methane::Graphics
@@ -27,6 +27,7 @@ DirectX 12 implementation of the command queue interface.
 #include <Methane/Graphics/DirectX/TransferCommandList.h>
 #include <Methane/Graphics/DirectX/RenderCommandList.h>
 #include <Methane/Graphics/DirectX/ParallelRenderCommandList.h>
+#include <Methane/Graphics/DirectX/ComputeCommandList.h>
 #include <Methane/Graphics/DirectX/QueryPool.h>
 #include <Methane/Graphics/DirectX/ICommandList.h>
 
@@ -70,6 +71,9 @@ static D3D12_COMMAND_LIST_TYPE GetNativeCommandListType(Rhi::CommandListType com
     case Rhi::CommandListType::ParallelRender:
         return D3D12_COMMAND_LIST_TYPE_DIRECT;
 
+    case Rhi::CommandListType::Compute:
+        return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+
     default:
         META_UNEXPECTED_ARG_RETURN(command_list_type, D3D12_COMMAND_LIST_TYPE_DIRECT);
     }
@@ -134,6 +138,12 @@ Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandLi
     return std::make_shared<ParallelRenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass));
 }
 
+Ptr<Rhi::IComputeCommandList> CommandQueue::CreateComputeCommandList()
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeCommandList>(*this);
+}
+
 Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t max_timestamps_per_frame)
 {
     META_FUNCTION_TASK();
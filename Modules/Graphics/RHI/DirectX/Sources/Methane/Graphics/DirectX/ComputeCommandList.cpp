@@ -0,0 +1,95 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DirectX/ComputeCommandList.cpp
+DirectX 12 implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/DirectX/ComputeCommandList.h>
+#include <Methane/Graphics/DirectX/ComputeState.h>
+#include <Methane/Graphics/DirectX/CommandQueue.h>
+#include <Methane/Graphics/DirectX/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::DirectX
+{
+
+ComputeCommandList::ComputeCommandList(CommandQueue& command_queue)
+    : CommandList(D3D12_COMMAND_LIST_TYPE_COMPUTE, command_queue)
+{ }
+
+void ComputeCommandList::Reset(IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    ResetNative();
+    Base::ComputeCommandList::Reset(debug_group_ptr);
+}
+
+void ComputeCommandList::ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    ResetNative(static_cast<Base::ComputeState&>(compute_state).GetPtr<ComputeState>());
+    Base::ComputeCommandList::ResetWithState(compute_state, debug_group_ptr);
+}
+
+void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::Dispatch(thread_groups_count);
+    GetNativeCommandListRef().Dispatch(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth());
+}
+
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(arguments_buffer, arguments_offset);
+
+    auto& dx_arguments_buffer = static_cast<Buffer&>(arguments_buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = dx_arguments_buffer.GetSetupTransitionBarriers();
+        dx_arguments_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+
+    ID3D12CommandSignature& dx_command_signature = GetDirectCommandQueue().GetDirectContext().GetDirectDevice().GetNativeDispatchCommandSignature();
+    GetNativeCommandListRef().ExecuteIndirect(&dx_command_signature, 1U, dx_arguments_buffer.GetNativeResource(), arguments_offset, nullptr, 0U);
+}
+
+void ComputeCommandList::ResetNative(const Ptr<ComputeState>& compute_state_ptr)
+{
+    META_FUNCTION_TASK();
+    if (!IsNativeCommitted())
+        return;
+
+    SetNativeCommitted(false);
+    SetCommandListState(Rhi::CommandListState::Encoding);
+
+    // Command list is reset with initial pipeline state to skip redundant pipeline state setup by compute state
+    ID3D12PipelineState* p_dx_initial_state = compute_state_ptr ? compute_state_ptr->GetNativePipelineState().Get() : nullptr;
+    ID3D12CommandAllocator& dx_cmd_allocator = GetNativeCommandAllocatorRef();
+    ID3D12Device* p_native_device = GetDirectCommandQueue().GetDirectContext().GetDirectDevice().GetNativeDevice().Get();
+    ThrowIfFailed(dx_cmd_allocator.Reset(), p_native_device);
+    ThrowIfFailed(GetNativeCommandListRef().Reset(&dx_cmd_allocator, p_dx_initial_state), p_native_device);
+
+    BeginGpuZoneDx();
+}
+
+} // namespace Methane::Graphics::DirectX
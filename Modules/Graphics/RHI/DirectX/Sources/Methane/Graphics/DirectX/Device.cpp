@@ -171,7 +171,53 @@ const wrl::ComPtr<ID3D12Device>& Device::GetNativeDevice() const
 void Device::ReleaseNativeDevice()
 {
     META_FUNCTION_TASK();
+    for(wrl::ComPtr<ID3D12CommandSignature>& cp_draw_command_signature : m_cp_draw_command_signatures)
+    {
+        cp_draw_command_signature.Reset();
+    }
+    m_cp_dispatch_command_signature.Reset();
     m_cp_device.Reset();
 }
 
+ID3D12CommandSignature& Device::GetNativeDrawCommandSignature(bool is_indexed) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_draw_command_signatures_mutex);
+    wrl::ComPtr<ID3D12CommandSignature>& cp_draw_command_signature = m_cp_draw_command_signatures[is_indexed ? 1U : 0U];
+    if (cp_draw_command_signature)
+        return *cp_draw_command_signature.Get();
+
+    D3D12_INDIRECT_ARGUMENT_DESC argument_desc{};
+    argument_desc.Type = is_indexed ? D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED : D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;
+
+    D3D12_COMMAND_SIGNATURE_DESC command_signature_desc{};
+    command_signature_desc.ByteStride       = is_indexed ? sizeof(D3D12_DRAW_INDEXED_ARGUMENTS) : sizeof(D3D12_DRAW_ARGUMENTS);
+    command_signature_desc.NumArgumentDescs = 1U;
+    command_signature_desc.pArgumentDescs   = &argument_desc;
+
+    const wrl::ComPtr<ID3D12Device>& cp_device = GetNativeDevice();
+    ThrowIfFailed(cp_device->CreateCommandSignature(&command_signature_desc, nullptr, IID_PPV_ARGS(&cp_draw_command_signature)), cp_device.Get());
+    return *cp_draw_command_signature.Get();
+}
+
+ID3D12CommandSignature& Device::GetNativeDispatchCommandSignature() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_draw_command_signatures_mutex);
+    if (m_cp_dispatch_command_signature)
+        return *m_cp_dispatch_command_signature.Get();
+
+    D3D12_INDIRECT_ARGUMENT_DESC argument_desc{};
+    argument_desc.Type = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH;
+
+    D3D12_COMMAND_SIGNATURE_DESC command_signature_desc{};
+    command_signature_desc.ByteStride       = sizeof(D3D12_DISPATCH_ARGUMENTS);
+    command_signature_desc.NumArgumentDescs = 1U;
+    command_signature_desc.pArgumentDescs   = &argument_desc;
+
+    const wrl::ComPtr<ID3D12Device>& cp_device = GetNativeDevice();
+    ThrowIfFailed(cp_device->CreateCommandSignature(&command_signature_desc, nullptr, IID_PPV_ARGS(&m_cp_dispatch_command_signature)), cp_device.Get());
+    return *m_cp_dispatch_command_signature.Get();
+}
+
 } // namespace Methane::Graphics::DirectX
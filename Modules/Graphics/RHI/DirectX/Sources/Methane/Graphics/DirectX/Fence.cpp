@@ -102,6 +102,13 @@ void Fence::WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue)
                   dx_wait_on_command_queue.GetDirectContext().GetDirectDevice().GetNativeDevice().Get());
 }
 
+uint64_t Fence::GetCompletedValue() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_cp_fence);
+    return m_cp_fence->GetCompletedValue();
+}
+
 bool Fence::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
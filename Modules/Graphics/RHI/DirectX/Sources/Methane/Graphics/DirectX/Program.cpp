@@ -87,10 +87,11 @@ static D3D12_SHADER_VISIBILITY GetShaderVisibilityByType(Rhi::ShaderType shader_
     META_FUNCTION_TASK();
     switch (shader_type)
     {
-    case Rhi::ShaderType::All:    return D3D12_SHADER_VISIBILITY_ALL;
-    case Rhi::ShaderType::Vertex: return D3D12_SHADER_VISIBILITY_VERTEX;
-    case Rhi::ShaderType::Pixel:  return D3D12_SHADER_VISIBILITY_PIXEL;
-    default:                 META_UNEXPECTED_ARG_RETURN(shader_type, D3D12_SHADER_VISIBILITY_ALL);
+    case Rhi::ShaderType::All:     return D3D12_SHADER_VISIBILITY_ALL;
+    case Rhi::ShaderType::Vertex:  return D3D12_SHADER_VISIBILITY_VERTEX;
+    case Rhi::ShaderType::Pixel:   return D3D12_SHADER_VISIBILITY_PIXEL;
+    case Rhi::ShaderType::Compute: return D3D12_SHADER_VISIBILITY_ALL; // compute pipeline has the only stage
+    default:                       META_UNEXPECTED_ARG_RETURN(shader_type, D3D12_SHADER_VISIBILITY_ALL);
     }
 };
 
@@ -196,6 +197,10 @@ void Program::InitRootSignature()
             root_parameters.back().InitAsShaderResourceView(bind_settings.point, bind_settings.space, D3D12_ROOT_DESCRIPTOR_FLAG_DATA_STATIC, shader_visibility);
             break;
 
+        case DirectArgumentBinding::Type::UnorderedAccessView:
+            root_parameters.back().InitAsUnorderedAccessView(bind_settings.point, bind_settings.space, D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE, shader_visibility);
+            break;
+
         default:
             META_UNEXPECTED_ARG(bind_settings.type);
         }
@@ -293,7 +293,8 @@ void ProgramBindings::AddRootParameterBindingsForArgument(ArgumentBinding& argum
     for (const ResourceView& resource_view_dx : argument_binding.GetDirectResourceViews())
     {
         if (binding_settings.type == DXBindingType::ConstantBufferView ||
-            binding_settings.type == DXBindingType::ShaderResourceView)
+            binding_settings.type == DXBindingType::ShaderResourceView ||
+            binding_settings.type == DXBindingType::UnorderedAccessView)
         {
             AddRootParameterBinding(binding_settings.argument, {
                 argument_binding,
@@ -309,8 +310,10 @@ void ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask
                                                  const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const
 {
     META_FUNCTION_TASK();
+    // Compute programs have root signature bound to compute pipeline, so root arguments are set with compute methods
+    const bool is_compute_pipeline = GetProgram().GetShaderTypes().count(Rhi::ShaderType::Compute) > 0;
     Data::ForEachBitInEnumMask(access,
-        [this, &d3d12_command_list, applied_program_bindings_ptr, apply_changes_only](Rhi::ProgramArgumentAccessType access_type)
+        [this, &d3d12_command_list, applied_program_bindings_ptr, apply_changes_only, is_compute_pipeline](Rhi::ProgramArgumentAccessType access_type)
         {
             const bool do_program_bindings_comparing = access_type == Rhi::ProgramArgumentAccessType::Mutable && apply_changes_only && applied_program_bindings_ptr;
             const RootParameterBindings& root_parameter_bindings = m_root_parameter_bindings_by_access[magic_enum::enum_index(access_type).value()];
@@ -320,27 +323,45 @@ void ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask
                 if (do_program_bindings_comparing && root_parameter_binding.argument_binding.IsAlreadyApplied(GetProgram(), *applied_program_bindings_ptr))
                     continue;
 
-                ApplyRootParameterBinding(root_parameter_binding, d3d12_command_list);
+                ApplyRootParameterBinding(root_parameter_binding, d3d12_command_list, is_compute_pipeline);
             }
         });
 }
 
-void ProgramBindings::ApplyRootParameterBinding(const RootParameterBinding& root_parameter_binding, ID3D12GraphicsCommandList& d3d12_command_list) const
+void ProgramBindings::ApplyRootParameterBinding(const RootParameterBinding& root_parameter_binding, ID3D12GraphicsCommandList& d3d12_command_list,
+                                                bool is_compute_pipeline) const
 {
     META_FUNCTION_TASK();
+    const uint32_t root_parameter_index = root_parameter_binding.root_parameter_index;
     switch (const ArgumentBinding::Type binding_type = root_parameter_binding.argument_binding.GetDirectSettings().type;
             binding_type)
     {
     case ArgumentBinding::Type::DescriptorTable:
-        d3d12_command_list.SetGraphicsRootDescriptorTable(root_parameter_binding.root_parameter_index, root_parameter_binding.base_descriptor);
+        if (is_compute_pipeline)
+            d3d12_command_list.SetComputeRootDescriptorTable(root_parameter_index, root_parameter_binding.base_descriptor);
+        else
+            d3d12_command_list.SetGraphicsRootDescriptorTable(root_parameter_index, root_parameter_binding.base_descriptor);
         break;
 
     case ArgumentBinding::Type::ConstantBufferView:
-        d3d12_command_list.SetGraphicsRootConstantBufferView(root_parameter_binding.root_parameter_index, root_parameter_binding.gpu_virtual_address);
+        if (is_compute_pipeline)
+            d3d12_command_list.SetComputeRootConstantBufferView(root_parameter_index, root_parameter_binding.gpu_virtual_address);
+        else
+            d3d12_command_list.SetGraphicsRootConstantBufferView(root_parameter_index, root_parameter_binding.gpu_virtual_address);
         break;
 
     case ArgumentBinding::Type::ShaderResourceView:
-        d3d12_command_list.SetGraphicsRootShaderResourceView(root_parameter_binding.root_parameter_index, root_parameter_binding.gpu_virtual_address);
+        if (is_compute_pipeline)
+            d3d12_command_list.SetComputeRootShaderResourceView(root_parameter_index, root_parameter_binding.gpu_virtual_address);
+        else
+            d3d12_command_list.SetGraphicsRootShaderResourceView(root_parameter_index, root_parameter_binding.gpu_virtual_address);
+        break;
+
+    case ArgumentBinding::Type::UnorderedAccessView:
+        if (is_compute_pipeline)
+            d3d12_command_list.SetComputeRootUnorderedAccessView(root_parameter_index, root_parameter_binding.gpu_virtual_address);
+        else
+            d3d12_command_list.SetGraphicsRootUnorderedAccessView(root_parameter_index, root_parameter_binding.gpu_virtual_address);
         break;
 
     default:
@@ -0,0 +1,215 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DirectX/RenderCommandBundle.cpp
+DirectX 12 native bundle of the render command sequence encoded once
+in the bundle command list, which is executed by render command lists.
+
+******************************************************************************/
+
+#include <Methane/Graphics/DirectX/RenderCommandBundle.h>
+#include <Methane/Graphics/DirectX/RenderCommandList.h>
+#include <Methane/Graphics/DirectX/RenderState.h>
+#include <Methane/Graphics/DirectX/ProgramBindings.h>
+#include <Methane/Graphics/DirectX/CommandQueue.h>
+#include <Methane/Graphics/DirectX/IContext.h>
+#include <Methane/Graphics/DirectX/Device.h>
+#include <Methane/Graphics/DirectX/Buffer.h>
+#include <Methane/Graphics/DirectX/BufferSet.h>
+#include <Methane/Graphics/DirectX/ErrorHandling.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <nowide/convert.hpp>
+
+namespace Methane::Graphics::DirectX
+{
+
+using Sequence = Base::RenderCommandSequence;
+
+static const Rhi::RenderStateGroupMask s_all_render_state_groups(~0U);
+
+class RenderCommandEncoder
+{
+public:
+    explicit RenderCommandEncoder(ICommandList& command_list)
+        : m_cmd_list(command_list)
+        , m_d3d12_cmd_list(command_list.GetNativeCommandList())
+    { }
+
+    void operator()(const Sequence::SetRenderStateCommand& cmd) const
+    {
+        static_cast<RenderState&>(*cmd.render_state_ptr).Apply(m_d3d12_cmd_list, cmd.state_groups);
+    }
+
+    void operator()(const Sequence::SetProgramBindingsCommand& cmd)
+    {
+        if (m_applied_program_bindings_ptr == cmd.program_bindings_ptr.get())
+            return;
+
+        // Resource state barriers are set in command list before bundle execution
+        Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = cmd.apply_behavior;
+        apply_behavior.SetBitOff(Rhi::ProgramBindingsApplyBehavior::StateBarriers);
+        static_cast<const ProgramBindings&>(*cmd.program_bindings_ptr).Apply(m_cmd_list, m_applied_program_bindings_ptr, apply_behavior);
+
+        if (constexpr Rhi::ProgramBindingsApplyBehaviorMask constant_once_and_changes_only({
+                Rhi::ProgramBindingsApplyBehavior::ConstantOnce,
+                Rhi::ProgramBindingsApplyBehavior::ChangesOnly
+            });
+            cmd.apply_behavior.HasAnyBits(constant_once_and_changes_only))
+        {
+            m_applied_program_bindings_ptr = cmd.program_bindings_ptr.get();
+        }
+    }
+
+    void operator()(const Sequence::SetVertexBuffersCommand& cmd) const
+    {
+        const std::vector<D3D12_VERTEX_BUFFER_VIEW>& vertex_buffer_views = static_cast<const BufferSet&>(*cmd.vertex_buffers_ptr).GetNativeVertexBufferViews();
+        m_d3d12_cmd_list.IASetVertexBuffers(0, static_cast<UINT>(vertex_buffer_views.size()), vertex_buffer_views.data());
+    }
+
+    void operator()(const Sequence::SetIndexBufferCommand& cmd)
+    {
+        const auto& dx_index_buffer = static_cast<const Buffer&>(*cmd.index_buffer_ptr);
+        const D3D12_INDEX_BUFFER_VIEW dx_index_buffer_view = dx_index_buffer.GetNativeIndexBufferView();
+        m_d3d12_cmd_list.IASetIndexBuffer(&dx_index_buffer_view);
+        m_index_buffer_ptr = &dx_index_buffer;
+    }
+
+    void operator()(const Sequence::DrawIndexedCommand& cmd)
+    {
+        const uint32_t index_count = cmd.index_count == 0U && m_index_buffer_ptr
+                                   ? m_index_buffer_ptr->GetFormattedItemsCount()
+                                   : cmd.index_count;
+        SetPrimitiveTopology(cmd.primitive);
+        m_d3d12_cmd_list.DrawIndexedInstanced(index_count, cmd.instance_count, cmd.start_index, cmd.start_vertex, cmd.start_instance);
+    }
+
+    void operator()(const Sequence::DrawCommand& cmd)
+    {
+        SetPrimitiveTopology(cmd.primitive);
+        m_d3d12_cmd_list.DrawInstanced(cmd.vertex_count, cmd.instance_count, cmd.start_vertex, cmd.start_instance);
+    }
+
+private:
+    void SetPrimitiveTopology(Rhi::RenderPrimitive primitive)
+    {
+        if (m_primitive_opt == primitive)
+            return;
+
+        m_d3d12_cmd_list.IASetPrimitiveTopology(PrimitiveToDXTopology(primitive));
+        m_primitive_opt = primitive;
+    }
+
+    ICommandList&                m_cmd_list;
+    ID3D12GraphicsCommandList&   m_d3d12_cmd_list;
+    const Base::ProgramBindings* m_applied_program_bindings_ptr = nullptr;
+    const Buffer*                m_index_buffer_ptr = nullptr;
+    Opt<Rhi::RenderPrimitive>    m_primitive_opt;
+};
+
+bool RenderCommandBundle::IsSupported(const Base::RenderCommandSequence& command_sequence, const Base::RenderState* inherited_render_state_ptr)
+{
+    META_FUNCTION_TASK();
+    if (!inherited_render_state_ptr)
+        return false;
+
+    ID3D12RootSignature* p_inherited_root_signature = static_cast<const RenderState&>(*inherited_render_state_ptr).GetNativeRootSignature();
+    for(const Sequence::Command& command : command_sequence.GetCommands())
+    {
+        if (const auto* render_state_cmd_ptr = std::get_if<Sequence::SetRenderStateCommand>(&command);
+            render_state_cmd_ptr && static_cast<const RenderState&>(*render_state_cmd_ptr->render_state_ptr).GetNativeRootSignature() != p_inherited_root_signature)
+            return false;
+    }
+    return true;
+}
+
+RenderCommandBundle::RenderCommandBundle(Base::RenderCommandSequence& command_sequence, CommandQueue& command_queue,
+                                         const Ptr<Base::RenderState>& inherited_render_state_ptr, const DescriptorHeaps& descriptor_heaps)
+    : Base::Object(command_sequence.GetName())
+    , m_command_queue_ptr(command_queue.GetPtr<CommandQueue>())
+    , m_commands(command_sequence.GetCommands())
+    , m_inherited_render_state_ptr(inherited_render_state_ptr)
+    , m_descriptor_heaps(descriptor_heaps)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL_DESCR(m_inherited_render_state_ptr, "render state must be set in command list before replay of command sequence");
+
+    const wrl::ComPtr<ID3D12Device>& cp_device = command_queue.GetDirectContext().GetDirectDevice().GetNativeDevice();
+    META_CHECK_ARG_NOT_NULL(cp_device);
+
+    ThrowIfFailed(cp_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_BUNDLE, IID_PPV_ARGS(&m_cp_command_allocator)), cp_device.Get());
+    ThrowIfFailed(cp_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_BUNDLE, m_cp_command_allocator.Get(), nullptr, IID_PPV_ARGS(&m_cp_command_list)), cp_device.Get());
+    m_cp_command_list->SetName(nowide::widen(GetName()).c_str());
+
+    EncodeCommands();
+    ThrowIfFailed(m_cp_command_list->Close(), cp_device.Get());
+}
+
+bool RenderCommandBundle::IsEncodedFor(const Base::RenderState* inherited_render_state_ptr, const DescriptorHeaps& descriptor_heaps) const
+{
+    META_FUNCTION_TASK();
+    // Native pipeline state is compared too, because it is recreated on render state reset
+    return inherited_render_state_ptr &&
+           m_inherited_render_state_ptr.get() == inherited_render_state_ptr &&
+           m_inherited_pipeline_state_ptr == static_cast<RenderState&>(*m_inherited_render_state_ptr).GetNativePipelineState().Get() &&
+           m_descriptor_heaps == descriptor_heaps;
+}
+
+CommandQueue& RenderCommandBundle::GetDirectCommandQueue()
+{
+    META_FUNCTION_TASK();
+    return *m_command_queue_ptr;
+}
+
+ID3D12GraphicsCommandList& RenderCommandBundle::GetNativeCommandList() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_cp_command_list);
+    return *m_cp_command_list.Get();
+}
+
+void RenderCommandBundle::SetResourceBarriers(const Rhi::IResourceBarriers&)
+{
+    META_FUNCTION_NOT_IMPLEMENTED_DESCR("resource barriers can not be encoded in render command bundle");
+}
+
+void RenderCommandBundle::EncodeCommands()
+{
+    META_FUNCTION_TASK();
+    META_LOG("Render command bundle '{}' ENCODE {} commands", GetName(), m_commands.size());
+
+    // Bundle using descriptor tables must set the same descriptor heaps as the calling command list
+    if (!m_descriptor_heaps.empty())
+    {
+        m_cp_command_list->SetDescriptorHeaps(static_cast<UINT>(m_descriptor_heaps.size()), m_descriptor_heaps.data());
+    }
+
+    auto& dx_inherited_render_state = static_cast<RenderState&>(*m_inherited_render_state_ptr);
+    m_inherited_pipeline_state_ptr = dx_inherited_render_state.GetNativePipelineState().Get();
+    dx_inherited_render_state.Apply(*m_cp_command_list.Get(), s_all_render_state_groups);
+
+    RenderCommandEncoder command_encoder(*this);
+    for(const Sequence::Command& command : m_commands)
+    {
+        std::visit(command_encoder, command);
+    }
+}
+
+} // namespace Methane::Graphics::DirectX
@@ -22,6 +22,7 @@ DirectX 12 implementation of the render command list interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/DirectX/RenderCommandList.h>
+#include <Methane/Graphics/DirectX/RenderCommandBundle.h>
 #include <Methane/Graphics/DirectX/ParallelRenderCommandList.h>
 #include <Methane/Graphics/DirectX/RenderState.h>
 #include <Methane/Graphics/DirectX/RenderPass.h>
@@ -51,7 +52,7 @@ Ptr<Rhi::IRenderCommandList> RenderCommandList::CreateForSynchronization(Rhi::IC
 namespace Methane::Graphics::DirectX
 {
 
-static D3D12_PRIMITIVE_TOPOLOGY PrimitiveToDXTopology(Rhi::RenderPrimitive primitive)
+D3D12_PRIMITIVE_TOPOLOGY PrimitiveToDXTopology(Rhi::RenderPrimitive primitive)
 {
     META_FUNCTION_TASK();
     switch (primitive)
@@ -221,6 +222,22 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     dx_command_list.DrawInstanced(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+    ExecuteNativeIndirectDraws(true, primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+    ExecuteNativeIndirectDraws(false, primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+}
+
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
@@ -239,6 +256,77 @@ void RenderCommandList::Commit()
     CommandList<Base::RenderCommandList>::Commit();
 }
 
+void RenderCommandList::ExecuteCommandSequence(Base::RenderCommandSequence& command_sequence)
+{
+    META_FUNCTION_TASK();
+    // Descriptor heaps of render pass are set in bundle, so it is used only in command lists with render pass
+    if (!HasPass())
+    {
+        Base::RenderCommandList::ExecuteCommandSequence(command_sequence);
+        return;
+    }
+
+    const DrawingState& drawing_state = GetDrawingState();
+    const RenderCommandBundle::DescriptorHeaps& descriptor_heaps = GetDirectPass().GetNativeDescriptorHeaps();
+    auto render_bundle_ptr = std::static_pointer_cast<RenderCommandBundle>(command_sequence.GetNativeBundle());
+    if (!render_bundle_ptr || !render_bundle_ptr->IsEncodedFor(drawing_state.render_state_ptr.get(), descriptor_heaps))
+    {
+        if (!RenderCommandBundle::IsSupported(command_sequence, drawing_state.render_state_ptr.get()))
+        {
+            Base::RenderCommandList::ExecuteCommandSequence(command_sequence);
+            return;
+        }
+
+        // Bundle encoded for the previous render state is still retained by command lists executing it
+        render_bundle_ptr = std::make_shared<RenderCommandBundle>(command_sequence, GetDirectCommandQueue(),
+                                                                  drawing_state.render_state_ptr, descriptor_heaps);
+        command_sequence.SetNativeBundle(render_bundle_ptr);
+    }
+
+    SetCommandSequenceResourceStates(command_sequence);
+    GetNativeCommandListRef().ExecuteBundle(&render_bundle_ptr->GetNativeCommandList());
+
+    RetainResource(render_bundle_ptr);
+    RestoreDrawingStateAfterBundle();
+}
+
+void RenderCommandList::ExecuteNativeIndirectDraws(bool is_indexed, Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset,
+                                                   uint32_t max_draw_count, Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    SetIndirectBufferState(arguments_buffer);
+    if (draw_count_buffer_ptr)
+    {
+        SetIndirectBufferState(*draw_count_buffer_ptr);
+    }
+
+    ID3D12GraphicsCommandList& dx_command_list = GetNativeCommandListRef();
+    if (DrawingState& drawing_state = GetDrawingState();
+        drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
+    {
+        const D3D12_PRIMITIVE_TOPOLOGY primitive_topology = PrimitiveToDXTopology(primitive);
+        dx_command_list.IASetPrimitiveTopology(primitive_topology);
+        drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
+    }
+
+    ID3D12CommandSignature& dx_command_signature = GetDirectCommandQueue().GetDirectContext().GetDirectDevice().GetNativeDrawCommandSignature(is_indexed);
+    dx_command_list.ExecuteIndirect(&dx_command_signature, max_draw_count,
+                                    static_cast<Buffer&>(arguments_buffer).GetNativeResource(), arguments_offset,
+                                    draw_count_buffer_ptr ? static_cast<Buffer&>(*draw_count_buffer_ptr).GetNativeResource() : nullptr,
+                                    draw_count_offset);
+}
+
+void RenderCommandList::SetIndirectBufferState(Rhi::IBuffer& indirect_buffer)
+{
+    META_FUNCTION_TASK();
+    auto& dx_indirect_buffer = static_cast<Buffer&>(indirect_buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = dx_indirect_buffer.GetSetupTransitionBarriers();
+        dx_indirect_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+}
+
 RenderPass& RenderCommandList::GetDirectPass()
 {
     META_FUNCTION_TASK();
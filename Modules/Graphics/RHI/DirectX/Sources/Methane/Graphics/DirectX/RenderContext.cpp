@@ -28,6 +28,7 @@ DirectX 12 implementation of the render context interface.
 #include <Methane/Graphics/DirectX/Program.h>
 #include <Methane/Graphics/DirectX/RenderPass.h>
 #include <Methane/Graphics/DirectX/RenderState.h>
+#include <Methane/Graphics/DirectX/ComputeState.h>
 #include <Methane/Graphics/DirectX/RenderPattern.h>
 #include <Methane/Graphics/DirectX/Buffer.h>
 #include <Methane/Graphics/DirectX/Texture.h>
@@ -100,6 +101,12 @@ Ptr<Rhi::ISampler> RenderContext::CreateSampler(const Rhi::SamplerSettings& sett
     return std::make_shared<Sampler>(*this, settings);
 }
 
+Ptr<Rhi::IComputeState> RenderContext::CreateComputeState(const Rhi::ComputeStateSettings& settings) const
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeState>(*this, settings);
+}
+
 Ptr<Rhi::IRenderState> RenderContext::CreateRenderState(const Rhi::RenderStateSettings& settings) const
 {
     META_FUNCTION_TASK();
@@ -202,7 +209,7 @@ void RenderContext::Initialize(Base::Device& device, bool is_callback_emitted)
     ThrowIfFailed(cp_swap_chain.As(&m_cp_swap_chain), p_native_device);
 
     // Create waitable object to reduce frame latency (https://docs.microsoft.com/en-us/windows/uwp/gaming/reduce-latency-with-dxgi-1-3-swap-chains)
-    m_cp_swap_chain->SetMaximumFrameLatency(settings.frame_buffers_count);
+    m_cp_swap_chain->SetMaximumFrameLatency(GetFramesInFlightCount());
     m_frame_latency_waitable_object = m_cp_swap_chain->GetFrameLatencyWaitableObject();
     META_CHECK_ARG_NOT_ZERO_DESCR(m_frame_latency_waitable_object, "swap-chain waitable object is null");
 
@@ -282,14 +282,18 @@ void RenderState::Apply(Base::RenderCommandList& command_list, Groups state_grou
 {
     META_FUNCTION_TASK();
     const auto& dx_render_command_list = static_cast<RenderCommandList&>(command_list);
-    ID3D12GraphicsCommandList& d3d12_command_list = dx_render_command_list.GetNativeCommandList();
+    Apply(dx_render_command_list.GetNativeCommandList(), state_groups);
+}
 
+void RenderState::Apply(ID3D12GraphicsCommandList& d3d12_command_list, Groups state_groups)
+{
+    META_FUNCTION_TASK();
     if (state_groups.HasAnyBits({Group::Program, Group::Rasterizer, Group::Blending, Group::DepthStencil}))
     {
         d3d12_command_list.SetPipelineState(GetNativePipelineState().Get());
     }
 
-    d3d12_command_list.SetGraphicsRootSignature(GetDirectProgram().GetNativeRootSignature().Get());
+    d3d12_command_list.SetGraphicsRootSignature(GetNativeRootSignature());
 
     if (state_groups.HasAnyBit(Group::BlendingColor))
     {
@@ -331,6 +335,12 @@ wrl::ComPtr<ID3D12PipelineState>& RenderState::GetNativePipelineState()
     return m_cp_pipeline_state;
 }
 
+ID3D12RootSignature* RenderState::GetNativeRootSignature() const
+{
+    META_FUNCTION_TASK();
+    return m_pipeline_state_desc.pRootSignature;
+}
+
 Program& RenderState::GetDirectProgram()
 {
     META_FUNCTION_TASK();
@@ -44,13 +44,25 @@ namespace Methane::Graphics::DirectX
 {
 
 [[nodiscard]]
-static D3D12_RESOURCE_BARRIER_TYPE GetNativeBarrierType(Rhi::ResourceBarrier::Type barrier_type)
+static bool IsUnorderedAccessBarrier(const Rhi::ResourceBarrier::StateChange& state_change)
+{
+    // Transition from unordered access to the same state synchronizes shader writes between dispatches with UAV barrier
+    return state_change.GetStateBefore() == Rhi::ResourceState::UnorderedAccess &&
+           state_change.GetStateAfter()  == Rhi::ResourceState::UnorderedAccess;
+}
+
+[[nodiscard]]
+static D3D12_RESOURCE_BARRIER_TYPE GetNativeBarrierType(const Rhi::ResourceBarrier& barrier)
 {
     META_FUNCTION_TASK();
-    switch (barrier_type) // NOSONAR
+    switch (barrier.GetId().GetType()) // NOSONAR
     {
-    case Rhi::ResourceBarrier::Type::StateTransition: return D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    default: META_UNEXPECTED_ARG_RETURN(barrier_type, D3D12_RESOURCE_BARRIER_TYPE_TRANSITION);
+    case Rhi::ResourceBarrier::Type::StateTransition:
+        return IsUnorderedAccessBarrier(barrier.GetStateChange())
+             ? D3D12_RESOURCE_BARRIER_TYPE_UAV
+             : D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    default:
+        META_UNEXPECTED_ARG_RETURN(barrier.GetId().GetType(), D3D12_RESOURCE_BARRIER_TYPE_TRANSITION);
     }
 }
 
@@ -90,6 +102,9 @@ D3D12_RESOURCE_BARRIER ResourceBarriers::GetNativeResourceBarrier(const Barrier:
     switch (id.GetType()) // NOSONAR
     {
     case Barrier::Type::StateTransition:
+        if (IsUnorderedAccessBarrier(state_change))
+            return CD3DX12_RESOURCE_BARRIER::UAV(dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource());
+
         return CD3DX12_RESOURCE_BARRIER::Transition(
             dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource(),
             IResource::GetNativeResourceState(state_change.GetStateBefore()),
@@ -114,7 +129,11 @@ ResourceBarriers::ResourceBarriers(const Set& barriers)
 Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier::Id& id, const Barrier& barrier)
 {
     META_FUNCTION_TASK();
-    const auto lock_guard  = Base::ResourceBarriers::Lock();
+    const auto lock_guard = Base::ResourceBarriers::Lock();
+    const Barrier* const existing_barrier_ptr = GetBarrier(id);
+    const D3D12_RESOURCE_BARRIER_TYPE existing_native_barrier_type = existing_barrier_ptr
+                                                                   ? GetNativeBarrierType(*existing_barrier_ptr)
+                                                                   : D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     const AddResult result = Base::ResourceBarriers::Add(id, barrier);
 
     if (id.GetType() != Barrier::Type::StateTransition)
@@ -123,7 +142,7 @@ Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier::Id& id, c
     switch (result)
     {
     case AddResult::Added:    AddNativeResourceBarrier(id, barrier.GetStateChange()); break;
-    case AddResult::Updated:  UpdateNativeResourceBarrier(id, barrier.GetStateChange()); break;
+    case AddResult::Updated:  UpdateNativeResourceBarrier(id, existing_native_barrier_type, barrier.GetStateChange()); break;
     case AddResult::Existing: break;
     default: META_UNEXPECTED_ARG_RETURN(result, result);
     }
@@ -134,13 +153,13 @@ bool ResourceBarriers::Remove(const Barrier::Id& id)
 {
     META_FUNCTION_TASK();
     const auto lock_guard = Base::ResourceBarriers::Lock();
-    if (!Base::ResourceBarriers::Remove(id))
-        return false;
+    const Barrier* const barrier_ptr = GetBarrier(id);
+    if (!barrier_ptr || id.GetType() != Barrier::Type::StateTransition)
+        return Base::ResourceBarriers::Remove(id);
 
-    if (id.GetType() != Barrier::Type::StateTransition)
-        return true;
+    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(*barrier_ptr);
+    Base::ResourceBarriers::Remove(id);
 
-    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
     const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
     const auto native_resource_barrier_it = std::find_if(m_native_resource_barriers.begin(), m_native_resource_barriers.end(),
                                                          GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
@@ -164,15 +183,22 @@ void ResourceBarriers::AddNativeResourceBarrier(const Barrier::Id& id, const Bar
     m_native_resource_barriers.emplace_back(GetNativeResourceBarrier(id, state_change));
 }
 
-void ResourceBarriers::UpdateNativeResourceBarrier(const Barrier::Id& id, const Barrier::StateChange& state_change)
+void ResourceBarriers::UpdateNativeResourceBarrier(const Barrier::Id& id, D3D12_RESOURCE_BARRIER_TYPE native_barrier_type,
+                                                   const Barrier::StateChange& state_change)
 {
     META_FUNCTION_TASK();
-    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
     const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
     const auto native_resource_barrier_it = std::find_if(m_native_resource_barriers.begin(), m_native_resource_barriers.end(),
                                                          GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
     META_CHECK_ARG_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
 
+    if (native_barrier_type == D3D12_RESOURCE_BARRIER_TYPE_UAV || IsUnorderedAccessBarrier(state_change))
+    {
+        // Barrier type changes between state transition and UAV barrier
+        *native_resource_barrier_it = GetNativeResourceBarrier(id, state_change);
+        return;
+    }
+
     switch (native_barrier_type) // NOSONAR - do not replace switch with if
     {
     case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
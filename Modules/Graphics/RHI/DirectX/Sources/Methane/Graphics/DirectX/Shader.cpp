@@ -57,13 +57,48 @@ static Rhi::IResource::Type GetResourceTypeByInputType(D3D_SHADER_INPUT_TYPE inp
     {
     case D3D_SIT_CBUFFER:
     case D3D_SIT_STRUCTURED:
-    case D3D_SIT_TBUFFER:   return Rhi::IResource::Type::Buffer;
-    case D3D_SIT_TEXTURE:   return Rhi::IResource::Type::Texture;
-    case D3D_SIT_SAMPLER:   return Rhi::IResource::Type::Sampler;
+    case D3D_SIT_TBUFFER:
+    case D3D_SIT_UAV_RWSTRUCTURED:
+    case D3D_SIT_UAV_RWBYTEADDRESS:
+    case D3D_SIT_UAV_APPEND_STRUCTURED:
+    case D3D_SIT_UAV_CONSUME_STRUCTURED:
+    case D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER:
+    case D3D_SIT_BYTEADDRESS:  return Rhi::IResource::Type::Buffer;
+    case D3D_SIT_TEXTURE:
+    case D3D_SIT_UAV_RWTYPED:  return Rhi::IResource::Type::Texture;
+    case D3D_SIT_SAMPLER:      return Rhi::IResource::Type::Sampler;
     default: META_UNEXPECTED_ARG_DESCR_RETURN(input_type, Rhi::IResource::Type::Buffer, "unable to determine resource type by DX shader input type");
     }
 }
 
+[[nodiscard]]
+static bool IsUnorderedAccessInputType(D3D_SHADER_INPUT_TYPE input_type) noexcept
+{
+    switch (input_type)
+    {
+    case D3D_SIT_UAV_RWTYPED:
+    case D3D_SIT_UAV_RWSTRUCTURED:
+    case D3D_SIT_UAV_RWBYTEADDRESS:
+    case D3D_SIT_UAV_APPEND_STRUCTURED:
+    case D3D_SIT_UAV_CONSUME_STRUCTURED:
+    case D3D_SIT_UAV_RWSTRUCTURED_WITH_COUNTER:
+        return true;
+    default:
+        return false;
+    }
+}
+
+[[nodiscard]]
+static ProgramBindings::ArgumentBinding::Type GetAddressableBindingTypeByInputType(D3D_SHADER_INPUT_TYPE input_type) noexcept
+{
+    if (input_type == D3D_SIT_CBUFFER)
+        return ProgramBindings::ArgumentBinding::Type::ConstantBufferView;
+
+    return IsUnorderedAccessInputType(input_type)
+         ? ProgramBindings::ArgumentBinding::Type::UnorderedAccessView
+         : ProgramBindings::ArgumentBinding::Type::ShaderResourceView;
+}
+
 using StepType = Base::Program::InputBufferLayout::StepType;
 
 [[nodiscard]]
@@ -153,12 +188,9 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
                                                    ? Rhi::ProgramArgumentAccessor(shader_argument)
                                                    : *argument_acc_it;
 
-        const ProgramBindings::ArgumentBinding::Type dx_addressable_binding_type = binding_desc.Type == D3D_SIT_CBUFFER
-                                                                                     ? ProgramBindings::ArgumentBinding::Type::ConstantBufferView
-                                                                                     : ProgramBindings::ArgumentBinding::Type::ShaderResourceView;
-        const ProgramBindings::ArgumentBinding::Type dx_binding_type             = argument_acc.IsAddressable()
-                                                                                     ? dx_addressable_binding_type
-                                                                                     : ProgramBindings::ArgumentBinding::Type::DescriptorTable;
+        const ProgramBindings::ArgumentBinding::Type dx_binding_type = argument_acc.IsAddressable()
+                                                                         ? GetAddressableBindingTypeByInputType(binding_desc.Type)
+                                                                         : ProgramBindings::ArgumentBinding::Type::DescriptorTable;
 
         argument_bindings.push_back(std::make_shared<ProgramBindings::ArgumentBinding>(
             GetContext(),
@@ -168,7 +200,10 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
                 {
                     argument_acc,
                     GetResourceTypeByInputType(binding_desc.Type),
-                    binding_desc.BindCount
+                    binding_desc.BindCount,
+                    IsUnorderedAccessInputType(binding_desc.Type)
+                        ? Rhi::ProgramArgumentShaderAccess::ReadWrite
+                        : Rhi::ProgramArgumentShaderAccess::ReadOnly
                 },
                 dx_binding_type,
                 binding_desc.Type,
@@ -252,6 +287,8 @@ std::vector<D3D12_INPUT_ELEMENT_DESC> Shader::GetNativeProgramInputLayout(const
 
         uint32_t& buffer_byte_offset = input_buffer_byte_offsets[buffer_index];
 
+        // Explicit argument format is used for packed vertex attributes, which are unpacked to shader input types by input assembler
+        const PixelFormat argument_format = GetProgramInputArgumentFormatBySemantic(program, param_desc.SemanticName);
         uint32_t element_byte_size = 0;
         D3D12_INPUT_ELEMENT_DESC element_desc{};
         element_desc.SemanticName             = param_desc.SemanticName;
@@ -259,9 +296,14 @@ std::vector<D3D12_INPUT_ELEMENT_DESC> Shader::GetNativeProgramInputLayout(const
         element_desc.InputSlot                = buffer_index;
         element_desc.InputSlotClass           = GetInputClassificationByLayoutStepType(input_buffer_layout.step_type);
         element_desc.InstanceDataStepRate     = input_buffer_layout.step_type == StepType::PerVertex ? 0 : input_buffer_layout.step_rate;
-        element_desc.Format                   = TypeConverter::ParameterDescToDxgiFormatAndSize(param_desc, element_byte_size);
+        element_desc.Format                   = argument_format == PixelFormat::Unknown
+                                              ? TypeConverter::ParameterDescToDxgiFormatAndSize(param_desc, element_byte_size)
+                                              : TypeConverter::PixelFormatToDxgi(argument_format);
         element_desc.AlignedByteOffset        = buffer_byte_offset;
 
+        if (argument_format != PixelFormat::Unknown)
+            element_byte_size = static_cast<uint32_t>(GetPixelSize(argument_format));
+
         dx_input_layout.push_back(element_desc);
         buffer_byte_offset += element_byte_size;
     }
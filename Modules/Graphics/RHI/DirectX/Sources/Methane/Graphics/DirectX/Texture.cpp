@@ -22,6 +22,7 @@ DirectX 12 implementation of the texture interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/DirectX/Texture.h>
+#include <Methane/Graphics/DirectX/Buffer.h>
 #include <Methane/Graphics/DirectX/RenderContext.h>
 #include <Methane/Graphics/DirectX/Device.h>
 #include <Methane/Graphics/DirectX/DescriptorHeap.h>
@@ -41,6 +42,8 @@ DirectX 12 implementation of the texture interface.
 #include <directx/d3dx12_resource_helpers.h>
 #include <DirectXTex.h>
 
+#include <algorithm>
+
 template<>
 struct fmt::formatter<Methane::Graphics::Rhi::ResourceUsage>
 {
@@ -297,12 +300,22 @@ bool Texture::SetName(std::string_view name)
 void Texture::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue)
 {
     META_FUNCTION_TASK();
-    META_CHECK_ARG_NOT_NULL_DESCR(m_cp_upload_resource, "Only ForImage textures support data upload from CPU.");
+    META_CHECK_ARG_EQUAL_DESCR(GetSettings().type, Rhi::TextureType::Image, "only image textures support data upload from CPU");
 
     Resource::SetData(sub_resources, target_cmd_queue);
 
+    if (std::any_of(sub_resources.begin(), sub_resources.end(), [](const SubResource& sub_resource) { return sub_resource.HasDataRange(); }))
+    {
+        // Sliced sub-resources data is copied by rows to the regions of texture sub-resources
+        ID3D12Resource& upload_resource = GetUploadResource();
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(GetStagingDataSize(sub_resources), upload_resource.GetDesc().Width,
+                                           "sliced sub-resources data does not fit in texture upload resource");
+        UploadSubResourceSlices(sub_resources, PrepareResourceUpload(target_cmd_queue), upload_resource, 0U);
+        GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+        return;
+    }
+
     const Settings&  settings                    = GetSettings();
-    const Data::Size pixel_size                  = GetPixelSize(settings.pixel_format);
     const SubResource::Count& sub_resource_count = GetSubresourceCount();
     const uint32_t       sub_resources_raw_count = sub_resource_count.GetRawCount();
 
@@ -314,10 +327,15 @@ void Texture::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& tar
         const uint32_t sub_resource_raw_index = sub_resource.GetIndex().GetRawIndex(sub_resource_count);
         META_CHECK_ARG_LESS(sub_resource_raw_index, dx_sub_resources.size());
 
+        // Row pitch of block-compressed formats is a size of pixel blocks row
+        const Data::Index mip_level = sub_resource.GetIndex().GetMipLevel();
+        const uint32_t mip_width    = GetMipLevelSize(settings.dimensions.GetWidth(), mip_level);
+        const uint32_t mip_height   = GetMipLevelSize(settings.dimensions.GetHeight(), mip_level);
+
         D3D12_SUBRESOURCE_DATA& dx_sub_resource = dx_sub_resources[sub_resource_raw_index];
         dx_sub_resource.pData      = sub_resource.GetDataPtr();
-        dx_sub_resource.RowPitch   = static_cast<int64_t>(settings.dimensions.GetWidth())  * pixel_size;
-        dx_sub_resource.SlicePitch = dx_sub_resource.RowPitch * settings.dimensions.GetHeight();
+        dx_sub_resource.RowPitch   = static_cast<int64_t>(GetRowPitch(settings.pixel_format, mip_width));
+        dx_sub_resource.SlicePitch = dx_sub_resource.RowPitch * GetBlockRowsCount(settings.pixel_format, mip_height);
 
         META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(sub_resource.GetDataSize(), dx_sub_resource.SlicePitch,
                                               "sub-resource data size is less than computed MIP slice size, possibly due to pixel format mismatch");
@@ -325,19 +343,119 @@ void Texture::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& tar
 
     // NOTE: scratch_image is the owner of generated mip-levels memory, which should be hold until UpdateSubresources call completes
     ::DirectX::ScratchImage scratch_image;
-    if (settings.mipmapped && sub_resources.size() < sub_resources_raw_count)
+    if (IsMipLevelsGenerationRequired(sub_resources))
     {
+        META_CHECK_ARG_FALSE_DESCR(IsBlockCompressedFormat(settings.pixel_format),
+                                   "MIP levels can not be generated for block-compressed texture, all levels must be uploaded");
         GenerateMipLevels(dx_sub_resources, scratch_image);
     }
 
     // Upload texture subresources data to GPU via intermediate upload resource
     const TransferCommandList& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
     UpdateSubresources(&upload_cmd_list.GetNativeCommandList(),
-                       GetNativeResource(), m_cp_upload_resource.Get(), 0, 0,
+                       GetNativeResource(), &GetUploadResource(), 0, 0,
                        static_cast<UINT>(dx_sub_resources.size()), dx_sub_resources.data());
     GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
+Data::Size Texture::GetStagingDataSize(const SubResources& sub_resources) const
+{
+    META_FUNCTION_TASK();
+    Data::Size staging_data_size = 0U;
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        const D3D12_PLACED_SUBRESOURCE_FOOTPRINT dx_footprint = GetSliceFootprint(sub_resource, staging_data_size);
+        staging_data_size = static_cast<Data::Size>(dx_footprint.Offset + dx_footprint.Footprint.RowPitch * GetSubResourceBlockRows(sub_resource).GetLength());
+    }
+    return staging_data_size;
+}
+
+void Texture::SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                                    Rhi::IBuffer& staging_buffer, Data::Size staging_offset)
+{
+    META_FUNCTION_TASK();
+    Resource::SetDataThroughStaging(sub_resources, target_cmd_queue, staging_buffer, staging_offset);
+
+    // Texture does not own upload resource in this case, data is written to the region of shared staging buffer
+    UploadSubResourceSlices(sub_resources, PrepareResourceUpload(target_cmd_queue),
+                            static_cast<Buffer&>(staging_buffer).GetNativeResourceRef(), staging_offset);
+    GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+}
+
+D3D12_PLACED_SUBRESOURCE_FOOTPRINT Texture::GetSliceFootprint(const SubResource& sub_resource, Data::Size upload_offset) const
+{
+    META_FUNCTION_TASK();
+    const auto                sub_resource_raw_index = static_cast<UINT>(sub_resource.GetIndex().GetRawIndex(GetSubresourceCount()));
+    const D3D12_RESOURCE_DESC dx_resource_desc       = GetNativeResource()->GetDesc();
+    ID3D12Device&             dx_device              = *GetDirectContext().GetDirectDevice().GetNativeDevice().Get();
+
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT dx_footprint{};
+    dx_device.GetCopyableFootprints(&dx_resource_desc, sub_resource_raw_index, 1, 0, &dx_footprint, nullptr, nullptr, nullptr);
+
+    // Rows of sliced data are packed in upload resource one after another with footprint height of the slice
+    const Data::Range<Data::Index> block_rows = GetSubResourceBlockRows(sub_resource);
+    const uint32_t block_height = GetPixelFormatBlock(GetSettings().pixel_format).height;
+    const auto     begin_y      = static_cast<UINT>(block_rows.GetStart() * block_height);
+    const auto     end_y        = std::min(static_cast<UINT>(block_rows.GetEnd() * block_height), dx_footprint.Footprint.Height);
+    dx_footprint.Offset           = AlignStagingDataOffset(upload_offset);
+    dx_footprint.Footprint.Height = end_y - begin_y;
+    return dx_footprint;
+}
+
+ID3D12Resource& Texture::GetUploadResource()
+{
+    META_FUNCTION_TASK();
+    if (m_cp_upload_resource)
+        return *m_cp_upload_resource.Get();
+
+    // Upload resource is created on first data upload, so it is not allocated for textures uploaded through shared staging buffer
+    const UINT64 upload_buffer_size = GetRequiredIntermediateSize(GetNativeResource(), 0, GetSubresourceCount().GetRawCount());
+    m_cp_upload_resource = CreateCommittedResource(CD3DX12_RESOURCE_DESC::Buffer(upload_buffer_size), D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ);
+    if (const std::string_view name = GetName();
+        !name.empty())
+    {
+        m_cp_upload_resource->SetName(nowide::widen(fmt::format("{} Upload Resource", name)).c_str());
+    }
+    return *m_cp_upload_resource.Get();
+}
+
+void Texture::UploadSubResourceSlices(const SubResources& sub_resources, const TransferCommandList& upload_cmd_list,
+                                      ID3D12Resource& upload_resource, Data::Size upload_offset) const
+{
+    META_FUNCTION_TASK();
+    const SubResource::Count& sub_resource_count = GetSubresourceCount();
+    const PixelFormatBlock    pixel_block        = GetPixelFormatBlock(GetSettings().pixel_format);
+    ID3D12Device&             dx_device          = *GetDirectContext().GetDirectDevice().GetNativeDevice().Get();
+
+    Data::RawPtr upload_data_ptr = nullptr;
+    const CD3DX12_RANGE read_range(0, 0);
+    ThrowIfFailed(upload_resource.Map(0, &read_range, reinterpret_cast<void**>(&upload_data_ptr)), &dx_device); // NOSONAR
+
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        ValidateSubResource(sub_resource);
+
+        const D3D12_PLACED_SUBRESOURCE_FOOTPRINT dx_footprint = GetSliceFootprint(sub_resource, upload_offset);
+        const Data::Range<Data::Index> block_rows = GetSubResourceBlockRows(sub_resource);
+        const Data::Size  row_pitch   = GetRowPitch(GetSettings().pixel_format, dx_footprint.Footprint.Width);
+        const Data::Byte* src_row_ptr = sub_resource.GetDataPtr();
+        for(Data::Index block_row = 0U; block_row < block_rows.GetLength(); ++block_row, src_row_ptr += row_pitch)
+        {
+            std::copy(src_row_ptr, src_row_ptr + row_pitch,
+                      upload_data_ptr + dx_footprint.Offset + static_cast<UINT64>(block_row) * dx_footprint.Footprint.RowPitch);
+        }
+
+        const auto sub_resource_raw_index = static_cast<UINT>(sub_resource.GetIndex().GetRawIndex(sub_resource_count));
+        const auto begin_y = static_cast<UINT>(block_rows.GetStart() * pixel_block.height);
+        const CD3DX12_TEXTURE_COPY_LOCATION dx_dst_location(GetNativeResource(), sub_resource_raw_index);
+        const CD3DX12_TEXTURE_COPY_LOCATION dx_src_location(&upload_resource, dx_footprint);
+        upload_cmd_list.GetNativeCommandList().CopyTextureRegion(&dx_dst_location, 0U, begin_y, 0U, &dx_src_location, nullptr);
+        upload_offset = static_cast<Data::Size>(dx_footprint.Offset + dx_footprint.Footprint.RowPitch * block_rows.GetLength());
+    }
+
+    upload_resource.Unmap(0, nullptr);
+}
+
 Opt<Rhi::IResource::Descriptor> Texture::InitializeNativeViewDescriptor(const View::Id& view_id)
 {
     META_FUNCTION_TASK();
@@ -395,9 +513,6 @@ void Texture::InitializeAsImage()
     const SubResource::Count& sub_resource_count = GetSubresourceCount();
     const CD3DX12_RESOURCE_DESC resource_desc = CreateNativeResourceDesc(settings, sub_resource_count);
     InitializeCommittedResource(resource_desc, D3D12_HEAP_TYPE_DEFAULT, Rhi::ResourceState::CopyDest);
-
-    const UINT64 upload_buffer_size = GetRequiredIntermediateSize(GetNativeResource(), 0, GetSubresourceCount().GetRawCount());
-    m_cp_upload_resource = CreateCommittedResource(CD3DX12_RESOURCE_DESC::Buffer(upload_buffer_size), D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ);
 }
 
 void Texture::InitializeAsRenderTarget()
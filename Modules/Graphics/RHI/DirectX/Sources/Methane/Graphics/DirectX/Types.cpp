@@ -57,6 +57,7 @@ DXGI_FORMAT TypeConverter::PixelFormatToDxgi(const PixelFormat& pixel_format)
     case PixelFormat::RGBA8Unorm_sRGB:  return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
     case PixelFormat::BGRA8Unorm:       return DXGI_FORMAT_B8G8R8A8_UNORM;
     case PixelFormat::BGRA8Unorm_sRGB:  return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+    case PixelFormat::RGBA16Float:      return DXGI_FORMAT_R16G16B16A16_FLOAT;
     case PixelFormat::Depth32Float:     return DXGI_FORMAT_D32_FLOAT;
     case PixelFormat::R32Float:         return DXGI_FORMAT_R32_FLOAT;
     case PixelFormat::R32Uint:          return DXGI_FORMAT_R32_UINT;
@@ -66,11 +67,24 @@ DXGI_FORMAT TypeConverter::PixelFormatToDxgi(const PixelFormat& pixel_format)
     case PixelFormat::R16Sint:          return DXGI_FORMAT_R16_SINT;
     case PixelFormat::R16Unorm:         return DXGI_FORMAT_R16_UNORM;
     case PixelFormat::R16Snorm:         return DXGI_FORMAT_R16_SNORM;
+    case PixelFormat::RG16Unorm:        return DXGI_FORMAT_R16G16_UNORM;
+    case PixelFormat::RG16Snorm:        return DXGI_FORMAT_R16G16_SNORM;
     case PixelFormat::R8Uint:           return DXGI_FORMAT_R8_UINT;
     case PixelFormat::R8Sint:           return DXGI_FORMAT_R8_SINT;
     case PixelFormat::R8Unorm:          return DXGI_FORMAT_R8_UNORM;
     case PixelFormat::R8Snorm:          return DXGI_FORMAT_R8_SNORM;
     case PixelFormat::A8Unorm:          return DXGI_FORMAT_A8_UNORM;
+    case PixelFormat::BC1Unorm:         return DXGI_FORMAT_BC1_UNORM;
+    case PixelFormat::BC1Unorm_sRGB:    return DXGI_FORMAT_BC1_UNORM_SRGB;
+    case PixelFormat::BC3Unorm:         return DXGI_FORMAT_BC3_UNORM;
+    case PixelFormat::BC3Unorm_sRGB:    return DXGI_FORMAT_BC3_UNORM_SRGB;
+    case PixelFormat::BC4Unorm:         return DXGI_FORMAT_BC4_UNORM;
+    case PixelFormat::BC4Snorm:         return DXGI_FORMAT_BC4_SNORM;
+    case PixelFormat::BC5Unorm:         return DXGI_FORMAT_BC5_UNORM;
+    case PixelFormat::BC5Snorm:         return DXGI_FORMAT_BC5_SNORM;
+    case PixelFormat::BC7Unorm:         return DXGI_FORMAT_BC7_UNORM;
+    case PixelFormat::BC7Unorm_sRGB:    return DXGI_FORMAT_BC7_UNORM_SRGB;
+    // ASTC formats are not supported by DirectX 12
     default:                            META_UNEXPECTED_ARG_RETURN(pixel_format, DXGI_FORMAT_UNKNOWN);
     }
 }
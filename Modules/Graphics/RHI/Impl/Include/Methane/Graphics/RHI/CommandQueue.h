@@ -43,6 +43,7 @@ class RenderContext;
 class RenderCommandList;
 class ParallelRenderCommandList;
 class TransferCommandList;
+class ComputeCommandList;
 
 class CommandQueue // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
 {
@@ -72,6 +73,7 @@ public:
     [[nodiscard]] META_PIMPL_API TransferCommandList       CreateTransferCommandList() const;
     [[nodiscard]] META_PIMPL_API RenderCommandList         CreateRenderCommandList(const RenderPass& render_pass) const;
     [[nodiscard]] META_PIMPL_API ParallelRenderCommandList CreateParallelRenderCommandList(const RenderPass& render_pass) const;
+    [[nodiscard]] META_PIMPL_API ComputeCommandList        CreateComputeCommandList() const;
     [[nodiscard]] META_PIMPL_API const IContext&           GetContext() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API CommandListType           GetCommandListType() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t                  GetFamilyIndex() const META_PIMPL_NOEXCEPT;
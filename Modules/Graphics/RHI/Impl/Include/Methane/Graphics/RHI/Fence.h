@@ -65,6 +65,8 @@ public:
     META_PIMPL_API void WaitOnGpu(ICommandQueue& wait_on_command_queue) const;
     META_PIMPL_API void FlushOnCpu() const;
     META_PIMPL_API void FlushOnGpu(ICommandQueue& wait_on_command_queue) const;
+    [[nodiscard]] META_PIMPL_API uint64_t GetValue() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API uint64_t GetCompletedValue() const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::Fence;
@@ -37,6 +37,7 @@ Methane graphics RHI PIMPL implementations.
 #include "RenderPass.h"
 #include "RenderContext.h"
 #include "RenderState.h"
+#include "ComputeState.h"
 #include "ViewState.h"
 #include "Buffer.h"
 #include "BufferSet.h"
@@ -44,5 +45,7 @@ Methane graphics RHI PIMPL implementations.
 #include "Sampler.h"
 #include "ResourceBarriers.h"
 #include "RenderCommandList.h"
+#include "RenderCommandSequence.h"
 #include "ParallelRenderCommandList.h"
 #include "TransferCommandList.h"
+#include "ComputeCommandList.h"
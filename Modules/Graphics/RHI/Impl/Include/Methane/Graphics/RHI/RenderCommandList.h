@@ -44,6 +44,7 @@ class BufferSet;
 class RenderState;
 class ViewState;
 class ProgramBindings;
+class RenderCommandSequence;
 
 class RenderCommandList // NOSONAR - class has more than 35 methods, constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
 {
@@ -105,6 +106,11 @@ public:
                                     uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
     META_PIMPL_API void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0U,
                              uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void ReplayCommandSequence(const RenderCommandSequence& command_sequence) const;
+    META_PIMPL_API void DrawIndexedIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset = 0U, uint32_t max_draw_count = 1U,
+                                            const Buffer* draw_count_buffer_ptr = nullptr, Data::Size draw_count_offset = 0U) const;
+    META_PIMPL_API void DrawIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset = 0U, uint32_t max_draw_count = 1U,
+                                     const Buffer* draw_count_buffer_ptr = nullptr, Data::Size draw_count_offset = 0U) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::RenderCommandList;
@@ -0,0 +1,102 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/RenderCommandSequence.h
+Methane RenderCommandSequence PIMPL wrappers for direct calls to final implementation.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Pimpl.h>
+
+#include <Methane/Graphics/RHI/IRenderCommandSequence.h>
+
+namespace Methane::Graphics::Base
+{
+class RenderCommandSequence;
+}
+
+namespace Methane::Graphics::Rhi
+{
+
+class RenderPattern;
+class RenderState;
+class ProgramBindings;
+class BufferSet;
+class Buffer;
+
+class RenderCommandSequence // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
+{
+public:
+    using State     = RenderCommandSequenceState;
+    using Primitive = RenderPrimitive;
+    using ICallback = IRenderCommandSequenceCallback;
+
+    META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(RenderCommandSequence);
+    META_PIMPL_METHODS_COMPARE_DECLARE(RenderCommandSequence);
+
+    META_PIMPL_API explicit RenderCommandSequence(const Ptr<IRenderCommandSequence>& interface_ptr);
+    META_PIMPL_API explicit RenderCommandSequence(IRenderCommandSequence& interface_ref);
+    META_PIMPL_API explicit RenderCommandSequence(const RenderPattern& render_pattern);
+
+    META_PIMPL_API bool IsInitialized() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API IRenderCommandSequence& GetInterface() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API Ptr<IRenderCommandSequence> GetInterfacePtr() const META_PIMPL_NOEXCEPT;
+
+    // IObject interface methods
+    META_PIMPL_API bool SetName(std::string_view name) const;
+    META_PIMPL_API std::string_view GetName() const META_PIMPL_NOEXCEPT;
+
+    // Data::IEmitter<IObjectCallback> interface methods
+    META_PIMPL_API void Connect(Data::Receiver<IObjectCallback>& receiver) const;
+    META_PIMPL_API void Disconnect(Data::Receiver<IObjectCallback>& receiver) const;
+
+    // Data::IEmitter<IRenderCommandSequenceCallback> interface methods
+    META_PIMPL_API void Connect(Data::Receiver<IRenderCommandSequenceCallback>& receiver) const;
+    META_PIMPL_API void Disconnect(Data::Receiver<IRenderCommandSequenceCallback>& receiver) const;
+
+    // IRenderCommandSequence interface methods
+    [[nodiscard]] META_PIMPL_API RenderPattern GetRenderPattern() const;
+    [[nodiscard]] META_PIMPL_API State GetState() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API Data::Size GetCommandsCount() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API void Reset() const;
+    META_PIMPL_API void SetRenderState(const RenderState& render_state, RenderStateGroupMask state_groups = RenderStateGroupMask(~0U)) const;
+    META_PIMPL_API void SetProgramBindings(const ProgramBindings& program_bindings,
+                                           ProgramBindingsApplyBehaviorMask apply_behavior = ProgramBindingsApplyBehaviorMask(~0U)) const;
+    META_PIMPL_API void SetVertexBuffers(const BufferSet& vertex_buffers, bool set_resource_barriers = true) const;
+    META_PIMPL_API void SetIndexBuffer(const Buffer& index_buffer, bool set_resource_barriers = true) const;
+    META_PIMPL_API void DrawIndexed(Primitive primitive, uint32_t index_count = 0U, uint32_t start_index = 0U, uint32_t start_vertex = 0U,
+                                    uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0U,
+                             uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void Commit() const;
+
+private:
+    using Impl = Methane::Graphics::Base::RenderCommandSequence;
+
+    Ptr<Impl> m_impl_ptr;
+};
+
+} // namespace Methane::Graphics::Rhi
+
+#ifdef META_PIMPL_INLINE
+
+#include <Methane/Graphics/RHI/RenderCommandSequence.cpp>
+
+#endif // META_PIMPL_INLINE
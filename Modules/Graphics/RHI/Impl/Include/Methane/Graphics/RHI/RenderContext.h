@@ -44,6 +44,7 @@ class Buffer;
 class Texture;
 class Sampler;
 class RenderState;
+class ComputeState;
 class RenderPattern;
 
 struct ShaderSettings;
@@ -52,6 +53,7 @@ struct BufferSettings;
 struct TextureSettings;
 struct SamplerSettings;
 struct RenderStateSettingsImpl;
+struct ComputeStateSettingsImpl;
 struct RenderPatternSettings;
 
 enum class CommandListType;
@@ -95,12 +97,15 @@ public:
     [[nodiscard]] META_PIMPL_API Buffer           CreateBuffer(const BufferSettings& settings) const;
     [[nodiscard]] META_PIMPL_API Texture          CreateTexture(const TextureSettings& settings) const;
     [[nodiscard]] META_PIMPL_API Sampler          CreateSampler(const SamplerSettings& settings) const;
+    [[nodiscard]] META_PIMPL_API ComputeState     CreateComputeState(const ComputeStateSettingsImpl& settings) const;
     [[nodiscard]] META_PIMPL_API RenderState      CreateRenderState(const RenderStateSettingsImpl& settings) const;
     [[nodiscard]] META_PIMPL_API RenderPattern    CreateRenderPattern(const RenderPatternSettings& settings) const;
     [[nodiscard]] META_PIMPL_API OptionMask       GetOptions() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API tf::Executor&    GetParallelExecutor() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API Data::FrameMemoryPool& GetFrameMemoryPool() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API IObjectRegistry& GetObjectRegistry() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void RequestDeferredAction(DeferredAction action) const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API void ExecuteResourceUploads() const;
     META_PIMPL_API void CompleteInitialization() const;
     [[nodiscard]] META_PIMPL_API bool IsCompletingInitialization() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void WaitForGpu(WaitFor wait_for) const;
@@ -112,6 +117,12 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetRenderCommandKit() const;
 
+    template<typename IndexType, typename FuncType>
+    void ParallelFor(IndexType begin_index, IndexType end_index, const FuncType& func, IndexType chunk_size = 1) const
+    {
+        Data::ParallelFor(GetParallelExecutor(), begin_index, end_index, func, chunk_size);
+    }
+
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
     META_PIMPL_API void Disconnect(Data::Receiver<IContextCallback>& receiver) const;
@@ -124,6 +135,7 @@ public:
     [[nodiscard]] META_PIMPL_API const Settings&    GetSettings() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t           GetFrameBufferIndex() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t           GetFrameIndex() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API uint32_t           GetFramesInFlightCount() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const IFpsCounter& GetFpsCounter() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API bool SetVSyncEnabled(bool vsync_enabled) const;
     META_PIMPL_API bool SetFrameBuffersCount(uint32_t frame_buffers_count) const;
@@ -41,7 +41,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(Buffer);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(Buffer);
 
 Buffer::Buffer(const Ptr<IBuffer>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
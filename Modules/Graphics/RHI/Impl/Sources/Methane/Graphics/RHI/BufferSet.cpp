@@ -49,7 +49,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(BufferSet);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(BufferSet);
 
 BufferSet::BufferSet(const Ptr<IBufferSet>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -38,7 +38,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(CommandKit);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(CommandKit);
 
 CommandKit::CommandKit(const Ptr<ICommandKit>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
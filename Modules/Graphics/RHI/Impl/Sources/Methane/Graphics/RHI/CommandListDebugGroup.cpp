@@ -40,7 +40,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(CommandListDebugGroup);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(CommandListDebugGroup);
 
 CommandListDebugGroup::CommandListDebugGroup(const Ptr<ICommandListDebugGroup>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -40,7 +40,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(CommandListSet);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(CommandListSet);
 
 CommandListSet::CommandListSet(const Ptr<ICommandListSet>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -30,6 +30,7 @@ Methane CommandQueue PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/RenderCommandList.h>
 #include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
 #include <Methane/Graphics/RHI/TransferCommandList.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
 
 #include <Methane/Pimpl.hpp>
 
@@ -46,7 +47,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(CommandQueue);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(CommandQueue);
 
 CommandQueue::CommandQueue(const Ptr<ICommandQueue>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -120,6 +121,11 @@ ParallelRenderCommandList CommandQueue::CreateParallelRenderCommandList(const Re
     return ParallelRenderCommandList(GetImpl(m_impl_ptr).CreateParallelRenderCommandList(render_pass.GetInterface()));
 }
 
+ComputeCommandList CommandQueue::CreateComputeCommandList() const
+{
+    return ComputeCommandList(GetImpl(m_impl_ptr).CreateComputeCommandList());
+}
+
 [[nodiscard]] const IContext& CommandQueue::GetContext() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetContext();
@@ -39,7 +39,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(Fence);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(Fence);
 
 Fence::Fence(const Ptr<IFence>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -113,4 +113,14 @@ void Fence::FlushOnGpu(ICommandQueue& wait_on_command_queue) const
     GetImpl(m_impl_ptr).FlushOnGpu(wait_on_command_queue);
 }
 
+uint64_t Fence::GetValue() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetValue();
+}
+
+uint64_t Fence::GetCompletedValue() const
+{
+    return GetImpl(m_impl_ptr).GetCompletedValue();
+}
+
 } // namespace Methane::Graphics::Rhi
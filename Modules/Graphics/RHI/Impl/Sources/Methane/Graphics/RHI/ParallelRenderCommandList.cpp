@@ -45,7 +45,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(ParallelRenderCommandList);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(ParallelRenderCommandList);
 
 ParallelRenderCommandList::ParallelRenderCommandList(const Ptr<IParallelRenderCommandList>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -192,6 +192,7 @@ void ParallelRenderCommandList::SetEndingResourceBarriers(const ResourceBarriers
 void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count) const
 {
     GetImpl(m_impl_ptr).SetParallelCommandListsCount(count);
+    m_parallel_command_lists.clear();
 }
 
 const std::vector<RenderCommandList>& ParallelRenderCommandList::GetParallelCommandLists() const
@@ -60,7 +60,7 @@ ProgramSettings ProgramSettingsImpl::Convert(const IContext& context, const Prog
 META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(Program);
 
 Program::Program(const Ptr<IProgram>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -31,6 +31,7 @@ Methane RenderCommandList PIMPL wrappers for direct calls to final implementatio
 #include <Methane/Graphics/RHI/RenderState.h>
 #include <Methane/Graphics/RHI/ViewState.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/RenderCommandSequence.h>
 
 #include <Methane/Pimpl.hpp>
 
@@ -47,7 +48,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(RenderCommandList);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(RenderCommandList);
 
 RenderCommandList::RenderCommandList(const Ptr<IRenderCommandList>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -220,4 +221,23 @@ void RenderCommandList::Draw(Primitive primitive,
     GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 }
 
+void RenderCommandList::ReplayCommandSequence(const RenderCommandSequence& command_sequence) const
+{
+    GetImpl(m_impl_ptr).ReplayCommandSequence(command_sequence.GetInterface());
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            const Buffer* draw_count_buffer_ptr, Data::Size draw_count_offset) const
+{
+    GetImpl(m_impl_ptr).DrawIndexedIndirect(primitive, arguments_buffer.GetInterface(), arguments_offset, max_draw_count,
+                                            draw_count_buffer_ptr ? &draw_count_buffer_ptr->GetInterface() : nullptr, draw_count_offset);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, const Buffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     const Buffer* draw_count_buffer_ptr, Data::Size draw_count_offset) const
+{
+    GetImpl(m_impl_ptr).DrawIndirect(primitive, arguments_buffer.GetInterface(), arguments_offset, max_draw_count,
+                                     draw_count_buffer_ptr ? &draw_count_buffer_ptr->GetInterface() : nullptr, draw_count_offset);
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -0,0 +1,160 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/RenderCommandSequence.cpp
+Methane RenderCommandSequence PIMPL wrappers for direct calls to final implementation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/RenderCommandSequence.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+
+#include <Methane/Graphics/Base/RenderCommandSequence.h>
+
+#include <Methane/Pimpl.hpp>
+
+namespace Methane::Graphics::Rhi
+{
+
+META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(RenderCommandSequence);
+META_PIMPL_METHODS_COMPARE_IMPLEMENT(RenderCommandSequence);
+
+RenderCommandSequence::RenderCommandSequence(const Ptr<IRenderCommandSequence>& interface_ptr)
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
+{
+}
+
+RenderCommandSequence::RenderCommandSequence(IRenderCommandSequence& interface_ref)
+    : RenderCommandSequence(interface_ref.GetDerivedPtr<IRenderCommandSequence>())
+{
+}
+
+RenderCommandSequence::RenderCommandSequence(const RenderPattern& render_pattern)
+    : RenderCommandSequence(IRenderCommandSequence::Create(render_pattern.GetInterface()))
+{
+}
+
+bool RenderCommandSequence::IsInitialized() const META_PIMPL_NOEXCEPT
+{
+    return static_cast<bool>(m_impl_ptr);
+}
+
+IRenderCommandSequence& RenderCommandSequence::GetInterface() const META_PIMPL_NOEXCEPT
+{
+    return *m_impl_ptr;
+}
+
+Ptr<IRenderCommandSequence> RenderCommandSequence::GetInterfacePtr() const META_PIMPL_NOEXCEPT
+{
+    return m_impl_ptr;
+}
+
+bool RenderCommandSequence::SetName(std::string_view name) const
+{
+    return GetImpl(m_impl_ptr).SetName(name);
+}
+
+std::string_view RenderCommandSequence::GetName() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetName();
+}
+
+void RenderCommandSequence::Connect(Data::Receiver<IObjectCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IObjectCallback>::Connect(receiver);
+}
+
+void RenderCommandSequence::Disconnect(Data::Receiver<IObjectCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IObjectCallback>::Disconnect(receiver);
+}
+
+void RenderCommandSequence::Connect(Data::Receiver<IRenderCommandSequenceCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IRenderCommandSequenceCallback>::Connect(receiver);
+}
+
+void RenderCommandSequence::Disconnect(Data::Receiver<IRenderCommandSequenceCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IRenderCommandSequenceCallback>::Disconnect(receiver);
+}
+
+RenderPattern RenderCommandSequence::GetRenderPattern() const
+{
+    return RenderPattern(GetImpl(m_impl_ptr).GetRenderPattern());
+}
+
+RenderCommandSequence::State RenderCommandSequence::GetState() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetState();
+}
+
+Data::Size RenderCommandSequence::GetCommandsCount() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetCommandsCount();
+}
+
+void RenderCommandSequence::Reset() const
+{
+    GetImpl(m_impl_ptr).Reset();
+}
+
+void RenderCommandSequence::SetRenderState(const RenderState& render_state, RenderStateGroupMask state_groups) const
+{
+    GetImpl(m_impl_ptr).SetRenderState(render_state.GetInterface(), state_groups);
+}
+
+void RenderCommandSequence::SetProgramBindings(const ProgramBindings& program_bindings, ProgramBindingsApplyBehaviorMask apply_behavior) const
+{
+    GetImpl(m_impl_ptr).SetProgramBindings(program_bindings.GetInterface(), apply_behavior);
+}
+
+void RenderCommandSequence::SetVertexBuffers(const BufferSet& vertex_buffers, bool set_resource_barriers) const
+{
+    GetImpl(m_impl_ptr).SetVertexBuffers(vertex_buffers.GetInterface(), set_resource_barriers);
+}
+
+void RenderCommandSequence::SetIndexBuffer(const Buffer& index_buffer, bool set_resource_barriers) const
+{
+    GetImpl(m_impl_ptr).SetIndexBuffer(index_buffer.GetInterface(), set_resource_barriers);
+}
+
+void RenderCommandSequence::DrawIndexed(Primitive primitive, uint32_t index_count,
+                                      uint32_t start_index, uint32_t start_vertex,
+                                      uint32_t instance_count, uint32_t start_instance) const
+{
+    GetImpl(m_impl_ptr).DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+}
+
+void RenderCommandSequence::Draw(Primitive primitive,
+                               uint32_t vertex_count, uint32_t start_vertex,
+                               uint32_t instance_count, uint32_t start_instance) const
+{
+    GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+}
+
+void RenderCommandSequence::Commit() const
+{
+    GetImpl(m_impl_ptr).Commit();
+}
+
+} // namespace Methane::Graphics::Rhi
@@ -31,6 +31,7 @@ Methane RenderContext PIMPL wrappers for direct calls to final implementation.
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ComputeState.h>
 #include <Methane/Graphics/RHI/RenderPattern.h>
 
 #include <Methane/Pimpl.hpp>
@@ -48,7 +49,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(RenderContext);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(RenderContext);
 
 RenderContext::RenderContext(const Ptr<IRenderContext>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -132,6 +133,11 @@ Sampler RenderContext::CreateSampler(const SamplerSettings& settings) const
     return Sampler(GetImpl(m_impl_ptr).CreateSampler(settings));
 }
 
+ComputeState RenderContext::CreateComputeState(const ComputeStateSettingsImpl& settings) const
+{
+    return ComputeState(GetImpl(m_impl_ptr).CreateComputeState(ComputeStateSettingsImpl::Convert(settings)));
+}
+
 RenderState RenderContext::CreateRenderState(const RenderStateSettingsImpl& settings) const
 {
     return RenderState(GetImpl(m_impl_ptr).CreateRenderState(RenderStateSettingsImpl::Convert(settings)));
@@ -152,6 +158,11 @@ tf::Executor& RenderContext::GetParallelExecutor() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetParallelExecutor();
 }
 
+Data::FrameMemoryPool& RenderContext::GetFrameMemoryPool() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetFrameMemoryPool();
+}
+
 IObjectRegistry& RenderContext::GetObjectRegistry() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetObjectRegistry();
@@ -162,6 +173,11 @@ void RenderContext::RequestDeferredAction(DeferredAction action) const META_PIMP
     GetImpl(m_impl_ptr).RequestDeferredAction(action);
 }
 
+void RenderContext::ExecuteResourceUploads() const
+{
+    GetImpl(m_impl_ptr).ExecuteResourceUploads();
+}
+
 void RenderContext::CompleteInitialization() const
 {
     GetImpl(m_impl_ptr).CompleteInitialization();
@@ -257,6 +273,11 @@ uint32_t RenderContext::GetFrameIndex() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetFrameIndex();
 }
 
+uint32_t RenderContext::GetFramesInFlightCount() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetFramesInFlightCount();
+}
+
 const IFpsCounter& RenderContext::GetFpsCounter() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetFpsCounter();
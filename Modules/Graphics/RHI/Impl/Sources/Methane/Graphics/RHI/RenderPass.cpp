@@ -40,7 +40,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(RenderPass);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(RenderPass);
 
 RenderPass::RenderPass(const Ptr<IRenderPass>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
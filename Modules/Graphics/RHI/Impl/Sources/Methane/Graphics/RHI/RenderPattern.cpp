@@ -40,7 +40,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(RenderPattern);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(RenderPattern);
 
 RenderPattern::RenderPattern(const Ptr<IRenderPattern>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -53,7 +53,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(RenderState);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(RenderState);
 
 RenderState::RenderState(const Ptr<IRenderState>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -40,7 +40,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(Sampler);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(Sampler);
 
 Sampler::Sampler(const Ptr<ISampler>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -51,7 +51,7 @@ System& System::Get()
 }
 
 System::System(const Ptr<ISystem>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
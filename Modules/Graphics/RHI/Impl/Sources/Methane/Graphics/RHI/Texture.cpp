@@ -41,7 +41,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(Texture);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(Texture);
 
 Texture::Texture(const Ptr<ITexture>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
@@ -39,7 +39,7 @@ META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(ViewState);
 META_PIMPL_METHODS_COMPARE_IMPLEMENT(ViewState);
 
 ViewState::ViewState(const Ptr<IViewState>& interface_ptr)
-    : m_impl_ptr(std::dynamic_pointer_cast<Impl>(interface_ptr))
+    : m_impl_ptr(GetImplPtr<Impl>(interface_ptr))
 {
 }
 
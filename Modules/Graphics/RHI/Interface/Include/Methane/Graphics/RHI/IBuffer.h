@@ -36,7 +36,8 @@ enum class BufferType
     Storage,
     Index,
     Vertex,
-    ReadBack
+    ReadBack,
+    Indirect
 };
 
 enum class BufferStorageMode
@@ -54,13 +55,20 @@ struct BufferSettings
     PixelFormat       data_format;
     BufferStorageMode storage_mode = BufferStorageMode::Managed;
 
+    // Opt-in for small private addressable constant buffers of render context, which are updated every frame:
+    // CPU writes data directly to persistently mapped GPU memory without staging copy, when supported by RHI (Vulkan).
+    // Buffer memory is split into regions for each frame in flight, which are selected with dynamic offsets of addressable bindings
+    bool              is_direct_cpu_write = false;
+
     static constexpr Data::Size s_data_alignment = 256U;
 
     [[nodiscard]] static Data::Size     GetAlignedSize(Data::Size size) noexcept;
     [[nodiscard]] static BufferSettings ForVertexBuffer(Data::Size size, Data::Size stride, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForIndexBuffer(Data::Size size, PixelFormat format, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForConstantBuffer(Data::Size size, bool addressable = false, bool is_volatile = false);
+    [[nodiscard]] static BufferSettings ForStorageBuffer(Data::Size size, Data::Size stride, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForReadBackBuffer(Data::Size size);
+    [[nodiscard]] static BufferSettings ForIndirectBuffer(Data::Size size, bool is_volatile = false);
 };
 
 struct IBuffer
@@ -44,8 +44,8 @@ using CommandListId = uint32_t;
 enum class CommandListPurpose : CommandListId // NOSONAR - multiple values initialized
 {
     Default        = 0U,
-    PreUploadSync  = std::numeric_limits<CommandListId>::max() - 2,
-    PostUploadSync
+    PreUploadSync  = std::numeric_limits<CommandListId>::max() - 4,
+    PostUploadSync // followed by post-upload sync command lists of the rotating asynchronous upload batches
 };
 
 struct ICommandKit
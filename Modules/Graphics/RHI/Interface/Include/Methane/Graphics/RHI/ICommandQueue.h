@@ -39,6 +39,7 @@ struct IRenderPass;
 struct ITransferCommandList;
 struct IRenderCommandList;
 struct IParallelRenderCommandList;
+struct IComputeCommandList;
 struct ITimestampQueryPool;
 
 struct ICommandQueue
@@ -53,6 +54,7 @@ struct ICommandQueue
     [[nodiscard]] virtual Ptr<ITransferCommandList>       CreateTransferCommandList() = 0;
     [[nodiscard]] virtual Ptr<IRenderCommandList>         CreateRenderCommandList(IRenderPass& render_pass) = 0;
     [[nodiscard]] virtual Ptr<IParallelRenderCommandList> CreateParallelRenderCommandList(IRenderPass& render_pass) = 0;
+    [[nodiscard]] virtual Ptr<IComputeCommandList>        CreateComputeCommandList() = 0;
     [[nodiscard]] virtual Ptr<ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t max_timestamps_per_frame) = 0;
     [[nodiscard]] virtual const IContext&                 GetContext() const noexcept = 0;
     [[nodiscard]] virtual CommandListType                 GetCommandListType() const noexcept = 0;
@@ -0,0 +1,60 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/IComputeCommandList.h
+Methane compute command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ICommandList.h"
+#include "IComputeState.h"
+
+#include <Methane/Memory.hpp>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IBuffer;
+
+// Layout of indirect dispatch arguments matches D3D12_DISPATCH_ARGUMENTS, VkDispatchIndirectCommand and MTLDispatchThreadgroupsIndirectArguments
+struct DispatchIndirectArguments
+{
+    uint32_t thread_groups_count_x = 0U;
+    uint32_t thread_groups_count_y = 0U;
+    uint32_t thread_groups_count_z = 0U;
+};
+
+struct IComputeCommandList
+    : virtual ICommandList // NOSONAR
+{
+    static constexpr Type type = Type::Compute;
+
+    // Create IComputeCommandList instance
+    [[nodiscard]] static Ptr<IComputeCommandList> Create(ICommandQueue& command_queue);
+
+    // IComputeCommandList interface
+    virtual void ResetWithState(IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) = 0;
+    virtual void ResetWithStateOnce(IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) = 0;
+    virtual void SetComputeState(IComputeState& compute_state) = 0;
+    virtual void Dispatch(const ThreadGroupsCount& thread_groups_count) = 0;
+    virtual void DispatchIndirect(IBuffer& arguments_buffer, Data::Size arguments_offset = 0U) = 0;
+};
+
+} // namespace Methane::Graphics::Rhi
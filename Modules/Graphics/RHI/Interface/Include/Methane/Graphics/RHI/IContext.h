@@ -29,6 +29,7 @@ Methane base context interface: wraps graphics device used for GPU interaction.
 #include <Methane/Graphics/Types.h>
 #include <Methane/Data/IEmitter.h>
 #include <Methane/Data/EnumMask.hpp>
+#include <Methane/Data/ParallelFor.hpp>
 
 #include <stdexcept>
 
@@ -38,6 +39,11 @@ namespace tf // NOSONAR
 class Executor;
 }
 
+namespace Methane::Data
+{
+class FrameMemoryPool;
+}
+
 namespace Methane::Graphics::Rhi
 {
 
@@ -63,7 +69,8 @@ enum class ContextDeferredAction : uint32_t
 enum class ContextOption : uint32_t
 {
     TransferWithD3D12DirectQueue, // Transfer command lists and queues in DX API are created with DIRECT type instead of COPY type
-    EmulateD3D12RenderPass        // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    EmulateD3D12RenderPass,       // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    AsyncResourceUploads          // Uploads are not awaited by other queues until uploaded resources are used by executed command lists
 };
 
 using ContextOptionMask = Data::EnumMask<ContextOption>;
@@ -94,12 +101,14 @@ struct IProgram;
 struct IBuffer;
 struct ITexture;
 struct ISampler;
+struct IComputeState;
 
 struct ShaderSettings;
 struct ProgramSettings;
 struct BufferSettings;
 struct TextureSettings;
 struct SamplerSettings;
+struct ComputeStateSettings;
 
 enum class CommandListType;
 enum class ShaderType : uint32_t;
@@ -123,12 +132,15 @@ struct IContext
     [[nodiscard]] virtual Ptr<IBuffer>       CreateBuffer(const BufferSettings& settings) const = 0;
     [[nodiscard]] virtual Ptr<ITexture>      CreateTexture(const TextureSettings& settings) const = 0;
     [[nodiscard]] virtual Ptr<ISampler>      CreateSampler(const SamplerSettings& settings) const = 0;
+    [[nodiscard]] virtual Ptr<IComputeState> CreateComputeState(const ComputeStateSettings& settings) const = 0;
     [[nodiscard]] virtual Type               GetType() const noexcept = 0;
     [[nodiscard]] virtual OptionMask         GetOptions() const noexcept = 0;
     [[nodiscard]] virtual tf::Executor&      GetParallelExecutor() const noexcept = 0;
+    [[nodiscard]] virtual Data::FrameMemoryPool& GetFrameMemoryPool() const noexcept = 0;
     [[nodiscard]] virtual IObjectRegistry&   GetObjectRegistry() noexcept = 0;
     [[nodiscard]] virtual const IObjectRegistry& GetObjectRegistry() const noexcept = 0;
     virtual void RequestDeferredAction(DeferredAction action) const noexcept = 0;
+    virtual void ExecuteResourceUploads() const = 0; // execute encoded uploads in upload command queue right away, without waiting for completion
     virtual void CompleteInitialization() = 0;
     [[nodiscard]] virtual bool IsCompletingInitialization() const noexcept = 0;
     virtual void WaitForGpu(WaitFor wait_for) = 0;
@@ -139,6 +151,13 @@ struct IContext
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(ICommandQueue& cmd_queue) const = 0;
 
     [[nodiscard]] ICommandKit& GetUploadCommandKit() const;
+
+    // Parallel loop on context executor without task graph construction, requires <taskflow/taskflow.hpp> at call site
+    template<typename IndexType, typename FuncType>
+    void ParallelFor(IndexType begin_index, IndexType end_index, const FuncType& func, IndexType chunk_size = 1) const
+    {
+        Data::ParallelFor(GetParallelExecutor(), begin_index, end_index, func, chunk_size);
+    }
 };
 
 } // namespace Methane::Graphics::Rhi
@@ -59,10 +59,12 @@ struct DeviceCaps
     DeviceFeatureMask features              { ~0U };
     uint32_t          render_queues_count   { 1U };
     uint32_t          transfer_queues_count { 1U };
+    uint32_t          compute_queues_count  { 0U }; // when zero, compute queues share the render queue family
 
     DeviceCaps& SetFeatures(DeviceFeatureMask new_features) noexcept;
     DeviceCaps& SetRenderQueuesCount(uint32_t new_render_queues_count) noexcept;
     DeviceCaps& SetTransferQueuesCount(uint32_t new_transfer_queues_count) noexcept;
+    DeviceCaps& SetComputeQueuesCount(uint32_t new_compute_queues_count) noexcept;
 };
 
 struct IDevice;
@@ -43,6 +43,8 @@ struct IFence
     virtual void WaitOnGpu(ICommandQueue& wait_on_command_queue) = 0;
     virtual void FlushOnCpu() = 0;
     virtual void FlushOnGpu(ICommandQueue& wait_on_command_queue) = 0;
+    [[nodiscard]] virtual uint64_t GetValue() const noexcept = 0;
+    [[nodiscard]] virtual uint64_t GetCompletedValue() const = 0; // last fence value reached by GPU
 };
 
 } // namespace Methane::Graphics::Rhi
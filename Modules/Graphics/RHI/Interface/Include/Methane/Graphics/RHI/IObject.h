@@ -27,13 +27,81 @@ Methane object interface: represents any named object.
 #include <Methane/Data/IEmitter.h>
 
 #include <string>
+#include <string_view>
 #include <stdexcept>
+#include <cstdint>
 
 namespace Methane::Graphics::Rhi
 {
 
 struct IObject;
 
+// Interned object name identifier: 64-bit FNV-1a hash of the name, computed at compile time for string literals
+using ObjectNameId = uint64_t;
+
+[[nodiscard]] constexpr ObjectNameId GetObjectNameId(std::string_view name) noexcept
+{
+    ObjectNameId name_id = 14695981039346656037ULL;
+    for(const char name_char : name)
+    {
+        name_id ^= static_cast<uint8_t>(name_char);
+        name_id *= 1099511628211ULL;
+    }
+    return name_id;
+}
+
+// Object name with its identifier used for registry lookup, names are compared on identifier match to resolve hash collisions
+struct ObjectName
+{
+    ObjectNameId     id;
+    std::string_view name;
+
+    constexpr explicit ObjectName(std::string_view object_name) noexcept
+        : id(GetObjectNameId(object_name))
+        , name(object_name)
+    { }
+
+    constexpr ObjectName(ObjectNameId object_name_id, std::string_view object_name) noexcept
+        : id(object_name_id)
+        , name(object_name)
+    { }
+};
+
+namespace ObjectNameLiterals
+{
+
+[[nodiscard]] constexpr ObjectNameId operator""_name_id(const char* name, size_t name_length) noexcept
+{
+    return GetObjectNameId(std::string_view(name, name_length));
+}
+
+[[nodiscard]] constexpr ObjectName operator""_name(const char* name, size_t name_length) noexcept
+{
+    return ObjectName(std::string_view(name, name_length));
+}
+
+} // namespace ObjectNameLiterals
+
+// Unique identifier of the object interface type, which does not require RTTI
+class ObjectTypeId
+{
+public:
+    template<typename T>
+    [[nodiscard]] static ObjectTypeId Get() noexcept { return ObjectTypeId(&s_type_tag<T>); }
+
+    [[nodiscard]] friend bool operator==(const ObjectTypeId& left, const ObjectTypeId& right) noexcept { return left.m_tag_ptr == right.m_tag_ptr; }
+    [[nodiscard]] friend bool operator!=(const ObjectTypeId& left, const ObjectTypeId& right) noexcept { return left.m_tag_ptr != right.m_tag_ptr; }
+
+private:
+    explicit ObjectTypeId(const void* tag_ptr) noexcept : m_tag_ptr(tag_ptr) { }
+
+    // Non-constant tag variable has unique address per type, which can not be folded by linker
+    template<typename T>
+    static inline char s_type_tag = 0;
+
+    const void* m_tag_ptr;
+};
+
 class NameConflictException : public std::invalid_argument
 {
 public:
@@ -44,12 +112,32 @@ struct IObjectRegistry
 {
     using NameConflictException = Rhi::NameConflictException;
 
-    virtual void AddGraphicsObject(IObject& object) = 0;
+    // Object is registered with the type of its interface reference, which is used later for typed lookup without RTTI casts
+    template<typename T>
+    std::enable_if_t<std::is_base_of_v<IObject, T>> AddGraphicsObject(T& object)
+    { AddGraphicsObject(object, ObjectTypeId::Get<T>(), Ptr<void>(object.GetPtr(), std::addressof(object))); }
+
+    // Returns empty pointer when object is not found or was registered with different interface type
+    template<typename T>
+    [[nodiscard]] std::enable_if_t<std::is_base_of_v<IObject, T>, Ptr<T>> GetGraphicsObject(const ObjectName& object_name) const noexcept
+    { return std::static_pointer_cast<T>(GetTypedGraphicsObject(object_name, ObjectTypeId::Get<T>())); }
+
+    template<typename T>
+    [[nodiscard]] std::enable_if_t<std::is_base_of_v<IObject, T>, Ptr<T>> GetGraphicsObject(std::string_view object_name) const noexcept
+    { return GetGraphicsObject<T>(ObjectName(object_name)); }
+
+    [[nodiscard]] Ptr<IObject> GetGraphicsObject(std::string_view object_name) const noexcept { return GetGraphicsObject(ObjectName(object_name)); }
+    [[nodiscard]] bool         HasGraphicsObject(std::string_view object_name) const noexcept { return HasGraphicsObject(ObjectName(object_name)); }
+
     virtual void RemoveGraphicsObject(IObject& object) = 0;
-    [[nodiscard]] virtual Ptr<IObject> GetGraphicsObject(const std::string& object_name) const noexcept = 0;
-    [[nodiscard]] virtual bool         HasGraphicsObject(const std::string& object_name) const noexcept = 0;
+    [[nodiscard]] virtual Ptr<IObject> GetGraphicsObject(const ObjectName& object_name) const noexcept = 0;
+    [[nodiscard]] virtual bool         HasGraphicsObject(const ObjectName& object_name) const noexcept = 0;
 
     virtual ~IObjectRegistry() = default;
+
+protected:
+    virtual void AddGraphicsObject(IObject& object, ObjectTypeId object_type_id, const Ptr<void>& typed_object_ptr) = 0;
+    [[nodiscard]] virtual Ptr<void> GetTypedGraphicsObject(const ObjectName& object_name, ObjectTypeId object_type_id) const noexcept = 0;
 };
 
 struct IObjectCallback
@@ -67,6 +155,7 @@ struct IObject
 
     virtual bool SetName(std::string_view name) = 0;
     [[nodiscard]] virtual std::string_view GetName() const noexcept = 0;
+    [[nodiscard]] virtual ObjectNameId     GetNameId() const noexcept = 0;
     [[nodiscard]] virtual Ptr<IObject>     GetPtr() = 0;
 
     template<typename T>
@@ -55,6 +55,10 @@ struct ProgramInputBufferLayout
     ArgumentSemantics argument_semantics;
     StepType          step_type = StepType::PerVertex;
     uint32_t          step_rate = 1U;
+
+    // Optional formats of arguments ordered as semantics are required for packed vertex attributes,
+    // formats of other arguments are Unknown and deduced from shader input types
+    PixelFormats      argument_formats;
 };
 
 using ProgramInputBufferLayouts = std::vector<ProgramInputBufferLayout>;
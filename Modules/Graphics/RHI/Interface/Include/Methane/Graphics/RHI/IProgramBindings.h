@@ -53,11 +53,20 @@ public:
     explicit ProgramArgumentConstantModificationException(const IProgram::Argument& argument);
 };
 
+// Shader access to the bound resources is defined by shader reflection:
+// storage buffers and textures are writable in shaders and require resources with ShaderWrite usage
+enum class ProgramArgumentShaderAccess : uint32_t
+{
+    ReadOnly,
+    ReadWrite
+};
+
 struct ProgramArgumentBindingSettings
 {
     Rhi::ProgramArgumentAccessor argument;
-    IResource::Type         resource_type;
-    uint32_t                resource_count = 1;
+    IResource::Type              resource_type;
+    uint32_t                     resource_count = 1;
+    ProgramArgumentShaderAccess  shader_access  = ProgramArgumentShaderAccess::ReadOnly;
 };
 
 struct IProgramArgumentBinding
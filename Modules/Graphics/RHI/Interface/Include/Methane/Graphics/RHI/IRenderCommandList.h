@@ -36,6 +36,7 @@ struct IParallelRenderCommandList;
 struct IBuffer;
 struct IBufferSet;
 struct IViewState;
+struct IRenderCommandSequence;
 
 enum class RenderPrimitive
 {
@@ -46,6 +47,25 @@ enum class RenderPrimitive
     TriangleStrip
 };
 
+// Layout of indirect draw arguments matches D3D12_DRAW_ARGUMENTS, VkDrawIndirectCommand and MTLDrawPrimitivesIndirectArguments
+struct DrawIndirectArguments
+{
+    uint32_t vertex_count   = 0U;
+    uint32_t instance_count = 0U;
+    uint32_t start_vertex   = 0U;
+    uint32_t start_instance = 0U;
+};
+
+// Layout of indexed indirect draw arguments matches D3D12_DRAW_INDEXED_ARGUMENTS, VkDrawIndexedIndirectCommand and MTLDrawIndexedPrimitivesIndirectArguments
+struct DrawIndexedIndirectArguments
+{
+    uint32_t index_count    = 0U;
+    uint32_t instance_count = 0U;
+    uint32_t start_index    = 0U;
+    int32_t  base_vertex    = 0;
+    uint32_t start_instance = 0U;
+};
+
 struct IRenderCommandList
     : virtual ICommandList // NOSONAR
 {
@@ -70,6 +90,17 @@ struct IRenderCommandList
                              uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
     virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
                       uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+
+    // Render and view states are kept after sequence replay, while vertex and index buffers and program bindings
+    // have to be set again before next draws, because native command bundles leave them undefined in command list
+    virtual void ReplayCommandSequence(IRenderCommandSequence& command_sequence) = 0;
+
+    // Draws up to max_draw_count argument structures placed one after another in the indirect arguments buffer,
+    // actual draws count is read from 32-bit value in the indirect draw count buffer when it is provided
+    virtual void DrawIndexedIndirect(Primitive primitive, IBuffer& arguments_buffer, Data::Size arguments_offset = 0U, uint32_t max_draw_count = 1U,
+                                     IBuffer* draw_count_buffer_ptr = nullptr, Data::Size draw_count_offset = 0U) = 0;
+    virtual void DrawIndirect(Primitive primitive, IBuffer& arguments_buffer, Data::Size arguments_offset = 0U, uint32_t max_draw_count = 1U,
+                              IBuffer* draw_count_buffer_ptr = nullptr, Data::Size draw_count_offset = 0U) = 0;
     
     using ICommandList::Reset;
 };
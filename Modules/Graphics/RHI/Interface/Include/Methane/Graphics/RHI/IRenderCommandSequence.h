@@ -0,0 +1,84 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/IRenderCommandSequence.h
+Methane render command sequence interface: render commands recorded once on CPU side
+and replayed to render command lists inside of render pass in many frames.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IObject.h"
+#include "IRenderCommandList.h"
+
+#include <Methane/Memory.hpp>
+#include <Methane/Data/IEmitter.h>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IRenderPattern;
+struct IRenderCommandSequence;
+
+enum class RenderCommandSequenceState
+{
+    Empty,
+    Recording,
+    Recorded,
+    Invalidated
+};
+
+struct IRenderCommandSequenceCallback
+{
+    virtual void OnRenderCommandSequenceInvalidated(IRenderCommandSequence& command_sequence) = 0;
+
+    virtual ~IRenderCommandSequenceCallback() = default;
+};
+
+struct IRenderCommandSequence
+    : virtual IObject // NOSONAR
+    , virtual Data::IEmitter<IRenderCommandSequenceCallback> // NOSONAR
+{
+    using State     = RenderCommandSequenceState;
+    using Primitive = RenderPrimitive;
+    using ICallback = IRenderCommandSequenceCallback;
+
+    // Create IRenderCommandSequence instance, which can be executed in render passes of the given pattern
+    [[nodiscard]] static Ptr<IRenderCommandSequence> Create(IRenderPattern& render_pattern);
+
+    // IRenderCommandSequence interface
+    [[nodiscard]] virtual IRenderPattern& GetRenderPattern() const noexcept = 0;
+    [[nodiscard]] virtual State GetState() const noexcept = 0;
+    [[nodiscard]] virtual Data::Size GetCommandsCount() const noexcept = 0;
+
+    // Recording clears previous commands, sequence is invalidated when argument bindings of recorded program bindings change
+    virtual void Reset() = 0;
+    virtual void SetRenderState(IRenderState& render_state, RenderStateGroupMask state_groups = RenderStateGroupMask(~0U)) = 0;
+    virtual void SetProgramBindings(IProgramBindings& program_bindings,
+                                    ProgramBindingsApplyBehaviorMask apply_behavior = ProgramBindingsApplyBehaviorMask(~0U)) = 0;
+    virtual void SetVertexBuffers(IBufferSet& vertex_buffers, bool set_resource_barriers = true) = 0;
+    virtual void SetIndexBuffer(IBuffer& index_buffer, bool set_resource_barriers = true) = 0;
+    virtual void DrawIndexed(Primitive primitive, uint32_t index_count = 0, uint32_t start_index = 0, uint32_t start_vertex = 0,
+                             uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+    virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
+                      uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+    virtual void Commit() = 0;
+};
+
+} // namespace Methane::Graphics::Rhi
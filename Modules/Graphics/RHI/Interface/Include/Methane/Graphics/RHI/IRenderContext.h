@@ -47,6 +47,7 @@ struct RenderContextSettings
     Opt<Color4F>            clear_color;
     Opt<DepthStencilValues> clear_depth_stencil;
     uint32_t                frame_buffers_count  = 3U;
+    uint32_t                frames_in_flight_count = 0U; // limited by frame buffers count, which is used when zero
     bool                    vsync_enabled        = true;
     bool                    is_full_screen       = false;
     ContextOptionMask       options_mask;
@@ -58,6 +59,7 @@ struct RenderContextSettings
     RenderContextSettings& SetClearColor(Opt<Color4F>&& new_clear_color) noexcept;
     RenderContextSettings& SetClearDepthStencil(Opt<DepthStencilValues>&& new_clear_ds) noexcept;
     RenderContextSettings& SetFrameBuffersCount(uint32_t new_fb_count) noexcept;
+    RenderContextSettings& SetFramesInFlightCount(uint32_t new_frames_in_flight_count) noexcept;
     RenderContextSettings& SetVSyncEnabled(bool new_vsync_enabled) noexcept;
     RenderContextSettings& SetFullscreen(bool new_full_screen) noexcept;
     RenderContextSettings& SetOptionMask(ContextOptionMask new_options_mask) noexcept;
@@ -89,6 +91,7 @@ struct IRenderContext
     [[nodiscard]] virtual const Settings&    GetSettings() const noexcept = 0;
     [[nodiscard]] virtual uint32_t           GetFrameBufferIndex() const noexcept = 0;
     [[nodiscard]] virtual uint32_t           GetFrameIndex() const noexcept = 0;
+    [[nodiscard]] virtual uint32_t           GetFramesInFlightCount() const noexcept = 0;
     [[nodiscard]] virtual const IFpsCounter& GetFpsCounter() const noexcept = 0;
 
     virtual bool SetVSyncEnabled(bool vsync_enabled) = 0;
@@ -94,6 +94,7 @@ struct TextureSettings
 };
 
 struct IRenderContext;
+struct IBuffer;
 
 struct ITexture
     : virtual IResource // NOSONAR
@@ -108,8 +109,17 @@ struct ITexture
     // Create ITexture instance
     [[nodiscard]] static Ptr<ITexture> Create(const IContext& context, const Settings& settings);
 
+    // Data of each sub-resource is placed in staging buffer with this alignment, required by DirectX texture data placement
+    static constexpr Data::Size s_staging_data_alignment = 512U;
+
     // ITexture interface
     [[nodiscard]] virtual const Settings& GetSettings() const = 0;
+    [[nodiscard]] virtual Data::Size      GetStagingDataSize(const SubResources& sub_resources) const = 0;
+
+    // Sub-resources data is written to the region of shared staging buffer with managed storage, instead of texture own staging memory,
+    // and copied to texture with upload command list; staging region must not be reused until GPU completes the upload
+    virtual void SetDataThroughStaging(const SubResources& sub_resources, ICommandQueue& target_cmd_queue,
+                                       IBuffer& staging_buffer, Data::Size staging_offset) = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
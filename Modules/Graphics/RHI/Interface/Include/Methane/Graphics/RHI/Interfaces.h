@@ -32,6 +32,7 @@ Methane graphics RHI interfaces: all headers under one umbrella.
 #include "IRenderPattern.h"
 #include "IRenderPass.h"
 #include "IRenderState.h"
+#include "IComputeState.h"
 #include "IViewState.h"
 #include "IResource.h"
 #include "IBuffer.h"
@@ -45,4 +46,6 @@ Methane graphics RHI interfaces: all headers under one umbrella.
 #include "ICommandQueue.h"
 #include "ITransferCommandList.h"
 #include "IRenderCommandList.h"
+#include "IRenderCommandSequence.h"
 #include "IParallelRenderCommandList.h"
+#include "IComputeCommandList.h"
@@ -0,0 +1,122 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/TextureUploader.h
+Methane texture uploader streams texture data to GPU in slices of block rows,
+limited by per-frame upload budget and copied through the shared staging memory ring,
+which regions are released when upload command queue fence is reached by GPU.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IResource.h"
+
+#include <Methane/Data/RingBufferAllocator.hpp>
+#include <Methane/Memory.hpp>
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct ITexture;
+struct IBuffer;
+struct IFence;
+struct ICommandQueue;
+
+class TextureUploader
+{
+public:
+    struct Settings
+    {
+        Data::Size staging_ring_size   = 64U * 1024U * 1024U; // size of staging buffer shared by uploads of all textures in flight
+        Data::Size frame_upload_budget = 8U * 1024U * 1024U;  // maximum size of data uploaded in one frame
+    };
+
+    struct FrameStatistics
+    {
+        Data::Size uploaded_data_size = 0U;
+        uint32_t   slices_count       = 0U;
+        uint32_t   textures_count     = 0U;
+    };
+
+    using CompletionCallback = std::function<void(ITexture&)>;
+
+    TextureUploader(ICommandQueue& target_cmd_queue, const Settings& settings);
+    ~TextureUploader();
+
+    TextureUploader(const TextureUploader&) = delete;
+    TextureUploader(TextureUploader&&) = delete;
+
+    TextureUploader& operator=(const TextureUploader&) = delete;
+    TextureUploader& operator=(TextureUploader&&) = delete;
+
+    // Sub-resources data must be kept alive until texture upload completion; mipmapped textures require data of all MIP levels
+    void Enqueue(ITexture& texture, IResource::SubResources&& sub_resources, const CompletionCallback& completion_callback = {});
+
+    // Called once per frame before command queue execution to upload next slices of the enqueued textures
+    // in upload command queue and to call completion callbacks of the textures uploaded by GPU
+    void UploadFrame();
+
+    [[nodiscard]] const Settings&        GetSettings() const noexcept              { return m_settings; }
+    [[nodiscard]] bool                   IsIdle() const noexcept                   { return m_pending_textures.empty() && m_frame_uploads.empty(); }
+    [[nodiscard]] size_t                 GetPendingTexturesCount() const noexcept  { return m_pending_textures.size(); }
+    [[nodiscard]] Data::Size             GetInFlightStagingSize() const noexcept   { return m_staging_ring.GetUsedSize(); }
+    [[nodiscard]] const IBuffer&         GetStagingBuffer() const noexcept         { return *m_staging_buffer_ptr; }
+    [[nodiscard]] const FrameStatistics& GetLastFrameStatistics() const noexcept   { return m_last_frame_statistics; }
+
+private:
+    struct PendingTexture
+    {
+        Ptr<ITexture>           texture_ptr;
+        IResource::SubResources sub_resources;
+        CompletionCallback      completion_callback;
+        size_t                  sub_resource_index  = 0U;
+        Data::Size              sub_resource_offset = 0U;
+    };
+
+    struct CompletedTexture
+    {
+        Ptr<ITexture>      texture_ptr;
+        CompletionCallback completion_callback;
+    };
+
+    struct FrameUpload
+    {
+        uint64_t                      fence_value           = 0U;
+        uint32_t                      staging_regions_count = 0U;
+        std::vector<CompletedTexture> completed_textures;
+    };
+
+    void ReleaseCompletedFrameUploads();
+    Data::Size UploadTextureSlices(PendingTexture& pending_texture, Data::Size budget_size, bool force_progress, FrameUpload& frame_upload);
+
+    ICommandQueue&                        m_target_cmd_queue;
+    Settings                              m_settings;
+    Ptr<IBuffer>                          m_staging_buffer_ptr;
+    Data::RingBufferAllocator<Data::Size> m_staging_ring;
+    Ptr<IFence>                           m_upload_fence_ptr;
+    std::deque<PendingTexture>            m_pending_textures;
+    std::deque<FrameUpload>               m_frame_uploads;
+    FrameStatistics                       m_last_frame_statistics;
+};
+
+} // namespace Methane::Graphics::Rhi
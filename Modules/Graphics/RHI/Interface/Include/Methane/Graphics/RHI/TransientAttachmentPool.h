@@ -0,0 +1,80 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/TransientAttachmentPool.h
+Methane pool of transient render pass attachments, aliasing textures of attachments
+with disjoint lifetimes between render passes of the frame.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ITexture.h"
+
+#include <Methane/Memory.hpp>
+
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IContext;
+
+class TransientAttachmentPool
+{
+public:
+    struct Request
+    {
+        TextureSettings settings;
+        uint32_t        first_pass_index = 0U; // index of the first render pass of the frame using attachment
+        uint32_t        last_pass_index  = 0U; // index of the last render pass of the frame using attachment
+    };
+
+    using Requests = std::vector<Request>;
+
+    // Attachments are placed in blocks, where each block is a texture shared by attachments
+    // with equal format, dimensions and usage, which are not used in the same render passes
+    struct Placement
+    {
+        std::vector<uint32_t>        block_index_by_request;
+        std::vector<TextureSettings> block_settings;
+        Data::Size                   requested_memory_size = 0U;
+        Data::Size                   placed_memory_size    = 0U;
+    };
+
+    [[nodiscard]] static Placement Place(const Requests& requests);
+    [[nodiscard]] static bool      IsAliasingCompatible(const TextureSettings& left, const TextureSettings& right) noexcept;
+
+    explicit TransientAttachmentPool(const IContext& context);
+
+    // Returns textures of requested attachments for the given frame, textures of the previous request
+    // of the same frame are reused by compatible blocks without any GPU synchronization:
+    // caller must guarantee that GPU has completed execution of all command lists using them,
+    // which is the case for frame buffer index of render context waiting for frame presentation before its reuse
+    [[nodiscard]] Ptrs<ITexture> Acquire(const Requests& requests, Data::Index frame_index);
+
+    [[nodiscard]] const Placement& GetLastPlacement() const noexcept { return m_last_placement; }
+    [[nodiscard]] size_t           GetTexturesCount() const noexcept;
+
+private:
+    const IContext&             m_context;
+    std::vector<Ptrs<ITexture>> m_block_textures_by_frame;
+    Placement                   m_last_placement;
+};
+
+} // namespace Methane::Graphics::Rhi
@@ -80,6 +80,19 @@ BufferSettings BufferSettings::ForConstantBuffer(Data::Size size, bool addressab
     };
 }
 
+BufferSettings BufferSettings::ForStorageBuffer(Data::Size size, Data::Size stride, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    return Rhi::BufferSettings{
+        Rhi::BufferType::Storage,
+        Rhi::ResourceUsageMask({ Rhi::ResourceUsage::ShaderRead, Rhi::ResourceUsage::ShaderWrite }),
+        GetAlignedSize(size),
+        stride,
+        PixelFormat::Unknown,
+        GetBufferStorageMode(is_volatile)
+    };
+}
+
 BufferSettings BufferSettings::ForReadBackBuffer(Data::Size size)
 {
     META_FUNCTION_TASK();
@@ -93,6 +106,19 @@ BufferSettings BufferSettings::ForReadBackBuffer(Data::Size size)
     };
 }
 
+BufferSettings BufferSettings::ForIndirectBuffer(Data::Size size, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    return Rhi::BufferSettings{
+        Rhi::BufferType::Indirect,
+        Rhi::ResourceUsageMask(),
+        GetAlignedSize(size),
+        0U,
+        PixelFormat::Unknown,
+        GetBufferStorageMode(is_volatile)
+    };
+}
+
 Data::Size BufferSettings::GetAlignedSize(Data::Size size) noexcept
 {
     // Aligned size must be a multiple 256 bytes
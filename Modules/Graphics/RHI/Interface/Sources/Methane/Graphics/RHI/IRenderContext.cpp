@@ -73,6 +73,13 @@ RenderContextSettings& RenderContextSettings::SetFrameBuffersCount(uint32_t new_
     return *this;
 }
 
+RenderContextSettings& RenderContextSettings::SetFramesInFlightCount(uint32_t new_frames_in_flight_count) noexcept
+{
+    META_FUNCTION_TASK();
+    frames_in_flight_count = new_frames_in_flight_count;
+    return *this;
+}
+
 RenderContextSettings& RenderContextSettings::SetVSyncEnabled(bool new_vsync_enabled) noexcept
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,236 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/TextureUploader.cpp
+Methane texture uploader streams texture data to GPU in slices of block rows,
+limited by per-frame upload budget and copied through the shared staging memory ring,
+which regions are released when upload command queue fence is reached by GPU.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/TextureUploader.h>
+#include <Methane/Graphics/RHI/ITexture.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Graphics/RHI/IFence.h>
+#include <Methane/Graphics/RHI/ICommandKit.h>
+#include <Methane/Graphics/RHI/ICommandQueue.h>
+#include <Methane/Graphics/RHI/IContext.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <optional>
+
+namespace Methane::Graphics::Rhi
+{
+
+static BufferSettings GetStagingBufferSettings(Data::Size staging_ring_size)
+{
+    META_FUNCTION_TASK();
+    return BufferSettings{
+        BufferType::Storage,
+        ResourceUsageMask(),
+        BufferSettings::GetAlignedSize(staging_ring_size),
+        0U,
+        PixelFormat::Unknown,
+        BufferStorageMode::Managed
+    };
+}
+
+TextureUploader::TextureUploader(ICommandQueue& target_cmd_queue, const Settings& settings)
+    : m_target_cmd_queue(target_cmd_queue)
+    , m_settings(settings)
+    , m_staging_ring(settings.staging_ring_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.frame_upload_budget, "texture uploader frame budget can not be zero");
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_settings.staging_ring_size, m_settings.frame_upload_budget,
+                                          "texture uploader staging ring can not be smaller than frame budget");
+
+    // Staging ring is shared by uploads of all textures, which are copied to GPU memory in upload command queue
+    const IContext& context = m_target_cmd_queue.GetContext();
+    m_staging_buffer_ptr = context.CreateBuffer(GetStagingBufferSettings(m_settings.staging_ring_size));
+    m_staging_buffer_ptr->SetName("Texture Uploader Staging Ring");
+    m_upload_fence_ptr = context.GetUploadCommandKit().GetQueue().CreateFence();
+}
+
+TextureUploader::~TextureUploader()
+{
+    META_FUNCTION_TASK();
+    // Staging buffer must not be released while GPU is still copying texture data from it
+    if (!m_frame_uploads.empty())
+        m_upload_fence_ptr->WaitOnCpu();
+}
+
+void TextureUploader::Enqueue(ITexture& texture, IResource::SubResources&& sub_resources, const CompletionCallback& completion_callback)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY_DESCR(sub_resources, "can not enqueue texture upload from empty sub-resources");
+    const TextureSettings& settings = texture.GetSettings();
+    META_CHECK_ARG_EQUAL_DESCR(settings.type, TextureType::Image, "only image textures support data upload from CPU");
+
+    // MIP levels are not generated on GPU for sliced uploads, so all MIP levels have to be uploaded
+    if (settings.mipmapped)
+    {
+        META_CHECK_ARG_EQUAL_DESCR(sub_resources.size(), texture.GetSubresourceCount().GetRawCount(),
+                                   "streamed upload of mipmapped texture requires data of all sub-resources");
+    }
+
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        META_CHECK_ARG_FALSE_DESCR(sub_resource.HasDataRange(), "sub-resource {} data is sliced by texture uploader and can not have data range",
+                                   static_cast<std::string>(sub_resource.GetIndex()));
+        META_CHECK_ARG_EQUAL_DESCR(sub_resource.GetDataSize(), texture.GetSubResourceDataSize(sub_resource.GetIndex()),
+                                   "sub-resource {} data size must be equal to the texture sub-resource size",
+                                   static_cast<std::string>(sub_resource.GetIndex()));
+
+        // Progress of the upload is guaranteed only when a single row of pixel blocks fits in the empty staging ring
+        const Data::Size row_pitch = GetRowPitch(settings.pixel_format, GetMipLevelSize(settings.dimensions.GetWidth(), sub_resource.GetIndex().GetMipLevel()));
+        const Data::Size row_staging_size = texture.GetStagingDataSize({
+            SubResource(sub_resource.GetDataPtr(), row_pitch, sub_resource.GetIndex(), BytesRange(0U, row_pitch))
+        });
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(row_staging_size, m_settings.staging_ring_size,
+                                           "texture uploader staging ring is too small for the row of sub-resource {}",
+                                           static_cast<std::string>(sub_resource.GetIndex()));
+    }
+
+    m_pending_textures.push_back(PendingTexture{ texture.GetDerivedPtr<ITexture>(), std::move(sub_resources), completion_callback });
+}
+
+void TextureUploader::UploadFrame()
+{
+    META_FUNCTION_TASK();
+    ReleaseCompletedFrameUploads();
+
+    m_last_frame_statistics = {};
+
+    FrameUpload frame_upload;
+    Data::Size  frame_upload_size = 0U;
+    while(!m_pending_textures.empty())
+    {
+        // Progress is guaranteed with at least one row uploaded in every frame when staging ring has free space,
+        // even if budget is smaller than a row of pixel blocks
+        PendingTexture&  pending_texture = m_pending_textures.front();
+        const Data::Size budget_size     = m_settings.frame_upload_budget - std::min(m_settings.frame_upload_budget, frame_upload_size);
+        const Data::Size uploaded_size   = UploadTextureSlices(pending_texture, budget_size, !frame_upload_size, frame_upload);
+        if (!uploaded_size)
+            break;
+
+        frame_upload_size += uploaded_size;
+        m_last_frame_statistics.textures_count++;
+
+        if (pending_texture.sub_resource_index < pending_texture.sub_resources.size())
+            break;
+
+        frame_upload.completed_textures.push_back(CompletedTexture{ std::move(pending_texture.texture_ptr), std::move(pending_texture.completion_callback) });
+        m_pending_textures.pop_front();
+    }
+
+    if (!frame_upload.staging_regions_count)
+        return;
+
+    // Encoded texture copies are executed in upload command queue right away,
+    // and staging regions of this frame are released when upload fence signalled after them is reached by GPU
+    m_target_cmd_queue.GetContext().ExecuteResourceUploads();
+    m_upload_fence_ptr->Signal();
+    frame_upload.fence_value = m_upload_fence_ptr->GetValue();
+    m_frame_uploads.push_back(std::move(frame_upload));
+}
+
+void TextureUploader::ReleaseCompletedFrameUploads()
+{
+    META_FUNCTION_TASK();
+    if (m_frame_uploads.empty())
+        return;
+
+    const uint64_t completed_fence_value = m_upload_fence_ptr->GetCompletedValue();
+    while(!m_frame_uploads.empty() && m_frame_uploads.front().fence_value <= completed_fence_value)
+    {
+        FrameUpload frame_upload = std::move(m_frame_uploads.front());
+        m_frame_uploads.pop_front();
+
+        // Staging regions are freed in the same order as they were allocated
+        for(uint32_t region_index = 0U; region_index < frame_upload.staging_regions_count; ++region_index)
+        {
+            m_staging_ring.Free();
+        }
+
+        for(const CompletedTexture& completed_texture : frame_upload.completed_textures)
+        {
+            if (completed_texture.completion_callback)
+                completed_texture.completion_callback(*completed_texture.texture_ptr);
+        }
+    }
+}
+
+Data::Size TextureUploader::UploadTextureSlices(PendingTexture& pending_texture, Data::Size budget_size, bool force_progress, FrameUpload& frame_upload)
+{
+    META_FUNCTION_TASK();
+    ITexture& texture = *pending_texture.texture_ptr;
+    const TextureSettings& settings = texture.GetSettings();
+
+    Data::Size uploaded_size = 0U;
+    while(pending_texture.sub_resource_index < pending_texture.sub_resources.size())
+    {
+        // Sub-resource data is sliced by whole rows of pixel blocks, which is required by texture data ranges
+        const SubResource& sub_resource   = pending_texture.sub_resources[pending_texture.sub_resource_index];
+        const Data::Index  mip_level      = sub_resource.GetIndex().GetMipLevel();
+        const Data::Size   row_pitch      = GetRowPitch(settings.pixel_format, GetMipLevelSize(settings.dimensions.GetWidth(), mip_level));
+        const Data::Size   remaining_size = sub_resource.GetDataSize() - pending_texture.sub_resource_offset;
+
+        const Data::Size free_budget_size = budget_size - std::min(budget_size, uploaded_size);
+        Data::Size slice_size = std::min(remaining_size, free_budget_size / row_pitch * row_pitch);
+        if (!slice_size && force_progress && !uploaded_size)
+            slice_size = std::min(remaining_size, row_pitch);
+
+        // Slice rows count is halved until its staging data fits in the free region of staging ring
+        const Data::Size slice_offset = pending_texture.sub_resource_offset;
+        while(slice_size)
+        {
+            const SubResource slice(sub_resource.GetDataPtr() + slice_offset, slice_size, sub_resource.GetIndex(),
+                                    BytesRange(slice_offset, slice_offset + slice_size));
+            if (const std::optional<Data::Size> staging_offset_opt = m_staging_ring.Allocate(texture.GetStagingDataSize({ slice }),
+                                                                                             ITexture::s_staging_data_alignment);
+                staging_offset_opt)
+            {
+                texture.SetDataThroughStaging({ slice }, m_target_cmd_queue, *m_staging_buffer_ptr, *staging_offset_opt);
+                break;
+            }
+            slice_size = slice_size > row_pitch ? slice_size / row_pitch / 2U * row_pitch : 0U;
+        }
+        if (!slice_size)
+            break;
+
+        frame_upload.staging_regions_count++;
+        m_last_frame_statistics.slices_count++;
+        m_last_frame_statistics.uploaded_data_size += slice_size;
+
+        uploaded_size += slice_size;
+        pending_texture.sub_resource_offset += slice_size;
+        if (pending_texture.sub_resource_offset == sub_resource.GetDataSize())
+        {
+            pending_texture.sub_resource_index++;
+            pending_texture.sub_resource_offset = 0U;
+        }
+    }
+
+    return uploaded_size;
+}
+
+} // namespace Methane::Graphics::Rhi
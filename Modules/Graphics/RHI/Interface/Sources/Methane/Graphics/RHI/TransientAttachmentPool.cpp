@@ -0,0 +1,157 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/TransientAttachmentPool.cpp
+Methane pool of transient render pass attachments, aliasing textures of attachments
+with disjoint lifetimes between render passes of the frame.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/TransientAttachmentPool.h>
+#include <Methane/Graphics/RHI/IContext.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace Methane::Graphics::Rhi
+{
+
+[[nodiscard]]
+static Data::Size GetAttachmentMemorySize(const TextureSettings& settings)
+{
+    return GetSlicePitch(settings.pixel_format, settings.dimensions.GetWidth(), settings.dimensions.GetHeight())
+         * settings.dimensions.GetDepth() * settings.array_length;
+}
+
+TransientAttachmentPool::Placement TransientAttachmentPool::Place(const Requests& requests)
+{
+    META_FUNCTION_TASK();
+    Placement placement;
+    placement.block_index_by_request.resize(requests.size());
+
+    // Requests are placed in the order of their first render pass, so that each block is reused by the next
+    // compatible attachment right after the last pass of the previous one, which gives minimal count of blocks
+    std::vector<uint32_t> request_indices(requests.size());
+    std::iota(request_indices.begin(), request_indices.end(), 0U);
+    std::stable_sort(request_indices.begin(), request_indices.end(),
+                     [&requests](uint32_t left, uint32_t right)
+                     { return requests[left].first_pass_index < requests[right].first_pass_index; });
+
+    std::vector<uint32_t> block_last_pass_indices;
+    for(const uint32_t request_index : request_indices)
+    {
+        const Request& request = requests[request_index];
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(request.first_pass_index, request.last_pass_index,
+                                           "transient attachment first pass can not be after its last pass");
+        META_CHECK_ARG_NOT_EQUAL_DESCR(request.settings.type, TextureType::FrameBuffer,
+                                       "frame buffer textures are owned by render context and can not be transient attachments");
+        META_CHECK_ARG_TRUE_DESCR(request.settings.usage_mask.HasAnyBit(ResourceUsage::RenderTarget),
+                                  "transient attachment texture must have render target usage");
+
+        uint32_t block_index = 0U;
+        for(; block_index < placement.block_settings.size(); ++block_index)
+        {
+            if (block_last_pass_indices[block_index] < request.first_pass_index &&
+                IsAliasingCompatible(placement.block_settings[block_index], request.settings))
+                break;
+        }
+
+        if (block_index == placement.block_settings.size())
+        {
+            placement.block_settings.push_back(request.settings);
+            block_last_pass_indices.push_back(request.last_pass_index);
+            placement.placed_memory_size += GetAttachmentMemorySize(request.settings);
+        }
+        else
+        {
+            block_last_pass_indices[block_index] = request.last_pass_index;
+        }
+
+        placement.block_index_by_request[request_index] = block_index;
+        placement.requested_memory_size += GetAttachmentMemorySize(request.settings);
+    }
+
+    return placement;
+}
+
+bool TransientAttachmentPool::IsAliasingCompatible(const TextureSettings& left, const TextureSettings& right) noexcept
+{
+    META_FUNCTION_TASK();
+    return left.type                    == right.type &&
+           left.dimension_type          == right.dimension_type &&
+           left.usage_mask              == right.usage_mask &&
+           left.pixel_format            == right.pixel_format &&
+           left.dimensions              == right.dimensions &&
+           left.array_length            == right.array_length &&
+           left.mipmapped               == right.mipmapped &&
+           left.depth_stencil_clear_opt == right.depth_stencil_clear_opt;
+}
+
+TransientAttachmentPool::TransientAttachmentPool(const IContext& context)
+    : m_context(context)
+{ }
+
+Ptrs<ITexture> TransientAttachmentPool::Acquire(const Requests& requests, Data::Index frame_index)
+{
+    META_FUNCTION_TASK();
+    m_last_placement = Place(requests);
+    if (frame_index >= m_block_textures_by_frame.size())
+        m_block_textures_by_frame.resize(frame_index + 1U);
+
+    // Previous textures of the frame are reused for compatible blocks and released if they are not needed anymore
+    Ptrs<ITexture> prev_textures = std::move(m_block_textures_by_frame[frame_index]);
+    Ptrs<ITexture>& block_textures = m_block_textures_by_frame[frame_index];
+    block_textures.clear();
+    for(const TextureSettings& block_settings : m_last_placement.block_settings)
+    {
+        const auto prev_texture_it = std::find_if(prev_textures.begin(), prev_textures.end(),
+                                                  [&block_settings](const Ptr<ITexture>& texture_ptr)
+                                                  { return texture_ptr && IsAliasingCompatible(texture_ptr->GetSettings(), block_settings); });
+        if (prev_texture_it == prev_textures.end())
+        {
+            block_textures.emplace_back(ITexture::Create(m_context, block_settings));
+            continue;
+        }
+
+        block_textures.emplace_back(std::move(*prev_texture_it));
+    }
+
+    Ptrs<ITexture> textures;
+    textures.reserve(requests.size());
+    for(const uint32_t block_index : m_last_placement.block_index_by_request)
+    {
+        textures.push_back(block_textures[block_index]);
+    }
+    return textures;
+}
+
+size_t TransientAttachmentPool::GetTexturesCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    size_t textures_count = 0U;
+    for(const Ptrs<ITexture>& block_textures : m_block_textures_by_frame)
+    {
+        textures_count += block_textures.size();
+    }
+    return textures_count;
+}
+
+} // namespace Methane::Graphics::Rhi
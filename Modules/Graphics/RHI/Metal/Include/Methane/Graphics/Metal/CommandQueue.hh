@@ -45,6 +45,7 @@ public:
     [[nodiscard]] Ptr<Rhi::ITransferCommandList>       CreateTransferCommandList() override;
     [[nodiscard]] Ptr<Rhi::IRenderCommandList>         CreateRenderCommandList(Rhi::IRenderPass& render_pass) override;
     [[nodiscard]] Ptr<Rhi::IParallelRenderCommandList> CreateParallelRenderCommandList(Rhi::IRenderPass& render_pass) override;
+    [[nodiscard]] Ptr<Rhi::IComputeCommandList>        CreateComputeCommandList() override;
     [[nodiscard]] Ptr<Rhi::ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t max_timestamps_per_frame) override;
     uint32_t                  GetFamilyIndex() const noexcept override { return 0U; }
     Rhi::ITimestampQueryPool& GetTimestampQueryPool() override         { return m_timestamp_query_pool; }
@@ -0,0 +1,54 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Metal/ComputeCommandList.hh
+Metal implementation of the compute command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandList.hpp"
+
+#include <Methane/Graphics/Base/ComputeCommandList.h>
+
+#import <Metal/Metal.h>
+
+namespace Methane::Graphics::Metal
+{
+
+class ComputeCommandList final
+    : public CommandList<id<MTLComputeCommandEncoder>, Base::ComputeCommandList>
+{
+public:
+    explicit ComputeCommandList(Base::CommandQueue& command_queue);
+
+    // ICommandList interface
+    void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
+
+    // IComputeCommandList interface
+    void ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) override;
+    void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset) override;
+
+private:
+    void ResetCommandEncoder();
+    MTLSize GetNativeThreadGroupSize() const;
+};
+
+} // namespace Methane::Graphics::Metal
@@ -48,10 +48,13 @@ public:
 
 private:
     const IContext& GetMetalContext() const noexcept;
+    void InitRenderReflection(const Settings& settings);
+    void InitComputeReflection();
     void SetNativeShaderArguments(Rhi::ShaderType shader_type, NSArray<MTLArgument*>* mtl_arguments) noexcept;
     
     MTLVertexDescriptor*         m_mtl_vertex_desc = nil;
     id<MTLRenderPipelineState>   m_mtl_dummy_pipeline_state_for_reflection;
+    id<MTLComputePipelineState>  m_mtl_dummy_compute_state_for_reflection;
 };
 
 } // namespace Methane::Graphics::Metal
@@ -52,10 +52,16 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+
+    // Creates native render encoder, if it was not created yet for current encoding
+    void ResetCommandEncoder();
 
 private:
     RenderPass& GetMetalRenderPass();
-    void ResetCommandEncoder();
 
     const ParallelRenderCommandList* m_parallel_render_command_list_ptr = nullptr;
     const bool m_device_supports_gpu_family_apple_3;
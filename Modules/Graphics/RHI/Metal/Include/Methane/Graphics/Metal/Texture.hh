@@ -45,6 +45,10 @@ public:
     // IResource interface
     void SetData(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue) override;
 
+    // ITexture interface
+    void SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                               Rhi::IBuffer& staging_buffer, Data::Size staging_offset) override;
+
     // IObject interface
     bool SetName(std::string_view name) override;
 
@@ -53,6 +57,8 @@ public:
     const id<MTLTexture>& GetNativeTexture() const { return m_mtl_texture; }
 
 private:
+    void CopySubResourceFromBuffer(const SubResource& sub_resource, const id<MTLBuffer>& mtl_buffer, Data::Size buffer_offset,
+                                   TransferCommandList& transfer_command_list);
     void GenerateMipLevels(TransferCommandList& transfer_command_list);
     const RenderContext& GetMetalRenderContext() const;
 
@@ -27,6 +27,7 @@ Metal implementation of the command queue interface.
 #include <Methane/Graphics/Metal/TransferCommandList.hh>
 #include <Methane/Graphics/Metal/RenderCommandList.hh>
 #include <Methane/Graphics/Metal/ParallelRenderCommandList.hh>
+#include <Methane/Graphics/Metal/ComputeCommandList.hh>
 #include <Methane/Graphics/Metal/RenderContext.hh>
 
 #include <Methane/Platform/Apple/Types.hh>
@@ -76,6 +77,12 @@ Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandLi
     return std::make_shared<ParallelRenderCommandList>(*this, dynamic_cast<Base::RenderPass&>(render_pass));
 }
 
+Ptr<Rhi::IComputeCommandList> CommandQueue::CreateComputeCommandList()
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeCommandList>(*this);
+}
+
 Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t)
 {
     META_FUNCTION_TASK();
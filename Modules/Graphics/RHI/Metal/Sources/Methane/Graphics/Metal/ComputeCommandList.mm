@@ -0,0 +1,97 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Metal/ComputeCommandList.mm
+Metal implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Metal/ComputeCommandList.hh>
+#include <Methane/Graphics/Metal/Buffer.hh>
+
+#include <Methane/Graphics/Base/ComputeState.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Metal
+{
+
+ComputeCommandList::ComputeCommandList(Base::CommandQueue& command_queue)
+    : CommandList<id<MTLComputeCommandEncoder>, Base::ComputeCommandList>(true, command_queue)
+{ }
+
+void ComputeCommandList::Reset(IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    ResetCommandEncoder();
+    Base::ComputeCommandList::Reset(debug_group_ptr);
+}
+
+void ComputeCommandList::ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    ResetCommandEncoder();
+    Base::ComputeCommandList::ResetWithState(compute_state, debug_group_ptr);
+}
+
+void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::Dispatch(thread_groups_count);
+
+    const id<MTLComputeCommandEncoder>& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    [mtl_cmd_encoder dispatchThreadgroups:MTLSizeMake(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth())
+                    threadsPerThreadgroup:GetNativeThreadGroupSize()];
+}
+
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(arguments_buffer, arguments_offset);
+
+    const id<MTLComputeCommandEncoder>& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    [mtl_cmd_encoder dispatchThreadgroupsWithIndirectBuffer:static_cast<const Buffer&>(arguments_buffer).GetNativeBuffer()
+                                       indirectBufferOffset:arguments_offset
+                                      threadsPerThreadgroup:GetNativeThreadGroupSize()];
+}
+
+void ComputeCommandList::ResetCommandEncoder()
+{
+    META_FUNCTION_TASK();
+    if (IsCommandEncoderInitialized())
+        return;
+
+    const id<MTLCommandBuffer>& mtl_cmd_buffer = InitializeCommandBuffer();
+    InitializeCommandEncoder([mtl_cmd_buffer computeCommandEncoder]);
+}
+
+MTLSize ComputeCommandList::GetNativeThreadGroupSize() const
+{
+    META_FUNCTION_TASK();
+    // Unlike DirectX and Vulkan, Metal does not take thread group size from the compute shader code
+    const Base::ComputeState* compute_state_ptr = GetComputeStatePtr();
+    META_CHECK_ARG_NOT_NULL(compute_state_ptr);
+    const Rhi::ThreadGroupSize& thread_group_size = compute_state_ptr->GetSettings().thread_group_size;
+    return MTLSizeMake(thread_group_size.GetWidth(), thread_group_size.GetHeight(), thread_group_size.GetDepth());
+}
+
+} // namespace Methane::Graphics::Metal
@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Metal/ComputeState.mm
+Metal implementation of the compute state interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Metal/ComputeState.hh>
+#include <Methane/Graphics/Metal/ComputeCommandList.hh>
+#include <Methane/Graphics/Metal/IContext.h>
+#include <Methane/Graphics/Metal/Device.hh>
+#include <Methane/Graphics/Metal/Program.hh>
+
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Platform/Apple/Types.hh>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Metal
+{
+
+ComputeState::ComputeState(const Base::Context& context, const Settings& settings)
+    : Base::ComputeState(context, settings)
+    , m_metal_context(dynamic_cast<const IContext&>(context))
+{
+    META_FUNCTION_TASK();
+    Reset(settings);
+}
+
+void ComputeState::Reset(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeState::Reset(settings);
+
+    id<MTLFunction> mtl_compute_function = static_cast<Program&>(GetProgram()).GetNativeShaderFunction(Rhi::ShaderType::Compute);
+    META_CHECK_ARG_NOT_NULL_DESCR(mtl_compute_function, "compute state program has no compute shader function");
+
+    m_mtl_pipeline_state_desc = [[MTLComputePipelineDescriptor alloc] init];
+    m_mtl_pipeline_state_desc.computeFunction = mtl_compute_function;
+    m_mtl_pipeline_state_desc.label           = MacOS::ConvertToNsString(GetName());
+    m_mtl_pipeline_state = nil;
+}
+
+void ComputeState::Apply(Base::ComputeCommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    const auto& metal_command_list = static_cast<ComputeCommandList&>(command_list);
+    const id<MTLComputeCommandEncoder>& mtl_cmd_encoder = metal_command_list.GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    [mtl_cmd_encoder setComputePipelineState: GetNativePipelineState()];
+}
+
+bool ComputeState::SetName(std::string_view name)
+{
+    META_FUNCTION_TASK();
+    if (!Base::ComputeState::SetName(name))
+        return false;
+
+    // Pipeline state label is immutable, so it is created again with a new name
+    m_mtl_pipeline_state_desc.label = MacOS::ConvertToNsString(name);
+    m_mtl_pipeline_state = nil;
+    return true;
+}
+
+void ComputeState::InitializeNativePipelineState()
+{
+    META_FUNCTION_TASK();
+    if (m_mtl_pipeline_state)
+        return;
+
+    NSError* ns_error = nil;
+    m_mtl_pipeline_state = [m_metal_context.GetMetalDevice().GetNativeDevice() newComputePipelineStateWithDescriptor:m_mtl_pipeline_state_desc
+                                                                                                              options:MTLPipelineOptionNone
+                                                                                                           reflection:nil
+                                                                                                                error:&ns_error];
+    META_CHECK_ARG_NOT_NULL_DESCR(m_mtl_pipeline_state,
+                                  "failed to create Metal compute pipeline state: {}",
+                                  MacOS::ConvertFromNsString([ns_error localizedDescription]));
+}
+
+id<MTLComputePipelineState> ComputeState::GetNativePipelineState()
+{
+    META_FUNCTION_TASK();
+    if (!m_mtl_pipeline_state)
+    {
+        InitializeNativePipelineState();
+    }
+    return m_mtl_pipeline_state;
+}
+
+} // namespace Methane::Graphics::Metal
@@ -92,6 +92,13 @@ void Fence::WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue)
     [mtl_command_buffer commit];
 }
 
+uint64_t Fence::GetCompletedValue() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_mtl_event);
+    return m_mtl_event.signaledValue;
+}
+
 bool Fence::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
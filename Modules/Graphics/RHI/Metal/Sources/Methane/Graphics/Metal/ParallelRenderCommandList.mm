@@ -61,17 +61,25 @@ Ptr<Rhi::IRenderCommandList> ParallelRenderCommandList::CreateCommandList(bool)
 bool ParallelRenderCommandList::ResetCommandEncoder()
 {
     META_FUNCTION_TASK();
-    if (IsCommandEncoderInitialized())
-        return false;
+    const bool is_encoder_created = !IsCommandEncoderInitialized();
+    if (is_encoder_created)
+    {
+        // NOTE: If command buffer was not created for current frame yet,
+        // then render pass descriptor should be reset with new frame drawable
+        MTLRenderPassDescriptor* mtl_render_pass = GetMetalRenderPass().GetNativeDescriptor(!IsCommandBufferInitialized());
+        META_CHECK_ARG_NOT_NULL(mtl_render_pass);
 
-    // NOTE: If command buffer was not created for current frame yet,
-    // then render pass descriptor should be reset with new frame drawable
-    MTLRenderPassDescriptor* mtl_render_pass = GetMetalRenderPass().GetNativeDescriptor(!IsCommandBufferInitialized());
-    META_CHECK_ARG_NOT_NULL(mtl_render_pass);
+        const id<MTLCommandBuffer>& mtl_cmd_buffer = InitializeCommandBuffer();
+        InitializeCommandEncoder([mtl_cmd_buffer parallelRenderCommandEncoderWithDescriptor: mtl_render_pass]);
+    }
 
-    const id<MTLCommandBuffer>& mtl_cmd_buffer = InitializeCommandBuffer();
-    InitializeCommandEncoder([mtl_cmd_buffer parallelRenderCommandEncoderWithDescriptor: mtl_render_pass]);
-    return true;
+    // Order of render encoders creation defines their execution order in parallel render encoder,
+    // so they are created here in order of command lists, which are reset in parallel after that
+    for(const Ref<Rhi::IRenderCommandList>& render_cmd_list_ref : GetParallelCommandLists())
+    {
+        static_cast<RenderCommandList&>(render_cmd_list_ref.get()).ResetCommandEncoder();
+    }
+    return is_encoder_created;
 }
 
 RenderPass& ParallelRenderCommandList::GetMetalRenderPass()
@@ -38,9 +38,21 @@ namespace Methane::Graphics::Metal
 
 Program::Program(const Base::Context& context, const Settings& settings)
     : Base::Program(context, settings)
-    , m_mtl_vertex_desc(GetMetalShader(Rhi::ShaderType::Vertex).GetNativeVertexDescriptor(*this))
 {
     META_FUNCTION_TASK();
+    // Compute program has the only compute shader, which arguments are reflected with compute pipeline state
+    if (HasShader(Rhi::ShaderType::Compute))
+        InitComputeReflection();
+    else
+        InitRenderReflection(settings);
+
+    InitArgumentBindings(settings.argument_accessors);
+}
+
+void Program::InitRenderReflection(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    m_mtl_vertex_desc = GetMetalShader(Rhi::ShaderType::Vertex).GetNativeVertexDescriptor(*this);
 
     // Create dummy pipeline state to get program reflection of vertex and fragment shader arguments
     MTLRenderPipelineDescriptor* mtl_reflection_state_desc = [MTLRenderPipelineDescriptor new];
@@ -59,10 +71,8 @@ Program::Program(const Base::Context& context, const Settings& settings)
     mtl_reflection_state_desc.depthAttachmentPixelFormat   = TypeConverter::DataFormatToMetalPixelType(settings.attachment_formats.depth);
     mtl_reflection_state_desc.stencilAttachmentPixelFormat = TypeConverter::DataFormatToMetalPixelType(settings.attachment_formats.stencil);
     
-    const IContext& metal_context = dynamic_cast<const IContext&>(context);
-    
     NSError* ns_error = nil;
-    const id<MTLDevice>& mtl_device = metal_context.GetMetalDevice().GetNativeDevice();
+    const id<MTLDevice>& mtl_device = GetMetalContext().GetMetalDevice().GetNativeDevice();
 
     MTLRenderPipelineReflection* mtl_render_pipeline_reflection = nil;
     m_mtl_dummy_pipeline_state_for_reflection = [mtl_device newRenderPipelineStateWithDescriptor:mtl_reflection_state_desc
@@ -78,7 +88,28 @@ Program::Program(const Base::Context& context, const Settings& settings)
     {
         SetNativeShaderArguments(Rhi::ShaderType::Vertex, mtl_render_pipeline_reflection.vertexArguments);
         SetNativeShaderArguments(Rhi::ShaderType::Pixel,  mtl_render_pipeline_reflection.fragmentArguments);
-        InitArgumentBindings(settings.argument_accessors);
+    }
+}
+
+void Program::InitComputeReflection()
+{
+    META_FUNCTION_TASK();
+    NSError* ns_error = nil;
+    const id<MTLDevice>& mtl_device = GetMetalContext().GetMetalDevice().GetNativeDevice();
+
+    MTLComputePipelineReflection* mtl_compute_pipeline_reflection = nil;
+    m_mtl_dummy_compute_state_for_reflection = [mtl_device newComputePipelineStateWithFunction:GetNativeShaderFunction(Rhi::ShaderType::Compute)
+                                                                                       options:MTLPipelineOptionArgumentInfo
+                                                                                    reflection:&mtl_compute_pipeline_reflection
+                                                                                         error:&ns_error];
+
+    META_CHECK_ARG_NOT_NULL_DESCR(m_mtl_dummy_compute_state_for_reflection,
+                                  "Failed to create dummy compute pipeline state for program reflection: {}",
+                                  MacOS::ConvertFromNsString([ns_error localizedDescription]));
+
+    if (mtl_compute_pipeline_reflection)
+    {
+        SetNativeShaderArguments(Rhi::ShaderType::Compute, mtl_compute_pipeline_reflection.arguments);
     }
 }
 
@@ -27,6 +27,7 @@ Metal implementation of the program bindings interface.
 #include <Methane/Graphics/Metal/Texture.hh>
 #include <Methane/Graphics/Metal/Sampler.hh>
 #include <Methane/Graphics/Metal/RenderCommandList.hh>
+#include <Methane/Graphics/Metal/ComputeCommandList.hh>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -163,6 +164,33 @@ void SetMetalResourcesForAll(Rhi::ShaderType shader_type, const Rhi::IProgram& p
     }
 }
 
+template<typename TMetalResource>
+void SetMetalComputeResources(const id<MTLComputeCommandEncoder>& mtl_cmd_encoder, const std::vector<TMetalResource>& mtl_resources, uint32_t arg_index, const std::vector<NSUInteger>& offsets);
+
+template<>
+void SetMetalComputeResources(const id<MTLComputeCommandEncoder>& mtl_cmd_encoder, const NativeBuffers& mtl_buffers,
+                              uint32_t arg_index, const std::vector<NSUInteger>& buffer_offsets)
+{
+    META_FUNCTION_TASK();
+    [mtl_cmd_encoder setBuffers:mtl_buffers.data() offsets:buffer_offsets.data() withRange:NSMakeRange(arg_index, mtl_buffers.size())];
+}
+
+template<>
+void SetMetalComputeResources(const id<MTLComputeCommandEncoder>& mtl_cmd_encoder, const NativeTextures& mtl_textures,
+                              uint32_t arg_index, const std::vector<NSUInteger>&)
+{
+    META_FUNCTION_TASK();
+    [mtl_cmd_encoder setTextures:mtl_textures.data() withRange:NSMakeRange(arg_index, mtl_textures.size())];
+}
+
+template<>
+void SetMetalComputeResources(const id<MTLComputeCommandEncoder>& mtl_cmd_encoder, const NativeSamplerStates& mtl_samplers,
+                              uint32_t arg_index, const std::vector<NSUInteger>&)
+{
+    META_FUNCTION_TASK();
+    [mtl_cmd_encoder setSamplerStates:mtl_samplers.data() withRange:NSMakeRange(arg_index, mtl_samplers.size())];
+}
+
 ProgramBindings::ProgramBindings(Program& program, const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index)
     : Base::ProgramBindings(program, resource_views_by_argument, frame_index)
 { }
@@ -180,8 +208,10 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgu
 void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
-    RenderCommandList& metal_command_list = static_cast<RenderCommandList&>(command_list);
-    const id<MTLRenderCommandEncoder>& mtl_cmd_encoder = metal_command_list.GetNativeCommandEncoder();
+    // Compute command encoder has no shader stages, so arguments are bound to it with stage-less methods
+    const bool is_compute_command_list = command_list.GetType() == Rhi::CommandListType::Compute;
+    const id<MTLRenderCommandEncoder>  mtl_render_cmd_encoder  = is_compute_command_list ? nil : static_cast<RenderCommandList&>(command_list).GetNativeCommandEncoder();
+    const id<MTLComputeCommandEncoder> mtl_compute_cmd_encoder = is_compute_command_list ? static_cast<ComputeCommandList&>(command_list).GetNativeCommandEncoder() : nil;
     constexpr ApplyBehaviorMask constant_once_and_changes_only({
         ApplyBehavior::ConstantOnce,
         ApplyBehavior::ChangesOnly
@@ -193,26 +223,32 @@ void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask a
         const ArgumentBinding& metal_argument_binding = static_cast<const ArgumentBinding&>(*binding_by_argument.second);
 
         if (apply_behavior.HasAnyBits(constant_once_and_changes_only) &&
-            metal_command_list.GetProgramBindingsPtr() &&
-            metal_argument_binding.IsAlreadyApplied(GetProgram(), *metal_command_list.GetProgramBindingsPtr(),
+            command_list.GetProgramBindingsPtr() &&
+            metal_argument_binding.IsAlreadyApplied(GetProgram(), *command_list.GetProgramBindingsPtr(),
                                                     apply_behavior.HasAnyBit(ApplyBehavior::ChangesOnly)))
             continue;
 
         const uint32_t arg_index = metal_argument_binding.GetMetalSettings().argument_index;
+        const auto set_metal_resources = [&](const auto& mtl_resources, const std::vector<NSUInteger>& offsets)
+        {
+            if (is_compute_command_list)
+                SetMetalComputeResources(mtl_compute_cmd_encoder, mtl_resources, arg_index, offsets);
+            else
+                SetMetalResourcesForAll(program_argument.GetShaderType(), GetProgram(), mtl_render_cmd_encoder, mtl_resources, arg_index, offsets);
+        };
 
         switch(metal_argument_binding.GetMetalSettings().resource_type)
         {
             case Rhi::ResourceType::Buffer:
-                SetMetalResourcesForAll(program_argument.GetShaderType(), GetProgram(), mtl_cmd_encoder, metal_argument_binding.GetNativeBuffers(), arg_index,
-                                       metal_argument_binding.GetBufferOffsets());
+                set_metal_resources(metal_argument_binding.GetNativeBuffers(), metal_argument_binding.GetBufferOffsets());
                 break;
 
             case Rhi::ResourceType::Texture:
-                SetMetalResourcesForAll(program_argument.GetShaderType(), GetProgram(), mtl_cmd_encoder, metal_argument_binding.GetNativeTextures(), arg_index);
+                set_metal_resources(metal_argument_binding.GetNativeTextures(), {});
                 break;
 
             case Rhi::ResourceType::Sampler:
-                SetMetalResourcesForAll(program_argument.GetShaderType(), GetProgram(), mtl_cmd_encoder, metal_argument_binding.GetNativeSamplerStates(), arg_index);
+                set_metal_resources(metal_argument_binding.GetNativeSamplerStates(), {});
                 break;
 
             default: META_UNEXPECTED_ARG(metal_argument_binding.GetMetalSettings().resource_type);
@@ -216,6 +216,54 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     }
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    // Metal render encoder has no multi-draw with GPU draws count, so unused draw arguments must have zero instance count instead
+    META_CHECK_ARG_TRUE_DESCR(!draw_count_buffer_ptr, "indirect draw count buffer is not supported by Metal");
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+
+    const Buffer& metal_index_buffer = static_cast<const Buffer&>(*GetDrawingState().index_buffer_ptr);
+    const id<MTLBuffer>& mtl_arguments_buffer = static_cast<const Buffer&>(arguments_buffer).GetNativeBuffer();
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    for(uint32_t draw_index = 0U; draw_index < max_draw_count; ++draw_index)
+    {
+        [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
+                                     indexType:metal_index_buffer.GetNativeIndexType()
+                                   indexBuffer:metal_index_buffer.GetNativeBuffer()
+                             indexBufferOffset:0U
+                                indirectBuffer:mtl_arguments_buffer
+                          indirectBufferOffset:arguments_offset + draw_index * sizeof(MTLDrawIndexedPrimitivesIndirectArguments)];
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    // Metal render encoder has no multi-draw with GPU draws count, so unused draw arguments must have zero instance count instead
+    META_CHECK_ARG_TRUE_DESCR(!draw_count_buffer_ptr, "indirect draw count buffer is not supported by Metal");
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+
+    const id<MTLBuffer>& mtl_arguments_buffer = static_cast<const Buffer&>(arguments_buffer).GetNativeBuffer();
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    for(uint32_t draw_index = 0U; draw_index < max_draw_count; ++draw_index)
+    {
+        [mtl_cmd_encoder drawPrimitives:mtl_primitive_type
+                         indirectBuffer:mtl_arguments_buffer
+                   indirectBufferOffset:arguments_offset + draw_index * sizeof(MTLDrawPrimitivesIndirectArguments)];
+    }
+}
+
 RenderPass& RenderCommandList::GetMetalRenderPass()
 {
     META_FUNCTION_TASK();
@@ -27,6 +27,7 @@ Metal implementation of the render context interface.
 #include <Methane/Graphics/Metal/Program.hh>
 #include <Methane/Graphics/Metal/RenderPass.hh>
 #include <Methane/Graphics/Metal/RenderState.hh>
+#include <Methane/Graphics/Metal/ComputeState.hh>
 #include <Methane/Graphics/Metal/RenderPattern.hh>
 #include <Methane/Graphics/Metal/Buffer.hh>
 #include <Methane/Graphics/Metal/Texture.hh>
@@ -53,7 +54,7 @@ RenderContext::RenderContext(const Platform::AppEnvironment& env, Base::Device&
     , m_app_view(CreateRenderContextAppView(env, settings))
     , m_frame_capture_scope([[MTLCaptureManager sharedCaptureManager] newCaptureScopeWithDevice:Context<Base::RenderContext>::GetMetalDevice().GetNativeDevice()])
 #ifdef USE_DISPATCH_QUEUE_SEMAPHORE
-    , m_dispatch_semaphore(dispatch_semaphore_create(settings.frame_buffers_count))
+    , m_dispatch_semaphore(dispatch_semaphore_create(GetFramesInFlightCount()))
 #endif
 {
     META_FUNCTION_TASK();
@@ -117,6 +118,12 @@ Ptr<Rhi::ISampler> RenderContext::CreateSampler(const Rhi::SamplerSettings& sett
     return std::make_shared<Sampler>(*this, settings);
 }
 
+Ptr<Rhi::IComputeState> RenderContext::CreateComputeState(const Rhi::ComputeStateSettings& settings) const
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeState>(*this, settings);
+}
+
 Ptr<Rhi::IRenderState> RenderContext::CreateRenderState(const Rhi::RenderStateSettings& settings) const
 {
     META_FUNCTION_TASK();
@@ -149,7 +156,7 @@ void RenderContext::Initialize(Base::Device& device, bool is_callback_emitted)
     Context<Base::RenderContext>::Initialize(device, is_callback_emitted);
     
 #ifdef USE_DISPATCH_QUEUE_SEMAPHORE
-    m_dispatch_semaphore = dispatch_semaphore_create(GetSettings().frame_buffers_count);
+    m_dispatch_semaphore = dispatch_semaphore_create(GetFramesInFlightCount());
 #endif
     
     m_app_view.redrawing = YES;
@@ -147,6 +147,9 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
                     argument_desc,
                     GetResourceTypeByMetalArgumentType(mtl_arg.type),
                     static_cast<uint32_t>(mtl_arg.arrayLength),
+                    mtl_arg.access == MTLArgumentAccessReadOnly
+                        ? Rhi::ProgramArgumentShaderAccess::ReadOnly
+                        : Rhi::ProgramArgumentShaderAccess::ReadWrite
                 },
                 static_cast<uint32_t>(mtl_arg.index)
             }
@@ -185,8 +188,13 @@ MTLVertexDescriptor* Shader::GetNativeVertexDescriptor(const Program& program) c
         if (!mtl_vertex_attrib.active)
             continue;
         
-        const MTLVertexFormat mtl_vertex_format = TypeConverter::MetalDataTypeToVertexFormat(mtl_vertex_attrib.attributeType);
-        const std::string attrib_name = std::regex_replace(MacOS::ConvertFromNsString(mtl_vertex_attrib.name), s_attr_suffix_regex, "");
+        const std::string attrib_name   = std::regex_replace(MacOS::ConvertFromNsString(mtl_vertex_attrib.name), s_attr_suffix_regex, "");
+        const PixelFormat attrib_format = GetProgramInputArgumentFormatBySemantic(program, attrib_name);
+
+        // Explicit argument format is used for packed vertex attributes, which are unpacked to shader input types on fetch
+        const MTLVertexFormat mtl_vertex_format = attrib_format == PixelFormat::Unknown
+                                                ? TypeConverter::MetalDataTypeToVertexFormat(mtl_vertex_attrib.attributeType)
+                                                : TypeConverter::DataFormatToMetalVertexFormat(attrib_format);
         const uint32_t    attrib_size = TypeConverter::ByteSizeOfVertexFormat(mtl_vertex_format);
         const uint32_t    attrib_slot = GetProgramInputBufferIndexByArgumentSemantic(program, attrib_name);
         
@@ -22,6 +22,7 @@ Metal implementation of the texture interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Metal/Texture.hh>
+#include <Methane/Graphics/Metal/Buffer.hh>
 #include <Methane/Graphics/Metal/RenderContext.hh>
 #include <Methane/Graphics/Metal/TransferCommandList.hh>
 #include <Methane/Graphics/Metal/Types.hh>
@@ -100,55 +101,117 @@ void Texture::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& tar
 
     Resource::SetData(sub_resources, target_cmd_queue);
 
-    TransferCommandList& transfer_command_list = dynamic_cast<TransferCommandList&>(GetBaseContext().GetUploadCommandKit().GetListForEncoding());
+    TransferCommandList& transfer_command_list = dynamic_cast<TransferCommandList&>(GetUploadCommandListForEncoding());
     transfer_command_list.RetainResource(*this);
 
-    const id<MTLBlitCommandEncoder>& mtl_blit_encoder = transfer_command_list.GetNativeCommandEncoder();
-    META_CHECK_ARG_NOT_NULL(mtl_blit_encoder);
-
-    const Settings& settings        = GetSettings();
-    const uint32_t  bytes_per_row   = settings.dimensions.GetWidth()  * GetPixelSize(settings.pixel_format);
-    const uint32_t  bytes_per_image = settings.dimensions.GetHeight() * bytes_per_row;
-    const MTLRegion texture_region  = GetTextureRegion(settings.dimensions, settings.dimension_type);
-
     for(const SubResource& sub_resource : sub_resources)
     {
-        uint32_t slice = 0;
-        switch(settings.dimension_type)
-        {
-            case Rhi::TextureDimensionType::Tex1DArray:
-            case Rhi::TextureDimensionType::Tex2DArray:
-                slice = sub_resource.GetIndex().GetArrayIndex();
-                break;
-            case Rhi::TextureDimensionType::Cube:
-                slice = sub_resource.GetIndex().GetDepthSlice();
-                break;
-            case Rhi::TextureDimensionType::CubeArray:
-                slice = sub_resource.GetIndex().GetDepthSlice() + sub_resource.GetIndex().GetArrayIndex() * 6;
-                break;
-            default:
-                slice = 0;
-        }
-
-        [mtl_blit_encoder copyFromBuffer:GetUploadSubresourceBuffer(sub_resource)
-                            sourceOffset:0
-                       sourceBytesPerRow:bytes_per_row
-                     sourceBytesPerImage:bytes_per_image
-                              sourceSize:texture_region.size
-                               toTexture:m_mtl_texture
-                        destinationSlice:slice
-                        destinationLevel:sub_resource.GetIndex().GetMipLevel()
-                       destinationOrigin:texture_region.origin];
+        CopySubResourceFromBuffer(sub_resource, GetUploadSubresourceBuffer(sub_resource), 0U, transfer_command_list);
     }
 
-    if (settings.mipmapped && sub_resources.size() < GetSubresourceCount().GetRawCount())
+    if (IsMipLevelsGenerationRequired(sub_resources))
     {
+        META_CHECK_ARG_FALSE_DESCR(IsBlockCompressedFormat(GetSettings().pixel_format),
+                                   "MIP levels can not be generated for block-compressed texture, all levels must be uploaded");
         GenerateMipLevels(transfer_command_list);
     }
 
     GetBaseContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
+void Texture::SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                                    Rhi::IBuffer& staging_buffer, Data::Size staging_offset)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_mtl_texture);
+    META_CHECK_ARG_EQUAL(m_mtl_texture.storageMode, MTLStorageModePrivate);
+
+    Resource::SetDataThroughStaging(sub_resources, target_cmd_queue, staging_buffer, staging_offset);
+
+    TransferCommandList& transfer_command_list = dynamic_cast<TransferCommandList&>(GetUploadCommandListForEncoding());
+    transfer_command_list.RetainResource(*this);
+
+    // Texture does not allocate upload buffers in this case, data is written to the region of shared staging buffer
+    const id<MTLBuffer>& mtl_staging_buffer = static_cast<const Buffer&>(staging_buffer).GetNativeBuffer();
+    META_CHECK_ARG_NOT_NULL(mtl_staging_buffer);
+
+    Data::Size sub_resource_offset = staging_offset;
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        sub_resource_offset = AlignStagingDataOffset(sub_resource_offset);
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(),
+                  static_cast<Data::RawPtr>([mtl_staging_buffer contents]) + sub_resource_offset);
+#ifdef APPLE_MACOS
+        if (mtl_staging_buffer.storageMode == MTLStorageModeManaged)
+            [mtl_staging_buffer didModifyRange:NSMakeRange(sub_resource_offset, sub_resource.GetDataSize())];
+#endif
+
+        CopySubResourceFromBuffer(sub_resource, mtl_staging_buffer, sub_resource_offset, transfer_command_list);
+        sub_resource_offset += sub_resource.GetDataSize();
+    }
+
+    GetBaseContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+}
+
+void Texture::CopySubResourceFromBuffer(const SubResource& sub_resource, const id<MTLBuffer>& mtl_buffer, Data::Size buffer_offset,
+                                        TransferCommandList& transfer_command_list)
+{
+    META_FUNCTION_TASK();
+    const id<MTLBlitCommandEncoder>& mtl_blit_encoder = transfer_command_list.GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_blit_encoder);
+
+    // Bytes per row of block-compressed formats are calculated for the row of pixel blocks
+    const Settings&  settings        = GetSettings();
+    const uint32_t   mip_level       = sub_resource.GetIndex().GetMipLevel();
+    const Dimensions mip_dimensions(GetMipLevelSize(settings.dimensions.GetWidth(), mip_level),
+                                    GetMipLevelSize(settings.dimensions.GetHeight(), mip_level),
+                                    settings.dimension_type == Rhi::TextureDimensionType::Tex3D
+                                        ? GetMipLevelSize(settings.dimensions.GetDepth(), mip_level)
+                                        : settings.dimensions.GetDepth());
+    const auto       bytes_per_row   = static_cast<uint32_t>(GetRowPitch(settings.pixel_format, mip_dimensions.GetWidth()));
+    auto             bytes_per_image = static_cast<uint32_t>(GetSlicePitch(settings.pixel_format, mip_dimensions.GetWidth(), mip_dimensions.GetHeight()));
+    MTLRegion        texture_region  = GetTextureRegion(mip_dimensions, settings.dimension_type);
+
+    if (sub_resource.HasDataRange())
+    {
+        // Sliced sub-resource data is copied to the range of block rows selected by its data range
+        const Data::Range<Data::Index> block_rows = GetSubResourceBlockRows(sub_resource);
+        const uint32_t block_height = GetPixelFormatBlock(settings.pixel_format).height;
+        const uint32_t begin_y      = block_rows.GetStart() * block_height;
+        const uint32_t end_y        = std::min(block_rows.GetEnd() * block_height, mip_dimensions.GetHeight());
+        texture_region.origin.y    = begin_y;
+        texture_region.size.height = end_y - begin_y;
+        bytes_per_image            = bytes_per_row * static_cast<uint32_t>(block_rows.GetLength());
+    }
+
+    uint32_t slice = 0;
+    switch(settings.dimension_type)
+    {
+        case Rhi::TextureDimensionType::Tex1DArray:
+        case Rhi::TextureDimensionType::Tex2DArray:
+            slice = sub_resource.GetIndex().GetArrayIndex();
+            break;
+        case Rhi::TextureDimensionType::Cube:
+            slice = sub_resource.GetIndex().GetDepthSlice();
+            break;
+        case Rhi::TextureDimensionType::CubeArray:
+            slice = sub_resource.GetIndex().GetDepthSlice() + sub_resource.GetIndex().GetArrayIndex() * 6;
+            break;
+        default:
+            slice = 0;
+    }
+
+    [mtl_blit_encoder copyFromBuffer:mtl_buffer
+                        sourceOffset:buffer_offset
+                   sourceBytesPerRow:bytes_per_row
+                 sourceBytesPerImage:bytes_per_image
+                          sourceSize:texture_region.size
+                           toTexture:m_mtl_texture
+                    destinationSlice:slice
+                    destinationLevel:mip_level
+                   destinationOrigin:texture_region.origin];
+}
+
 void Texture::UpdateFrameBuffer()
 {
     META_FUNCTION_TASK();
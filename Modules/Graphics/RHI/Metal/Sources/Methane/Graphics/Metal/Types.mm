@@ -53,6 +53,7 @@ MTLPixelFormat TypeConverter::DataFormatToMetalPixelType(PixelFormat data_format
     case PixelFormat::RGBA8Unorm_sRGB:  return MTLPixelFormatRGBA8Unorm_sRGB;
     case PixelFormat::BGRA8Unorm:       return MTLPixelFormatBGRA8Unorm;
     case PixelFormat::BGRA8Unorm_sRGB:  return MTLPixelFormatBGRA8Unorm_sRGB;
+    case PixelFormat::RGBA16Float:      return MTLPixelFormatRGBA16Float;
     case PixelFormat::R32Float:         return MTLPixelFormatR32Float;
     case PixelFormat::R32Uint:          return MTLPixelFormatR32Uint;
     case PixelFormat::R32Sint:          return MTLPixelFormatR32Sint;
@@ -61,12 +62,32 @@ MTLPixelFormat TypeConverter::DataFormatToMetalPixelType(PixelFormat data_format
     case PixelFormat::R16Sint:          return MTLPixelFormatR16Sint;
     case PixelFormat::R16Unorm:         return MTLPixelFormatR16Unorm;
     case PixelFormat::R16Snorm:         return MTLPixelFormatR16Snorm;
+    case PixelFormat::RG16Unorm:        return MTLPixelFormatRG16Unorm;
+    case PixelFormat::RG16Snorm:        return MTLPixelFormatRG16Snorm;
     case PixelFormat::R8Uint:           return MTLPixelFormatR8Uint;
     case PixelFormat::R8Sint:           return MTLPixelFormatR8Sint;
     case PixelFormat::R8Unorm:          return MTLPixelFormatR8Unorm;
     case PixelFormat::R8Snorm:          return MTLPixelFormatR8Snorm;
     case PixelFormat::A8Unorm:          return MTLPixelFormatA8Unorm;
     case PixelFormat::Depth32Float:     return MTLPixelFormatDepth32Float;
+#ifdef APPLE_MACOS
+    case PixelFormat::BC1Unorm:         return MTLPixelFormatBC1_RGBA;
+    case PixelFormat::BC1Unorm_sRGB:    return MTLPixelFormatBC1_RGBA_sRGB;
+    case PixelFormat::BC3Unorm:         return MTLPixelFormatBC3_RGBA;
+    case PixelFormat::BC3Unorm_sRGB:    return MTLPixelFormatBC3_RGBA_sRGB;
+    case PixelFormat::BC4Unorm:         return MTLPixelFormatBC4_RUnorm;
+    case PixelFormat::BC4Snorm:         return MTLPixelFormatBC4_RSnorm;
+    case PixelFormat::BC5Unorm:         return MTLPixelFormatBC5_RGUnorm;
+    case PixelFormat::BC5Snorm:         return MTLPixelFormatBC5_RGSnorm;
+    case PixelFormat::BC7Unorm:         return MTLPixelFormatBC7_RGBAUnorm;
+    case PixelFormat::BC7Unorm_sRGB:    return MTLPixelFormatBC7_RGBAUnorm_sRGB;
+#endif
+    case PixelFormat::ASTC4x4Unorm:     return MTLPixelFormatASTC_4x4_LDR;
+    case PixelFormat::ASTC4x4Unorm_sRGB: return MTLPixelFormatASTC_4x4_sRGB;
+    case PixelFormat::ASTC6x6Unorm:     return MTLPixelFormatASTC_6x6_LDR;
+    case PixelFormat::ASTC6x6Unorm_sRGB: return MTLPixelFormatASTC_6x6_sRGB;
+    case PixelFormat::ASTC8x8Unorm:     return MTLPixelFormatASTC_8x8_LDR;
+    case PixelFormat::ASTC8x8Unorm_sRGB: return MTLPixelFormatASTC_8x8_sRGB;
     // MTLPixelFormatRG8Unorm;
     // MTLPixelFormatRG8Snorm;
     // MTLPixelFormatRG8Uint;
@@ -170,6 +191,23 @@ MTLVertexFormat TypeConverter::MetalDataTypeToVertexFormat(MTLDataType data_type
     }
 }
 
+MTLVertexFormat TypeConverter::DataFormatToMetalVertexFormat(PixelFormat data_format)
+{
+    META_FUNCTION_TASK();
+
+    switch(data_format)
+    {
+        case PixelFormat::R32Float:     return MTLVertexFormatFloat;
+        case PixelFormat::R32Uint:      return MTLVertexFormatUInt;
+        case PixelFormat::R32Sint:      return MTLVertexFormatInt;
+        case PixelFormat::RGBA16Float:  return MTLVertexFormatHalf4;
+        case PixelFormat::RG16Unorm:    return MTLVertexFormatUShort2Normalized;
+        case PixelFormat::RG16Snorm:    return MTLVertexFormatShort2Normalized;
+        case PixelFormat::RGBA8Unorm:   return MTLVertexFormatUChar4Normalized;
+        default:                        META_UNEXPECTED_ARG_RETURN(data_format, MTLVertexFormatInvalid);
+    }
+}
+
 uint32_t TypeConverter::ByteSizeOfVertexFormat(MTLVertexFormat vertex_format)
 {
     META_FUNCTION_TASK();
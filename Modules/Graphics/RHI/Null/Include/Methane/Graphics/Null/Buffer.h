@@ -35,6 +35,17 @@ class Buffer final // NOSONAR - inheritance hierarchy is greater than 5
 {
 public:
     Buffer(const Base::Context& context, const Settings& settings);
+
+    // IResource interface
+    void SetData(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue) override;
+    [[nodiscard]] SubResource GetData(const SubResource::Index& sub_resource_index = SubResource::Index(),
+                                      const std::optional<BytesRange>& data_range = {}) override;
+
+    // Buffer data is kept in CPU memory to simulate GPU reading of buffer content, like indirect draw arguments
+    [[nodiscard]] const Data::Bytes& GetNativeData() const noexcept { return m_data; }
+
+private:
+    Data::Bytes m_data;
 };
 
 } // namespace Methane::Graphics::Null
@@ -23,6 +23,8 @@ Null base template implementation of the command list interface.
 
 #pragma once
 
+#include "ProgramBindings.h"
+
 #include <Methane/Graphics/Base/CommandList.h>
 
 namespace Methane::Graphics::Null
@@ -39,6 +41,13 @@ public:
     {
         CommandListBaseT::VerifyEncodingState();
     }
+
+protected:
+    void ApplyProgramBindings(Base::ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) final
+    {
+        // Optimization to skip virtual call of Apply method of the Base::ProgramBinding implementation
+        static_cast<ProgramBindings&>(program_bindings).Apply(*this, apply_behavior);
+    }
 };
 
 } // namespace Methane::Graphics::Null
@@ -27,6 +27,9 @@ Null implementation of the command queue interface.
 
 #include <Methane/Graphics/Base/CommandQueue.h>
 
+#include <chrono>
+#include <mutex>
+
 namespace Methane::Graphics::Null
 {
 
@@ -36,6 +39,9 @@ class CommandQueue final
     : public Base::CommandQueue
 {
 public:
+    using Clock     = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
     using Base::CommandQueue::CommandQueue;
 
     // ICommandQueue interface
@@ -43,12 +49,26 @@ public:
     [[nodiscard]] Ptr<Rhi::ITransferCommandList>       CreateTransferCommandList() override;
     [[nodiscard]] Ptr<Rhi::IRenderCommandList>         CreateRenderCommandList(Rhi::IRenderPass& render_pass) override;
     [[nodiscard]] Ptr<Rhi::IParallelRenderCommandList> CreateParallelRenderCommandList(Rhi::IRenderPass& render_pass) override;
+    [[nodiscard]] Ptr<Rhi::IComputeCommandList>        CreateComputeCommandList() override;
     [[nodiscard]] Ptr<Rhi::ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t max_timestamps_per_frame) override;
     uint32_t                  GetFamilyIndex() const noexcept override { return 0U; }
     Rhi::ITimestampQueryPool& GetTimestampQueryPool() override         { return m_timestamp_query_pool; }
+    void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
+
+    // Emulated GPU executes command list sets one after another, each during the given duration,
+    // so that fences block CPU until emulated completion to measure CPU and GPU work overlap
+    void SetEmulatedExecutionDuration(std::chrono::microseconds execution_duration);
+    std::chrono::microseconds GetEmulatedExecutionDuration() const;
+    TimePoint GetEmulatedCompletionTime() const;
+
+    // Emulated GPU waits for completion of other command queue, so that next command list sets are executed after it
+    void WaitForEmulatedCompletion(TimePoint completion_time);
 
 private:
-    TimestampQueryPool m_timestamp_query_pool{ *this, 1000U };
+    TimestampQueryPool        m_timestamp_query_pool{ *this, 1000U };
+    mutable std::mutex        m_emulation_mutex;
+    std::chrono::microseconds m_emulated_execution_duration{ 0 };
+    TimePoint                 m_emulated_completion_time;
 };
 
 } // namespace Methane::Graphics::Null
@@ -0,0 +1,59 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/ComputeCommandList.h
+Null implementation of the compute command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandList.hpp"
+
+#include <Methane/Graphics/Base/ComputeCommandList.h>
+
+namespace Methane::Graphics::Null
+{
+
+class CommandQueue;
+
+class ComputeCommandList final // NOSONAR - inheritance hierarchy is greater than 5
+    : public CommandList<Base::ComputeCommandList>
+{
+public:
+    explicit ComputeCommandList(CommandQueue& command_queue);
+
+    // IComputeCommandList interface
+    void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
+    void ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) override;
+    void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset) override;
+
+    // Statistics of non-empty dispatches encoded since command list reset, including dispatches simulated from indirect arguments
+    [[nodiscard]] uint32_t GetDispatchesCount() const noexcept    { return m_dispatches_count; }
+    [[nodiscard]] uint64_t GetThreadGroupsCount() const noexcept  { return m_thread_groups_count; }
+
+private:
+    void ResetDispatchStatistics() noexcept;
+    void AddDispatchStatistics(const Rhi::ThreadGroupsCount& thread_groups_count) noexcept;
+
+    uint32_t m_dispatches_count    = 0U;
+    uint64_t m_thread_groups_count = 0U;
+};
+
+} // namespace Methane::Graphics::Null
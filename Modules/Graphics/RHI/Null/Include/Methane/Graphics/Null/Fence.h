@@ -23,8 +23,13 @@ Null fence implementation.
 
 #pragma once
 
+#include "CommandQueue.h"
+
 #include <Methane/Graphics/Base/Fence.h>
 
+#include <deque>
+#include <utility>
+
 namespace Methane::Graphics::Null
 {
 
@@ -32,7 +37,21 @@ class Fence final
     : public Base::Fence
 {
 public:
-    using Base::Fence::Fence;
+    explicit Fence(CommandQueue& command_queue);
+
+    // IFence overrides
+    void Signal() override;
+    void WaitOnCpu() override;
+    void WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue) override;
+    uint64_t GetCompletedValue() const override;
+
+private:
+    using SignalledValue = std::pair<uint64_t, CommandQueue::TimePoint>;
+
+    CommandQueue&                      m_null_command_queue;
+    CommandQueue::TimePoint            m_signalled_completion_time;
+    mutable std::deque<SignalledValue> m_pending_signalled_values;
+    mutable uint64_t                   m_completed_value = 0U;
 };
 
 } // namespace Methane::Graphics::Null
@@ -32,7 +32,7 @@ class Program final
     : public Base::Program
 {
 public:
-    using Base::Program::Program;
+    Program(const Base::Context& context, const Settings& settings);
 
     // IProgram interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateBindings(const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index) override;
@@ -43,6 +43,9 @@ public:
 
     // Base::ProgramArgumentBinding interface
     [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
+
+    // IArgumentBinding interface
+    bool SetResourceViews(const Rhi::ResourceViews& resource_views) override;
 };
 
 } // namespace Methane::Graphics::Null
@@ -52,6 +52,25 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+
+    // Statistics of non-empty draws encoded since command list reset, including draws simulated from indirect arguments
+    [[nodiscard]] uint32_t GetDrawsCount() const noexcept     { return m_draws_count; }
+    [[nodiscard]] uint32_t GetInstancesCount() const noexcept { return m_instances_count; }
+
+private:
+    void ResetDrawStatistics() noexcept;
+    void AddDrawStatistics(uint32_t instance_count) noexcept;
+
+    template<typename DrawArgumentsType>
+    std::vector<DrawArgumentsType> ReadDrawIndirectArguments(const Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                                             const Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) const;
+
+    uint32_t m_draws_count     = 0U;
+    uint32_t m_instances_count = 0U;
 };
 
 } // namespace Methane::Graphics::Null
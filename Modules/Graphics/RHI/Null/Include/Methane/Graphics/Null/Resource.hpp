@@ -25,6 +25,8 @@ Null implementation of the resource interface.
 
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/Resource.h>
+#include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Instrumentation.h>
 
 #include <type_traits>
 
@@ -56,6 +58,16 @@ public:
 
     void RestoreDescriptorViews(const DescriptorByViewId&) final
     { /* Intentionally unimplemented */ }
+
+protected:
+    // Resource upload is encoded to upload command list to emulate its execution in upload command queue
+    void EncodeResourceUpload()
+    {
+        META_FUNCTION_TASK();
+        auto& upload_cmd_list = dynamic_cast<Base::CommandList&>(Base::Resource::GetUploadCommandListForEncoding());
+        upload_cmd_list.RetainResource(*this);
+        Base::Resource::GetBaseContext().RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
+    }
 };
 
 } // namespace Methane::Graphics::Null
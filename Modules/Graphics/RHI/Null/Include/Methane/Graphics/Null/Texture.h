@@ -38,6 +38,25 @@ class Texture final // NOSONAR - inheritance hierarchy is greater than 5
 public:
     Texture(const Base::Context& context, const Settings& settings);
     Texture(const RenderContext& render_context, const Settings& settings, Data::Index frame_index);
+
+    // IResource overrides
+    void SetData(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue) override;
+
+    // ITexture overrides
+    void SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                               Rhi::IBuffer& staging_buffer, Data::Size staging_offset) override;
+
+    // Statistics of texture data uploads, including uploads of sliced sub-resources
+    [[nodiscard]] uint32_t   GetUploadsCount() const noexcept        { return m_uploads_count; }
+    [[nodiscard]] uint32_t   GetStagedUploadsCount() const noexcept  { return m_staged_uploads_count; }
+    [[nodiscard]] Data::Size GetUploadedDataSize() const noexcept    { return m_uploaded_data_size; }
+
+private:
+    void EncodeSubResourcesUpload(const SubResources& sub_resources);
+
+    uint32_t   m_uploads_count        = 0U;
+    uint32_t   m_staged_uploads_count = 0U;
+    Data::Size m_uploaded_data_size   = 0U;
 };
 
 } // namespace Methane::Graphics::Null
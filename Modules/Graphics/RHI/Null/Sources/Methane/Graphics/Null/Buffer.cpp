@@ -23,6 +23,10 @@ Null implementation of the buffer interface.
 
 #include <Methane/Graphics/Null/Buffer.h>
 
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
 #include <iterator>
 
 namespace Methane::Graphics::Null
@@ -30,7 +34,37 @@ namespace Methane::Graphics::Null
 
 Buffer::Buffer(const Base::Context& context, const Settings& settings)
     : Resource(context, settings)
+    , m_data(settings.size, std::byte{})
+{
+}
+
+void Buffer::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    Resource::SetData(sub_resources, target_cmd_queue);
+
+    // Sub-resource data is written from the beginning of buffer, the same way as in other graphics backends
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), m_data.begin());
+    }
+
+    // Private buffer data is uploaded to GPU with upload command list, like in other graphics backends
+    if (GetSettings().storage_mode == IBuffer::StorageMode::Private)
+    {
+        EncodeResourceUpload();
+    }
+}
+
+Rhi::SubResource Buffer::GetData(const SubResource::Index& sub_resource_index, const std::optional<BytesRange>& data_range)
 {
+    META_FUNCTION_TASK();
+    const Data::Index data_start  = data_range ? data_range->GetStart() : 0U;
+    const Data::Index data_length = data_range ? data_range->GetLength() : static_cast<Data::Size>(m_data.size());
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(data_start + data_length, m_data.size(), "data range is out of buffer bounds");
+
+    const auto data_begin_it = m_data.begin() + data_start;
+    return SubResource(Data::Bytes(data_begin_it, data_begin_it + data_length), sub_resource_index, data_range);
 }
 
 } // namespace Methane::Graphics::Null
@@ -26,8 +26,12 @@ Null implementation of the command queue interface.
 #include <Methane/Graphics/Null/TransferCommandList.h>
 #include <Methane/Graphics/Null/RenderCommandList.h>
 #include <Methane/Graphics/Null/ParallelRenderCommandList.h>
+#include <Methane/Graphics/Null/ComputeCommandList.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
 #include <Methane/Graphics/Base/Context.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Null
 {
 
@@ -55,10 +59,59 @@ Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandLi
     return std::make_shared<ParallelRenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass));
 }
 
+Ptr<Rhi::IComputeCommandList> CommandQueue::CreateComputeCommandList()
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeCommandList>(*this);
+}
+
 Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t)
 {
     META_FUNCTION_TASK();
     return nullptr;
 }
 
+void CommandQueue::Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback)
+{
+    META_FUNCTION_TASK();
+    Base::CommandQueue::Execute(command_lists, completed_callback);
+
+    {
+        std::scoped_lock lock(m_emulation_mutex);
+        m_emulated_completion_time = std::max(m_emulated_completion_time, Clock::now()) + m_emulated_execution_duration;
+    }
+
+    // Command lists are completed right away to be reset for the next frame encoding,
+    // while GPU execution time is emulated with fences waiting for completion time
+    static_cast<CommandListSet&>(command_lists).Complete();
+}
+
+void CommandQueue::SetEmulatedExecutionDuration(std::chrono::microseconds execution_duration)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_emulation_mutex);
+    m_emulated_execution_duration = execution_duration;
+}
+
+std::chrono::microseconds CommandQueue::GetEmulatedExecutionDuration() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_emulation_mutex);
+    return m_emulated_execution_duration;
+}
+
+CommandQueue::TimePoint CommandQueue::GetEmulatedCompletionTime() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_emulation_mutex);
+    return m_emulated_completion_time;
+}
+
+void CommandQueue::WaitForEmulatedCompletion(TimePoint completion_time)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_emulation_mutex);
+    m_emulated_completion_time = std::max(m_emulated_completion_time, completion_time);
+}
+
 } // namespace Methane::Graphics::Null
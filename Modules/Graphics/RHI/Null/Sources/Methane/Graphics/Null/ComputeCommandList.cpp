@@ -0,0 +1,96 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/ComputeCommandList.cpp
+Null implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Null/ComputeCommandList.h>
+#include <Methane/Graphics/Null/CommandQueue.h>
+#include <Methane/Graphics/Null/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <cstring>
+
+namespace Methane::Graphics::Null
+{
+
+ComputeCommandList::ComputeCommandList(CommandQueue& command_queue)
+    : CommandList(command_queue)
+{ }
+
+void ComputeCommandList::Reset(IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    CommandList::ResetCommandState();
+    CommandList::Reset(debug_group_ptr);
+    ResetDispatchStatistics();
+}
+
+void ComputeCommandList::ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    CommandList::ResetCommandState();
+    CommandList::Reset(debug_group_ptr);
+    CommandList::SetComputeState(compute_state);
+    ResetDispatchStatistics();
+}
+
+void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::Dispatch(thread_groups_count);
+    AddDispatchStatistics(thread_groups_count);
+}
+
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(arguments_buffer, arguments_offset);
+
+    // Simulate GPU execution of indirect dispatch by reading thread groups count from arguments buffer
+    const Data::Bytes& arguments_data = static_cast<const Buffer&>(arguments_buffer).GetNativeData();
+    META_CHECK_ARG_LESS_OR_EQUAL(arguments_offset + sizeof(Rhi::DispatchIndirectArguments), arguments_data.size());
+
+    Rhi::DispatchIndirectArguments dispatch_args;
+    std::memcpy(&dispatch_args, arguments_data.data() + arguments_offset, sizeof(Rhi::DispatchIndirectArguments));
+
+    const Rhi::ThreadGroupsCount thread_groups_count(dispatch_args.thread_groups_count_x,
+                                                     dispatch_args.thread_groups_count_y,
+                                                     dispatch_args.thread_groups_count_z);
+    if (thread_groups_count)
+        AddDispatchStatistics(thread_groups_count);
+}
+
+void ComputeCommandList::ResetDispatchStatistics() noexcept
+{
+    m_dispatches_count    = 0U;
+    m_thread_groups_count = 0U;
+}
+
+void ComputeCommandList::AddDispatchStatistics(const Rhi::ThreadGroupsCount& thread_groups_count) noexcept
+{
+    m_dispatches_count++;
+    m_thread_groups_count += static_cast<uint64_t>(thread_groups_count.GetWidth()) *
+                             thread_groups_count.GetHeight() * thread_groups_count.GetDepth();
+}
+
+} // namespace Methane::Graphics::Null
@@ -0,0 +1,73 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Null/Fence.cpp
+Null fence implementation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Null/Fence.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <thread>
+
+namespace Methane::Graphics::Null
+{
+
+Fence::Fence(CommandQueue& command_queue)
+    : Base::Fence(command_queue)
+    , m_null_command_queue(command_queue)
+{ }
+
+void Fence::Signal()
+{
+    META_FUNCTION_TASK();
+    Base::Fence::Signal();
+    m_signalled_completion_time = m_null_command_queue.GetEmulatedCompletionTime();
+    m_pending_signalled_values.emplace_back(GetValue(), m_signalled_completion_time);
+}
+
+void Fence::WaitOnCpu()
+{
+    META_FUNCTION_TASK();
+    Base::Fence::WaitOnCpu();
+    std::this_thread::sleep_until(m_signalled_completion_time);
+}
+
+void Fence::WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue)
+{
+    META_FUNCTION_TASK();
+    Base::Fence::WaitOnGpu(wait_on_command_queue);
+    static_cast<CommandQueue&>(wait_on_command_queue).WaitForEmulatedCompletion(m_signalled_completion_time);
+}
+
+uint64_t Fence::GetCompletedValue() const
+{
+    META_FUNCTION_TASK();
+    // Fence value is reached by emulated GPU when command lists executed before the fence signal are completed
+    const CommandQueue::TimePoint current_time = CommandQueue::Clock::now();
+    while(!m_pending_signalled_values.empty() && m_pending_signalled_values.front().second <= current_time)
+    {
+        m_completed_value = m_pending_signalled_values.front().first;
+        m_pending_signalled_values.pop_front();
+    }
+    return m_completed_value;
+}
+
+} // namespace Methane::Graphics::Null
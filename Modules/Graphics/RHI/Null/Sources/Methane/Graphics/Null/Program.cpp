@@ -28,8 +28,16 @@ Null implementation of the program interface.
 namespace Methane::Graphics::Null
 {
 
+Program::Program(const Base::Context& context, const Settings& settings)
+    : Base::Program(context, settings)
+{
+    META_FUNCTION_TASK();
+    InitArgumentBindings(settings.argument_accessors);
+}
+
 Ptr<Rhi::IProgramBindings> Program::CreateBindings(const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index)
 {
+    META_FUNCTION_TASK();
     return std::make_shared<ProgramBindings>(*this, resource_views_by_argument, frame_index);
 }
 
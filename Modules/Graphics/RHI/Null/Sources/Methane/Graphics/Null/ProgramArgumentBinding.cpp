@@ -33,4 +33,17 @@ Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
     return std::make_shared<ProgramArgumentBinding>(*this);
 }
 
+// IArgumentBinding interface
+bool ProgramArgumentBinding::SetResourceViews(const Rhi::ResourceViews& resource_views)
+{
+    META_FUNCTION_TASK();
+    // Null shader has no byte-code to reflect argument resource type,
+    // so it is taken from the resource bound to the argument
+    if (!resource_views.empty())
+    {
+        SetResourceType(resource_views.front().GetResource().GetResourceType());
+    }
+    return Base::ProgramArgumentBinding::SetResourceViews(resource_views);
+}
+
 } // namespace Methane::Graphics::Null
@@ -29,6 +29,9 @@ Null implementation of the render command list interface.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace Methane::Graphics::Base
 {
 
@@ -60,6 +63,7 @@ void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
     META_FUNCTION_TASK();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    ResetDrawStatistics();
 }
 
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
@@ -68,6 +72,7 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
     CommandList::SetRenderState(render_state);
+    ResetDrawStatistics();
 }
 
 bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
@@ -99,6 +104,7 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    AddDrawStatistics(instance_count);
 }
 
 void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
@@ -106,6 +112,82 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 {
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    AddDrawStatistics(instance_count);
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+
+    // Simulate GPU execution of indirect draws by validating and counting each non-empty draw from arguments buffer
+    const auto draw_arguments = ReadDrawIndirectArguments<Rhi::DrawIndexedIndirectArguments>(arguments_buffer, arguments_offset, max_draw_count,
+                                                                                             draw_count_buffer_ptr, draw_count_offset);
+    for(const Rhi::DrawIndexedIndirectArguments& draw_args : draw_arguments)
+    {
+        if (!draw_args.index_count || !draw_args.instance_count)
+            continue;
+
+        META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(draw_args.base_vertex, 0, "negative base vertex is not supported by Null indirect draw simulation");
+        Base::RenderCommandList::DrawIndexed(primitive, draw_args.index_count, draw_args.start_index, static_cast<uint32_t>(draw_args.base_vertex),
+                                             draw_args.instance_count, draw_args.start_instance);
+        AddDrawStatistics(draw_args.instance_count);
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+
+    // Simulate GPU execution of indirect draws by validating and counting each non-empty draw from arguments buffer
+    const auto draw_arguments = ReadDrawIndirectArguments<Rhi::DrawIndirectArguments>(arguments_buffer, arguments_offset, max_draw_count,
+                                                                                      draw_count_buffer_ptr, draw_count_offset);
+    for(const Rhi::DrawIndirectArguments& draw_args : draw_arguments)
+    {
+        if (!draw_args.vertex_count || !draw_args.instance_count)
+            continue;
+
+        Base::RenderCommandList::Draw(primitive, draw_args.vertex_count, draw_args.start_vertex,
+                                      draw_args.instance_count, draw_args.start_instance);
+        AddDrawStatistics(draw_args.instance_count);
+    }
+}
+
+void RenderCommandList::ResetDrawStatistics() noexcept
+{
+    m_draws_count     = 0U;
+    m_instances_count = 0U;
+}
+
+void RenderCommandList::AddDrawStatistics(uint32_t instance_count) noexcept
+{
+    m_draws_count++;
+    m_instances_count += instance_count;
+}
+
+template<typename DrawArgumentsType>
+std::vector<DrawArgumentsType> RenderCommandList::ReadDrawIndirectArguments(const Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                                                            const Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) const
+{
+    META_FUNCTION_TASK();
+    uint32_t draw_count = max_draw_count;
+    if (draw_count_buffer_ptr)
+    {
+        const Data::Bytes& draw_count_data = static_cast<const Buffer&>(*draw_count_buffer_ptr).GetNativeData();
+        META_CHECK_ARG_LESS_OR_EQUAL(draw_count_offset + sizeof(uint32_t), draw_count_data.size());
+        std::memcpy(&draw_count, draw_count_data.data() + draw_count_offset, sizeof(uint32_t));
+        draw_count = std::min(draw_count, max_draw_count);
+    }
+
+    const Data::Bytes& arguments_data = static_cast<const Buffer&>(arguments_buffer).GetNativeData();
+    META_CHECK_ARG_LESS_OR_EQUAL(arguments_offset + sizeof(DrawArgumentsType) * draw_count, arguments_data.size());
+
+    std::vector<DrawArgumentsType> draw_arguments(draw_count);
+    std::memcpy(draw_arguments.data(), arguments_data.data() + arguments_offset, sizeof(DrawArgumentsType) * draw_count);
+    return draw_arguments;
 }
 
 } // namespace Methane::Graphics::Null
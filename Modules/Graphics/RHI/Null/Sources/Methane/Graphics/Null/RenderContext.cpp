@@ -27,6 +27,7 @@ Null implementation of the render context interface.
 #include <Methane/Graphics/Null/Program.h>
 #include <Methane/Graphics/Null/RenderPass.h>
 #include <Methane/Graphics/Null/RenderState.h>
+#include <Methane/Graphics/Null/ComputeState.h>
 #include <Methane/Graphics/Null/RenderPattern.h>
 #include <Methane/Graphics/Null/Buffer.h>
 #include <Methane/Graphics/Null/Texture.h>
@@ -90,6 +91,12 @@ Ptr<Rhi::ISampler> RenderContext::CreateSampler(const Rhi::SamplerSettings& sett
     return std::make_shared<Sampler>(*this, settings);
 }
 
+Ptr<Rhi::IComputeState> RenderContext::CreateComputeState(const Rhi::ComputeStateSettings& settings) const
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeState>(*this, settings);
+}
+
 Ptr<Rhi::IRenderState> RenderContext::CreateRenderState(const Rhi::RenderStateSettings& settings) const
 {
     META_FUNCTION_TASK();
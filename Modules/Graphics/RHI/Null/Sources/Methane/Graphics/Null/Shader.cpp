@@ -22,15 +22,30 @@ Null implementation of the shader interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Null/Shader.h>
+#include <Methane/Graphics/Null/ProgramArgumentBinding.h>
 
 #include <Methane/Graphics/Base/Context.h>
 
 namespace Methane::Graphics::Null
 {
 
-Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::ProgramArgumentAccessors&) const
+// Null shader has no byte-code to reflect, so argument bindings are emulated
+// for all explicitly declared argument accessors of this shader type.
+// Resource type of the argument is unknown here, it is taken from the bound resource in Null::ProgramArgumentBinding
+Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::ProgramArgumentAccessors& argument_accessors) const
 {
-    return {};
+    META_FUNCTION_TASK();
+    Ptrs<Base::ProgramArgumentBinding> argument_bindings;
+    for(const Rhi::ProgramArgumentAccessor& argument_accessor : argument_accessors)
+    {
+        if (argument_accessor.GetShaderType() != Rhi::ShaderType::All &&
+            argument_accessor.GetShaderType() != GetType())
+            continue;
+
+        argument_bindings.emplace_back(std::make_shared<ProgramArgumentBinding>(GetContext(),
+            Rhi::ProgramArgumentBindingSettings{ argument_accessor, Rhi::IResource::Type::Buffer, 1U }));
+    }
+    return argument_bindings;
 }
 
 } // namespace Methane::Graphics::Null
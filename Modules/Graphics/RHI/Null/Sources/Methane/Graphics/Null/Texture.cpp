@@ -42,4 +42,36 @@ Texture::Texture(const RenderContext& render_context, const Settings& settings,
     META_CHECK_ARG_EQUAL(frame_index, settings.frame_index_opt.value());
 }
 
+void Texture::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(GetSettings().type, Rhi::TextureType::Image, "only image textures support data upload from CPU");
+
+    Resource::SetData(sub_resources, target_cmd_queue);
+    EncodeSubResourcesUpload(sub_resources);
+}
+
+void Texture::SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                                    Rhi::IBuffer& staging_buffer, Data::Size staging_offset)
+{
+    META_FUNCTION_TASK();
+    Resource::SetDataThroughStaging(sub_resources, target_cmd_queue, staging_buffer, staging_offset);
+    EncodeSubResourcesUpload(sub_resources);
+    m_staged_uploads_count++;
+}
+
+void Texture::EncodeSubResourcesUpload(const SubResources& sub_resources)
+{
+    META_FUNCTION_TASK();
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        ValidateSubResource(sub_resource);
+        // Sliced sub-resource data range is validated to select whole rows of pixel blocks, like in native backends
+        META_UNUSED(GetSubResourceBlockRows(sub_resource));
+        m_uploaded_data_size += sub_resource.GetDataSize();
+    }
+    m_uploads_count++;
+    EncodeResourceUpload();
+}
+
 } // namespace Methane::Graphics::Null
@@ -24,6 +24,7 @@ Vulkan implementation of the buffer interface.
 #pragma once
 
 #include "Resource.hpp"
+#include "UploadHeap.h"
 
 #include <Methane/Graphics/Base/Buffer.h>
 #include <Methane/Graphics/Types.h>
@@ -45,14 +46,24 @@ public:
     // IObject interface
     bool SetName(std::string_view name) override;
 
+    // Buffer placed in upload heap is bound with dynamic offset of its region for the current frame
+    [[nodiscard]] bool           HasFrameRegions() const noexcept { return static_cast<bool>(m_upload_heap_regions_ptr); }
+    [[nodiscard]] vk::DeviceSize GetCurrentFrameRegionOffset() const;
+
 protected:
     // Resource override
     Ptr<ResourceView::ViewDescriptorVariant> CreateNativeViewDescriptor(const View::Id& view_id) override;
 
 private:
-    vk::UniqueBuffer            m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory      m_vk_unique_staging_memory;
-    std::vector<vk::BufferCopy> m_vk_copy_regions;
+    Buffer(const Base::Context& context, const Settings& settings, uint32_t frame_regions_count);
+
+    void SetDataToUploadHeap(const SubResources& sub_resources);
+    bool IsCopyRegionRecorded(const vk::BufferCopy& vk_copy_region) const;
+
+    Ptr<UploadHeap::FrameRegions> m_upload_heap_regions_ptr;
+    vk::UniqueBuffer              m_vk_unique_staging_buffer;
+    vk::UniqueDeviceMemory        m_vk_unique_staging_memory;
+    std::vector<vk::BufferCopy>   m_vk_copy_regions; // copy regions recorded in the upload batch of the buffer
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -273,6 +273,30 @@ protected:
         m_vk_command_buffer_encoding_flags[cmd_buffer_index] = false;
     }
 
+    // Ends encoding of the secondary command buffer and continues encoding with the next command buffer begun with the same info,
+    // which is taken from the given free command buffer or allocated from the command list pool; ended command buffer is returned
+    vk::UniqueCommandBuffer ContinueCommandBuffer(CommandBufferType cmd_buffer_type, vk::UniqueCommandBuffer&& vk_unique_free_command_buffer)
+    {
+        META_FUNCTION_TASK();
+        const auto cmd_buffer_index = static_cast<uint32_t>(cmd_buffer_type);
+        META_CHECK_ARG_FALSE_DESCR(m_vk_command_buffer_primary_flags[cmd_buffer_index],
+                                   "encoding of primary command buffer can not be continued in the next command buffer");
+        CommitCommandBuffer(cmd_buffer_type);
+
+        vk::UniqueCommandBuffer vk_unique_next_command_buffer = std::move(vk_unique_free_command_buffer);
+        if (!vk_unique_next_command_buffer)
+        {
+            vk_unique_next_command_buffer = std::move(m_vk_device.allocateCommandBuffersUnique(
+                vk::CommandBufferAllocateInfo(m_vk_unique_command_pool.get(), vk::CommandBufferLevel::eSecondary, 1U)
+            ).back());
+        }
+
+        vk_unique_next_command_buffer.get().begin(GetCommandBufferBeginInfo(cmd_buffer_type));
+        m_vk_command_buffer_encoding_flags[cmd_buffer_index] = true;
+        std::swap(m_vk_unique_command_buffers[cmd_buffer_index], vk_unique_next_command_buffer);
+        return vk_unique_next_command_buffer;
+    }
+
     void ApplyProgramBindings(Base::ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) final
     {
         // Optimization to skip dynamic_cast required to call Apply method of the Base::ProgramBinding implementation
@@ -295,6 +319,8 @@ protected:
     }
 
 private:
+    // Every command list owns its command pool, which makes per-thread command lists of parallel render command list
+    // safe to reset and encode from different threads, since Vulkan requires external synchronization of pool access
     vk::UniqueCommandPool CreateVulkanCommandPool(uint32_t queue_family_index)
     {
         META_FUNCTION_TASK();
@@ -27,6 +27,7 @@ Vulkan template implementation of the base context interface.
 #include "Device.h"
 #include "CommandQueue.h"
 #include "DescriptorManager.h"
+#include "UploadHeap.h"
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
@@ -64,6 +65,9 @@ public:
         ContextBaseT::GetDescriptorManager().Release();
 
         ContextBaseT::Release();
+
+        // Upload heap memory blocks are freed with the last buffer allocated in them
+        m_upload_heap_ptr.reset();
     }
 
     // IContext interface
@@ -84,6 +88,17 @@ public:
     {
         return static_cast<DescriptorManager&>(ContextBaseT::GetDescriptorManager());
     }
+
+    UploadHeap& GetVulkanUploadHeap() const final
+    {
+        META_FUNCTION_TASK();
+        if (!m_upload_heap_ptr)
+            m_upload_heap_ptr = std::make_unique<UploadHeap>(GetVulkanDevice());
+        return *m_upload_heap_ptr;
+    }
+
+private:
+    mutable UniquePtr<UploadHeap> m_upload_heap_ptr;
 };
 
 } // namespace Methane::Graphics::Vulkan
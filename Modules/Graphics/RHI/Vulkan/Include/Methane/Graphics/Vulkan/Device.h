@@ -99,12 +99,16 @@ public:
     const vk::Device&                GetNativeDevice() const noexcept         { return m_vk_unique_device.get(); }
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
 
+    [[nodiscard]] bool IsMultiDrawIndirectSupported() const noexcept { return m_is_multi_draw_indirect_supported; }
+    [[nodiscard]] bool IsDrawIndirectCountSupported() const noexcept { return m_is_draw_indirect_count_supported; }
+
 private:
     using QueueFamilyReservationByType = std::map<Rhi::CommandListType, Ptr<QueueFamilyReservation>>;
 
     void ReserveQueueFamily(Rhi::CommandListType cmd_queue_type, uint32_t queues_count,
                             std::vector<uint32_t>& reserved_queues_count_per_family,
                             const vk::SurfaceKHR& vk_surface = vk::SurfaceKHR());
+    void ShareQueueFamily(Rhi::CommandListType cmd_queue_type, Rhi::CommandListType shared_cmd_queue_type);
 
     bool IsExtensionSupported(const std::vector<std::string_view>& required_extensions) const;
 
@@ -112,6 +116,8 @@ private:
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
+    bool                                   m_is_multi_draw_indirect_supported = false;
+    bool                                   m_is_draw_indirect_count_supported = false;
 };
 
 } // namespace Methane::Graphics::Vulkan
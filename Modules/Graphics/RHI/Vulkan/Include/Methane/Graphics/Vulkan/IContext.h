@@ -31,12 +31,14 @@ namespace Methane::Graphics::Vulkan
 class Device;
 class CommandQueue;
 class DescriptorManager;
+class UploadHeap;
 
 struct IContext
 {
     virtual const Device& GetVulkanDevice() const noexcept = 0;
     virtual CommandQueue& GetVulkanDefaultCommandQueue(Rhi::CommandListType type) = 0;
     virtual DescriptorManager& GetVulkanDescriptorManager() const = 0;
+    virtual UploadHeap& GetVulkanUploadHeap() const = 0;
 
     virtual ~IContext() = default;
 };
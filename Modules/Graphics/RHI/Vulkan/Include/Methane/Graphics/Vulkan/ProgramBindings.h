@@ -30,12 +30,14 @@ Vulkan implementation of the program bindings interface.
 
 #include <vulkan/vulkan.hpp>
 #include <vector>
+#include <utility>
 
 namespace Methane::Graphics::Vulkan
 {
 
 struct ICommandList;
 class Program;
+class Buffer;
 
 class ProgramBindings final
     : public Base::ProgramBindings
@@ -59,11 +61,23 @@ public:
     void Apply(ICommandList& command_list, const Rhi::ICommandQueue& command_queue,
                const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const;
 
+    // Dynamic offsets of buffers with frame regions change every frame, so they can not be baked in native command bundles
+    bool HasFrameRegionBuffers() const noexcept { return !m_frame_region_buffer_by_dynamic_offset_index.empty(); }
+
 private:
+    using FrameRegionBuffers = std::vector<std::pair<uint32_t, const Buffer*>>;
+
     // IObjectCallback interface
     void OnObjectNameChanged(Rhi::IObject&, const std::string&) override; // IProgram name changed
 
+    // Base::ProgramBindings overrides
+    void OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding& argument_binding,
+                                                      const Rhi::IResource::Views& old_resource_views,
+                                                      const Rhi::IResource::Views& new_resource_views) override;
+
     void SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument);
+    void UpdateDynamicOffsets(const IArgumentBinding* changed_argument_binding_ptr = nullptr,
+                              const Rhi::IResource::Views* changed_resource_views_ptr = nullptr);
 
     template<typename FuncType> // function void(const IProgram::Argument&, ArgumentBinding&)
     void ForEachArgumentBinding(FuncType argument_binding_function) const;
@@ -74,6 +88,7 @@ private:
     bool                                m_has_mutable_descriptor_set = false; // if true, then m_descriptor_sets.back() is mutable descriptor set
     std::vector<uint32_t>               m_dynamic_offsets; // dynamic buffer offsets for all descriptor sets from the bound ResourceView::Settings::offset
     std::vector<uint32_t>               m_dynamic_offset_index_by_set_index; // beginning index in dynamic buffer offsets corresponding to the particular descriptor set or access type
+    FrameRegionBuffers                  m_frame_region_buffer_by_dynamic_offset_index; // buffers with frame regions adding offset of the current frame region to dynamic offset
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -0,0 +1,80 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/RenderCommandBundle.h
+Vulkan native bundle of the render command sequence encoded once
+in the secondary command buffer, which is executed inside render pass of command lists.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ICommandList.h"
+
+#include <Methane/Graphics/Base/Object.h>
+#include <Methane/Graphics/Base/RenderCommandSequence.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <vector>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class CommandQueue;
+class ViewState;
+
+class RenderCommandBundle final
+    : public Base::Object
+    , public ICommandList
+{
+public:
+    // Program bindings with frame region buffers have dynamic offsets changing every frame, which can not be baked in bundle
+    [[nodiscard]] static bool IsSupported(const Base::RenderCommandSequence& command_sequence);
+
+    // Secondary command buffer does not inherit any state, so pipeline and viewports set in command list
+    // before sequence replay are encoded in bundle along with recorded commands
+    RenderCommandBundle(Base::RenderCommandSequence& command_sequence, CommandQueue& command_queue,
+                        const Ptr<Base::RenderState>& inherited_render_state_ptr, const ViewState* inherited_view_state_ptr);
+
+    [[nodiscard]] bool IsEncodedFor(const Base::RenderState* inherited_render_state_ptr, const ViewState* inherited_view_state_ptr) const;
+
+    // ICommandList interface
+    CommandQueue&            GetVulkanCommandQueue() override;
+    const CommandQueue&      GetVulkanCommandQueue() const override;
+    const vk::CommandBuffer& GetNativeCommandBufferDefault() const override { return m_vk_unique_command_buffer.get(); }
+    const vk::CommandBuffer& GetNativeCommandBuffer(CommandBufferType cmd_buffer_type) const override;
+    vk::PipelineBindPoint    GetNativePipelineBindPoint() const override    { return vk::PipelineBindPoint::eGraphics; }
+    void                     SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) override;
+
+private:
+    void EncodeCommands(const Ptr<Base::RenderState>& inherited_render_state_ptr, const ViewState* inherited_view_state_ptr);
+
+    const Ptr<CommandQueue>                     m_command_queue_ptr;
+    const Base::RenderCommandSequence::Commands m_commands; // copied to keep resources alive while bundle is executed
+    const bool                                  m_is_render_state_inherited;
+    Ptr<Base::RenderState>                      m_inherited_render_state_ptr;
+    vk::Pipeline                                m_vk_inherited_pipeline;
+    std::vector<vk::Viewport>                   m_vk_inherited_viewports;
+    std::vector<vk::Rect2D>                     m_vk_inherited_scissor_rects;
+    vk::CommandBufferInheritanceInfo            m_vk_inheritance_info;
+    vk::UniqueCommandPool                       m_vk_unique_command_pool;
+    vk::UniqueCommandBuffer                     m_vk_unique_command_buffer;
+};
+
+} // namespace Methane::Graphics::Vulkan
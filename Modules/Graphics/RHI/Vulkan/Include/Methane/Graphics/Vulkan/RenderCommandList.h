@@ -31,6 +31,8 @@ Vulkan implementation of the render command list interface.
 
 #include <vulkan/vulkan.hpp>
 
+#include <vector>
+
 namespace Methane::Graphics::Vulkan
 {
 
@@ -39,6 +41,9 @@ class Buffer;
 class RenderPass;
 class ParallelRenderCommandList;
 
+vk::PrimitiveTopology GetVulkanPrimitiveTopology(Rhi::RenderPrimitive primitive_type);
+vk::IndexType         GetVulkanIndexTypeByStride(Data::Size index_stride_bytes);
+
 class RenderCommandList final // NOSONAR - inheritance hierarchy is greater than 5
     : public CommandList<Base::RenderCommandList, vk::PipelineBindPoint::eGraphics, 2U, CommandBufferType::SecondaryRenderPass>
     , private Data::Receiver<Rhi::IRenderPassCallback>
@@ -60,14 +65,33 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                             Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                      Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset) override;
+
+    // Render pass command buffers in execution order: encoded segments interleaved with native bundles of command sequences
+    std::vector<vk::CommandBuffer> GetNativeRenderPassCommandBuffers() const;
+
+protected:
+    // Base::RenderCommandList overrides
+    void ExecuteCommandSequence(Base::RenderCommandSequence& command_sequence) override;
 
 private:
     // IRenderPassCallback
     void OnRenderPassUpdated(const Rhi::IRenderPass& render_pass) override;
 
     void UpdatePrimitiveTopology(Primitive primitive);
+    void ExecuteNativeIndirectDraws(bool is_indexed, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset,
+                                    uint32_t max_draw_count, Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset);
+    void SetIndirectBufferState(Rhi::IBuffer& indirect_buffer);
+    void ReleaseRenderPassSegments();
 
     RenderPass& GetVulkanPass();
+
+    std::vector<vk::UniqueCommandBuffer> m_vk_unique_pass_segment_buffers;      // encoded render pass segments ended before native bundles
+    std::vector<vk::UniqueCommandBuffer> m_vk_unique_free_pass_segment_buffers; // segment buffers reused after command list reset
+    std::vector<vk::CommandBuffer>       m_vk_pass_execute_buffers;             // segments and bundles preceding the current segment
 };
 
 } // namespace Methane::Graphics::Vulkan
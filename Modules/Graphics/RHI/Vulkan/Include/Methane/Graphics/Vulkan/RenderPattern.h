@@ -32,7 +32,7 @@ namespace Methane::Graphics::Vulkan
 
 class RenderContext;
 
-class RenderPattern
+class RenderPattern final
     : public Base::RenderPattern
 {
 public:
@@ -210,7 +210,7 @@ protected:
     {
         META_FUNCTION_TASK();
         const Rhi::ICommandKit& upload_cmd_kit = Base::Resource::GetContext().GetUploadCommandKit();
-        auto& upload_cmd_list = dynamic_cast<TransferCommandList&>(upload_cmd_kit.GetListForEncoding());
+        auto& upload_cmd_list = dynamic_cast<TransferCommandList&>(Base::Resource::GetUploadCommandListForEncoding());
         upload_cmd_list.RetainResource(*this);
 
         const bool owner_changed = SetOwnerQueueFamily(upload_cmd_kit.GetQueue().GetFamilyIndex(), m_upload_begin_transition_barriers_ptr);
@@ -246,7 +246,7 @@ protected:
         // If owner queue family has changed, resource barriers have to be also repeated on target command queue
         if (owner_changed && upload_end_barriers_non_empty)
         {
-            constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+            const Rhi::CommandListId post_upload_cmd_list_id = Base::Resource::GetBaseContext().GetPostUploadSyncCommandListId(Base::Resource::GetUploadBatchIndex());
             Rhi::ICommandList& target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
             target_cmd_list.SetResourceBarriers(*m_upload_end_transition_barriers_ptr);
         }
@@ -36,7 +36,7 @@ class CommandQueue;
 class Buffer;
 class Texture;
 
-class ResourceBarriers
+class ResourceBarriers final
     : public Base::ResourceBarriers
     , private Data::Receiver<Rhi::IResourceCallback>
 {
@@ -52,6 +52,10 @@ public:
     // IResource interface
     void SetData(const SubResources& sub_resources, Rhi::ICommandQueue&) override;
 
+    // ITexture interface
+    void SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                               Rhi::IBuffer& staging_buffer, Data::Size staging_offset) override;
+
     // IObject overide
     bool SetName(std::string_view name) override;
 
@@ -65,6 +69,10 @@ private:
     void InitializeAsImage();
     void InitializeAsRenderTarget();
     void InitializeAsDepthStencil();
+    void ReserveStagingBuffer(vk::DeviceSize staging_size);
+    void UploadSubResources(const SubResources& sub_resources, const TransferCommandList& upload_cmd_list,
+                            const vk::Buffer& vk_staging_buffer, const vk::DeviceMemory& vk_staging_memory,
+                            vk::DeviceSize staging_offset);
 
     // Resource override
     Ptr<ResourceView::ViewDescriptorVariant> CreateNativeViewDescriptor(const ResourceView::Id& view_id) override;
@@ -74,6 +82,7 @@ private:
     vk::UniqueImage                  m_vk_unique_image;
     vk::UniqueBuffer                 m_vk_unique_staging_buffer;
     vk::UniqueDeviceMemory           m_vk_unique_staging_memory;
+    vk::DeviceSize                   m_vk_staging_buffer_size = 0U;
     std::vector<vk::BufferImageCopy> m_vk_copy_regions;
 };
 
@@ -0,0 +1,153 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/UploadHeap.h
+Vulkan persistently mapped heap of host-visible memory for small buffers written directly from CPU.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+
+#include <tracy/Tracy.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include <mutex>
+#include <vector>
+#include <limits>
+#include <utility>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+class UploadHeap
+{
+public:
+    // Buffers opted in for direct CPU writes and not larger than this size are placed in heap memory
+    static constexpr vk::DeviceSize s_max_allocation_size = 64U * 1024U;
+    static constexpr vk::DeviceSize s_block_size          = 4U * 1024U * 1024U;
+
+    struct FrameStatistics
+    {
+        Data::Size direct_uploaded_data_size = 0U; // written by CPU directly to frame regions of heap buffers
+        Data::Size staged_uploaded_data_size = 0U; // written to staging buffers and copied on GPU
+        uint32_t   copy_commands_count       = 0U;
+        uint32_t   saved_copy_commands_count = 0U; // direct uploads and staged uploads coalesced with already recorded copy
+        uint32_t   coalesced_writes_count    = 0U; // repeated uploads of the same buffer in one frame
+    };
+
+    class Block;
+
+    struct Allocation
+    {
+        Ptr<Block>       block_ptr;
+        vk::DeviceMemory vk_memory;
+        vk::DeviceSize   offset   = 0U;
+        Data::RawPtr     data_ptr = nullptr;
+
+        explicit operator bool() const noexcept { return static_cast<bool>(block_ptr); }
+    };
+
+    // Buffer memory is split into regions, one per frame: CPU writes data to the region of the current frame,
+    // while GPU may still read other regions in previous frames, which are updated with the latest data in next frames.
+    // Region of the frame is reused after frames in flight count frames, so it is not in use by GPU even before waiting for frame presented
+    class FrameRegions
+    {
+    public:
+        FrameRegions(Allocation&& allocation, vk::DeviceSize region_size, uint32_t regions_count);
+        ~FrameRegions();
+
+        FrameRegions(const FrameRegions&) = delete;
+        FrameRegions(FrameRegions&&) = delete;
+
+        FrameRegions& operator=(const FrameRegions&) = delete;
+        FrameRegions& operator=(FrameRegions&&) = delete;
+
+        [[nodiscard]] static uint32_t GetRegionsCount(uint32_t frames_in_flight_count) noexcept { return frames_in_flight_count + 1U; }
+
+        [[nodiscard]] const Allocation& GetAllocation() const noexcept     { return m_allocation; }
+        [[nodiscard]] uint32_t          GetRegionsCount() const noexcept   { return m_regions_count; }
+        [[nodiscard]] vk::DeviceSize    GetRegionOffset(uint32_t frame_index) const noexcept;
+
+        // Data is written by the given function to the CPU copy of buffer data, which is then copied to the region of the frame
+        template<typename WriteDataFunction> // void(Data::RawPtr data_ptr)
+        void Write(uint32_t frame_index, const WriteDataFunction& write_data)
+        {
+            std::scoped_lock lock_guard(m_mutex);
+            write_data(m_data.data());
+            CommitWrite(frame_index);
+        }
+
+        // Copies the latest data to the region of the frame if it is outdated, returns true when all regions are up to date
+        bool UpdateRegion(uint32_t frame_index);
+
+        // Returns true if the buffer was already written in the heap frame with the given index and remembers it
+        bool SetWriteHeapFrameIndex(uint64_t heap_frame_index) noexcept;
+
+        // Outdated flag is changed by upload heap only to register buffer regions for update once, returns previous flag value
+        bool SetOutdated(bool is_outdated) noexcept { return std::exchange(m_is_outdated, is_outdated); }
+
+    private:
+        void CommitWrite(uint32_t frame_index);
+        void CopyDataToRegion(uint32_t region_index);
+
+        Allocation            m_allocation;
+        const vk::DeviceSize  m_region_size;
+        const uint32_t        m_regions_count;
+        Data::Bytes           m_data;
+        uint64_t              m_data_version = 0U;
+        std::vector<uint64_t> m_region_data_versions;
+        uint64_t              m_write_heap_frame_index = std::numeric_limits<uint64_t>::max();
+        bool                  m_is_outdated = false;
+        TracyLockable(std::mutex, m_mutex);
+    };
+
+    explicit UploadHeap(const Device& device);
+
+    // Returns null pointer when host-visible memory is not suitable for the given requirements
+    [[nodiscard]] Ptr<FrameRegions> AllocateFrameRegions(const vk::MemoryRequirements& memory_requirements,
+                                                         vk::DeviceSize region_size, uint32_t regions_count);
+
+    void AddDirectUpload(const Ptr<FrameRegions>& frame_regions_ptr, Data::Size data_size);
+    void AddStagedUpload(Data::Size data_size, bool is_copy_command_recorded, bool is_coalesced);
+
+    // Heap frame is completed on render context present, then outdated frame regions of written buffers
+    // are updated with the latest data for the next frame with the given index
+    void CompleteFrame(uint32_t next_frame_index);
+
+    [[nodiscard]] uint64_t               GetFrameIndex() const noexcept          { return m_frame_index; }
+    [[nodiscard]] const FrameStatistics& GetLastFrameStatistics() const noexcept { return m_last_frame_statistics; }
+
+private:
+    Allocation    Allocate(const vk::MemoryRequirements& memory_requirements);
+    Opt<uint32_t> FindMemoryType(uint32_t memory_type_bits) const;
+
+    const Device&          m_device;
+    Ptrs<Block>            m_blocks;
+    WeakPtrs<FrameRegions> m_outdated_frame_regions;
+    uint64_t               m_frame_index = 0U;
+    FrameStatistics        m_frame_statistics;
+    FrameStatistics        m_last_frame_statistics;
+    TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
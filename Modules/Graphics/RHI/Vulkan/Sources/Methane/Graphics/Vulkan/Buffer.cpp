@@ -25,9 +25,10 @@ Vulkan implementation of the buffer interface.
 #include <Methane/Graphics/Vulkan/IContext.h>
 
 #include <Methane/Graphics/Types.h>
-#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/RenderContext.h>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
 #include <iterator>
 
 namespace Methane::Graphics::Vulkan
@@ -43,46 +44,106 @@ static vk::BufferUsageFlags GetVulkanBufferUsageFlags(Rhi::BufferType buffer_typ
     case Rhi::BufferType::Constant: vk_usage_flags |= vk::BufferUsageFlagBits::eUniformBuffer; break;
     case Rhi::BufferType::Index:    vk_usage_flags |= vk::BufferUsageFlagBits::eIndexBuffer;   break;
     case Rhi::BufferType::Vertex:   vk_usage_flags |= vk::BufferUsageFlagBits::eVertexBuffer;  break;
+    case Rhi::BufferType::Indirect: vk_usage_flags |= vk::BufferUsageFlagBits::eIndirectBuffer; break;
     // Buffer::Type::ReadBack - unsupported
     default: META_UNEXPECTED_ARG_DESCR(buffer_type, "Unsupported buffer type");
     }
 
+    // Managed buffers can be used as a source of copy operations, like shared staging buffer of texture uploads
     if (storage_mode == Rhi::BufferStorageMode::Private)
         vk_usage_flags |= vk::BufferUsageFlagBits::eTransferDst;
+    else
+        vk_usage_flags |= vk::BufferUsageFlagBits::eTransferSrc;
 
     return vk_usage_flags;
 }
 
-static Rhi::ResourceState GetTargetResourceStateByBufferType(Rhi::BufferType buffer_type)
+static Rhi::ResourceState GetTargetResourceStateByBufferSettings(const Rhi::BufferSettings& buffer_settings)
 {
     META_FUNCTION_TASK();
-    switch(buffer_type)
+    switch(const Rhi::BufferType buffer_type = buffer_settings.type;
+           buffer_type)
     {
-    case Rhi::BufferType::Storage:     return Rhi::ResourceState::ShaderResource;
+    case Rhi::BufferType::Storage:     return buffer_settings.usage_mask.HasAnyBit(Rhi::ResourceUsage::ShaderWrite)
+                                            ? Rhi::ResourceState::UnorderedAccess
+                                            : Rhi::ResourceState::ShaderResource;
     case Rhi::BufferType::Constant:    return Rhi::ResourceState::ConstantBuffer;
     case Rhi::BufferType::Index:       return Rhi::ResourceState::IndexBuffer;
     case Rhi::BufferType::Vertex:      return Rhi::ResourceState::VertexBuffer;
     case Rhi::BufferType::ReadBack:    return Rhi::ResourceState::StreamOut;
+    case Rhi::BufferType::Indirect:    return Rhi::ResourceState::IndirectArgument;
     default: META_UNEXPECTED_ARG_DESCR_RETURN(buffer_type, Rhi::ResourceState::Undefined, "Unsupported buffer type");
     }
 }
 
+// Sub-resource data is written at the beginning of its data range or right after data of the previous sub-resource
+static Data::Size GetSubResourceOffset(const Rhi::SubResource& sub_resource, Data::Size buffer_size, Data::Size& next_sub_resource_offset)
+{
+    META_FUNCTION_TASK();
+    const Data::Size sub_resource_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : next_sub_resource_offset;
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(sub_resource_offset + sub_resource.GetDataSize(), buffer_size,
+                                       "sub-resource {} data is out of buffer bounds", sub_resource.GetIndex());
+    next_sub_resource_offset = sub_resource_offset + sub_resource.GetDataSize();
+    return sub_resource_offset;
+}
+
+// Small private addressable constant buffers of render context opted in for direct CPU writes are placed in upload heap
+// with a separate region for each frame, which is selected with dynamic offset of addressable program argument binding
+static uint32_t GetUploadHeapFrameRegionsCount(const Base::Context& context, const Rhi::BufferSettings& settings)
+{
+    META_FUNCTION_TASK();
+    if (!settings.is_direct_cpu_write ||
+        settings.type != Rhi::BufferType::Constant ||
+        settings.storage_mode != Rhi::BufferStorageMode::Private ||
+        !settings.usage_mask.HasAnyBit(Rhi::ResourceUsage::Addressable) ||
+        settings.size > UploadHeap::s_max_allocation_size ||
+        context.GetType() != Rhi::ContextType::Render)
+        return 0U;
+
+    return UploadHeap::FrameRegions::GetRegionsCount(dynamic_cast<const Base::RenderContext&>(context).GetFramesInFlightCount());
+}
+
+// Region size is aligned to the maximum of dynamic uniform buffer offset alignment required by Vulkan spec
+static vk::DeviceSize GetUploadHeapRegionSize(const Rhi::BufferSettings& settings)
+{
+    return static_cast<vk::DeviceSize>(Rhi::BufferSettings::GetAlignedSize(settings.size));
+}
+
 Buffer::Buffer(const Base::Context& context, const Settings& settings)
+    : Buffer(context, settings, GetUploadHeapFrameRegionsCount(context, settings))
+{ }
+
+Buffer::Buffer(const Base::Context& context, const Settings& settings, uint32_t frame_regions_count)
     : Resource(context, settings,
                  dynamic_cast<const IContext&>(context).GetVulkanDevice().GetNativeDevice().createBufferUnique(
                      vk::BufferCreateInfo(
                          vk::BufferCreateFlags{},
-                         settings.size,
+                         frame_regions_count ? GetUploadHeapRegionSize(settings) * frame_regions_count : settings.size,
                          GetVulkanBufferUsageFlags(settings.type, settings.storage_mode),
                          vk::SharingMode::eExclusive)))
 {
     META_FUNCTION_TASK();
     const bool is_private_storage = settings.storage_mode == Rhi::BufferStorageMode::Private;
+    const vk::MemoryRequirements vk_memory_requirements = GetNativeDevice().getBufferMemoryRequirements(GetNativeResource());
+
+    if (frame_regions_count)
+    {
+        m_upload_heap_regions_ptr = GetVulkanContext().GetVulkanUploadHeap().AllocateFrameRegions(vk_memory_requirements,
+                                                                                                  GetUploadHeapRegionSize(settings),
+                                                                                                  frame_regions_count);
+        if (m_upload_heap_regions_ptr)
+        {
+            const UploadHeap::Allocation& allocation = m_upload_heap_regions_ptr->GetAllocation();
+            GetNativeDevice().bindBufferMemory(GetNativeResource(), allocation.vk_memory, allocation.offset);
+            return;
+        }
+    }
+
     const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
     const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_staging_memory_flags;
 
     // Allocate resource primary memory
-    AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
+    AllocateResourceMemory(vk_memory_requirements, vk_memory_property_flags);
     GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
 
     if (!is_private_storage)
@@ -103,22 +164,33 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 void Buffer::SetData(const Rhi::SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue)
 {
     META_FUNCTION_TASK();
+    // Copy commands of the buffer recorded in upload command list, which is still encoded, read staging buffer on execution,
+    // so repeated updates of the buffer in the same upload batch are coalesced by writing staging data only
+    const bool is_upload_batch_encoded = GetUploadBatchIndex() == GetBaseContext().GetEncodingUploadBatchIndex();
     Resource::SetData(sub_resources, target_cmd_queue);
 
+    if (m_upload_heap_regions_ptr)
+    {
+        SetDataToUploadHeap(sub_resources);
+        return;
+    }
+
     const Settings& buffer_settings = GetSettings();
     const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
-    if (is_private_storage)
+    if (is_private_storage && !is_upload_batch_encoded)
     {
         m_vk_copy_regions.clear();
-        m_vk_copy_regions.reserve(sub_resources.size());
     }
 
+    const size_t recorded_copy_regions_count = m_vk_copy_regions.size();
     const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
+    Data::Size next_sub_resource_offset = 0U;
+    Data::Size uploaded_data_size = 0U;
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
 
-        const vk::DeviceSize sub_resource_offset = 0U;
+        const vk::DeviceSize sub_resource_offset = GetSubResourceOffset(sub_resource, buffer_settings.size, next_sub_resource_offset);
         Data::RawPtr sub_resource_data_ptr = nullptr;
         const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
                                                                      reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
@@ -128,23 +200,81 @@ void Buffer::SetData(const Rhi::SubResources& sub_resources, Rhi::ICommandQueue&
         std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
 
         GetNativeDevice().unmapMemory(vk_device_memory);
+        uploaded_data_size += sub_resource.GetDataSize();
 
-        if (is_private_storage)
+        if (const vk::BufferCopy vk_copy_region(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
+            is_private_storage && !IsCopyRegionRecorded(vk_copy_region))
         {
-            m_vk_copy_regions.emplace_back(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
+            m_vk_copy_regions.emplace_back(vk_copy_region);
         }
     }
 
     if (!is_private_storage)
         return;
 
-    // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
+    // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource,
+    // only regions which are not copied yet by the commands recorded in current upload batch
+    const auto new_copy_regions_count = static_cast<uint32_t>(m_vk_copy_regions.size() - recorded_copy_regions_count);
+    GetVulkanContext().GetVulkanUploadHeap().AddStagedUpload(uploaded_data_size, new_copy_regions_count > 0U, is_upload_batch_encoded);
+    if (!new_copy_regions_count)
+        return;
+
     TransferCommandList& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
-    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), m_vk_copy_regions);
-    CompleteResourceUpload(upload_cmd_list, GetTargetResourceStateByBufferType(buffer_settings.type), target_cmd_queue);
+    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(),
+                                                               vk::ArrayProxy<const vk::BufferCopy>(new_copy_regions_count,
+                                                                   m_vk_copy_regions.data() + recorded_copy_regions_count));
+    CompleteResourceUpload(upload_cmd_list, GetTargetResourceStateByBufferSettings(buffer_settings), target_cmd_queue);
     GetContext().RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
 }
 
+vk::DeviceSize Buffer::GetCurrentFrameRegionOffset() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL_DESCR(m_upload_heap_regions_ptr, "buffer is not placed in upload heap frame regions");
+    const auto& render_context = dynamic_cast<const Base::RenderContext&>(GetBaseContext());
+    META_CHECK_ARG_LESS_DESCR(render_context.GetFramesInFlightCount(), m_upload_heap_regions_ptr->GetRegionsCount(),
+                              "buffer frame regions were allocated for less frames in flight, buffer has to be recreated");
+    return m_upload_heap_regions_ptr->GetRegionOffset(render_context.GetFrameIndex());
+}
+
+void Buffer::SetDataToUploadHeap(const SubResources& sub_resources)
+{
+    META_FUNCTION_TASK();
+    // Sub-resource data is written straight to the persistently mapped region of the current frame without recording any copy commands,
+    // regions of other frames, which may still be read by GPU, are updated with the latest data when their frames begin
+    const Settings& buffer_settings = GetSettings();
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        ValidateSubResource(sub_resource);
+    }
+
+    Data::Size uploaded_data_size = 0U;
+    const uint32_t frame_index = dynamic_cast<const Base::RenderContext&>(GetBaseContext()).GetFrameIndex();
+    m_upload_heap_regions_ptr->Write(frame_index, [&sub_resources, &buffer_settings, &uploaded_data_size](Data::RawPtr data_ptr)
+    {
+        Data::Size next_sub_resource_offset = 0U;
+        for(const SubResource& sub_resource : sub_resources)
+        {
+            const Data::Size sub_resource_offset = GetSubResourceOffset(sub_resource, buffer_settings.size, next_sub_resource_offset);
+            std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), data_ptr + sub_resource_offset);
+            uploaded_data_size += sub_resource.GetDataSize();
+        }
+    });
+
+    GetVulkanContext().GetVulkanUploadHeap().AddDirectUpload(m_upload_heap_regions_ptr, uploaded_data_size);
+}
+
+bool Buffer::IsCopyRegionRecorded(const vk::BufferCopy& vk_copy_region) const
+{
+    META_FUNCTION_TASK();
+    return std::any_of(m_vk_copy_regions.begin(), m_vk_copy_regions.end(),
+                       [&vk_copy_region](const vk::BufferCopy& vk_recorded_copy_region)
+                       {
+                           return vk_recorded_copy_region.srcOffset <= vk_copy_region.srcOffset &&
+                                  vk_copy_region.srcOffset + vk_copy_region.size <= vk_recorded_copy_region.srcOffset + vk_recorded_copy_region.size;
+                       });
+}
+
 bool Buffer::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
@@ -27,6 +27,7 @@ Vulkan implementation of the command queue interface.
 #include <Methane/Graphics/Vulkan/TransferCommandList.h>
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
 #include <Methane/Graphics/Vulkan/ParallelRenderCommandList.h>
+#include <Methane/Graphics/Vulkan/ComputeCommandList.h>
 #include <Methane/Graphics/Vulkan/QueryPool.h>
 #include <Methane/Graphics/Vulkan/RenderPass.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
@@ -61,7 +62,8 @@ static vk::PipelineStageFlags GetPipelineStageFlagsByQueueFlags(vk::QueueFlags v
                                 |  vk::PipelineStageFlagBits::eColorAttachmentOutput;
 
     if (vk_queue_flags & vk::QueueFlagBits::eCompute)
-        vk_pipeline_stage_flags |= vk::PipelineStageFlagBits::eComputeShader;
+        vk_pipeline_stage_flags |= vk::PipelineStageFlagBits::eComputeShader
+                                |  vk::PipelineStageFlagBits::eDrawIndirect; // indirect dispatch arguments are read on this stage
 
     if (vk_queue_flags & vk::QueueFlagBits::eTransfer)
         vk_pipeline_stage_flags |= vk::PipelineStageFlagBits::eTransfer;
@@ -88,6 +90,10 @@ static vk::AccessFlags GetAccessFlagsByQueueFlags(vk::QueueFlags vk_queue_flags)
                         |  vk::AccessFlagBits::eDepthStencilAttachmentRead
                         |  vk::AccessFlagBits::eDepthStencilAttachmentWrite;
 
+    if (vk_queue_flags & vk::QueueFlagBits::eCompute)
+        vk_access_flags |= vk::AccessFlagBits::eIndirectCommandRead
+                        |  vk::AccessFlagBits::eUniformRead;
+
     if (vk_queue_flags & vk::QueueFlagBits::eCompute ||
         vk_queue_flags & vk::QueueFlagBits::eGraphics)
         vk_access_flags |= vk::AccessFlagBits::eShaderRead
@@ -157,6 +163,12 @@ Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandLi
     return std::make_shared<ParallelRenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass));
 }
 
+Ptr<Rhi::IComputeCommandList> CommandQueue::CreateComputeCommandList()
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeCommandList>(*this);
+}
+
 Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t max_timestamps_per_frame)
 {
     META_FUNCTION_TASK();
@@ -167,6 +179,8 @@ void CommandQueue::Execute(Rhi::ICommandListSet& command_list_set, const Rhi::IC
 {
     META_FUNCTION_TASK();
 
+    // Upload synchronization executes command lists in this queue, so it is done before adding frame execution waits
+    SynchronizeResourceUploads(command_list_set);
     AddWaitForFrameExecution(command_list_set);
     Base::CommandQueueTracking::Execute(command_list_set, completed_callback);
 
@@ -0,0 +1,68 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ComputeCommandList.cpp
+Vulkan implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/ComputeCommandList.h>
+#include <Methane/Graphics/Vulkan/CommandQueue.h>
+#include <Methane/Graphics/Vulkan/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Vulkan
+{
+
+ComputeCommandList::ComputeCommandList(CommandQueue& command_queue)
+    : CommandList(vk::CommandBufferLevel::ePrimary, {}, command_queue)
+{ }
+
+void ComputeCommandList::ResetWithState(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr)
+{
+    META_FUNCTION_TASK();
+    CommandList::ResetCommandState();
+    CommandList::Reset(debug_group_ptr);
+    CommandList::SetComputeState(compute_state);
+}
+
+void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::Dispatch(thread_groups_count);
+    GetNativeCommandBufferDefault().dispatch(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth());
+}
+
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(arguments_buffer, arguments_offset);
+
+    auto& vk_arguments_buffer = static_cast<Buffer&>(arguments_buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = vk_arguments_buffer.GetSetupTransitionBarriers();
+        vk_arguments_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+
+    GetNativeCommandBufferDefault().dispatchIndirect(vk_arguments_buffer.GetNativeResource(), arguments_offset);
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -73,6 +73,11 @@ static const std::vector<std::string_view> g_present_device_extensions = {
     VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
+// Optional extension enabled when supported, to read indirect draws count from GPU buffer
+static const std::vector<std::string_view> g_draw_indirect_count_device_extensions = {
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME
+};
+
 template<bool exact_flags_matching>
 std::optional<uint32_t> FindQueueFamily(const std::vector<vk::QueueFamilyProperties>& vk_queue_family_properties,
                                         vk::QueueFlags queue_flags, uint32_t queues_count,
@@ -146,8 +151,9 @@ static vk::QueueFlags GetQueueFlagsByType(Rhi::CommandListType cmd_list_type)
     META_FUNCTION_TASK();
     switch(cmd_list_type)
     {
-    case Rhi::CommandListType::Transfer:   return vk::QueueFlagBits::eTransfer;
-    case Rhi::CommandListType::Render: return vk::QueueFlagBits::eGraphics;
+    case Rhi::CommandListType::Transfer: return vk::QueueFlagBits::eTransfer;
+    case Rhi::CommandListType::Render:   return vk::QueueFlagBits::eGraphics;
+    case Rhi::CommandListType::Compute:  return vk::QueueFlagBits::eCompute;
     default: META_UNEXPECTED_ARG_RETURN(cmd_list_type, vk::QueueFlagBits::eGraphics);
     }
 }
@@ -246,6 +252,10 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
                        capabilities.features.HasBit(Rhi::DeviceFeature::PresentToWindow) ? vk_surface : vk::SurfaceKHR());
 
     ReserveQueueFamily(Rhi::CommandListType::Transfer, capabilities.transfer_queues_count, reserved_queues_count_per_family);
+    if (capabilities.compute_queues_count)
+        ReserveQueueFamily(Rhi::CommandListType::Compute, capabilities.compute_queues_count, reserved_queues_count_per_family);
+    else
+        ShareQueueFamily(Rhi::CommandListType::Compute, Rhi::CommandListType::Render);
 
     std::vector<vk::DeviceQueueCreateInfo> vk_queue_create_infos;
     std::set<QueueFamilyReservation*> unique_family_reservation_ptrs;
@@ -266,6 +276,12 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
 
     enabled_extension_names.insert(enabled_extension_names.end(), g_render_device_extensions.begin(), g_render_device_extensions.end());
 
+    m_is_draw_indirect_count_supported = IsDeviceExtensionSupported(vk_physical_device, g_draw_indirect_count_device_extensions);
+    if (m_is_draw_indirect_count_supported)
+    {
+        enabled_extension_names.insert(enabled_extension_names.end(), g_draw_indirect_count_device_extensions.begin(), g_draw_indirect_count_device_extensions.end());
+    }
+
     std::vector<const char*> raw_enabled_extension_names;
     std::transform(enabled_extension_names.begin(), enabled_extension_names.end(), std::back_inserter(raw_enabled_extension_names),
                    [](const std::string_view& extension_name) { return extension_name.data(); });
@@ -274,6 +290,8 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     vk::PhysicalDeviceFeatures vk_device_features;
     vk_device_features.samplerAnisotropy = capabilities.features.HasBit(Rhi::DeviceFeature::AnisotropicFiltering);
     vk_device_features.imageCubeArray    = capabilities.features.HasBit(Rhi::DeviceFeature::ImageCubeArray);
+    vk_device_features.multiDrawIndirect = vk_physical_device.getFeatures().multiDrawIndirect;
+    m_is_multi_draw_indirect_supported   = vk_device_features.multiDrawIndirect;
 
     // Add descriptions of enabled device features:
     vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT vk_device_dynamic_state_feature(true);
@@ -402,4 +420,23 @@ void Device::ReserveQueueFamily(Rhi::CommandListType cmd_list_type, uint32_t que
              *vk_queue_family_index, queues_count, magic_enum::enum_name(cmd_list_type));
 }
 
+void Device::ShareQueueFamily(Rhi::CommandListType cmd_list_type, Rhi::CommandListType shared_cmd_list_type)
+{
+    META_FUNCTION_TASK();
+    const auto shared_queue_family_reservation_it = m_queue_family_reservation_by_type.find(shared_cmd_list_type);
+    if (shared_queue_family_reservation_it == m_queue_family_reservation_by_type.end() || !shared_queue_family_reservation_it->second)
+        return;
+
+    const QueueFamilyReservation& shared_queue_family_reservation = *shared_queue_family_reservation_it->second;
+    const vk::QueueFlags queue_flags = GetQueueFlagsByType(cmd_list_type);
+    if (!(m_vk_queue_family_properties[shared_queue_family_reservation.GetFamilyIndex()].queueFlags & queue_flags))
+        return;
+
+    // Command queues of the given type claim free queues from the shared family reservation
+    m_queue_family_reservation_by_type.try_emplace(cmd_list_type, shared_queue_family_reservation_it->second);
+
+    META_LOG("Vulkan command queue family [{}] reserved for {} queues is shared with {} queues.",
+             shared_queue_family_reservation.GetFamilyIndex(), magic_enum::enum_name(shared_cmd_list_type), magic_enum::enum_name(cmd_list_type));
+}
+
 } // namespace Methane::Graphics::Vulkan
@@ -91,6 +91,12 @@ void Fence::WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue)
     static_cast<CommandQueue&>(wait_on_command_queue).WaitForSemaphore(GetNativeSemaphore(), vk::PipelineStageFlagBits::eBottomOfPipe, &wait_value);
 }
 
+uint64_t Fence::GetCompletedValue() const
+{
+    META_FUNCTION_TASK();
+    return m_vk_device.getSemaphoreCounterValueKHR(GetNativeSemaphore());
+}
+
 bool Fence::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
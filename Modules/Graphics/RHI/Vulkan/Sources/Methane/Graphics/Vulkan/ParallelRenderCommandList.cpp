@@ -109,17 +109,14 @@ void ParallelRenderCommandList::SetParallelCommandListsCount(uint32_t count)
     Base::ParallelRenderCommandList::SetParallelCommandListsCount(count);
 
     m_vk_parallel_sync_cmd_buffers.clear();
-    m_vk_parallel_pass_cmd_buffers.clear();
 
     const Refs<Rhi::IRenderCommandList>& parallel_cmd_list_refs = GetParallelCommandLists();
     m_vk_parallel_sync_cmd_buffers.reserve(parallel_cmd_list_refs.size());
-    m_vk_parallel_pass_cmd_buffers.reserve(parallel_cmd_list_refs.size());
 
     for(const Ref<Rhi::IRenderCommandList>& parallel_cmd_list_ref : parallel_cmd_list_refs)
     {
         const auto& parallel_cmd_list_vk = static_cast<const RenderCommandList&>(parallel_cmd_list_ref.get());
         m_vk_parallel_sync_cmd_buffers.emplace_back(parallel_cmd_list_vk.GetNativeCommandBuffer(Vulkan::CommandBufferType::Primary));
-        m_vk_parallel_pass_cmd_buffers.emplace_back(parallel_cmd_list_vk.GetNativeCommandBuffer(Vulkan::CommandBufferType::SecondaryRenderPass));
     }
 }
 
@@ -132,6 +129,15 @@ void ParallelRenderCommandList::Commit()
     const vk::CommandBuffer& vk_beginning_primary_cmd_buffer = m_beginning_command_list.GetNativeCommandBuffer(CommandBufferType::Primary);
     vk_beginning_primary_cmd_buffer.executeCommands(m_vk_parallel_sync_cmd_buffers);
 
+    // Render pass command buffers are collected on commit, because native bundles split them in segments while encoding
+    m_vk_parallel_pass_cmd_buffers.clear();
+    for(const Ref<Rhi::IRenderCommandList>& parallel_cmd_list_ref : GetParallelCommandLists())
+    {
+        const auto& parallel_cmd_list_vk = static_cast<const RenderCommandList&>(parallel_cmd_list_ref.get());
+        const std::vector<vk::CommandBuffer> vk_pass_cmd_buffers = parallel_cmd_list_vk.GetNativeRenderPassCommandBuffers();
+        m_vk_parallel_pass_cmd_buffers.insert(m_vk_parallel_pass_cmd_buffers.end(), vk_pass_cmd_buffers.begin(), vk_pass_cmd_buffers.end());
+    }
+
     RenderPass& render_pass = GetVulkanPass();
     render_pass.Begin(m_beginning_command_list);
 
@@ -23,6 +23,7 @@ Vulkan implementation of the program bindings interface.
 
 #include <Methane/Graphics/Vulkan/ProgramBindings.h>
 #include <Methane/Graphics/Vulkan/Program.h>
+#include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/ICommandList.h>
@@ -113,6 +114,7 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
     , m_has_mutable_descriptor_set(other_program_bindings.m_has_mutable_descriptor_set)
     , m_dynamic_offsets(other_program_bindings.m_dynamic_offsets)
     , m_dynamic_offset_index_by_set_index(other_program_bindings.m_dynamic_offset_index_by_set_index)
+    , m_frame_region_buffer_by_dynamic_offset_index(other_program_bindings.m_frame_region_buffer_by_dynamic_offset_index)
 {
     META_FUNCTION_TASK();
 
@@ -161,13 +163,37 @@ void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& re
 {
     META_FUNCTION_TASK();
     Base::ProgramBindings::SetResourcesForArguments(resource_views_by_argument);
+    UpdateDynamicOffsets();
+}
+
+void ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding& argument_binding,
+                                                                   const Rhi::IResource::Views& old_resource_views,
+                                                                   const Rhi::IResource::Views& new_resource_views)
+{
+    META_FUNCTION_TASK();
+    Base::ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(argument_binding, old_resource_views, new_resource_views);
+
+    // Callback is emitted before new resource views are set to argument binding, so they are passed explicitly
+    // to update dynamic offsets and to drop buffers with frame regions which are not bound anymore
+    if (argument_binding.GetSettings().argument.IsAddressable())
+    {
+        UpdateDynamicOffsets(&argument_binding, &new_resource_views);
+    }
+}
 
+void ProgramBindings::UpdateDynamicOffsets(const IArgumentBinding* changed_argument_binding_ptr,
+                                           const Rhi::IResource::Views* changed_resource_views_ptr)
+{
+    META_FUNCTION_TASK();
     auto& program = static_cast<Program&>(GetProgram());
     const Rhi::ProgramArgumentAccessors& program_argument_accessors = program.GetSettings().argument_accessors;
     std::vector<std::vector<uint32_t>> dynamic_offsets_by_set_index;
+    std::vector<std::vector<const Buffer*>> frame_region_buffers_by_set_index;
     dynamic_offsets_by_set_index.resize(m_descriptor_sets.size());
+    frame_region_buffers_by_set_index.resize(m_descriptor_sets.size());
 
-    ForEachArgumentBinding([&program, &program_argument_accessors, &dynamic_offsets_by_set_index]
+    ForEachArgumentBinding([&program, &program_argument_accessors, &dynamic_offsets_by_set_index, &frame_region_buffers_by_set_index,
+                            changed_argument_binding_ptr, changed_resource_views_ptr]
                            (const Rhi::IProgram::Argument& program_argument, const ArgumentBinding& argument_binding)
         {
             const auto program_accessor_it = Rhi::IProgram::FindArgumentAccessor(program_argument_accessors, program_argument);
@@ -180,19 +206,40 @@ void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& re
             META_CHECK_ARG_TRUE(layout_info.index_opt.has_value());
             META_CHECK_ARG_LESS(*layout_info.index_opt, dynamic_offsets_by_set_index.size());
             std::vector<uint32_t>& dynamic_offsets = dynamic_offsets_by_set_index[*layout_info.index_opt];
+            std::vector<const Buffer*>& frame_region_buffers = frame_region_buffers_by_set_index[*layout_info.index_opt];
             dynamic_offsets.clear();
+            frame_region_buffers.clear();
 
-            const Rhi::ResourceViews& resource_views = argument_binding.GetResourceViews();
+            const Rhi::ResourceViews& resource_views = changed_resource_views_ptr && changed_argument_binding_ptr == &argument_binding
+                                                     ? *changed_resource_views_ptr
+                                                     : argument_binding.GetResourceViews();
             std::transform(resource_views.begin(), resource_views.end(), std::back_inserter(dynamic_offsets),
                            [](const Rhi::IResource::View& resource_view)
                            { return resource_view.GetOffset(); });
+
+            // Buffers written directly by CPU are read by GPU from the region of current frame selected with dynamic offset on apply
+            std::transform(resource_views.begin(), resource_views.end(), std::back_inserter(frame_region_buffers),
+                           [](const Rhi::IResource::View& resource_view)
+                           {
+                               const auto* buffer_ptr = dynamic_cast<const Buffer*>(resource_view.GetResourcePtr().get());
+                               return buffer_ptr && buffer_ptr->HasFrameRegions() ? buffer_ptr : nullptr;
+                           });
         });
 
     m_dynamic_offsets.clear();
     m_dynamic_offset_index_by_set_index.clear();
-    for (const std::vector<uint32_t>& dynamic_offsets : dynamic_offsets_by_set_index)
+    m_frame_region_buffer_by_dynamic_offset_index.clear();
+    for (size_t set_index = 0U; set_index < dynamic_offsets_by_set_index.size(); ++set_index)
     {
+        const std::vector<uint32_t>& dynamic_offsets = dynamic_offsets_by_set_index[set_index];
+        const std::vector<const Buffer*>& frame_region_buffers = frame_region_buffers_by_set_index[set_index];
         m_dynamic_offset_index_by_set_index.emplace_back(static_cast<uint32_t>(m_dynamic_offsets.size()));
+        for(size_t offset_index = 0U; offset_index < frame_region_buffers.size(); ++offset_index)
+        {
+            if (frame_region_buffers[offset_index])
+                m_frame_region_buffer_by_dynamic_offset_index.emplace_back(static_cast<uint32_t>(m_dynamic_offsets.size() + offset_index),
+                                                                           frame_region_buffers[offset_index]);
+        }
         m_dynamic_offsets.insert(m_dynamic_offsets.end(), dynamic_offsets.begin(), dynamic_offsets.end());
     }
 }
@@ -254,6 +301,19 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
     const vk::PipelineBindPoint vk_pipeline_bind_point = command_list_vk.GetNativePipelineBindPoint();
     const uint32_t first_dynamic_offset_index = m_dynamic_offset_index_by_set_index[first_descriptor_set_layout_index];
 
+    // Dynamic offsets of buffers with frame regions are shifted to the region of current frame
+    const uint32_t* dynamic_offsets_ptr = m_dynamic_offsets.data();
+    std::vector<uint32_t> frame_dynamic_offsets;
+    if (!m_frame_region_buffer_by_dynamic_offset_index.empty())
+    {
+        frame_dynamic_offsets = m_dynamic_offsets;
+        for(const auto& [dynamic_offset_index, buffer_ptr] : m_frame_region_buffer_by_dynamic_offset_index)
+        {
+            frame_dynamic_offsets[dynamic_offset_index] += static_cast<uint32_t>(buffer_ptr->GetCurrentFrameRegionOffset());
+        }
+        dynamic_offsets_ptr = frame_dynamic_offsets.data();
+    }
+
     // Bind descriptor sets to pipeline
     auto& program = static_cast<Program&>(GetProgram());
     vk_command_buffer.bindDescriptorSets(vk_pipeline_bind_point,
@@ -262,7 +322,7 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
                                          static_cast<uint32_t>(m_descriptor_sets.size() - first_descriptor_set_layout_index),
                                          m_descriptor_sets.data() + first_descriptor_set_layout_index,
                                          static_cast<uint32_t>(m_dynamic_offsets.size() - first_dynamic_offset_index),
-                                         m_dynamic_offsets.data() + first_dynamic_offset_index);
+                                         dynamic_offsets_ptr + first_dynamic_offset_index);
 }
 
 void ProgramBindings::OnObjectNameChanged(IObject&, const std::string&)
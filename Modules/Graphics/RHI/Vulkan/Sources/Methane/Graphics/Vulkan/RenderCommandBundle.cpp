@@ -0,0 +1,249 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/RenderCommandBundle.cpp
+Vulkan native bundle of the render command sequence encoded once
+in the secondary command buffer, which is executed inside render pass of command lists.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/RenderCommandBundle.h>
+#include <Methane/Graphics/Vulkan/RenderCommandList.h>
+#include <Methane/Graphics/Vulkan/RenderPattern.h>
+#include <Methane/Graphics/Vulkan/RenderState.h>
+#include <Methane/Graphics/Vulkan/ViewState.h>
+#include <Methane/Graphics/Vulkan/ProgramBindings.h>
+#include <Methane/Graphics/Vulkan/CommandQueue.h>
+#include <Methane/Graphics/Vulkan/IContext.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/Buffer.h>
+#include <Methane/Graphics/Vulkan/BufferSet.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Vulkan
+{
+
+using Sequence = Base::RenderCommandSequence;
+
+// Render state set in command list is used by bundle when sequence draws before setting its own render state
+static bool IsRenderStateInherited(const Sequence::Commands& commands)
+{
+    META_FUNCTION_TASK();
+    for(const Sequence::Command& command : commands)
+    {
+        if (std::holds_alternative<Sequence::SetRenderStateCommand>(command))
+            return false;
+
+        if (std::holds_alternative<Sequence::DrawIndexedCommand>(command) ||
+            std::holds_alternative<Sequence::DrawCommand>(command))
+            return true;
+    }
+    return false;
+}
+
+class RenderCommandEncoder
+{
+public:
+    RenderCommandEncoder(ICommandList& command_list, const Rhi::ICommandQueue& command_queue)
+        : m_cmd_list(command_list)
+        , m_cmd_queue(command_queue)
+        , m_vk_cmd_buffer(command_list.GetNativeCommandBufferDefault())
+    { }
+
+    void operator()(const Sequence::SetRenderStateCommand& cmd)
+    {
+        m_vk_cmd_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, static_cast<const RenderState&>(*cmd.render_state_ptr).GetNativePipeline());
+    }
+
+    void operator()(const Sequence::SetProgramBindingsCommand& cmd)
+    {
+        if (m_applied_program_bindings_ptr == cmd.program_bindings_ptr.get())
+            return;
+
+        // Resource state barriers are set in command list before bundle execution
+        Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = cmd.apply_behavior;
+        apply_behavior.SetBitOff(Rhi::ProgramBindingsApplyBehavior::StateBarriers);
+        static_cast<const ProgramBindings&>(*cmd.program_bindings_ptr).Apply(m_cmd_list, m_cmd_queue, m_applied_program_bindings_ptr, apply_behavior);
+
+        if (constexpr Rhi::ProgramBindingsApplyBehaviorMask constant_once_and_changes_only({
+                Rhi::ProgramBindingsApplyBehavior::ConstantOnce,
+                Rhi::ProgramBindingsApplyBehavior::ChangesOnly
+            });
+            cmd.apply_behavior.HasAnyBits(constant_once_and_changes_only))
+        {
+            m_applied_program_bindings_ptr = cmd.program_bindings_ptr.get();
+        }
+    }
+
+    void operator()(const Sequence::SetVertexBuffersCommand& cmd) const
+    {
+        const auto& vk_vertex_buffers = static_cast<const BufferSet&>(*cmd.vertex_buffers_ptr);
+        m_vk_cmd_buffer.bindVertexBuffers(0U, vk_vertex_buffers.GetNativeBuffers(), vk_vertex_buffers.GetNativeOffsets());
+    }
+
+    void operator()(const Sequence::SetIndexBufferCommand& cmd)
+    {
+        const auto& vk_index_buffer = static_cast<const Buffer&>(*cmd.index_buffer_ptr);
+        const vk::IndexType vk_index_type = GetVulkanIndexTypeByStride(vk_index_buffer.GetSettings().item_stride_size);
+        m_vk_cmd_buffer.bindIndexBuffer(vk_index_buffer.GetNativeResource(), 0U, vk_index_type);
+        m_index_buffer_ptr = &vk_index_buffer;
+    }
+
+    void operator()(const Sequence::DrawIndexedCommand& cmd)
+    {
+        const uint32_t index_count = cmd.index_count == 0U && m_index_buffer_ptr
+                                   ? m_index_buffer_ptr->GetFormattedItemsCount()
+                                   : cmd.index_count;
+        SetPrimitiveTopology(cmd.primitive);
+        m_vk_cmd_buffer.drawIndexed(index_count, cmd.instance_count, cmd.start_index, cmd.start_vertex, cmd.start_instance);
+    }
+
+    void operator()(const Sequence::DrawCommand& cmd)
+    {
+        SetPrimitiveTopology(cmd.primitive);
+        m_vk_cmd_buffer.draw(cmd.vertex_count, cmd.instance_count, cmd.start_vertex, cmd.start_instance);
+    }
+
+private:
+    void SetPrimitiveTopology(Rhi::RenderPrimitive primitive)
+    {
+        if (m_primitive_opt == primitive)
+            return;
+
+        m_vk_cmd_buffer.setPrimitiveTopologyEXT(GetVulkanPrimitiveTopology(primitive));
+        m_primitive_opt = primitive;
+    }
+
+    ICommandList&                m_cmd_list;
+    const Rhi::ICommandQueue&    m_cmd_queue;
+    const vk::CommandBuffer&     m_vk_cmd_buffer;
+    const Base::ProgramBindings* m_applied_program_bindings_ptr = nullptr;
+    const Buffer*                m_index_buffer_ptr = nullptr;
+    Opt<Rhi::RenderPrimitive>    m_primitive_opt;
+};
+
+bool RenderCommandBundle::IsSupported(const Base::RenderCommandSequence& command_sequence)
+{
+    META_FUNCTION_TASK();
+    for(const Sequence::Command& command : command_sequence.GetCommands())
+    {
+        if (const auto* bindings_cmd_ptr = std::get_if<Sequence::SetProgramBindingsCommand>(&command);
+            bindings_cmd_ptr && static_cast<const ProgramBindings&>(*bindings_cmd_ptr->program_bindings_ptr).HasFrameRegionBuffers())
+            return false;
+    }
+    return true;
+}
+
+RenderCommandBundle::RenderCommandBundle(Base::RenderCommandSequence& command_sequence, CommandQueue& command_queue,
+                                         const Ptr<Base::RenderState>& inherited_render_state_ptr, const ViewState* inherited_view_state_ptr)
+    : Base::Object(command_sequence.GetName())
+    , m_command_queue_ptr(command_queue.GetPtr<CommandQueue>())
+    , m_commands(command_sequence.GetCommands())
+    , m_is_render_state_inherited(IsRenderStateInherited(m_commands))
+    , m_vk_inheritance_info(static_cast<const RenderPattern&>(command_sequence.GetRenderPattern()).GetNativeRenderPass(), 0U) // any frame buffer of render pattern
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = command_queue.GetVulkanContext().GetVulkanDevice().GetNativeDevice();
+    m_vk_unique_command_pool = vk_device.createCommandPoolUnique(vk::CommandPoolCreateInfo({}, command_queue.GetFamilyIndex()));
+    m_vk_unique_command_buffer = std::move(vk_device.allocateCommandBuffersUnique(
+        vk::CommandBufferAllocateInfo(m_vk_unique_command_pool.get(), vk::CommandBufferLevel::eSecondary, 1U)
+    ).back());
+
+    EncodeCommands(inherited_render_state_ptr, inherited_view_state_ptr);
+}
+
+bool RenderCommandBundle::IsEncodedFor(const Base::RenderState* inherited_render_state_ptr, const ViewState* inherited_view_state_ptr) const
+{
+    META_FUNCTION_TASK();
+    // Native pipeline is compared too, because it is recreated on render state reset
+    if (m_is_render_state_inherited &&
+        (!inherited_render_state_ptr || m_inherited_render_state_ptr.get() != inherited_render_state_ptr ||
+         m_vk_inherited_pipeline != static_cast<const RenderState&>(*inherited_render_state_ptr).GetNativePipeline()))
+        return false;
+
+    if (!inherited_view_state_ptr)
+        return m_vk_inherited_viewports.empty();
+
+    return m_vk_inherited_viewports    == inherited_view_state_ptr->GetNativeViewports() &&
+           m_vk_inherited_scissor_rects == inherited_view_state_ptr->GetNativeScissorRects();
+}
+
+CommandQueue& RenderCommandBundle::GetVulkanCommandQueue()
+{
+    META_FUNCTION_TASK();
+    return *m_command_queue_ptr;
+}
+
+const CommandQueue& RenderCommandBundle::GetVulkanCommandQueue() const
+{
+    META_FUNCTION_TASK();
+    return *m_command_queue_ptr;
+}
+
+const vk::CommandBuffer& RenderCommandBundle::GetNativeCommandBuffer(CommandBufferType cmd_buffer_type) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(cmd_buffer_type, CommandBufferType::SecondaryRenderPass,
+                               "render command bundle has only secondary render pass command buffer");
+    return m_vk_unique_command_buffer.get();
+}
+
+void RenderCommandBundle::SetResourceBarriers(const Rhi::IResourceBarriers&)
+{
+    META_FUNCTION_NOT_IMPLEMENTED_DESCR("resource barriers can not be encoded in render command bundle");
+}
+
+void RenderCommandBundle::EncodeCommands(const Ptr<Base::RenderState>& inherited_render_state_ptr, const ViewState* inherited_view_state_ptr)
+{
+    META_FUNCTION_TASK();
+    META_LOG("Render command bundle '{}' ENCODE {} commands", GetName(), m_commands.size());
+
+    const vk::CommandBuffer& vk_cmd_buffer = m_vk_unique_command_buffer.get();
+    vk_cmd_buffer.begin(vk::CommandBufferBeginInfo(
+        vk::CommandBufferUsageFlagBits::eRenderPassContinue | vk::CommandBufferUsageFlagBits::eSimultaneousUse,
+        &m_vk_inheritance_info
+    ));
+
+    if (m_is_render_state_inherited)
+    {
+        META_CHECK_ARG_NOT_NULL_DESCR(inherited_render_state_ptr, "render state must be set in command list before replay of command sequence without render state");
+        m_inherited_render_state_ptr = inherited_render_state_ptr;
+        m_vk_inherited_pipeline      = static_cast<const RenderState&>(*inherited_render_state_ptr).GetNativePipeline();
+        vk_cmd_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_vk_inherited_pipeline);
+    }
+
+    if (inherited_view_state_ptr)
+    {
+        m_vk_inherited_viewports     = inherited_view_state_ptr->GetNativeViewports();
+        m_vk_inherited_scissor_rects = inherited_view_state_ptr->GetNativeScissorRects();
+        vk_cmd_buffer.setViewportWithCountEXT(m_vk_inherited_viewports);
+        vk_cmd_buffer.setScissorWithCountEXT(m_vk_inherited_scissor_rects);
+    }
+
+    RenderCommandEncoder command_encoder(*this, *m_command_queue_ptr);
+    for(const Sequence::Command& command : m_commands)
+    {
+        std::visit(command_encoder, command);
+    }
+
+    vk_cmd_buffer.end();
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -22,18 +22,23 @@ Vulkan implementation of the render command list interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
+#include <Methane/Graphics/Vulkan/RenderCommandBundle.h>
 #include <Methane/Graphics/Vulkan/ParallelRenderCommandList.h>
 #include <Methane/Graphics/Vulkan/RenderState.h>
+#include <Methane/Graphics/Vulkan/ViewState.h>
 #include <Methane/Graphics/Vulkan/RenderPattern.h>
 #include <Methane/Graphics/Vulkan/RenderPass.h>
 #include <Methane/Graphics/Vulkan/CommandQueue.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
+#include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/BufferSet.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <iterator>
+
 namespace Methane::Graphics::Base
 {
 
@@ -62,7 +67,7 @@ vk::PrimitiveTopology GetVulkanPrimitiveTopology(Rhi::RenderPrimitive primitive_
     }
 }
 
-static vk::IndexType GetVulkanIndexTypeByStride(Data::Size index_stride_bytes)
+vk::IndexType GetVulkanIndexTypeByStride(Data::Size index_stride_bytes)
 {
     META_FUNCTION_TASK();
     switch(index_stride_bytes)
@@ -105,6 +110,7 @@ RenderCommandList::RenderCommandList(ParallelRenderCommandList& parallel_render_
 void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
+    ReleaseRenderPassSegments();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
 }
@@ -112,6 +118,7 @@ void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
+    ReleaseRenderPassSegments();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
     CommandList::SetRenderState(render_state);
@@ -179,6 +186,26 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     GetNativeCommandBufferDefault().draw(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                            Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+
+    UpdatePrimitiveTopology(primitive);
+    ExecuteNativeIndirectDraws(true, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset, uint32_t max_draw_count,
+                                     Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+
+    UpdatePrimitiveTopology(primitive);
+    ExecuteNativeIndirectDraws(false, arguments_buffer, arguments_offset, max_draw_count, draw_count_buffer_ptr, draw_count_offset);
+}
+
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
@@ -192,7 +219,7 @@ void RenderCommandList::Commit()
         if (render_pass_ptr)
             render_pass_ptr->Begin(*this);
 
-        GetNativeCommandBuffer(CommandBufferType::Primary).executeCommands(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+        GetNativeCommandBuffer(CommandBufferType::Primary).executeCommands(GetNativeRenderPassCommandBuffers());
 
         if (render_pass_ptr)
             render_pass_ptr->End(*this);
@@ -201,6 +228,60 @@ void RenderCommandList::Commit()
     CommandList::Commit();
 }
 
+std::vector<vk::CommandBuffer> RenderCommandList::GetNativeRenderPassCommandBuffers() const
+{
+    META_FUNCTION_TASK();
+    std::vector<vk::CommandBuffer> vk_pass_cmd_buffers(m_vk_pass_execute_buffers);
+    vk_pass_cmd_buffers.emplace_back(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+    return vk_pass_cmd_buffers;
+}
+
+void RenderCommandList::ExecuteCommandSequence(Base::RenderCommandSequence& command_sequence)
+{
+    META_FUNCTION_TASK();
+    // Bundle is executed in the separate secondary command buffer, which is possible only inside render pass of command list
+    if (!HasPass())
+    {
+        Base::RenderCommandList::ExecuteCommandSequence(command_sequence);
+        return;
+    }
+
+    const DrawingState& drawing_state = GetDrawingState();
+    const auto* vk_view_state_ptr = static_cast<const ViewState*>(drawing_state.view_state_ptr);
+    auto render_bundle_ptr = std::static_pointer_cast<RenderCommandBundle>(command_sequence.GetNativeBundle());
+    if (!render_bundle_ptr || !render_bundle_ptr->IsEncodedFor(drawing_state.render_state_ptr.get(), vk_view_state_ptr))
+    {
+        // Dynamic offsets of frame region buffers change every frame, so such sequences are replayed on CPU
+        if (!RenderCommandBundle::IsSupported(command_sequence))
+        {
+            Base::RenderCommandList::ExecuteCommandSequence(command_sequence);
+            return;
+        }
+
+        // Bundle encoded for the previous render or view state is still retained by command lists executing it
+        render_bundle_ptr = std::make_shared<RenderCommandBundle>(command_sequence, GetVulkanCommandQueue(),
+                                                                  drawing_state.render_state_ptr, vk_view_state_ptr);
+        command_sequence.SetNativeBundle(render_bundle_ptr);
+    }
+
+    SetCommandSequenceResourceStates(command_sequence);
+
+    // Secondary command buffers can not be nested, so the current render pass segment is ended to execute bundle after it
+    vk::UniqueCommandBuffer vk_unique_free_segment_buffer;
+    if (!m_vk_unique_free_pass_segment_buffers.empty())
+    {
+        vk_unique_free_segment_buffer = std::move(m_vk_unique_free_pass_segment_buffers.back());
+        m_vk_unique_free_pass_segment_buffers.pop_back();
+    }
+    vk::UniqueCommandBuffer& vk_unique_segment_buffer = m_vk_unique_pass_segment_buffers.emplace_back(
+        ContinueCommandBuffer(CommandBufferType::SecondaryRenderPass, std::move(vk_unique_free_segment_buffer)));
+    m_vk_pass_execute_buffers.emplace_back(vk_unique_segment_buffer.get());
+    m_vk_pass_execute_buffers.emplace_back(render_bundle_ptr->GetNativeCommandBufferDefault());
+
+    RetainResource(render_bundle_ptr);
+    RestoreDrawingStateAfterBundle();
+}
+
 void RenderCommandList::OnRenderPassUpdated(const Rhi::IRenderPass& render_pass)
 {
     META_FUNCTION_TASK();
@@ -219,6 +300,68 @@ void RenderCommandList::UpdatePrimitiveTopology(Primitive primitive)
     }
 }
 
+void RenderCommandList::ExecuteNativeIndirectDraws(bool is_indexed, Rhi::IBuffer& arguments_buffer, Data::Size arguments_offset,
+                                                   uint32_t max_draw_count, Rhi::IBuffer* draw_count_buffer_ptr, Data::Size draw_count_offset)
+{
+    META_FUNCTION_TASK();
+    SetIndirectBufferState(arguments_buffer);
+    if (draw_count_buffer_ptr)
+    {
+        SetIndirectBufferState(*draw_count_buffer_ptr);
+    }
+
+    const Device&            vulkan_device       = GetVulkanCommandQueue().GetVulkanContext().GetVulkanDevice();
+    const vk::CommandBuffer& vk_cmd_buffer       = GetNativeCommandBufferDefault();
+    const vk::Buffer&        vk_arguments_buffer = static_cast<Buffer&>(arguments_buffer).GetNativeResource();
+    const auto               arguments_stride    = static_cast<uint32_t>(is_indexed ? sizeof(vk::DrawIndexedIndirectCommand) : sizeof(vk::DrawIndirectCommand));
+
+    if (draw_count_buffer_ptr)
+    {
+        META_CHECK_ARG_TRUE_DESCR(vulkan_device.IsDrawIndirectCountSupported(), "indirect draw count buffer is not supported by Vulkan device");
+        const vk::Buffer& vk_draw_count_buffer = static_cast<Buffer&>(*draw_count_buffer_ptr).GetNativeResource();
+        if (is_indexed)
+            vk_cmd_buffer.drawIndexedIndirectCountKHR(vk_arguments_buffer, arguments_offset, vk_draw_count_buffer, draw_count_offset, max_draw_count, arguments_stride);
+        else
+            vk_cmd_buffer.drawIndirectCountKHR(vk_arguments_buffer, arguments_offset, vk_draw_count_buffer, draw_count_offset, max_draw_count, arguments_stride);
+        return;
+    }
+
+    // Multiple draws are issued one by one when multi-draw indirect feature is not supported by device
+    const uint32_t draws_per_call = vulkan_device.IsMultiDrawIndirectSupported() ? max_draw_count : 1U;
+    for(uint32_t draw_index = 0U; draw_index < max_draw_count; draw_index += draws_per_call)
+    {
+        const vk::DeviceSize draw_arguments_offset = arguments_offset + static_cast<vk::DeviceSize>(draw_index) * arguments_stride;
+        if (is_indexed)
+            vk_cmd_buffer.drawIndexedIndirect(vk_arguments_buffer, draw_arguments_offset, draws_per_call, arguments_stride);
+        else
+            vk_cmd_buffer.drawIndirect(vk_arguments_buffer, draw_arguments_offset, draws_per_call, arguments_stride);
+    }
+}
+
+void RenderCommandList::SetIndirectBufferState(Rhi::IBuffer& indirect_buffer)
+{
+    META_FUNCTION_TASK();
+    auto& vk_indirect_buffer = static_cast<Buffer&>(indirect_buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = vk_indirect_buffer.GetSetupTransitionBarriers();
+        vk_indirect_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+}
+
+void RenderCommandList::ReleaseRenderPassSegments()
+{
+    META_FUNCTION_TASK();
+    // Segment buffers are reused only after command list was committed and executed
+    if (!IsNativeCommitted())
+        return;
+
+    std::move(m_vk_unique_pass_segment_buffers.begin(), m_vk_unique_pass_segment_buffers.end(),
+              std::back_inserter(m_vk_unique_free_pass_segment_buffers));
+    m_vk_unique_pass_segment_buffers.clear();
+    m_vk_pass_execute_buffers.clear();
+}
+
 RenderPass& RenderCommandList::GetVulkanPass()
 {
     META_FUNCTION_TASK();
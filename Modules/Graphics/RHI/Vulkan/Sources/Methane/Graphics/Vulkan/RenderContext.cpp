@@ -29,6 +29,7 @@ Vulkan implementation of the render context interface.
 #include <Methane/Graphics/Vulkan/Program.h>
 #include <Methane/Graphics/Vulkan/RenderPass.h>
 #include <Methane/Graphics/Vulkan/RenderState.h>
+#include <Methane/Graphics/Vulkan/ComputeState.h>
 #include <Methane/Graphics/Vulkan/RenderPattern.h>
 #include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/Texture.h>
@@ -111,6 +112,12 @@ Ptr<Rhi::ISampler> RenderContext::CreateSampler(const Rhi::SamplerSettings& sett
     return std::make_shared<Sampler>(*this, settings);
 }
 
+Ptr<Rhi::IComputeState> RenderContext::CreateComputeState(const Rhi::ComputeStateSettings& settings) const
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeState>(*this, settings);
+}
+
 Ptr<Rhi::IRenderState> RenderContext::CreateRenderState(const Rhi::RenderStateSettings& settings) const
 {
     META_FUNCTION_TASK();
@@ -216,6 +223,9 @@ void RenderContext::Present()
 
     Context<Base::RenderContext>::OnCpuPresentComplete();
     UpdateFrameBufferIndex();
+
+    // Upload heap regions of the next frame are updated with data written in previous frames
+    GetVulkanUploadHeap().CompleteFrame(GetFrameIndex());
 }
 
 bool RenderContext::SetVSyncEnabled(bool vsync_enabled)
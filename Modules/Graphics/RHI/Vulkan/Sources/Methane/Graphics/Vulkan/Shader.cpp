@@ -26,6 +26,7 @@ Vulkan implementation of the shader interface.
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/ProgramBindings.h>
+#include <Methane/Graphics/Vulkan/Types.h>
 
 #include <Methane/Data/IProvider.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -132,6 +133,28 @@ static Rhi::IResource::Type ConvertDescriptorTypeToResourceType(vk::DescriptorTy
     }
 }
 
+static Rhi::ProgramArgumentShaderAccess GetShaderAccess(const spirv_cross::Compiler& spirv_compiler, const spirv_cross::Resource& resource,
+                                                      vk::DescriptorType vk_descriptor_type)
+{
+    META_FUNCTION_TASK();
+    // Storage resources are writable in shader unless decorated as non-writable, like HLSL StructuredBuffer
+    switch(vk_descriptor_type)
+    {
+    case vk::DescriptorType::eStorageBuffer:
+        return spirv_compiler.get_buffer_block_flags(resource.id).get(spv::DecorationNonWritable)
+             ? Rhi::ProgramArgumentShaderAccess::ReadOnly
+             : Rhi::ProgramArgumentShaderAccess::ReadWrite;
+
+    case vk::DescriptorType::eStorageImage:
+        return spirv_compiler.has_decoration(resource.id, spv::DecorationNonWritable)
+             ? Rhi::ProgramArgumentShaderAccess::ReadOnly
+             : Rhi::ProgramArgumentShaderAccess::ReadWrite;
+
+    default:
+        return Rhi::ProgramArgumentShaderAccess::ReadOnly;
+    }
+}
+
 static vk::DescriptorType UpdateDescriptorType(vk::DescriptorType vk_shader_descriptor_type, const Rhi::ProgramArgumentAccessor& argument_accessor)
 {
     META_FUNCTION_TASK();
@@ -184,7 +207,8 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
                 {
                     argument_acc,
                     resource_type,
-                    array_size
+                    array_size,
+                    GetShaderAccess(spirv_compiler, resource, vk_descriptor_type)
                 },
                 UpdateDescriptorType(vk_descriptor_type, argument_acc),
                 { std::move(byte_code_map) }
@@ -350,7 +374,12 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
         const std::string&           semantic_name    = spirv_compiler.get_decoration_string(input_resource.id, spv::DecorationHlslSemanticGOOGLE);
         const uint32_t               input_location   = spirv_compiler.get_decoration(input_resource.id, spv::DecorationLocation);
         const spirv_cross::SPIRType& attribute_type   = spirv_compiler.get_type(input_resource.base_type_id);
-        const vk::Format             attribute_format = GetVertexAttributeFormatFromSpirvType(attribute_type);
+
+        // Explicit argument format is used for packed vertex attributes, which are unpacked to shader input types on fetch
+        const PixelFormat argument_format  = GetProgramInputArgumentFormatBySemantic(program, semantic_name);
+        const vk::Format  attribute_format = argument_format == PixelFormat::Unknown
+                                           ? GetVertexAttributeFormatFromSpirvType(attribute_type)
+                                           : TypeConverter::PixelFormatToVulkan(argument_format);
 
         const uint32_t buffer_index = GetProgramInputBufferIndexByArgumentSemantic(program, semantic_name);
         META_CHECK_ARG_LESS(buffer_index, m_vertex_input_binding_descriptions.size());
@@ -373,7 +402,9 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
 #endif
 
         // Tight packing of attributes in vertex buffer is assumed
-        input_binding_desc.stride += attribute_type.vecsize * 4;
+        input_binding_desc.stride += argument_format == PixelFormat::Unknown
+                                   ? attribute_type.vecsize * 4
+                                   : static_cast<uint32_t>(GetPixelSize(argument_format));
     }
 
     META_LOG("{}", log_ss.str());
@@ -386,9 +417,10 @@ vk::ShaderStageFlagBits Shader::ConvertTypeToStageFlagBits(Rhi::ShaderType shade
     META_FUNCTION_TASK();
     switch(shader_type)
     {
-    case Rhi::ShaderType::All:    return vk::ShaderStageFlagBits::eAll;
-    case Rhi::ShaderType::Vertex: return vk::ShaderStageFlagBits::eVertex;
-    case Rhi::ShaderType::Pixel:  return vk::ShaderStageFlagBits::eFragment;
+    case Rhi::ShaderType::All:     return vk::ShaderStageFlagBits::eAll;
+    case Rhi::ShaderType::Vertex:  return vk::ShaderStageFlagBits::eVertex;
+    case Rhi::ShaderType::Pixel:   return vk::ShaderStageFlagBits::eFragment;
+    case Rhi::ShaderType::Compute: return vk::ShaderStageFlagBits::eCompute;
     default: META_UNEXPECTED_ARG_RETURN(shader_type, vk::ShaderStageFlagBits::eAll);
     }
 }
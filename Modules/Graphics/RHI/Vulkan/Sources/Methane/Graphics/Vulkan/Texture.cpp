@@ -22,6 +22,7 @@ Vulkan implementation of the texture interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Vulkan/Texture.h>
+#include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/RenderContext.h>
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
 #include <Methane/Graphics/Vulkan/Device.h>
@@ -256,16 +257,26 @@ void Texture::InitializeAsImage()
     const Settings& settings = GetSettings();
     META_CHECK_ARG_EQUAL(settings.type, Rhi::TextureType::Image);
 
-    // Allocate resource primary memory
+    // Allocate resource primary memory, while staging buffer is created on demand with size of uploaded data
     const vk::Device& vk_device = GetNativeDevice();
-    const vk::MemoryRequirements vk_image_memory_requirements = vk_device.getImageMemoryRequirements(GetNativeResource());
-    AllocateResourceMemory(vk_image_memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
     vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+}
+
+void Texture::ReserveStagingBuffer(vk::DeviceSize staging_size)
+{
+    META_FUNCTION_TASK();
+    if (m_vk_unique_staging_buffer && m_vk_staging_buffer_size >= staging_size)
+        return;
 
-    // Create staging buffer and allocate staging memory
+    // Staging buffer is grown only when required, so it does not exceed the largest upload,
+    // which is bounded by per-frame budget in case of sliced texture streaming
+    const vk::Device& vk_device = GetNativeDevice();
+    m_vk_unique_staging_buffer.reset();
+    m_vk_unique_staging_memory.reset();
     m_vk_unique_staging_buffer = vk_device.createBufferUnique(
         vk::BufferCreateInfo(vk::BufferCreateFlags{},
-                             vk_image_memory_requirements.size,
+                             staging_size,
                              vk::BufferUsageFlagBits::eTransferSrc,
                              vk::SharingMode::eExclusive)
     );
@@ -273,6 +284,13 @@ void Texture::InitializeAsImage()
     const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
     m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
     vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    m_vk_staging_buffer_size = staging_size;
+
+    if (const std::string_view name = GetName();
+        !name.empty())
+    {
+        SetVulkanObjectName(vk_device, m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
+    }
 }
 
 void Texture::InitializeAsRenderTarget()
@@ -326,57 +344,93 @@ void Texture::SetData(const SubResources& sub_resources, Rhi::ICommandQueue& tar
 
     Resource::SetData(sub_resources, target_cmd_queue);
 
+    // Upload command list is taken for encoding before writing to staging buffer, which waits for completion of its previous upload
+    TransferCommandList& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
+    ReserveStagingBuffer(GetStagingDataSize(sub_resources));
+    UploadSubResources(sub_resources, upload_cmd_list, m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0U);
+
+    if (IsMipLevelsGenerationRequired(sub_resources))
+    {
+        META_CHECK_ARG_FALSE_DESCR(IsBlockCompressedFormat(GetSettings().pixel_format),
+                                   "MIP levels can not be generated for block-compressed texture, all levels must be uploaded");
+        CompleteResourceUpload(upload_cmd_list, GetState(), target_cmd_queue); // ownership transition only
+        GenerateMipLevels(target_cmd_queue, State::ShaderResource);
+    }
+    else
+    {
+        CompleteResourceUpload(upload_cmd_list, State::ShaderResource, target_cmd_queue);
+    }
+    GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+}
+
+void Texture::SetDataThroughStaging(const SubResources& sub_resources, Rhi::ICommandQueue& target_cmd_queue,
+                                    Rhi::IBuffer& staging_buffer, Data::Size staging_offset)
+{
+    META_FUNCTION_TASK();
+    Resource::SetDataThroughStaging(sub_resources, target_cmd_queue, staging_buffer, staging_offset);
+
+    // Texture does not own staging memory in this case, data is written to the region of shared staging buffer
+    const auto&          vk_staging_buffer = static_cast<const Buffer&>(staging_buffer);
+    TransferCommandList& upload_cmd_list   = PrepareResourceUpload(target_cmd_queue);
+    UploadSubResources(sub_resources, upload_cmd_list, vk_staging_buffer.GetNativeResource(),
+                       vk_staging_buffer.GetNativeDeviceMemory(), staging_offset);
+    CompleteResourceUpload(upload_cmd_list, State::ShaderResource, target_cmd_queue);
+    GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+}
+
+void Texture::UploadSubResources(const SubResources& sub_resources, const TransferCommandList& upload_cmd_list,
+                                 const vk::Buffer& vk_staging_buffer, const vk::DeviceMemory& vk_staging_memory,
+                                 vk::DeviceSize staging_offset)
+{
+    META_FUNCTION_TASK();
     m_vk_copy_regions.clear();
     m_vk_copy_regions.reserve(sub_resources.size());
 
     const SubResource::Count& subresource_count = GetSubresourceCount();
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    vk::DeviceSize sub_resource_offset = 0U;
+    const Dimensions& dimensions = GetSettings().dimensions;
+    const PixelFormatBlock pixel_block = GetPixelFormatBlock(GetSettings().pixel_format);
+    vk::DeviceSize sub_resource_offset = staging_offset;
 
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
+        sub_resource_offset = AlignStagingDataOffset(sub_resource_offset);
+
         Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
+        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_staging_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
                                                                      reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
 
         META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
         META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
         std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
 
-        GetNativeDevice().unmapMemory(vk_device_memory);
+        GetNativeDevice().unmapMemory(vk_staging_memory);
 
+        // Buffer data is tightly packed, so both row length and image height are set to zero;
+        // sliced sub-resource data is copied to the range of block rows selected by its data range
+        const Data::Index mip_level = sub_resource.GetIndex().GetMipLevel();
+        const uint32_t mip_height = GetMipLevelSize(dimensions.GetHeight(), mip_level);
+        const Data::Range<Data::Index> block_rows = GetSubResourceBlockRows(sub_resource);
+        const uint32_t begin_y = block_rows.GetStart() * pixel_block.height;
+        const uint32_t end_y = std::min(block_rows.GetEnd() * pixel_block.height, mip_height);
         m_vk_copy_regions.emplace_back(
             sub_resource_offset, 0, 0,
             vk::ImageSubresourceLayers(
                 vk::ImageAspectFlagBits::eColor,
-                sub_resource.GetIndex().GetMipLevel(),
+                mip_level,
                 sub_resource.GetIndex().GetBaseLayerIndex(subresource_count),
                 1U
             ),
-            vk::Offset3D(),
-            TypeConverter::FrameSizeToExtent3D(GetSettings().dimensions.AsRectSize())
+            vk::Offset3D(0, static_cast<int32_t>(begin_y), 0),
+            vk::Extent3D(GetMipLevelSize(dimensions.GetWidth(), mip_level), end_y - begin_y, 1U)
         );
 
         sub_resource_offset += sub_resource.GetDataSize();
     }
 
     // Copy buffer data from staging upload resource to the device-local GPU resource
-    TransferCommandList&   upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
-    const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    vk_cmd_buffer.copyBufferToImage(m_vk_unique_staging_buffer.get(), GetNativeResource(),
-                                    vk::ImageLayout::eTransferDstOptimal, m_vk_copy_regions);
-
-    if (GetSettings().mipmapped && sub_resources.size() < GetSubresourceCount().GetRawCount())
-    {
-        CompleteResourceUpload(upload_cmd_list, GetState(), target_cmd_queue); // ownership transition only
-        GenerateMipLevels(target_cmd_queue, State::ShaderResource);
-    }
-    else
-    {
-        CompleteResourceUpload(upload_cmd_list, State::ShaderResource, target_cmd_queue);
-    }
-    GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
+    upload_cmd_list.GetNativeCommandBufferDefault().copyBufferToImage(vk_staging_buffer, GetNativeResource(),
+                                                                      vk::ImageLayout::eTransferDstOptimal, m_vk_copy_regions);
 }
 
 bool Texture::SetName(std::string_view name)
@@ -404,7 +458,7 @@ void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State targ
     META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(image_format_properties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear),
                               "texture pixel format does not support linear blitting");
 
-    constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+    const Rhi::CommandListId post_upload_cmd_list_id = GetBaseContext().GetPostUploadSyncCommandListId(GetUploadBatchIndex());
     const Rhi::ICommandList     & target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
     const vk::CommandBuffer& vk_cmd_buffer   = dynamic_cast<const RenderCommandList&>(target_cmd_list).GetNativeCommandBufferDefault();
 
@@ -40,6 +40,7 @@ vk::Format TypeConverter::PixelFormatToVulkan(PixelFormat pixel_format)
     case PixelFormat::RGBA8Unorm_sRGB:  return vk::Format::eR8G8B8A8Srgb;
     case PixelFormat::BGRA8Unorm:       return vk::Format::eB8G8R8A8Unorm;
     case PixelFormat::BGRA8Unorm_sRGB:  return vk::Format::eB8G8R8A8Srgb;
+    case PixelFormat::RGBA16Float:      return vk::Format::eR16G16B16A16Sfloat;
     case PixelFormat::Depth32Float:     return vk::Format::eD32Sfloat;
     case PixelFormat::R32Float:         return vk::Format::eR32Sfloat;
     case PixelFormat::R32Uint:          return vk::Format::eR32Uint;
@@ -49,11 +50,29 @@ vk::Format TypeConverter::PixelFormatToVulkan(PixelFormat pixel_format)
     case PixelFormat::R16Sint:          return vk::Format::eR16Sint;
     case PixelFormat::R16Unorm:         return vk::Format::eR16Unorm;
     case PixelFormat::R16Snorm:         return vk::Format::eR16Snorm;
+    case PixelFormat::RG16Unorm:        return vk::Format::eR16G16Unorm;
+    case PixelFormat::RG16Snorm:        return vk::Format::eR16G16Snorm;
     case PixelFormat::R8Uint:           return vk::Format::eR8Uint;
     case PixelFormat::R8Sint:           return vk::Format::eR8Sint;
     case PixelFormat::R8Unorm:          return vk::Format::eR8Unorm;
     case PixelFormat::R8Snorm:          return vk::Format::eR8Snorm;
     case PixelFormat::A8Unorm:          return vk::Format::eR8Unorm; // TODO: Channels swizzle?
+    case PixelFormat::BC1Unorm:         return vk::Format::eBc1RgbaUnormBlock;
+    case PixelFormat::BC1Unorm_sRGB:    return vk::Format::eBc1RgbaSrgbBlock;
+    case PixelFormat::BC3Unorm:         return vk::Format::eBc3UnormBlock;
+    case PixelFormat::BC3Unorm_sRGB:    return vk::Format::eBc3SrgbBlock;
+    case PixelFormat::BC4Unorm:         return vk::Format::eBc4UnormBlock;
+    case PixelFormat::BC4Snorm:         return vk::Format::eBc4SnormBlock;
+    case PixelFormat::BC5Unorm:         return vk::Format::eBc5UnormBlock;
+    case PixelFormat::BC5Snorm:         return vk::Format::eBc5SnormBlock;
+    case PixelFormat::BC7Unorm:         return vk::Format::eBc7UnormBlock;
+    case PixelFormat::BC7Unorm_sRGB:    return vk::Format::eBc7SrgbBlock;
+    case PixelFormat::ASTC4x4Unorm:     return vk::Format::eAstc4x4UnormBlock;
+    case PixelFormat::ASTC4x4Unorm_sRGB: return vk::Format::eAstc4x4SrgbBlock;
+    case PixelFormat::ASTC6x6Unorm:     return vk::Format::eAstc6x6UnormBlock;
+    case PixelFormat::ASTC6x6Unorm_sRGB: return vk::Format::eAstc6x6SrgbBlock;
+    case PixelFormat::ASTC8x8Unorm:     return vk::Format::eAstc8x8UnormBlock;
+    case PixelFormat::ASTC8x8Unorm_sRGB: return vk::Format::eAstc8x8SrgbBlock;
     default:                            META_UNEXPECTED_ARG_RETURN(pixel_format, vk::Format::eUndefined);
     }
 }
@@ -0,0 +1,252 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/UploadHeap.cpp
+Vulkan persistently mapped heap of host-visible memory for small buffers written directly from CPU.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/UploadHeap.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+
+#include <Methane/Data/LinearBlockAllocator.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class UploadHeap::Block
+{
+public:
+    Block(const vk::Device& vk_device, uint32_t memory_type_index, vk::DeviceSize size)
+        : m_memory_type_index(memory_type_index)
+        , m_vk_unique_memory(vk_device.allocateMemoryUnique(vk::MemoryAllocateInfo(size, memory_type_index)))
+        // Memory is mapped persistently and implicitly unmapped when it is freed
+        , m_data_ptr(static_cast<Data::RawPtr>(vk_device.mapMemory(m_vk_unique_memory.get(), 0U, size, vk::MemoryMapFlags{})))
+        , m_allocator(size)
+    {
+        META_CHECK_ARG_NOT_NULL_DESCR(m_data_ptr, "failed to map upload heap memory");
+    }
+
+    Opt<vk::DeviceSize> Allocate(const vk::MemoryRequirements& memory_requirements)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        return m_allocator.Allocate(memory_requirements.size, memory_requirements.alignment);
+    }
+
+    void Free()
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        m_allocator.Free();
+    }
+
+    uint32_t                GetMemoryTypeIndex() const noexcept { return m_memory_type_index; }
+    const vk::DeviceMemory& GetNativeMemory() const noexcept    { return m_vk_unique_memory.get(); }
+    Data::RawPtr            GetDataPtr() const noexcept         { return m_data_ptr; }
+
+private:
+    using Allocator = Data::LinearBlockAllocator<vk::DeviceSize>;
+
+    const uint32_t               m_memory_type_index;
+    const vk::UniqueDeviceMemory m_vk_unique_memory;
+    Data::RawPtr const           m_data_ptr;
+    Allocator                    m_allocator;
+    TracyLockable(std::mutex,    m_mutex);
+};
+
+UploadHeap::FrameRegions::FrameRegions(Allocation&& allocation, vk::DeviceSize region_size, uint32_t regions_count)
+    : m_allocation(std::move(allocation))
+    , m_region_size(region_size)
+    , m_regions_count(regions_count)
+    , m_data(static_cast<size_t>(region_size))
+    , m_region_data_versions(regions_count, 0U)
+{
+    META_CHECK_ARG_NOT_ZERO(regions_count);
+}
+
+UploadHeap::FrameRegions::~FrameRegions()
+{
+    META_FUNCTION_TASK();
+    m_allocation.block_ptr->Free();
+}
+
+vk::DeviceSize UploadHeap::FrameRegions::GetRegionOffset(uint32_t frame_index) const noexcept
+{
+    return m_region_size * (frame_index % m_regions_count);
+}
+
+bool UploadHeap::FrameRegions::UpdateRegion(uint32_t frame_index)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    if (const uint32_t region_index = frame_index % m_regions_count;
+        m_region_data_versions[region_index] != m_data_version)
+    {
+        CopyDataToRegion(region_index);
+    }
+    return std::all_of(m_region_data_versions.begin(), m_region_data_versions.end(),
+                       [this](uint64_t region_data_version) { return region_data_version == m_data_version; });
+}
+
+bool UploadHeap::FrameRegions::SetWriteHeapFrameIndex(uint64_t heap_frame_index) noexcept
+{
+    const bool is_written_in_frame = m_write_heap_frame_index == heap_frame_index;
+    m_write_heap_frame_index = heap_frame_index;
+    return is_written_in_frame;
+}
+
+void UploadHeap::FrameRegions::CommitWrite(uint32_t frame_index)
+{
+    META_FUNCTION_TASK();
+    m_data_version++;
+    CopyDataToRegion(frame_index % m_regions_count);
+}
+
+void UploadHeap::FrameRegions::CopyDataToRegion(uint32_t region_index)
+{
+    META_FUNCTION_TASK();
+    std::copy(m_data.begin(), m_data.end(), m_allocation.data_ptr + m_region_size * region_index);
+    m_region_data_versions[region_index] = m_data_version;
+}
+
+UploadHeap::UploadHeap(const Device& device)
+    : m_device(device)
+{ }
+
+Ptr<UploadHeap::FrameRegions> UploadHeap::AllocateFrameRegions(const vk::MemoryRequirements& memory_requirements,
+                                                               vk::DeviceSize region_size, uint32_t regions_count)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS_OR_EQUAL(region_size * regions_count, memory_requirements.size);
+    if (region_size > s_max_allocation_size || memory_requirements.size > s_block_size)
+        return {};
+
+    Allocation allocation = Allocate(memory_requirements);
+    if (!allocation)
+        return {};
+
+    return std::make_shared<FrameRegions>(std::move(allocation), region_size, regions_count);
+}
+
+UploadHeap::Allocation UploadHeap::Allocate(const vk::MemoryRequirements& memory_requirements)
+{
+    META_FUNCTION_TASK();
+    const Opt<uint32_t> memory_type_opt = FindMemoryType(memory_requirements.memoryTypeBits);
+    if (!memory_type_opt)
+        return {};
+
+    std::scoped_lock lock_guard(m_mutex);
+    for(const Ptr<Block>& block_ptr : m_blocks)
+    {
+        if (block_ptr->GetMemoryTypeIndex() != *memory_type_opt)
+            continue;
+
+        if (const Opt<vk::DeviceSize> offset_opt = block_ptr->Allocate(memory_requirements);
+            offset_opt)
+        {
+            return Allocation{ block_ptr, block_ptr->GetNativeMemory(), *offset_opt, block_ptr->GetDataPtr() + *offset_opt };
+        }
+    }
+
+    const Ptr<Block>& block_ptr = m_blocks.emplace_back(std::make_shared<Block>(m_device.GetNativeDevice(), *memory_type_opt, s_block_size));
+    const Opt<vk::DeviceSize> offset_opt = block_ptr->Allocate(memory_requirements);
+    META_CHECK_ARG_TRUE_DESCR(offset_opt.has_value(), "failed to allocate memory in new upload heap block");
+    return Allocation{ block_ptr, block_ptr->GetNativeMemory(), *offset_opt, block_ptr->GetDataPtr() + *offset_opt };
+}
+
+void UploadHeap::AddDirectUpload(const Ptr<FrameRegions>& frame_regions_ptr, Data::Size data_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(frame_regions_ptr);
+    std::scoped_lock lock_guard(m_mutex);
+    m_frame_statistics.direct_uploaded_data_size += data_size;
+    m_frame_statistics.saved_copy_commands_count++;
+    if (frame_regions_ptr->SetWriteHeapFrameIndex(m_frame_index))
+        m_frame_statistics.coalesced_writes_count++;
+
+    if (!frame_regions_ptr->SetOutdated(true))
+        m_outdated_frame_regions.emplace_back(frame_regions_ptr);
+}
+
+void UploadHeap::AddStagedUpload(Data::Size data_size, bool is_copy_command_recorded, bool is_coalesced)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    m_frame_statistics.staged_uploaded_data_size += data_size;
+    if (is_copy_command_recorded)
+        m_frame_statistics.copy_commands_count++;
+    else
+        m_frame_statistics.saved_copy_commands_count++;
+    if (is_coalesced)
+        m_frame_statistics.coalesced_writes_count++;
+}
+
+void UploadHeap::CompleteFrame(uint32_t next_frame_index)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    m_last_frame_statistics = m_frame_statistics;
+    m_frame_statistics = {};
+    m_frame_index++;
+
+    TracyPlot("Upload Heap Direct Uploaded Bytes", static_cast<int64_t>(m_last_frame_statistics.direct_uploaded_data_size));
+    TracyPlot("Upload Heap Staged Uploaded Bytes", static_cast<int64_t>(m_last_frame_statistics.staged_uploaded_data_size));
+    TracyPlot("Upload Heap Copy Commands",         static_cast<int64_t>(m_last_frame_statistics.copy_commands_count));
+    TracyPlot("Upload Heap Saved Copy Commands",   static_cast<int64_t>(m_last_frame_statistics.saved_copy_commands_count));
+    TracyPlot("Upload Heap Coalesced Writes",      static_cast<int64_t>(m_last_frame_statistics.coalesced_writes_count));
+    META_LOG("Upload heap frame statistics: {} bytes uploaded directly, {} bytes staged with {} copy commands, {} copy commands saved, {} writes coalesced",
+             m_last_frame_statistics.direct_uploaded_data_size, m_last_frame_statistics.staged_uploaded_data_size,
+             m_last_frame_statistics.copy_commands_count, m_last_frame_statistics.saved_copy_commands_count,
+             m_last_frame_statistics.coalesced_writes_count);
+
+    // Region of the next frame is not used by GPU anymore, so it is updated with the latest data written in previous frames,
+    // buffers are removed from the outdated list when all of their regions are up to date or when buffers are released
+    const auto outdated_end_it = std::remove_if(m_outdated_frame_regions.begin(), m_outdated_frame_regions.end(),
+        [next_frame_index](const WeakPtr<FrameRegions>& frame_regions_wptr)
+        {
+            const Ptr<FrameRegions> frame_regions_ptr = frame_regions_wptr.lock();
+            if (!frame_regions_ptr)
+                return true;
+
+            if (!frame_regions_ptr->UpdateRegion(next_frame_index))
+                return false;
+
+            frame_regions_ptr->SetOutdated(false);
+            return true;
+        });
+    m_outdated_frame_regions.erase(outdated_end_it, m_outdated_frame_regions.end());
+}
+
+Opt<uint32_t> UploadHeap::FindMemoryType(uint32_t memory_type_bits) const
+{
+    META_FUNCTION_TASK();
+    // Device-local memory visible to host is preferred to let GPU read data without PCIe transfers, when available
+    constexpr vk::MemoryPropertyFlags vk_host_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    if (const Opt<uint32_t> memory_type_opt = m_device.FindMemoryType(memory_type_bits, vk_host_memory_flags | vk::MemoryPropertyFlagBits::eDeviceLocal);
+        memory_type_opt)
+        return memory_type_opt;
+
+    return m_device.FindMemoryType(memory_type_bits, vk_host_memory_flags);
+}
+
+} // namespace Methane::Graphics::Vulkan
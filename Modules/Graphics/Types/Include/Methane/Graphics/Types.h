@@ -67,6 +67,7 @@ enum class PixelFormat : uint32_t
     RGBA8Unorm_sRGB,
     BGRA8Unorm,
     BGRA8Unorm_sRGB,
+    RGBA16Float,
     R32Float,
     R32Uint,
     R32Sint,
@@ -75,12 +76,32 @@ enum class PixelFormat : uint32_t
     R16Sint,
     R16Unorm,
     R16Snorm,
+    RG16Unorm,
+    RG16Snorm,
     R8Uint,
     R8Sint,
     R8Unorm,
     R8Snorm,
     A8Unorm,
-    Depth32Float
+    Depth32Float,
+
+    // Block-compressed formats
+    BC1Unorm,
+    BC1Unorm_sRGB,
+    BC3Unorm,
+    BC3Unorm_sRGB,
+    BC4Unorm,
+    BC4Snorm,
+    BC5Unorm,
+    BC5Snorm,
+    BC7Unorm,
+    BC7Unorm_sRGB,
+    ASTC4x4Unorm,
+    ASTC4x4Unorm_sRGB,
+    ASTC6x6Unorm,
+    ASTC6x6Unorm_sRGB,
+    ASTC8x8Unorm,
+    ASTC8x8Unorm_sRGB
 };
 
 using PixelFormats = std::vector<PixelFormat>;
@@ -92,9 +113,25 @@ struct AttachmentFormats
     PixelFormat  stencil  = PixelFormat::Unknown;
 };
 
+// Pixels of uncompressed formats are stored in blocks of 1x1 size
+struct PixelFormatBlock
+{
+    uint32_t   width  = 1U;
+    uint32_t   height = 1U;
+    Data::Size size   = 0U;
+};
+
 [[nodiscard]] Data::Size GetPixelSize(PixelFormat pixel_format);
+[[nodiscard]] PixelFormatBlock GetPixelFormatBlock(PixelFormat pixel_format);
 [[nodiscard]] bool IsSrgbColorSpace(PixelFormat pixel_format) noexcept;
 [[nodiscard]] bool IsDepthFormat(PixelFormat pixel_format) noexcept;
+[[nodiscard]] bool IsBlockCompressedFormat(PixelFormat pixel_format) noexcept;
+
+// Size math of tightly packed image data with rows of pixel blocks
+[[nodiscard]] uint32_t   GetMipLevelSize(uint32_t base_size, uint32_t mip_level) noexcept;
+[[nodiscard]] uint32_t   GetBlockRowsCount(PixelFormat pixel_format, uint32_t height);
+[[nodiscard]] Data::Size GetRowPitch(PixelFormat pixel_format, uint32_t width);
+[[nodiscard]] Data::Size GetSlicePitch(PixelFormat pixel_format, uint32_t width, uint32_t height);
 
 enum class Compare : uint32_t
 {
@@ -80,6 +80,9 @@ Data::Size GetPixelSize(PixelFormat pixel_format)
     META_FUNCTION_TASK();
     switch(pixel_format)
     {
+    case PixelFormat::RGBA16Float:
+        return 8;
+
     case PixelFormat::RGBA8:
     case PixelFormat::RGBA8Unorm:
     case PixelFormat::RGBA8Unorm_sRGB:
@@ -88,6 +91,8 @@ Data::Size GetPixelSize(PixelFormat pixel_format)
     case PixelFormat::R32Float:
     case PixelFormat::R32Uint:
     case PixelFormat::R32Sint:
+    case PixelFormat::RG16Unorm:
+    case PixelFormat::RG16Snorm:
     case PixelFormat::Depth32Float:
         return 4;
 
@@ -110,6 +115,40 @@ Data::Size GetPixelSize(PixelFormat pixel_format)
     }
 }
 
+PixelFormatBlock GetPixelFormatBlock(PixelFormat pixel_format)
+{
+    META_FUNCTION_TASK();
+    switch(pixel_format)
+    {
+    case PixelFormat::BC1Unorm:
+    case PixelFormat::BC1Unorm_sRGB:
+    case PixelFormat::BC4Unorm:
+    case PixelFormat::BC4Snorm:
+        return { 4U, 4U, 8U };
+
+    case PixelFormat::BC3Unorm:
+    case PixelFormat::BC3Unorm_sRGB:
+    case PixelFormat::BC5Unorm:
+    case PixelFormat::BC5Snorm:
+    case PixelFormat::BC7Unorm:
+    case PixelFormat::BC7Unorm_sRGB:
+    case PixelFormat::ASTC4x4Unorm:
+    case PixelFormat::ASTC4x4Unorm_sRGB:
+        return { 4U, 4U, 16U };
+
+    case PixelFormat::ASTC6x6Unorm:
+    case PixelFormat::ASTC6x6Unorm_sRGB:
+        return { 6U, 6U, 16U };
+
+    case PixelFormat::ASTC8x8Unorm:
+    case PixelFormat::ASTC8x8Unorm_sRGB:
+        return { 8U, 8U, 16U };
+
+    default:
+        return { 1U, 1U, GetPixelSize(pixel_format) };
+    }
+}
+
 bool IsSrgbColorSpace(PixelFormat pixel_format) noexcept
 {
     META_FUNCTION_TASK();
@@ -117,6 +156,12 @@ bool IsSrgbColorSpace(PixelFormat pixel_format) noexcept
     {
     case PixelFormat::RGBA8Unorm_sRGB:
     case PixelFormat::BGRA8Unorm_sRGB:
+    case PixelFormat::BC1Unorm_sRGB:
+    case PixelFormat::BC3Unorm_sRGB:
+    case PixelFormat::BC7Unorm_sRGB:
+    case PixelFormat::ASTC4x4Unorm_sRGB:
+    case PixelFormat::ASTC6x6Unorm_sRGB:
+    case PixelFormat::ASTC8x8Unorm_sRGB:
         return true;
 
     default:
@@ -130,4 +175,36 @@ bool IsDepthFormat(PixelFormat pixel_format) noexcept
     return pixel_format == PixelFormat::Depth32Float;
 }
 
+bool IsBlockCompressedFormat(PixelFormat pixel_format) noexcept
+{
+    META_FUNCTION_TASK();
+    return pixel_format >= PixelFormat::BC1Unorm && pixel_format <= PixelFormat::ASTC8x8Unorm_sRGB;
+}
+
+uint32_t GetMipLevelSize(uint32_t base_size, uint32_t mip_level) noexcept
+{
+    META_FUNCTION_TASK();
+    return mip_level < 32U ? std::max(1U, base_size >> mip_level) : 1U;
+}
+
+uint32_t GetBlockRowsCount(PixelFormat pixel_format, uint32_t height)
+{
+    META_FUNCTION_TASK();
+    const uint32_t block_height = GetPixelFormatBlock(pixel_format).height;
+    return (height + block_height - 1U) / block_height;
+}
+
+Data::Size GetRowPitch(PixelFormat pixel_format, uint32_t width)
+{
+    META_FUNCTION_TASK();
+    const PixelFormatBlock block = GetPixelFormatBlock(pixel_format);
+    return (width + block.width - 1U) / block.width * block.size;
+}
+
+Data::Size GetSlicePitch(PixelFormat pixel_format, uint32_t width, uint32_t height)
+{
+    META_FUNCTION_TASK();
+    return GetRowPitch(pixel_format, width) * GetBlockRowsCount(pixel_format, height);
+}
+
 } // namespace Methane::Graphics
@@ -30,6 +30,8 @@ Methane kit interfaces: all headers under one umbrella.
 #include <Methane/Graphics/RHI/Implementations.h>
 #include <Methane/Graphics/Primitives.h>
 #include <Methane/Graphics/ActionCamera.h>
+#include <Methane/Graphics/FrustumCuller.h>
+#include <Methane/Graphics/InstanceTransforms.h>
 
 // Methane User Interface Headers
 
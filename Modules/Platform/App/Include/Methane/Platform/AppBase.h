@@ -24,6 +24,7 @@ Base application interface and platform-independent implementation.
 #pragma once
 
 #include "IApp.h"
+#include "FrameUpdatePipeline.h"
 
 #include <Methane/Platform/AppView.h>
 #include <Methane/Platform/Input/State.h>
@@ -115,6 +116,8 @@ protected:
 
 private:
     bool UpdateAndRender();
+    void RenderFrame();
+    FrameUpdatePipeline& GetFrameUpdatePipeline();
 
     template<typename ObjectType, typename FuncType, typename... ArgTypes>
     bool ExecuteWithErrorHandling(std::string_view stage_name, bool is_error_deferred, ObjectType& obj, FuncType&& func_ptr, ArgTypes&&... args)
@@ -159,6 +162,7 @@ private:
     Input::State    m_input_state;
 
     mutable UniquePtr<tf::Executor> m_parallel_executor_ptr;
+    UniquePtr<FrameUpdatePipeline>  m_frame_update_pipeline_ptr;
 };
 
 } // namespace Methane::Platform
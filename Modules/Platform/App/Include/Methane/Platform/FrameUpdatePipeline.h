@@ -0,0 +1,63 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/FrameUpdatePipeline.h
+Frame update and render pipeline with optional update of the next frame
+in parallel with rendering of the current frame.
+
+******************************************************************************/
+
+#pragma once
+
+#include <functional>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Platform
+{
+
+class FrameUpdatePipeline
+{
+public:
+    using Function = std::function<void()>;
+
+    FrameUpdatePipeline(tf::Executor& parallel_executor, Function update_function, Function render_function);
+
+    // Pipelined update is enabled only by applications which Update does not change the state used by Render,
+    // otherwise frame state has to be copied per frame by the application before enabling it
+    void SetPipelined(bool is_pipelined) noexcept;
+    bool IsPipelined() const noexcept { return m_is_pipelined; }
+
+    // Updates and renders current frame. In pipelined mode the next frame is updated on worker thread
+    // while current frame is rendered, but update is always completed before returning from this function
+    // to keep input and window events processing single-threaded.
+    void Execute();
+
+private:
+    tf::Executor& m_parallel_executor;
+    Function      m_update_function;
+    Function      m_render_function;
+    bool          m_is_pipelined = false;
+    bool          m_is_next_frame_updated = false;
+};
+
+} // namespace Methane::Platform
@@ -40,12 +40,15 @@ struct AppSettings
     Data::FloatSize  size     { 0.8F, 0.8F};   // if dimension < 1.0 use as ratio of desktop size; else use as exact size in pixels/dots
     Data::FrameSize  min_size { 640U, 480U };
     bool             is_full_screen = false;
+    bool             is_update_pipelined = false; // opt-in for applications which Update does not change the state used by Render:
+                                                  // next frame is updated on worker thread in parallel with current frame rendering
     Data::IProvider* icon_provider  = nullptr;
 
     AppSettings& SetName(std::string&& new_name) noexcept;
     AppSettings& SetSize(Data::FloatSize&& new_size) noexcept;
     AppSettings& SetMinSize(Data::FrameSize&& new_min_size) noexcept;
     AppSettings& SetFullScreen(bool new_full_screen) noexcept;
+    AppSettings& SetUpdatePipelined(bool new_update_pipelined) noexcept;
     AppSettings& SetIconProvider(Data::IProvider* new_icon_provider) noexcept;
 };
 
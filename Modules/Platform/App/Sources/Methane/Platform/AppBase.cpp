@@ -141,6 +141,13 @@ IApp::Settings& IApp::Settings::SetFullScreen(bool new_full_screen) noexcept
     return *this;
 }
 
+IApp::Settings& IApp::Settings::SetUpdatePipelined(bool new_update_pipelined) noexcept
+{
+    META_FUNCTION_TASK();
+    is_update_pipelined = new_update_pipelined;
+    return *this;
+}
+
 IApp::Settings& IApp::Settings::SetIconProvider(Data::IProvider* new_icon_provider) noexcept
 {
     META_FUNCTION_TASK();
@@ -159,6 +166,12 @@ AppBase::AppBase(const AppBase::Settings& settings)
     AddRectSizeOption(*this, "-w,--wnd-size", m_settings.size, "Window size in pixels or as ratio of desktop size", true);
     add_option("-f,--full-screen", m_settings.is_full_screen, "Full-screen mode");
 
+    // Pipelined update option is available only in applications declaring that their Update does not change Render state
+    if (m_settings.is_update_pipelined)
+    {
+        add_option("-u,--pipelined-update", m_settings.is_update_pipelined, "Update next frame in parallel with current frame rendering");
+    }
+
 #ifdef __APPLE__
     // When application is opened on MacOS with its Bundle,
     // OS adds an additional command-line option which looks like "-psn_0_23004655" which should be allowed
@@ -366,8 +379,30 @@ bool AppBase::UpdateAndRender()
     if (HasError() || m_is_resize_required_to_render)
         return false;
 
-    Update();
+    FrameUpdatePipeline& frame_update_pipeline = GetFrameUpdatePipeline();
+    if (frame_update_pipeline.IsPipelined() != m_settings.is_update_pipelined)
+    {
+        frame_update_pipeline.SetPipelined(m_settings.is_update_pipelined);
+    }
+    frame_update_pipeline.Execute();
+    return true;
+}
+
+FrameUpdatePipeline& AppBase::GetFrameUpdatePipeline()
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_update_pipeline_ptr)
+    {
+        m_frame_update_pipeline_ptr = std::make_unique<FrameUpdatePipeline>(GetParallelExecutor(),
+                                                                            [this]() { Update(); },
+                                                                            [this]() { RenderFrame(); });
+    }
+    return *m_frame_update_pipeline_ptr;
+}
 
+void AppBase::RenderFrame()
+{
+    META_FUNCTION_TASK();
     try
     {
         Render();
@@ -379,7 +414,6 @@ bool AppBase::UpdateAndRender()
         // see https://github.com/MethanePowered/MethaneKit/issues/105
         m_is_resize_required_to_render = true;
     }
-    return true;
 }
 
 } // namespace Methane::Platform
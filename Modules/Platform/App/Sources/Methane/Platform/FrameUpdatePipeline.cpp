@@ -0,0 +1,83 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/FrameUpdatePipeline.cpp
+Frame update and render pipeline with optional update of the next frame
+in parallel with rendering of the current frame.
+
+******************************************************************************/
+
+#include <Methane/Platform/FrameUpdatePipeline.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+
+namespace Methane::Platform
+{
+
+FrameUpdatePipeline::FrameUpdatePipeline(tf::Executor& parallel_executor, Function update_function, Function render_function)
+    : m_parallel_executor(parallel_executor)
+    , m_update_function(std::move(update_function))
+    , m_render_function(std::move(render_function))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(m_update_function), "frame update function is not set");
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(m_render_function), "frame render function is not set");
+}
+
+void FrameUpdatePipeline::SetPipelined(bool is_pipelined) noexcept
+{
+    META_FUNCTION_TASK();
+    m_is_pipelined = is_pipelined;
+    m_is_next_frame_updated = false;
+}
+
+void FrameUpdatePipeline::Execute()
+{
+    META_FUNCTION_TASK();
+    if (!m_is_pipelined)
+    {
+        m_update_function();
+        m_render_function();
+        return;
+    }
+
+    // The first frame is updated in advance, then each next frame is updated on worker thread
+    if (!m_is_next_frame_updated)
+    {
+        m_update_function();
+    }
+
+    m_is_next_frame_updated = false;
+    auto next_frame_update_future = m_parallel_executor.async([this]() { m_update_function(); });
+    try
+    {
+        m_render_function();
+    }
+    catch(...)
+    {
+        next_frame_update_future.wait();
+        throw;
+    }
+
+    next_frame_update_future.get();
+    m_is_next_frame_updated = true;
+}
+
+} // namespace Methane::Platform
@@ -0,0 +1,207 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/AsyncLogger.h
+Asynchronous logger with lock-free multi-producer single-consumer queue of bounded size,
+background writer thread and per-category log levels.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/ILogger.h>
+
+#include <fmt/format.h>
+
+#include <atomic>
+#include <array>
+#include <vector>
+#include <string>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+namespace Methane::Platform
+{
+
+enum class LogLevel : uint8_t
+{
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Off
+};
+
+using LogCategoryId = uint8_t;
+
+class AsyncLogger final : public ILogger // NOSONAR - custom destructor is required
+{
+public:
+    enum class DropPolicy : uint8_t
+    {
+        DiscardNewest, // new records are discarded when queue is full, so memory usage and logging latency are bounded
+        WaitForSpace   // logging threads wait until writer frees space in queue, so no records are lost
+    };
+
+    struct Settings
+    {
+        uint32_t   records_capacity = 4096U; // rounded up to the power of two
+        uint32_t   max_message_size = 512U;  // longer messages are truncated
+        DropPolicy drop_policy      = DropPolicy::DiscardNewest;
+        LogLevel   default_level    = LogLevel::Debug;
+    };
+
+    static constexpr LogCategoryId g_default_category_id  = 0U;
+    static constexpr size_t        g_max_categories_count = 64U;
+
+    // Global logger used by META_LOG, which writes to platform debug output
+    [[nodiscard]] static AsyncLogger& Get();
+
+    AsyncLogger(ILogger& sink, const Settings& settings);
+    ~AsyncLogger() override;
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    // Returns identifier of the category with given name, new categories are created with the default log level
+    LogCategoryId RegisterCategory(std::string_view category_name);
+    void          SetCategoryLevel(LogCategoryId category_id, LogLevel level);
+    void          SetAllCategoriesLevel(LogLevel level);
+
+    // Unknown categories are disabled
+    [[nodiscard]] LogLevel GetCategoryLevel(LogCategoryId category_id) const noexcept
+    {
+        return category_id < g_max_categories_count
+             ? m_level_by_category[category_id].load(std::memory_order_relaxed)
+             : LogLevel::Off;
+    }
+
+    [[nodiscard]] bool IsEnabled(LogCategoryId category_id, LogLevel level) const noexcept
+    { return level != LogLevel::Off && level >= GetCategoryLevel(category_id); }
+
+    // Message is formatted in place of the queue record without memory allocations,
+    // while record prefix formatting and writing to the sink are deferred to the writer thread
+    template<typename... ArgTypes>
+    bool Log(LogCategoryId category_id, LogLevel level, fmt::format_string<ArgTypes...> format, ArgTypes&&... args)
+    {
+        if (!IsEnabled(category_id, level))
+            return false;
+
+        if (!m_is_running.load(std::memory_order_acquire))
+        {
+            std::string message;
+            try
+            {
+                message = fmt::format(format, std::forward<ArgTypes>(args)...);
+            }
+            catch(...)
+            {
+                message = GetFormatErrorMessage();
+            }
+            WriteSynchronously(category_id, level, message);
+            return true;
+        }
+
+        const std::optional<uint64_t> record_position = ReserveRecord();
+        if (!record_position)
+            return false;
+
+        // Reserved record is always committed, because writer can not skip uncommitted records,
+        // so format errors (like with invalid runtime format strings) are written to the record instead of the message
+        char* const message_ptr = GetRecordMessagePtr(*record_position);
+        size_t message_size = 0U;
+        try
+        {
+            message_size = fmt::format_to_n(message_ptr, m_settings.max_message_size, format, std::forward<ArgTypes>(args)...).size;
+        }
+        catch(...)
+        {
+            message_size = WriteFormatErrorMessage(message_ptr);
+        }
+        CommitRecord(*record_position, category_id, level, message_size);
+        return true;
+    }
+
+    // ILogger interface
+    void Log(std::string_view message) override;
+
+    // Blocks until all records logged before this call are written to the sink
+    void Flush();
+
+    // Stops writer thread after writing all queued records, later records are written to the sink synchronously
+    void Stop();
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept          { return m_settings; }
+    [[nodiscard]] uint64_t        GetDroppedRecordsCount() const noexcept { return m_dropped_records_count.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t        GetWrittenRecordsCount() const noexcept { return m_written_records_count.load(std::memory_order_acquire); }
+
+private:
+    struct RecordHeader
+    {
+        uint32_t      message_size = 0U;
+        LogCategoryId category_id  = g_default_category_id;
+        LogLevel      level        = LogLevel::Debug;
+        bool          is_truncated = false;
+    };
+
+    [[nodiscard]] std::optional<uint64_t> ReserveRecord();
+    [[nodiscard]] char* GetRecordMessagePtr(uint64_t record_position) const noexcept;
+    [[nodiscard]] static std::string GetFormatErrorMessage();
+    size_t WriteFormatErrorMessage(char* message_ptr) const noexcept;
+    void CommitRecord(uint64_t record_position, LogCategoryId category_id, LogLevel level, size_t message_size) noexcept;
+    void WriteSynchronously(LogCategoryId category_id, LogLevel level, std::string_view message);
+    void WriteRecordsAfterStop();
+    void AppendRecordLine(std::string& lines, LogCategoryId category_id, LogLevel level, std::string_view message, bool is_truncated) const;
+    bool WriteQueuedRecords();
+    void WakeUpWriter() noexcept;
+    void WriterThreadLoop();
+
+    ILogger&                                              m_sink;
+    const Settings                                        m_settings;
+    const uint64_t                                        m_records_mask;
+    std::unique_ptr<std::atomic<uint64_t>[]>              m_record_sequences;
+    std::vector<RecordHeader>                             m_record_headers;
+    std::unique_ptr<char[]>                               m_record_messages;
+    alignas(64) std::atomic<uint64_t>                     m_enqueue_position{ 0U };
+    alignas(64) uint64_t                                  m_dequeue_position = 0U; // accessed by writer thread only
+    std::atomic<uint64_t>                                 m_written_records_count{ 0U };
+    std::atomic<uint64_t>                                 m_dropped_records_count{ 0U };
+    uint64_t                                              m_reported_dropped_count = 0U;
+    std::array<std::atomic<LogLevel>, g_max_categories_count> m_level_by_category;
+    std::array<std::string, g_max_categories_count>       m_category_names;
+    size_t                                                m_categories_count = 1U;
+    std::mutex                                            m_categories_mutex;
+    std::string                                           m_lines_batch;
+    std::mutex                                            m_sync_write_mutex;
+    std::mutex                                            m_writer_mutex;
+    std::condition_variable                               m_writer_wake_condition;
+    std::condition_variable                               m_records_written_condition;
+    std::atomic<bool>                                     m_is_writer_waiting{ false };
+    std::atomic<bool>                                     m_is_running{ true };
+    std::atomic<bool>                                     m_is_writer_stopped{ false };
+    std::thread                                           m_writer_thread;
+};
+
+} // namespace Methane::Platform
@@ -0,0 +1,381 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Platform/AsyncLogger.cpp
+Asynchronous logger with lock-free multi-producer single-consumer queue of bounded size,
+background writer thread and per-category log levels.
+
+******************************************************************************/
+
+#include <Methane/Platform/AsyncLogger.h>
+#include <Methane/Platform/Logger.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace Methane::Platform
+{
+
+static constexpr std::chrono::milliseconds g_writer_wait_timeout(10);
+static constexpr size_t g_max_lines_batch_size = 64U * 1024U;
+
+[[nodiscard]]
+static uint64_t GetPowerOfTwoCapacity(uint32_t capacity) noexcept
+{
+    uint64_t power_of_two = 1U;
+    while (power_of_two < capacity)
+    {
+        power_of_two <<= 1U;
+    }
+    return power_of_two;
+}
+
+[[nodiscard]]
+static std::string_view GetLevelPrefix(LogLevel level) noexcept
+{
+    switch (level)
+    {
+    case LogLevel::Warning: return "WARNING: ";
+    case LogLevel::Error:   return "ERROR: ";
+    default:                return {};
+    }
+}
+
+AsyncLogger& AsyncLogger::Get()
+{
+    // Global logger and its sink are never destroyed to allow logging during static objects destruction,
+    // writer thread is stopped at exit after writing all queued records, so later records are written synchronously
+    static AsyncLogger* const s_async_logger_ptr = []()
+    {
+        auto* const platform_logger_ptr = new Logger(); // NOSONAR
+        auto* const async_logger_ptr    = new AsyncLogger(*platform_logger_ptr, Settings{}); // NOSONAR
+        std::atexit([]() { AsyncLogger::Get().Stop(); });
+        return async_logger_ptr;
+    }();
+    return *s_async_logger_ptr;
+}
+
+AsyncLogger::AsyncLogger(ILogger& sink, const Settings& settings)
+    : m_sink(sink)
+    , m_settings(settings)
+    , m_records_mask(GetPowerOfTwoCapacity(settings.records_capacity) - 1U)
+    , m_record_sequences(std::make_unique<std::atomic<uint64_t>[]>(m_records_mask + 1U))
+    , m_record_headers(m_records_mask + 1U)
+    , m_record_messages(std::make_unique<char[]>((m_records_mask + 1U) * settings.max_message_size))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(settings.records_capacity);
+    META_CHECK_ARG_NOT_ZERO(settings.max_message_size);
+
+    for (uint64_t record_index = 0U; record_index <= m_records_mask; ++record_index)
+    {
+        m_record_sequences[record_index].store(record_index, std::memory_order_relaxed);
+    }
+    for (std::atomic<LogLevel>& category_level : m_level_by_category)
+    {
+        category_level.store(settings.default_level, std::memory_order_relaxed);
+    }
+
+    m_writer_thread = std::thread(&AsyncLogger::WriterThreadLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    META_FUNCTION_TASK();
+    Stop();
+}
+
+LogCategoryId AsyncLogger::RegisterCategory(std::string_view category_name)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_categories_mutex);
+    const auto category_names_end_it = m_category_names.begin() + static_cast<std::ptrdiff_t>(m_categories_count);
+    if (const auto category_name_it = std::find(m_category_names.begin(), category_names_end_it, category_name);
+        category_name_it != category_names_end_it)
+        return static_cast<LogCategoryId>(std::distance(m_category_names.begin(), category_name_it));
+
+    META_CHECK_ARG_LESS_DESCR(m_categories_count, g_max_categories_count, "maximum count of log categories is reached");
+    m_category_names[m_categories_count] = category_name;
+    return static_cast<LogCategoryId>(m_categories_count++);
+}
+
+void AsyncLogger::SetCategoryLevel(LogCategoryId category_id, LogLevel level)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(category_id, g_max_categories_count);
+    m_level_by_category[category_id].store(level, std::memory_order_relaxed);
+}
+
+void AsyncLogger::SetAllCategoriesLevel(LogLevel level)
+{
+    META_FUNCTION_TASK();
+    for (std::atomic<LogLevel>& category_level : m_level_by_category)
+    {
+        category_level.store(level, std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogger::Log(std::string_view message)
+{
+    Log(g_default_category_id, LogLevel::Info, "{}", message);
+}
+
+void AsyncLogger::Flush()
+{
+    META_FUNCTION_TASK();
+    const uint64_t flush_position = m_enqueue_position.load(std::memory_order_acquire);
+    std::unique_lock lock(m_writer_mutex);
+    m_writer_wake_condition.notify_one();
+    m_records_written_condition.wait(lock, [this, flush_position]()
+    {
+        return m_written_records_count.load(std::memory_order_acquire) >= flush_position ||
+               !m_is_running.load(std::memory_order_acquire);
+    });
+}
+
+void AsyncLogger::Stop()
+{
+    META_FUNCTION_TASK();
+    if (!m_is_running.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    {
+        std::lock_guard lock(m_writer_mutex);
+        m_writer_wake_condition.notify_one();
+        m_records_written_condition.notify_all();
+    }
+    m_writer_thread.join();
+
+    // Writer thread is finished, so records committed concurrently with stopping are written by this thread,
+    // while records committed later are written by the logging threads (see WriteRecordsAfterStop)
+    m_is_writer_stopped.store(true, std::memory_order_seq_cst);
+    WriteRecordsAfterStop();
+}
+
+void AsyncLogger::WriteRecordsAfterStop()
+{
+    std::lock_guard lock(m_sync_write_mutex);
+    while (WriteQueuedRecords());
+}
+
+std::optional<uint64_t> AsyncLogger::ReserveRecord()
+{
+    uint64_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const uint64_t sequence = m_record_sequences[position & m_records_mask].load(std::memory_order_acquire);
+        if (const auto difference = static_cast<int64_t>(sequence - position);
+            difference == 0)
+        {
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                return position;
+        }
+        else if (difference < 0)
+        {
+            // Queue is full: the oldest record was not written yet.
+            // When logger is stopped, records are not dropped, but written by the logging thread
+            if (m_is_writer_stopped.load(std::memory_order_acquire))
+            {
+                WriteRecordsAfterStop();
+            }
+            else if (m_settings.drop_policy == DropPolicy::DiscardNewest && m_is_running.load(std::memory_order_relaxed))
+            {
+                m_dropped_records_count.fetch_add(1U, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            WakeUpWriter();
+            std::this_thread::yield();
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+char* AsyncLogger::GetRecordMessagePtr(uint64_t record_position) const noexcept
+{
+    return m_record_messages.get() + (record_position & m_records_mask) * m_settings.max_message_size;
+}
+
+void AsyncLogger::CommitRecord(uint64_t record_position, LogCategoryId category_id, LogLevel level, size_t message_size) noexcept
+{
+    const uint64_t record_index = record_position & m_records_mask;
+    RecordHeader& record_header = m_record_headers[record_index];
+    record_header.message_size  = static_cast<uint32_t>(std::min<size_t>(message_size, m_settings.max_message_size));
+    record_header.is_truncated  = message_size > m_settings.max_message_size;
+    record_header.category_id   = category_id;
+    record_header.level         = level;
+
+    m_record_sequences[record_index].store(record_position + 1U, std::memory_order_release);
+
+    // Sequentially consistent fence pairs with the writer stopped flag store in Stop: either Stop writes this record
+    // after setting the flag, or this thread observes the flag and writes the record itself
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_is_writer_stopped.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            WriteRecordsAfterStop();
+        }
+        catch(...)
+        {
+            // Records are left in queue for the next writing attempt, when sink or mutex fails
+        }
+        return;
+    }
+    WakeUpWriter();
+}
+
+std::string AsyncLogger::GetFormatErrorMessage()
+{
+    try
+    {
+        throw;
+    }
+    catch(const std::exception& e)
+    {
+        return fmt::format("<log message format error: {}>", e.what());
+    }
+    catch(...)
+    {
+        return "<log message format error>";
+    }
+}
+
+size_t AsyncLogger::WriteFormatErrorMessage(char* message_ptr) const noexcept
+{
+    try
+    {
+        const std::string error_message = GetFormatErrorMessage();
+        const size_t message_size = std::min<size_t>(error_message.size(), m_settings.max_message_size);
+        std::copy_n(error_message.data(), message_size, message_ptr);
+        return message_size;
+    }
+    catch(...)
+    {
+        return 0U;
+    }
+}
+
+void AsyncLogger::WriteSynchronously(LogCategoryId category_id, LogLevel level, std::string_view message)
+{
+    META_FUNCTION_TASK();
+    std::string line;
+    AppendRecordLine(line, category_id, level, message, false);
+    line.pop_back();
+
+    std::lock_guard lock(m_sync_write_mutex);
+    m_sink.Log(line);
+}
+
+void AsyncLogger::AppendRecordLine(std::string& lines, LogCategoryId category_id, LogLevel level, std::string_view message, bool is_truncated) const
+{
+    if (category_id != g_default_category_id)
+    {
+        lines += '[';
+        lines += m_category_names[category_id];
+        lines += "] ";
+    }
+    lines += GetLevelPrefix(level);
+    lines += message;
+    if (is_truncated)
+    {
+        lines += " <...truncated>";
+    }
+    lines += '\n';
+}
+
+bool AsyncLogger::WriteQueuedRecords()
+{
+    META_FUNCTION_TASK();
+    uint64_t written_records_count = 0U;
+    m_lines_batch.clear();
+
+    while (m_lines_batch.size() < g_max_lines_batch_size)
+    {
+        const uint64_t record_index = m_dequeue_position & m_records_mask;
+        if (m_record_sequences[record_index].load(std::memory_order_acquire) != m_dequeue_position + 1U)
+            break;
+
+        // Record message is copied to the lines batch before its slot is released for producers
+        const RecordHeader& record_header = m_record_headers[record_index];
+        AppendRecordLine(m_lines_batch, record_header.category_id, record_header.level,
+                         std::string_view(GetRecordMessagePtr(m_dequeue_position), record_header.message_size),
+                         record_header.is_truncated);
+
+        m_record_sequences[record_index].store(m_dequeue_position + m_records_mask + 1U, std::memory_order_release);
+        ++m_dequeue_position;
+        ++written_records_count;
+    }
+
+    if (const uint64_t dropped_records_count = m_dropped_records_count.load(std::memory_order_relaxed);
+        dropped_records_count != m_reported_dropped_count)
+    {
+        m_lines_batch += fmt::format("WARNING: {} log records were dropped on logger queue overflow\n",
+                                     dropped_records_count - m_reported_dropped_count);
+        m_reported_dropped_count = dropped_records_count;
+    }
+
+    if (m_lines_batch.empty())
+        return false;
+
+    // Sink writes message as a separate line, so the last line break is removed
+    m_lines_batch.pop_back();
+    m_sink.Log(m_lines_batch);
+
+    {
+        std::lock_guard lock(m_writer_mutex);
+        m_written_records_count.fetch_add(written_records_count, std::memory_order_release);
+    }
+    m_records_written_condition.notify_all();
+    return true;
+}
+
+void AsyncLogger::WakeUpWriter() noexcept
+{
+    if (m_is_writer_waiting.load(std::memory_order_relaxed) &&
+        m_is_writer_waiting.exchange(false, std::memory_order_acq_rel))
+    {
+        m_writer_wake_condition.notify_one();
+    }
+}
+
+void AsyncLogger::WriterThreadLoop()
+{
+    META_THREAD_NAME("Async Logger");
+    while (true)
+    {
+        if (WriteQueuedRecords())
+            continue;
+
+        if (!m_is_running.load(std::memory_order_acquire))
+            break;
+
+        // Wake up notifications are sent without locking mutex, so waiting is limited with timeout to not miss records
+        std::unique_lock lock(m_writer_mutex);
+        m_is_writer_waiting.store(true, std::memory_order_release);
+        m_writer_wake_condition.wait_for(lock, g_writer_wait_timeout);
+        m_is_writer_waiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace Methane::Platform
@@ -29,6 +29,7 @@ Base template class of the Methane user interface application.
 
 #include <Methane/Graphics/App.hpp>
 #include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/BatchRenderer.h>
 #include <Methane/Instrumentation.h>
 
 namespace Methane::UserInterface
@@ -49,6 +49,7 @@ class Badge;
 class Text;
 class Panel;
 class Context;
+class BatchRenderer;
 
 class AppBase // NOSONAR - custom destructor is required
 {
@@ -103,19 +104,21 @@ private:
     bool UpdateTextPanel(TextPanel& text_panel);
     void UpdateHelpTextPosition() const;
     void UpdateParametersTextPosition() const;
-
-    IApp::Settings      m_app_settings;
-    FontContext         m_font_context;
-    UniquePtr<Context>  m_ui_context_ptr;
-    UnitSize            m_frame_size;
-    UnitPoint           m_text_margins;
-    UnitPoint           m_window_padding;
-    Ptr<Badge>          m_logo_badge_ptr;
-    Ptr<HeadsUpDisplay> m_hud_ptr;
-    Opt<Font>           m_main_font_opt;
-    std::string         m_help_text_str;
-    HelpTextPanels      m_help_columns;
-    TextPanel           m_parameters;
+    void UpdateBatch() const;
+
+    IApp::Settings           m_app_settings;
+    FontContext              m_font_context;
+    UniquePtr<Context>       m_ui_context_ptr;
+    UnitSize                 m_frame_size;
+    UnitPoint                m_text_margins;
+    UnitPoint                m_window_padding;
+    Ptr<Badge>               m_logo_badge_ptr;
+    Ptr<HeadsUpDisplay>      m_hud_ptr;
+    UniquePtr<BatchRenderer> m_batch_renderer_ptr;
+    Opt<Font>                m_main_font_opt;
+    std::string              m_help_text_str;
+    HelpTextPanels           m_help_columns;
+    TextPanel                m_parameters;
 };
 
 } // namespace Methane::UserInterface
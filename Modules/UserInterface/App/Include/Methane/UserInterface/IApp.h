@@ -47,6 +47,7 @@ struct AppSettings
     UnitPoint                window_padding        { Units::Dots, 30, 30 };
     Font::Description        main_font             { "Main",  "Fonts/RobotoMono/RobotoMono-Regular.ttf", 11U };
     HeadsUpDisplay::Settings hud_settings;
+    bool                     batched_rendering_enabled = false; // draw all overlay widgets and texts with one batch renderer
 
     AppSettings& SetHeadsUpDisplayMode(HeadsUpDisplayMode new_heads_up_display_mode) noexcept;
     AppSettings& SetLogoBadgeVisible(bool new_logo_badge_visible) noexcept;
@@ -56,6 +57,7 @@ struct AppSettings
     AppSettings& SetWindowPadding(const UnitPoint& new_window_padding) noexcept;
     AppSettings& SetMainFont(const Font::Description& new_main_font) noexcept;
     AppSettings& SetHudSettings(const HeadsUpDisplay::Settings& new_hud_settings) noexcept;
+    AppSettings& SetBatchedRenderingEnabled(bool new_batched_rendering_enabled) noexcept;
 };
 
 struct IApp : Graphics::IApp
@@ -26,6 +26,7 @@ Base implementation of the Methane user interface application.
 #include <Methane/UserInterface/Text.h>
 #include <Methane/UserInterface/Panel.h>
 #include <Methane/UserInterface/Badge.h>
+#include <Methane/UserInterface/BatchRenderer.h>
 #include <Methane/Graphics/RHI/RenderCommandList.h>
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Graphics/ImageLoader.h>
@@ -99,6 +100,11 @@ void AppBase::InitUI(const Platform::IApp& app, const rhi::CommandQueue& render_
         m_hud_ptr = std::make_shared<HeadsUpDisplay>(*m_ui_context_ptr, m_font_context, m_app_settings.hud_settings);
     }
 
+    if (m_app_settings.batched_rendering_enabled)
+    {
+        m_batch_renderer_ptr = std::make_unique<BatchRenderer>(*m_ui_context_ptr, BatchRenderer::Settings{ "Overlay UI Batch" });
+    }
+
     // Update displayed text blocks
     if (!m_help_columns.first.text_str.empty()  && UpdateTextPanel(m_help_columns.first) &&
         (m_help_columns.second.text_str.empty() || UpdateTextPanel(m_help_columns.second)))
@@ -117,6 +123,7 @@ void AppBase::ReleaseUI()
     META_FUNCTION_TASK();
     m_logo_badge_ptr.reset();
     m_hud_ptr.reset();
+    m_batch_renderer_ptr.reset();
     m_main_font_opt.reset();
     m_help_columns.first.Reset(false);
     m_help_columns.second.Reset(false);
@@ -151,6 +158,10 @@ bool AppBase::UpdateUI() const
     m_help_columns.first.Update(m_frame_size);
     m_help_columns.second.Update(m_frame_size);
     m_parameters.Update(m_frame_size);
+
+    if (m_batch_renderer_ptr)
+        UpdateBatch();
+
     return true;
 }
 
@@ -159,6 +170,12 @@ void AppBase::RenderOverlay(const rhi::RenderCommandList& cmd_list) const
     META_FUNCTION_TASK();
     META_DEBUG_GROUP_VAR(s_debug_group, "Overlay Rendering");
 
+    if (m_batch_renderer_ptr)
+    {
+        m_batch_renderer_ptr->Draw(cmd_list, &s_debug_group);
+        return;
+    }
+
     if (m_hud_ptr && m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
         m_hud_ptr->Draw(cmd_list, &s_debug_group);
 
@@ -170,6 +187,22 @@ void AppBase::RenderOverlay(const rhi::RenderCommandList& cmd_list) const
         m_logo_badge_ptr->Draw(cmd_list, &s_debug_group);
 }
 
+void AppBase::UpdateBatch() const
+{
+    META_FUNCTION_TASK();
+    std::vector<const Item*> overlay_items;
+    if (m_hud_ptr && m_app_settings.heads_up_display_mode == HeadsUpDisplayMode::UserInterface)
+        overlay_items.push_back(m_hud_ptr.get());
+
+    // Text items are children of text panels and are batched along with them
+    overlay_items.push_back(m_help_columns.first.panel_ptr.get());
+    overlay_items.push_back(m_help_columns.second.panel_ptr.get());
+    overlay_items.push_back(m_parameters.panel_ptr.get());
+    overlay_items.push_back(m_logo_badge_ptr.get());
+
+    m_batch_renderer_ptr->Update(overlay_items, m_frame_size);
+}
+
 void AppBase::TextPanel::Update(const FrameSize& frame_size) const
 {
     META_FUNCTION_TASK();
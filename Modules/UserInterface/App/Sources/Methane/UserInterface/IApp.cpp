@@ -82,4 +82,11 @@ AppSettings& AppSettings::SetHudSettings(const HeadsUpDisplay::Settings& new_hud
     return *this;
 }
 
+AppSettings& AppSettings::SetBatchedRenderingEnabled(bool new_batched_rendering_enabled) noexcept
+{
+    META_FUNCTION_TASK();
+    batched_rendering_enabled = new_batched_rendering_enabled;
+    return *this;
+}
+
 } // namespace Methane::UserInterface
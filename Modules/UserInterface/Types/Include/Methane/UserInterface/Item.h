@@ -32,6 +32,7 @@ namespace Methane::UserInterface
 
 class Item;
 class Context;
+class QuadBatch;
 
 struct IItemCallback
 {
@@ -65,6 +66,9 @@ public:
     bool SetOrigin(const UnitPoint& origin);
     bool SetSize(const UnitSize& size);
 
+    // Adds screen quads of the item to the batch rendered with one vertex buffer
+    virtual void AddToBatch(QuadBatch&) const { }
+
 private:
     Context&  m_ui_context;
     UnitPoint m_rel_origin_px;
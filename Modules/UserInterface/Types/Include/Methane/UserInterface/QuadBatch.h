@@ -0,0 +1,100 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/QuadBatch.h
+Batch of screen quads and text glyph quads gathered from user interface items
+into one vertex array with draw ranges of consecutive quads sharing a texture.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Types.hpp"
+
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Data/Vector.hpp>
+#include <Methane/Data/Types.h>
+
+#include <vector>
+
+namespace Methane::UserInterface
+{
+
+namespace rhi = Methane::Graphics::Rhi;
+
+class QuadBatch
+{
+public:
+    enum class TextureMode : uint32_t
+    {
+        Disabled = 0U,
+        RgbaFloat,
+        RFloatToAlpha,
+    };
+
+    struct Vertex
+    {
+        Data::RawVector2F position; // normalized device coordinates
+        Data::RawVector3F texcoord; // z-component is the texture mode used for quad sampling
+        Data::RawVector4F color;
+    };
+
+    // Range of consecutive quads drawn with one texture, untextured quads are merged to any range
+    struct DrawRange
+    {
+        rhi::Texture texture;
+        Data::Index  start_quad = 0U;
+        Data::Size   quad_count = 0U;
+    };
+
+    using Vertices   = std::vector<Vertex>;
+    using DrawRanges = std::vector<DrawRange>;
+
+    static constexpr Data::Size g_vertices_per_quad = 4U;
+    static constexpr Data::Size g_indices_per_quad  = 6U;
+
+    // Clears batch content retaining allocated memory, quads will be placed in frame of the given size
+    void Reset(const FrameSize& frame_size);
+
+    void AddQuad(const FrameRect& screen_rect, const Color4F& color);
+    void AddTexturedQuad(const FrameRect& screen_rect, const rhi::Texture& texture, TextureMode texture_mode, const Color4F& color);
+    void AddTexturedQuad(const FloatRect& screen_rect, const FloatRect& texcoord_rect, const rhi::Texture& texture,
+                         TextureMode texture_mode, const Color4F& color);
+
+    [[nodiscard]] const FrameSize&  GetFrameSize() const noexcept  { return m_frame_size; }
+    [[nodiscard]] Data::Size        GetQuadCount() const noexcept  { return static_cast<Data::Size>(m_vertices.size() / g_vertices_per_quad); }
+    [[nodiscard]] const Vertices&   GetVertices() const noexcept   { return m_vertices; }
+    [[nodiscard]] const DrawRanges& GetDrawRanges() const noexcept { return m_draw_ranges; }
+    [[nodiscard]] bool              IsEmpty() const noexcept       { return m_vertices.empty(); }
+
+    // Indices of quads triangles list with vertices order used in batch: top-left, bottom-left, bottom-right, top-right
+    [[nodiscard]] static std::vector<uint32_t> GenerateQuadIndices(Data::Size quad_count);
+
+private:
+    void AddQuadVertices(float left, float top, float right, float bottom, const FloatRect& texcoord_rect,
+                         TextureMode texture_mode, const Color4F& color);
+    void AddToDrawRange(const rhi::Texture* texture_ptr);
+
+    FrameSize  m_frame_size;
+    float      m_x_scale = 0.F;
+    float      m_y_scale = 0.F;
+    Vertices   m_vertices;
+    DrawRanges m_draw_ranges;
+};
+
+} // namespace Methane::UserInterface
@@ -74,4 +74,14 @@ bool Container::SetRect(const UnitRect& ui_rect)
     return true;
 }
 
+void Container::AddToBatch(QuadBatch& quad_batch) const
+{
+    META_FUNCTION_TASK();
+    for (const Ptr<Item>& child_item_ptr : GetChildren())
+    {
+        META_CHECK_ARG_NOT_NULL(child_item_ptr);
+        child_item_ptr->AddToBatch(quad_batch);
+    }
+}
+
 } // namespace Methane::UserInterface
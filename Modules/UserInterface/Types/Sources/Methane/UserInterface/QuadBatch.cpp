@@ -0,0 +1,133 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/QuadBatch.cpp
+Batch of screen quads and text glyph quads gathered from user interface items
+into one vertex array with draw ranges of consecutive quads sharing a texture.
+
+******************************************************************************/
+
+#include <Methane/UserInterface/QuadBatch.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::UserInterface
+{
+
+static const FloatRect g_full_texcoord_rect{ { 0.F, 0.F }, { 1.F, 1.F } };
+
+void QuadBatch::Reset(const FrameSize& frame_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(frame_size, "quad batch frame size can not be zero");
+    m_frame_size = frame_size;
+    m_x_scale    = 2.F / static_cast<float>(frame_size.GetWidth());
+    m_y_scale    = 2.F / static_cast<float>(frame_size.GetHeight());
+    m_vertices.clear();
+    m_draw_ranges.clear();
+}
+
+void QuadBatch::AddQuad(const FrameRect& screen_rect, const Color4F& color)
+{
+    META_FUNCTION_TASK();
+    AddToDrawRange(nullptr);
+    AddQuadVertices(static_cast<float>(screen_rect.GetLeft()),  static_cast<float>(screen_rect.GetTop()),
+                    static_cast<float>(screen_rect.GetRight()), static_cast<float>(screen_rect.GetBottom()),
+                    g_full_texcoord_rect, TextureMode::Disabled, color);
+}
+
+void QuadBatch::AddTexturedQuad(const FrameRect& screen_rect, const rhi::Texture& texture, TextureMode texture_mode, const Color4F& color)
+{
+    META_FUNCTION_TASK();
+    AddToDrawRange(texture_mode == TextureMode::Disabled ? nullptr : &texture);
+    AddQuadVertices(static_cast<float>(screen_rect.GetLeft()),  static_cast<float>(screen_rect.GetTop()),
+                    static_cast<float>(screen_rect.GetRight()), static_cast<float>(screen_rect.GetBottom()),
+                    g_full_texcoord_rect, texture_mode, color);
+}
+
+void QuadBatch::AddTexturedQuad(const FloatRect& screen_rect, const FloatRect& texcoord_rect, const rhi::Texture& texture,
+                                TextureMode texture_mode, const Color4F& color)
+{
+    META_FUNCTION_TASK();
+    AddToDrawRange(texture_mode == TextureMode::Disabled ? nullptr : &texture);
+    AddQuadVertices(screen_rect.GetLeft(), screen_rect.GetTop(), screen_rect.GetRight(), screen_rect.GetBottom(),
+                    texcoord_rect, texture_mode, color);
+}
+
+std::vector<uint32_t> QuadBatch::GenerateQuadIndices(Data::Size quad_count)
+{
+    META_FUNCTION_TASK();
+    std::vector<uint32_t> indices;
+    indices.reserve(quad_count * g_indices_per_quad);
+    for (uint32_t start_vertex = 0U; start_vertex < quad_count * g_vertices_per_quad; start_vertex += g_vertices_per_quad)
+    {
+        indices.push_back(start_vertex);
+        indices.push_back(start_vertex + 1U);
+        indices.push_back(start_vertex + 2U);
+        indices.push_back(start_vertex + 2U);
+        indices.push_back(start_vertex + 3U);
+        indices.push_back(start_vertex);
+    }
+    return indices;
+}
+
+void QuadBatch::AddQuadVertices(float left, float top, float right, float bottom, const FloatRect& texcoord_rect,
+                                TextureMode texture_mode, const Color4F& color)
+{
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_frame_size, "quad batch should be reset with frame size before adding quads");
+
+    // Screen coordinates in pixels with Y-axis pointing down are converted to normalized device coordinates
+    const float ndc_left   = left   * m_x_scale - 1.F;
+    const float ndc_right  = right  * m_x_scale - 1.F;
+    const float ndc_top    = 1.F - top    * m_y_scale;
+    const float ndc_bottom = 1.F - bottom * m_y_scale;
+    const auto  mode       = static_cast<float>(texture_mode);
+    const Data::RawVector4F vertex_color(color.AsArray<float>());
+
+    m_vertices.push_back({ { ndc_left,  ndc_top    }, { texcoord_rect.GetLeft(),  texcoord_rect.GetTop(),    mode }, vertex_color });
+    m_vertices.push_back({ { ndc_left,  ndc_bottom }, { texcoord_rect.GetLeft(),  texcoord_rect.GetBottom(), mode }, vertex_color });
+    m_vertices.push_back({ { ndc_right, ndc_bottom }, { texcoord_rect.GetRight(), texcoord_rect.GetBottom(), mode }, vertex_color });
+    m_vertices.push_back({ { ndc_right, ndc_top    }, { texcoord_rect.GetRight(), texcoord_rect.GetTop(),    mode }, vertex_color });
+}
+
+void QuadBatch::AddToDrawRange(const rhi::Texture* texture_ptr)
+{
+    // Draw order of quads is preserved for correct alpha blending, so new range is started on each texture switch
+    const auto quad_index = static_cast<Data::Index>(m_vertices.size() / g_vertices_per_quad);
+    if (!m_draw_ranges.empty())
+    {
+        DrawRange& last_range = m_draw_ranges.back();
+        if (!texture_ptr || (texture_ptr->IsInitialized() && last_range.texture == *texture_ptr))
+        {
+            last_range.quad_count++;
+            return;
+        }
+        if (!last_range.texture.IsInitialized())
+        {
+            // Range of untextured quads adopts the first texture used in it
+            last_range.texture = *texture_ptr;
+            last_range.quad_count++;
+            return;
+        }
+    }
+
+    m_draw_ranges.push_back({ texture_ptr ? *texture_ptr : rhi::Texture(), quad_index, 1U });
+}
+
+} // namespace Methane::UserInterface
@@ -94,6 +94,7 @@ public:
     using Library     = FontLibrary;
 
     [[nodiscard]] static std::u32string ConvertUtf8To32(std::string_view text);
+    static void                         ConvertUtf8To32(std::string_view text, std::u32string& utf32_text); // reuses capacity of the output string
     [[nodiscard]] static std::string    ConvertUtf32To8(std::u32string_view text);
     [[nodiscard]] static std::u32string GetAlphabetDefault() { return GetAlphabetInRange(32, 126); }
     [[nodiscard]] static std::u32string GetAlphabetInRange(char32_t from, char32_t to);
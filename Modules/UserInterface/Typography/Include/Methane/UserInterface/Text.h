@@ -116,6 +116,7 @@ struct ITextCallback
 
 class Context;
 class Font;
+class QuadBatch;
 
 namespace rhi = Methane::Graphics::Rhi;
 
@@ -164,6 +165,9 @@ public:
     void Update(const gfx::FrameSize& frame_size) const;
     void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
 
+    // Adds glyph quads of the text mesh in screen coordinates to the batch instead of drawing text with its own buffers
+    void AddToBatch(QuadBatch& quad_batch) const;
+
 private:
     class Impl;
 
@@ -31,6 +31,7 @@ Font atlas textures generation and fonts library management classes.
 
 #include <codecvt>
 #include <locale>
+#include <stdexcept>
 
 namespace Methane::UserInterface
 {
@@ -56,8 +57,58 @@ FreeTypeError::FreeTypeError(FT_Error error)
 std::u32string Font::ConvertUtf8To32(std::string_view text)
 {
     META_FUNCTION_TASK();
-    static std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-    return converter.from_bytes(text.data(), text.data() + text.length());
+    std::u32string utf32_text;
+    ConvertUtf8To32(text, utf32_text);
+    return utf32_text;
+}
+
+void Font::ConvertUtf8To32(std::string_view text, std::u32string& utf32_text)
+{
+    META_FUNCTION_TASK();
+    utf32_text.clear();
+    for(size_t byte_index = 0; byte_index < text.length();)
+    {
+        const auto lead_byte = static_cast<uint8_t>(text[byte_index]);
+        size_t   char_bytes_count = 1;
+        char32_t char_code        = lead_byte;
+        if (lead_byte >= 0x80U)
+        {
+            if ((lead_byte & 0xE0U) == 0xC0U)
+            {
+                char_bytes_count = 2;
+                char_code        = lead_byte & 0x1FU;
+            }
+            else if ((lead_byte & 0xF0U) == 0xE0U)
+            {
+                char_bytes_count = 3;
+                char_code        = lead_byte & 0x0FU;
+            }
+            else if ((lead_byte & 0xF8U) == 0xF0U)
+            {
+                char_bytes_count = 4;
+                char_code        = lead_byte & 0x07U;
+            }
+            else
+            {
+                throw std::range_error(fmt::format("invalid UTF-8 lead byte at position {}", byte_index));
+            }
+        }
+
+        if (byte_index + char_bytes_count > text.length())
+            throw std::range_error(fmt::format("incomplete UTF-8 character at position {}", byte_index));
+
+        for(size_t continuation_index = 1; continuation_index < char_bytes_count; ++continuation_index)
+        {
+            const auto continuation_byte = static_cast<uint8_t>(text[byte_index + continuation_index]);
+            if ((continuation_byte & 0xC0U) != 0x80U)
+                throw std::range_error(fmt::format("invalid UTF-8 continuation byte at position {}", byte_index + continuation_index));
+
+            char_code = (char_code << 6U) | (continuation_byte & 0x3FU);
+        }
+
+        utf32_text.push_back(char_code);
+        byte_index += char_bytes_count;
+    }
 }
 
 std::string Font::ConvertUtf32To8(std::u32string_view text)
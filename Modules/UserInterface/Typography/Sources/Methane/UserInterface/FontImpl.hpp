@@ -359,7 +359,15 @@ public:
     [[nodiscard]] Chars GetTextChars(const std::u32string& text)
     {
         META_FUNCTION_TASK();
-        Refs<const Char> text_chars;
+        Chars text_chars;
+        GetTextChars(text, text_chars);
+        return text_chars;
+    }
+
+    void GetTextChars(std::u32string_view text, Chars& text_chars)
+    {
+        META_FUNCTION_TASK();
+        text_chars.clear();
         text_chars.reserve(text.length());
         for (Char::Code char_code : text)
         {
@@ -368,7 +376,6 @@ public:
 
             text_chars.emplace_back(AddChar(char_code));
         }
-        return text_chars;
     }
 
     gfx::FramePoint GetKerning(const Char& left_char, const Char& right_char) const
@@ -26,6 +26,7 @@ Methane text rendering primitive.
 #include <Methane/UserInterface/Font.h>
 #include <Methane/UserInterface/Text.h>
 #include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/QuadBatch.h>
 
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Graphics/RHI/RenderState.h>
@@ -236,7 +237,10 @@ public:
 
         if (!m_uniforms_buffer.IsInitialized())
         {
-            m_uniforms_buffer = render_context.CreateBuffer(rhi::BufferSettings::ForConstantBuffer(uniforms_data_size));
+            // Uniforms are updated on text layout changes, which may happen every frame, so they are written by CPU directly when supported by RHI
+            rhi::BufferSettings uniforms_buffer_settings = rhi::BufferSettings::ForConstantBuffer(uniforms_data_size, true);
+            uniforms_buffer_settings.is_direct_cpu_write = true;
+            m_uniforms_buffer = render_context.CreateBuffer(uniforms_buffer_settings);
             m_uniforms_buffer.SetName(fmt::format("{} Text Uniforms Buffer {}", text_name, m_frame_index));
 
             if (m_program_bindings.IsInitialized())
@@ -291,6 +295,7 @@ private:
     FrameSize           m_render_attachment_size = FrameSize::Max();
     Font                m_font;
     UniquePtr<TextMesh> m_text_mesh_ptr;
+    std::u32string      m_utf32_text_buffer;
     rhi::RenderState    m_render_state;
     rhi::ViewState      m_view_state;
     rhi::Buffer         m_const_buffer;
@@ -312,7 +317,7 @@ public:
         m_frame_rect = m_ui_context.ConvertTo<Units::Pixels>(m_settings.rect);
 
         rhi::IObjectRegistry& gfx_objects_registry = ui_context.GetRenderContext().GetObjectRegistry();
-        if (const auto render_state_ptr = std::dynamic_pointer_cast<rhi::IRenderState>(gfx_objects_registry.GetGraphicsObject(m_settings.state_name));
+        if (const auto render_state_ptr = gfx_objects_registry.GetGraphicsObject<rhi::IRenderState>(m_settings.state_name);
             render_state_ptr)
         {
             META_CHECK_ARG_EQUAL_DESCR(render_state_ptr->GetSettings().render_pattern_ptr->GetSettings(), render_pattern.GetSettings(),
@@ -340,7 +345,7 @@ public:
                         },
                         rhi::ProgramArgumentAccessors
                         {
-                            { { rhi::ShaderType::Vertex, "g_uniforms"  }, rhi::ProgramArgumentAccessor::Type::Mutable  },
+                            { { rhi::ShaderType::Vertex, "g_uniforms"  }, rhi::ProgramArgumentAccessor::Type::Mutable, true },
                             { { rhi::ShaderType::Pixel,  "g_constants" }, rhi::ProgramArgumentAccessor::Type::Mutable  },
                             { { rhi::ShaderType::Pixel,  "g_texture"   }, rhi::ProgramArgumentAccessor::Type::Mutable  },
                             { { rhi::ShaderType::Pixel,  "g_sampler"   }, rhi::ProgramArgumentAccessor::Type::Constant },
@@ -374,7 +379,7 @@ public:
         });
 
         static const std::string s_sampler_name = "Font Atlas Sampler";
-        if (const auto atlas_sampler_ptr = std::dynamic_pointer_cast<rhi::ISampler>(gfx_objects_registry.GetGraphicsObject(s_sampler_name));
+        if (const auto atlas_sampler_ptr = gfx_objects_registry.GetGraphicsObject<rhi::ISampler>(s_sampler_name);
             atlas_sampler_ptr)
         {
             m_atlas_sampler = rhi::Sampler(atlas_sampler_ptr);
@@ -449,7 +454,9 @@ public:
     void SetTextInScreenRect(std::string_view text, const UnitRect& ui_rect)
     {
         META_FUNCTION_TASK();
-        SetTextInScreenRect(Font::ConvertUtf8To32(text), ui_rect);
+        // Text is converted to the reused buffer to avoid memory allocations on frequent updates
+        Font::ConvertUtf8To32(text, m_utf32_text_buffer);
+        SetTextInScreenRect(std::u32string_view(m_utf32_text_buffer), ui_rect);
     }
 
     void SetTextInScreenRect(std::u32string_view text, const UnitRect& ui_rect)
@@ -602,6 +609,33 @@ public:
         cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle);
     }
 
+    void AddToBatch(QuadBatch& quad_batch) const
+    {
+        META_FUNCTION_TASK();
+        if (!m_text_mesh_ptr || m_text_mesh_ptr->GetVertices().empty())
+            return;
+
+        // Text mesh vertices are in pixels relative to the viewport top-left corner with Y-axis pointing up,
+        // each glyph quad starts from top-left vertex and has bottom-right vertex third
+        const FrameRect           viewport_rect = GetAlignedViewportRect();
+        const auto                origin_x      = static_cast<float>(viewport_rect.origin.GetX());
+        const auto                origin_y      = static_cast<float>(viewport_rect.origin.GetY());
+        const rhi::Texture&       atlas_texture = m_font.GetAtlasTexture(m_ui_context.GetRenderContext());
+        const TextMesh::Vertices& vertices      = m_text_mesh_ptr->GetVertices();
+        for(size_t quad_vertex_index = 0U; quad_vertex_index + 3U < vertices.size(); quad_vertex_index += 4U)
+        {
+            const TextMesh::Vertex& top_left     = vertices[quad_vertex_index];
+            const TextMesh::Vertex& bottom_right = vertices[quad_vertex_index + 2U];
+            const FloatRect screen_rect(origin_x + top_left.position.GetX(), origin_y - top_left.position.GetY(),
+                                        bottom_right.position.GetX() - top_left.position.GetX(),
+                                        top_left.position.GetY() - bottom_right.position.GetY());
+            const FloatRect texcoord_rect(top_left.texcoord.GetX(), top_left.texcoord.GetY(),
+                                          bottom_right.texcoord.GetX() - top_left.texcoord.GetX(),
+                                          bottom_right.texcoord.GetY() - top_left.texcoord.GetY());
+            quad_batch.AddTexturedQuad(screen_rect, texcoord_rect, atlas_texture, QuadBatch::TextureMode::RFloatToAlpha, m_settings.color);
+        }
+    }
+
     // IFontCallback interface
     void OnFontAtlasTextureReset(Font& font, const rhi::Texture* old_atlas_texture_ptr, const rhi::Texture* new_atlas_texture_ptr) override
     {
@@ -708,6 +742,10 @@ private:
         {
             m_text_mesh_ptr->Update(m_settings.text, m_frame_rect.size);
         }
+        else if (m_text_mesh_ptr)
+        {
+            m_text_mesh_ptr->Reset(m_settings.text, m_settings.layout, m_frame_rect.size);
+        }
         else
         {
             m_text_mesh_ptr = std::make_unique<TextMesh>(m_settings.text, m_settings.layout, m_font, m_frame_rect.size);
@@ -958,4 +996,9 @@ void Text::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDe
     GetImpl(m_impl_ptr).Draw(cmd_list, debug_group_ptr);
 }
 
+void Text::AddToBatch(QuadBatch& quad_batch) const
+{
+    GetImpl(m_impl_ptr).AddToBatch(quad_batch);
+}
+
 } // namespace Methane::Graphics
@@ -108,12 +108,11 @@ void ForEachTextCharacterInRange(const Font::Impl& font, const FontChars& text_c
 }
 
 template<typename FuncType> // function CharAction(const FontChar& text_char, const TextMesh::CharPosition& char_pos, size_t char_index)
-static void ForEachTextCharacter(const std::u32string& text, Font::Impl& font, TextMesh::CharPositions& char_positions,
+static void ForEachTextCharacter(const FontChars& text_chars, Font::Impl& font, TextMesh::CharPositions& char_positions,
                                  uint32_t frame_width, Text::Wrap wrap, FuncType process_char_at_position)
 {
     META_FUNCTION_TASK();
-    const FontChars text_chars = font.GetTextChars(text);
-    const IndexRange  text_range { 0, text_chars.size() };
+    const IndexRange text_range { 0, text_chars.size() };
     if (wrap == Text::Wrap::Word && frame_width)
     {
         ForEachTextCharacterInRange(font, text_chars, text_range, char_positions, frame_width, wrap,
@@ -158,7 +157,7 @@ TextMesh::CharPosition::CharPosition(CoordinateType x, CoordinateType y, bool is
 {
 }
 
-TextMesh::TextMesh(const std::u32string& text, Text::Layout layout, Font& font, gfx::FrameSize& frame_size)
+TextMesh::TextMesh(std::u32string_view text, Text::Layout layout, Font& font, gfx::FrameSize& frame_size)
     : m_font(font)
     , m_layout(layout)
     , m_frame_size(frame_size)
@@ -169,7 +168,7 @@ TextMesh::TextMesh(const std::u32string& text, Text::Layout layout, Font& font,
     Update(text, frame_size);
 }
 
-bool TextMesh::IsUpdatable(const std::u32string& text, const Text::Layout& layout, Font& font, const gfx::FrameSize& frame_size) const noexcept
+bool TextMesh::IsUpdatable(std::u32string_view text, const Text::Layout& layout, Font& font, const gfx::FrameSize& frame_size) const noexcept
 {
     META_FUNCTION_TASK();
     // Text mesh can be updated when all text visualization parameters are equal to the initial
@@ -182,7 +181,7 @@ bool TextMesh::IsUpdatable(const std::u32string& text, const Text::Layout& layou
            (IsNewTextStartsWithOldOne(text) || IsOldTextStartsWithNewOne(text));
 }
 
-void TextMesh::Update(const std::u32string& text, gfx::FrameSize& frame_size)
+void TextMesh::Update(std::u32string_view text, gfx::FrameSize& frame_size)
 {
     META_FUNCTION_TASK();
     const bool new_text_starts_with_old_one = IsNewTextStartsWithOldOne(text);
@@ -216,6 +215,23 @@ void TextMesh::Update(const std::u32string& text, gfx::FrameSize& frame_size)
     return;
 }
 
+void TextMesh::Reset(std::u32string_view text, const Text::Layout& layout, gfx::FrameSize& frame_size)
+{
+    META_FUNCTION_TASK();
+    m_layout                = layout;
+    m_frame_size            = frame_size;
+    m_content_size          = gfx::FrameSize(frame_size.GetWidth(), 0U);
+    m_content_top_offset    = std::numeric_limits<uint32_t>::max();
+    m_last_whitespace_index = std::string::npos;
+    m_last_line_start_index = 0U;
+    m_text.clear();
+    m_char_positions.clear();
+    m_vertices.clear();
+    m_indices.clear();
+
+    Update(text, frame_size);
+}
+
 void TextMesh::EraseTrailingChars(size_t erase_chars_count, bool fixup_whitespace, bool update_alignment_and_content_size)
 {
     META_FUNCTION_TASK();
@@ -276,7 +292,7 @@ void TextMesh::EraseTrailingChars(size_t erase_chars_count, bool fixup_whitespac
     }
 }
 
-void TextMesh::AppendChars(std::u32string added_text)
+void TextMesh::AppendChars(std::u32string_view added_text)
 {
     META_FUNCTION_TASK();
     if (added_text.empty())
@@ -297,7 +313,9 @@ void TextMesh::AppendChars(std::u32string added_text)
         }
         if (update_from_index < m_text.length())
         {
-            added_text = m_text.substr(update_from_index) + added_text;
+            m_appended_text.assign(m_text, update_from_index);
+            m_appended_text.append(added_text);
+            added_text = m_appended_text;
             EraseTrailingChars(m_text.length() - update_from_index, false, false);
         }
         m_last_whitespace_index = std::string::npos;
@@ -319,7 +337,8 @@ void TextMesh::AppendChars(std::u32string added_text)
     }
     m_char_positions.reserve(m_char_positions.size() + added_text.length());
 
-    ForEachTextCharacter(added_text, m_font.GetImplementation(), m_char_positions, m_frame_size.GetWidth(), m_layout.wrap,
+    m_font.GetImplementation().GetTextChars(added_text, m_appended_chars);
+    ForEachTextCharacter(m_appended_chars, m_font.GetImplementation(), m_char_positions, m_frame_size.GetWidth(), m_layout.wrap,
         [this, init_text_length, &atlas_size](const FontChar& font_char, const TextMesh::CharPosition& char_pos, size_t char_index)
         {
             if (font_char.IsWhiteSpace())
@@ -25,7 +25,10 @@ Methane text mesh generation helper.
 
 #include <Methane/UserInterface/Text.h>
 #include <Methane/Graphics/Types.h>
+#include <Methane/Memory.hpp>
 
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace Methane::UserInterface
@@ -64,10 +67,13 @@ public:
 
     using CharPositions = std::vector<CharPosition>;
 
-    TextMesh(const std::u32string& text, Text::Layout layout, Font& font, gfx::FrameSize& frame_size);
+    TextMesh(std::u32string_view text, Text::Layout layout, Font& font, gfx::FrameSize& frame_size);
 
-    [[nodiscard]] bool IsUpdatable(const std::u32string& text, const Text::Layout& layout, Font& font, const gfx::FrameSize& frame_size) const noexcept;
-    void Update(const std::u32string& text, gfx::FrameSize& frame_size);
+    [[nodiscard]] bool IsUpdatable(std::u32string_view text, const Text::Layout& layout, Font& font, const gfx::FrameSize& frame_size) const noexcept;
+    void Update(std::u32string_view text, gfx::FrameSize& frame_size);
+
+    // Rebuilds mesh of the new text with the same font, while reusing memory of the previous text mesh
+    void Reset(std::u32string_view text, const Text::Layout& layout, gfx::FrameSize& frame_size);
 
     [[nodiscard]] const std::u32string& GetText() const noexcept              { return m_text; }
     [[nodiscard]] Font&                 GetFont() noexcept                    { return m_font; }
@@ -87,7 +93,7 @@ public:
 
 private:
     void EraseTrailingChars(size_t erase_chars_count, bool fixup_whitespace, bool update_alignment_and_content_size);
-    void AppendChars(std::u32string added_text);
+    void AppendChars(std::u32string_view added_text);
     void AddCharQuad(const FontChar& font_char, const gfx::FramePoint& char_pos, const gfx::FrameSize& atlas_size);
     void ApplyAlignmentOffset(const size_t aligned_text_length, const size_t line_start_index);
     int32_t GetLineWidth(size_t line_start_index) const;
@@ -104,8 +110,8 @@ private:
 
     std::u32string       m_text;
     Font&                m_font;
-    const Text::Layout   m_layout;
-    const gfx::FrameSize m_frame_size;
+    Text::Layout         m_layout;
+    gfx::FrameSize       m_frame_size;
     gfx::FrameSize       m_content_size;
     uint32_t             m_content_top_offset = std::numeric_limits<uint32_t>::max(); // minimum distance from frame top border to character quads in first text line
     CharPositions        m_char_positions; // char positions without any hor/ver alignment
@@ -113,6 +119,8 @@ private:
     size_t               m_last_line_start_index = 0U;
     Vertices             m_vertices;
     Indices              m_indices;
+    std::u32string       m_appended_text;  // reused buffer of the text appended to mesh
+    Refs<const FontChar> m_appended_chars; // reused buffer of the font characters appended to mesh
 };
 
 } // namespace Methane::Graphics
@@ -77,6 +77,9 @@ public:
     void SetCorner(FrameCorner frame_corner);
     void SetMargins(const UnitSize& margins);
 
+    // Item overrides
+    void AddToBatch(QuadBatch& quad_batch) const override;
+
 private:
     // Item overrides
     bool SetRect(const UnitRect& ui_rect) override;
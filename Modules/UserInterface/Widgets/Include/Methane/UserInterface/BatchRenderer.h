@@ -0,0 +1,111 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/BatchRenderer.h
+Batched renderer of user interface items drawing all panels, badges and text items
+from one dynamic vertex buffer with one draw call per texture switch.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/UserInterface/QuadBatch.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+
+#include <string>
+#include <vector>
+
+namespace Methane::Graphics::Rhi
+{
+class RenderPattern;
+class RenderCommandList;
+class CommandListDebugGroup;
+}
+
+namespace Methane::UserInterface
+{
+
+class Item;
+class Context;
+
+class BatchRenderer
+{
+public:
+    struct Settings
+    {
+        std::string name = "UI Batch";
+
+        // Minimize number of vertex/index buffer re-allocations on dynamic batch updates by reserving additional size with multiplication of required size
+        Data::Size  buffers_reservation_multiplier = 2U;
+    };
+
+    BatchRenderer(Context& ui_context, const Settings& settings);
+    BatchRenderer(Context& ui_context, const rhi::RenderPattern& render_pattern, const Settings& settings);
+
+    // Gathers quads of the given items with all their children and uploads them to the vertex buffer of current frame
+    void Update(const std::vector<const Item*>& items, const FrameSize& render_attachment_size);
+    void Update(const QuadBatch& quad_batch);
+
+    // Draws all gathered quads with one draw call per range of quads sharing a texture
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
+
+    [[nodiscard]] const Settings&  GetSettings() const noexcept       { return m_settings; }
+    [[nodiscard]] const QuadBatch& GetQuadBatch() const noexcept      { return m_quad_batch; }
+    [[nodiscard]] Data::Size       GetDrawCallsCount() const noexcept { return static_cast<Data::Size>(m_draw_calls.size()); }
+
+private:
+    struct TextureBindings
+    {
+        rhi::Texture         texture;
+        rhi::ProgramBindings program_bindings;
+    };
+
+    struct DrawCall
+    {
+        rhi::ProgramBindings program_bindings;
+        uint32_t             index_count = 0U;
+        uint32_t             start_index = 0U;
+    };
+
+    void UpdateVertexBuffer(const QuadBatch::Vertices& vertices);
+    void UpdateIndexBuffer(Data::Size quad_count);
+    void UpdateViewState(const FrameSize& render_attachment_size);
+    const rhi::ProgramBindings& GetTextureBindings(const rhi::Texture& texture);
+
+    Context&                     m_ui_context;
+    Settings                     m_settings;
+    rhi::RenderState             m_render_state;
+    rhi::ViewState               m_view_state;
+    rhi::Sampler                 m_texture_sampler;
+    rhi::Texture                 m_white_texture;
+    rhi::Buffer                  m_index_buffer;
+    Data::Size                   m_index_buffer_quad_count = 0U;
+    std::vector<rhi::BufferSet>  m_frame_vertex_buffer_sets;
+    std::vector<TextureBindings> m_texture_bindings;
+    std::vector<DrawCall>        m_draw_calls;
+    FrameSize                    m_frame_size;
+    QuadBatch                    m_quad_batch;
+};
+
+} // namespace Methane::UserInterface
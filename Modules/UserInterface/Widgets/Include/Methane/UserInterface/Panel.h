@@ -52,6 +52,7 @@ public:
 
     // Item overrides
     bool SetRect(const UnitRect& ui_rect) override;
+    void AddToBatch(QuadBatch& quad_batch) const override;
 
 protected:
     using gfx::ScreenQuad::SetScreenRect;
@@ -43,6 +43,7 @@ public:
 
     // Item overrides
     bool SetRect(const UnitRect& ui_rect) override;
+    void AddToBatch(QuadBatch& quad_batch) const override { Text::AddToBatch(quad_batch); }
 
 private:
     // ITextCallback overrides
@@ -0,0 +1,63 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: MethaneKit/Modules/UserInterface/Widgets/Shaders/UIBatch.hlsl
+Shaders for batched rendering of user interface quads with per-vertex color and texture mode
+
+******************************************************************************/
+
+// Texture modes are encoded in Z-component of texture coordinates:
+// 0 - colored quad, 1 - RGBA texture blended with color, 2 - R-channel texture used as alpha of color
+
+struct VSInput
+{
+    float2 position : POSITION;
+    float3 texcoord : TEXCOORD;
+    float4 color    : COLOR;
+};
+
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float3 texcoord : TEXCOORD;
+    float4 color    : COLOR;
+};
+
+Texture2D<float4> g_texture : register(t0);
+SamplerState      g_sampler : register(s0);
+
+PSInput BatchVS(VSInput input)
+{
+    PSInput output;
+    output.position = float4(input.position, 0.F, 1.F);
+    output.texcoord = input.texcoord;
+    output.color    = input.color;
+    return output;
+}
+
+float4 BatchPS(PSInput input) : SV_TARGET
+{
+    // Texture is sampled unconditionally to keep implicit derivatives in uniform control flow
+    const float4 texel        = g_texture.Sample(g_sampler, input.texcoord.xy);
+    const uint   texture_mode = (uint)round(input.texcoord.z);
+    if (texture_mode == 1)
+        return texel * input.color;
+    if (texture_mode == 2)
+        return float4(input.color.rgb, input.color.a * texel.r);
+    return input.color;
+}
@@ -23,6 +23,7 @@ Badge widget displaying texture in specific corner of the screen.
 
 #include <Methane/UserInterface/Badge.h>
 #include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/QuadBatch.h>
 
 #include <Methane/Graphics/ImageLoader.h>
 #include <Methane/Data/AppResourceProviders.h>
@@ -140,6 +141,15 @@ void Badge::SetMargins(const UnitSize& margins)
     SetRect(GetBadgeRectInFrame());
 }
 
+void Badge::AddToBatch(QuadBatch& quad_batch) const
+{
+    META_FUNCTION_TASK();
+    const ScreenQuad::Settings& quad_settings = GetQuadSettings();
+    quad_batch.AddTexturedQuad(quad_settings.screen_rect, GetTexture(),
+                               static_cast<QuadBatch::TextureMode>(quad_settings.texture_mode),
+                               quad_settings.blend_color);
+}
+
 bool Badge::SetRect(const UnitRect& ui_rect)
 {
     META_FUNCTION_TASK();
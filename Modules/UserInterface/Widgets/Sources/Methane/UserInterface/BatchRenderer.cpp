@@ -0,0 +1,278 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/BatchRenderer.cpp
+Batched renderer of user interface items drawing all panels, badges and text items
+from one dynamic vertex buffer with one draw call per texture switch.
+
+******************************************************************************/
+
+#include <Methane/UserInterface/BatchRenderer.h>
+#include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/Item.h>
+
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Data/AppResourceProviders.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+#include <algorithm>
+#include <array>
+
+namespace Methane::UserInterface
+{
+
+static const std::string g_batch_state_name   = "UI Batch Render State";
+static const std::string g_batch_sampler_name = "UI Batch Sampler";
+static const std::string g_white_texture_name = "UI Batch White Texture";
+
+BatchRenderer::BatchRenderer(Context& ui_context, const Settings& settings)
+    : BatchRenderer(ui_context, ui_context.GetRenderPattern(), settings)
+{ }
+
+BatchRenderer::BatchRenderer(Context& ui_context, const rhi::RenderPattern& render_pattern, const Settings& settings)
+    : m_ui_context(ui_context)
+    , m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.buffers_reservation_multiplier, "buffers reservation multiplier can not be zero");
+
+    const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+    rhi::IObjectRegistry& gfx_objects_registry = render_context.GetObjectRegistry();
+    if (const auto render_state_ptr = gfx_objects_registry.GetGraphicsObject<rhi::IRenderState>(g_batch_state_name);
+        render_state_ptr)
+    {
+        m_render_state = rhi::RenderState(render_state_ptr);
+    }
+    else
+    {
+        rhi::RenderState::Settings state_settings
+        {
+            rhi::Program(render_context,
+                rhi::Program::Settings
+                {
+                    rhi::Program::ShaderSet
+                    {
+                        { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "UIBatch", "BatchVS" }, { } } },
+                        { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "UIBatch", "BatchPS" }, { } } },
+                    },
+                    rhi::ProgramInputBufferLayouts
+                    {
+                        rhi::Program::InputBufferLayout
+                        {
+                            rhi::Program::InputBufferLayout::ArgumentSemantics { "POSITION", "TEXCOORD", "COLOR" }
+                        }
+                    },
+                    rhi::ProgramArgumentAccessors
+                    {
+                        { { rhi::ShaderType::Pixel, "g_texture" }, rhi::ProgramArgumentAccessor::Type::Mutable  },
+                        { { rhi::ShaderType::Pixel, "g_sampler" }, rhi::ProgramArgumentAccessor::Type::Constant },
+                    },
+                    render_pattern.GetAttachmentFormats()
+                }),
+            render_pattern
+        };
+        state_settings.program.SetName("UI Batch Shading");
+        state_settings.depth.enabled                                        = false;
+        state_settings.depth.write_enabled                                  = false;
+        state_settings.rasterizer.is_front_counter_clockwise                = true;
+        state_settings.blending.render_targets[0].blend_enabled             = true;
+        state_settings.blending.render_targets[0].source_rgb_blend_factor   = rhi::IRenderState::Blending::Factor::SourceAlpha;
+        state_settings.blending.render_targets[0].dest_rgb_blend_factor     = rhi::IRenderState::Blending::Factor::OneMinusSourceAlpha;
+        state_settings.blending.render_targets[0].source_alpha_blend_factor = rhi::IRenderState::Blending::Factor::Zero;
+        state_settings.blending.render_targets[0].dest_alpha_blend_factor   = rhi::IRenderState::Blending::Factor::Zero;
+
+        m_render_state = render_context.CreateRenderState(state_settings);
+        m_render_state.SetName(g_batch_state_name);
+        gfx_objects_registry.AddGraphicsObject(m_render_state.GetInterface());
+    }
+
+    if (const auto sampler_ptr = gfx_objects_registry.GetGraphicsObject<rhi::ISampler>(g_batch_sampler_name);
+        sampler_ptr)
+    {
+        m_texture_sampler = rhi::Sampler(sampler_ptr);
+    }
+    else
+    {
+        m_texture_sampler = render_context.CreateSampler({
+            rhi::ISampler::Filter(rhi::ISampler::Filter::MinMag::Linear),
+            rhi::ISampler::Address(rhi::ISampler::Address::Mode::ClampToZero),
+        });
+        m_texture_sampler.SetName(g_batch_sampler_name);
+        gfx_objects_registry.AddGraphicsObject(m_texture_sampler.GetInterface());
+    }
+
+    // White texture is bound to draw ranges of untextured quads only, which never sample it
+    if (const auto texture_ptr = gfx_objects_registry.GetGraphicsObject<rhi::ITexture>(g_white_texture_name);
+        texture_ptr)
+    {
+        m_white_texture = rhi::Texture(texture_ptr);
+    }
+    else
+    {
+        static const std::array<uint8_t, 4> s_white_pixel{ 255U, 255U, 255U, 255U };
+        m_white_texture = render_context.CreateTexture(
+            rhi::TextureSettings::ForImage(gfx::Dimensions(1U, 1U), std::nullopt, gfx::PixelFormat::RGBA8Unorm, false));
+        m_white_texture.SetName(g_white_texture_name);
+        m_white_texture.SetData({ { reinterpret_cast<Data::ConstRawPtr>(s_white_pixel.data()), static_cast<Data::Size>(s_white_pixel.size()) } }, // NOSONAR
+                                render_context.GetRenderCommandKit().GetQueue());
+        gfx_objects_registry.AddGraphicsObject(m_white_texture.GetInterface());
+    }
+
+    m_frame_vertex_buffer_sets.resize(render_context.GetSettings().frame_buffers_count);
+    m_view_state = rhi::ViewState({
+        { gfx::GetFrameViewport(render_context.GetSettings().frame_size)    },
+        { gfx::GetFrameScissorRect(render_context.GetSettings().frame_size) }
+    });
+    m_frame_size = render_context.GetSettings().frame_size;
+}
+
+void BatchRenderer::Update(const std::vector<const Item*>& items, const FrameSize& render_attachment_size)
+{
+    META_FUNCTION_TASK();
+    m_quad_batch.Reset(render_attachment_size);
+    for(const Item* item_ptr : items)
+    {
+        if (item_ptr)
+            item_ptr->AddToBatch(m_quad_batch);
+    }
+    Update(m_quad_batch);
+}
+
+void BatchRenderer::Update(const QuadBatch& quad_batch)
+{
+    META_FUNCTION_TASK();
+    m_draw_calls.clear();
+    if (quad_batch.IsEmpty())
+        return;
+
+    UpdateViewState(quad_batch.GetFrameSize());
+    UpdateVertexBuffer(quad_batch.GetVertices());
+    UpdateIndexBuffer(quad_batch.GetQuadCount());
+
+    for(const QuadBatch::DrawRange& draw_range : quad_batch.GetDrawRanges())
+    {
+        m_draw_calls.push_back({
+            GetTextureBindings(draw_range.texture.IsInitialized() ? draw_range.texture : m_white_texture),
+            draw_range.quad_count * QuadBatch::g_indices_per_quad,
+            draw_range.start_quad * QuadBatch::g_indices_per_quad
+        });
+    }
+}
+
+void BatchRenderer::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const
+{
+    META_FUNCTION_TASK();
+    if (m_draw_calls.empty())
+        return;
+
+    const uint32_t frame_index = m_ui_context.GetRenderContext().GetFrameBufferIndex();
+    META_CHECK_ARG_LESS_DESCR(frame_index, m_frame_vertex_buffer_sets.size(), "no vertex buffer available for the current frame buffer index");
+
+    cmd_list.ResetWithStateOnce(m_render_state, debug_group_ptr);
+    cmd_list.SetViewState(m_view_state);
+    cmd_list.SetVertexBuffers(m_frame_vertex_buffer_sets[frame_index]);
+    cmd_list.SetIndexBuffer(m_index_buffer);
+    for(const DrawCall& draw_call : m_draw_calls)
+    {
+        cmd_list.SetProgramBindings(draw_call.program_bindings);
+        cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle, draw_call.index_count, draw_call.start_index);
+    }
+}
+
+void BatchRenderer::UpdateVertexBuffer(const QuadBatch::Vertices& vertices)
+{
+    META_FUNCTION_TASK();
+    const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+    const uint32_t frame_index = render_context.GetFrameBufferIndex();
+    META_CHECK_ARG_LESS_DESCR(frame_index, m_frame_vertex_buffer_sets.size(), "no vertex buffer available for the current frame buffer index");
+
+    const auto vertices_data_size = static_cast<Data::Size>(vertices.size() * sizeof(QuadBatch::Vertex));
+    rhi::BufferSet& vertex_buffer_set = m_frame_vertex_buffer_sets[frame_index];
+    if (!vertex_buffer_set.IsInitialized() || vertex_buffer_set[0].GetDataSize() < vertices_data_size)
+    {
+        const Data::Size vertex_buffer_size = vertices_data_size * m_settings.buffers_reservation_multiplier;
+        rhi::Buffer vertex_buffer = render_context.CreateBuffer(
+            rhi::BufferSettings::ForVertexBuffer(vertex_buffer_size, static_cast<Data::Size>(sizeof(QuadBatch::Vertex))));
+        vertex_buffer.SetName(fmt::format("{} Vertex Buffer {}", m_settings.name, frame_index));
+        vertex_buffer_set = rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer });
+    }
+
+    vertex_buffer_set[0].SetData({
+        rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(vertices.data()), vertices_data_size, // NOSONAR
+            rhi::SubResource::Index(), rhi::BytesRange(0U, vertices_data_size)
+        )
+    }, render_context.GetRenderCommandKit().GetQueue());
+}
+
+void BatchRenderer::UpdateIndexBuffer(Data::Size quad_count)
+{
+    META_FUNCTION_TASK();
+    // Quad indices do not depend on batch content, so index buffer is shared by all frames and updated on growth only
+    if (m_index_buffer.IsInitialized() && m_index_buffer_quad_count >= quad_count)
+        return;
+
+    const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+    m_index_buffer_quad_count = quad_count * m_settings.buffers_reservation_multiplier;
+
+    const std::vector<uint32_t> indices = QuadBatch::GenerateQuadIndices(m_index_buffer_quad_count);
+    const auto indices_data_size = static_cast<Data::Size>(indices.size() * sizeof(uint32_t));
+    m_index_buffer = render_context.CreateBuffer(rhi::BufferSettings::ForIndexBuffer(indices_data_size, gfx::PixelFormat::R32Uint));
+    m_index_buffer.SetName(fmt::format("{} Index Buffer", m_settings.name));
+    m_index_buffer.SetData({
+        rhi::SubResource(reinterpret_cast<Data::ConstRawPtr>(indices.data()), indices_data_size) // NOSONAR
+    }, render_context.GetRenderCommandKit().GetQueue());
+}
+
+void BatchRenderer::UpdateViewState(const FrameSize& render_attachment_size)
+{
+    META_FUNCTION_TASK();
+    if (m_frame_size == render_attachment_size)
+        return;
+
+    m_frame_size = render_attachment_size;
+    m_view_state.SetViewports({ gfx::GetFrameViewport(m_frame_size) });
+    m_view_state.SetScissorRects({ gfx::GetFrameScissorRect(m_frame_size) });
+}
+
+const rhi::ProgramBindings& BatchRenderer::GetTextureBindings(const rhi::Texture& texture)
+{
+    META_FUNCTION_TASK();
+    // Textures count is small in user interface, so linear search is faster than hashing
+    const auto texture_bindings_it = std::find_if(m_texture_bindings.begin(), m_texture_bindings.end(),
+        [&texture](const TextureBindings& texture_bindings) { return texture_bindings.texture == texture; });
+    if (texture_bindings_it != m_texture_bindings.end())
+        return texture_bindings_it->program_bindings;
+
+    rhi::ProgramBindings program_bindings = m_render_state.GetProgram().CreateBindings({
+        { { rhi::ShaderType::Pixel, "g_texture" }, { { texture.GetInterface()           } } },
+        { { rhi::ShaderType::Pixel, "g_sampler" }, { { m_texture_sampler.GetInterface() } } },
+    });
+    program_bindings.SetName(fmt::format("{} Bindings {}", m_settings.name, m_texture_bindings.size()));
+    m_texture_bindings.push_back({ texture, program_bindings });
+    return m_texture_bindings.back().program_bindings;
+}
+
+} // namespace Methane::UserInterface
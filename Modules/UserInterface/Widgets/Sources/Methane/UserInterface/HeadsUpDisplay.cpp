@@ -41,15 +41,29 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
 #include <Methane/Graphics/RHI/IFpsCounter.h>
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Data/AppResourceProviders.h>
+#include <Methane/Data/FrameMemoryPool.h>
 #include <Methane/Instrumentation.h>
 
 #include <magic_enum.hpp>
+#include <fmt/format.h>
+
+#include <memory_resource>
+#include <iterator>
 
 namespace Methane::UserInterface
 {
 
 static constexpr uint32_t g_first_line_height_decrement = 5;
 
+// Text is formatted in frame memory, since text items keep their own copy of the displayed string
+template<typename... ArgTypes>
+std::pmr::string FormatFrameText(std::pmr::memory_resource& frame_memory, fmt::format_string<ArgTypes...> format, ArgTypes&&... args)
+{
+    std::pmr::string text(&frame_memory);
+    fmt::format_to(std::back_inserter(text), format, std::forward<ArgTypes>(args)...);
+    return text;
+}
+
 inline uint32_t GetTextHeightInDots(const Context& ui_context, const Font& font)
 {
     return ui_context.ConvertPixelsToDots(font.GetMaxGlyphSize().GetHeight());
@@ -278,16 +292,17 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
 
     const rhi::IFpsCounter&           fps_counter      = GetUIContext().GetRenderContext().GetFpsCounter();
     const rhi::RenderContextSettings& context_settings = GetUIContext().GetRenderContext().GetSettings();
+    std::pmr::memory_resource&        frame_memory     = GetUIContext().GetRenderContext().GetFrameMemoryPool().GetMemoryResource();
 
-    GetTextBlock(TextBlock::Fps).SetText(fmt::format("{:d} FPS", fps_counter.GetFramesPerSecond()));
-    GetTextBlock(TextBlock::FrameTime).SetText(fmt::format("{:.2f} ms", fps_counter.GetAverageFrameTiming().GetTotalTimeMSec()));
-    GetTextBlock(TextBlock::CpuTime).SetText(fmt::format("{:.2f}% cpu", fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
+    GetTextBlock(TextBlock::Fps).SetText(FormatFrameText(frame_memory, "{:d} FPS", fps_counter.GetFramesPerSecond()));
+    GetTextBlock(TextBlock::FrameTime).SetText(FormatFrameText(frame_memory, "{:.2f} ms", fps_counter.GetAverageFrameTiming().GetTotalTimeMSec()));
+    GetTextBlock(TextBlock::CpuTime).SetText(FormatFrameText(frame_memory, "{:.2f}% cpu", fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
     GetTextBlock(TextBlock::GpuName).SetText(GetUIContext().GetRenderContext().GetDevice().GetAdapterName());
-    GetTextBlock(TextBlock::FrameBuffersAndApi).SetText(fmt::format("{:d} x {:d}  {:d} FB  {:s}", // NOSONAR - string contains invisible NBSP symbols
-                                                                    context_settings.frame_size.GetWidth(),
-                                                                    context_settings.frame_size.GetHeight(),
-                                                                    context_settings.frame_buffers_count,
-                                                                    magic_enum::enum_name(rhi::ISystem::GetNativeApi())));
+    GetTextBlock(TextBlock::FrameBuffersAndApi).SetText(FormatFrameText(frame_memory, "{:d} x {:d}  {:d} FB  {:s}", // NOSONAR - string contains invisible NBSP symbols
+                                                                                      context_settings.frame_size.GetWidth(),
+                                                                                      context_settings.frame_size.GetHeight(),
+                                                                                      context_settings.frame_buffers_count,
+                                                                                      magic_enum::enum_name(rhi::ISystem::GetNativeApi())));
     GetTextBlock(TextBlock::VSync).SetText(context_settings.vsync_enabled ? "VSync ON" : "VSync OFF");
     GetTextBlock(TextBlock::VSync).SetColor(context_settings.vsync_enabled ? m_settings.on_color : m_settings.off_color);
 
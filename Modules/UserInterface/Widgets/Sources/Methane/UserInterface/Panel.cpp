@@ -23,6 +23,7 @@ Panel widget with opaque background containing other widgets.
 
 #include <Methane/UserInterface/Panel.h>
 #include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/QuadBatch.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Instrumentation.h>
 
@@ -60,4 +61,12 @@ bool Panel::SetRect(const UnitRect& ui_rect)
     return true;
 }
 
+void Panel::AddToBatch(QuadBatch& quad_batch) const
+{
+    META_FUNCTION_TASK();
+    const ScreenQuad::Settings& quad_settings = GetQuadSettings();
+    quad_batch.AddQuad(quad_settings.screen_rect, quad_settings.blend_color);
+    Container::AddToBatch(quad_batch);
+}
+
 } // namespace Methane::UserInterface
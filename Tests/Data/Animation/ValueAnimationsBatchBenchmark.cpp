@@ -0,0 +1,86 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/ValueAnimationsBatchBenchmark.cpp
+Benchmark of batched value animations update versus animations pool update.
+
+******************************************************************************/
+
+#include <Methane/Data/ValueAnimationsBatch.hpp>
+#include <Methane/Data/ValueAnimation.hpp>
+#include <Methane/Data/AnimationsPool.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+static constexpr double g_long_duration_sec = 1000000.0;
+
+static size_t MeasureAnimationsPoolUpdate(size_t animations_count, Catch::Benchmark::Chronometer meter)
+{
+    std::vector<float> values(animations_count, 0.F);
+    AnimationsPool animations_pool;
+    for(float& value : values)
+    {
+        animations_pool.emplace_back(std::make_shared<ValueAnimation<float>>(value,
+            [](float& value_to_update, const float& start_value, double elapsed_seconds, double)
+            {
+                value_to_update = start_value + static_cast<float>(elapsed_seconds / g_long_duration_sec);
+                return true;
+            }, g_long_duration_sec));
+    }
+
+    meter.measure([&animations_pool]() { animations_pool.Update(); });
+    return animations_pool.size();
+}
+
+static size_t MeasureValueAnimationsBatchUpdate(size_t animations_count, tf::Executor* executor_ptr, Catch::Benchmark::Chronometer meter)
+{
+    std::vector<float> values(animations_count, 0.F);
+    ValueAnimationsBatch<float> animations_batch(executor_ptr);
+    for(float& value : values)
+    {
+        animations_batch.Add(value, 1.F, g_long_duration_sec, EasingType::QuadInOut);
+    }
+
+    meter.measure([&animations_batch]() { animations_batch.Update(); });
+    return animations_batch.GetCount();
+}
+
+TEST_CASE("Benchmark animations update", "[animation][benchmark]")
+{
+    tf::Executor executor;
+
+    for(size_t animations_count : { 1000U, 10000U, 100000U })
+    {
+        BENCHMARK_ADVANCED("Animations pool update of " + std::to_string(animations_count) + " values")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureAnimationsPoolUpdate(animations_count, meter);
+        };
+        BENCHMARK_ADVANCED("Serial batch update of " + std::to_string(animations_count) + " values")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureValueAnimationsBatchUpdate(animations_count, nullptr, meter);
+        };
+        BENCHMARK_ADVANCED("Parallel batch update of " + std::to_string(animations_count) + " values")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureValueAnimationsBatchUpdate(animations_count, &executor, meter);
+        };
+    }
+}
@@ -0,0 +1,169 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/ValueAnimationsBatchTest.cpp
+Unit tests of the batched value animations with easing curves
+
+******************************************************************************/
+
+#include <Methane/Data/ValueAnimationsBatch.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane::Data;
+using Catch::Approx;
+
+TEST_CASE("Easing curves", "[animation][easing]")
+{
+    const std::vector<EasingType> easing_types{
+        EasingType::Linear,
+        EasingType::QuadIn,  EasingType::QuadOut,  EasingType::QuadInOut,
+        EasingType::CubicIn, EasingType::CubicOut, EasingType::CubicInOut,
+        EasingType::SineIn,  EasingType::SineOut,  EasingType::SineInOut,
+    };
+
+    SECTION("Curves start at 0 and end at 1")
+    {
+        for(EasingType easing_type : easing_types)
+        {
+            CHECK(ApplyEasing(easing_type, 0.0) == Approx(0.0).margin(1E-9));
+            CHECK(ApplyEasing(easing_type, 1.0) == Approx(1.0).margin(1E-9));
+        }
+    }
+
+    SECTION("Symmetric curves pass through the middle point")
+    {
+        CHECK(ApplyEasing(EasingType::Linear,     0.5) == Approx(0.5));
+        CHECK(ApplyEasing(EasingType::QuadInOut,  0.5) == Approx(0.5));
+        CHECK(ApplyEasing(EasingType::CubicInOut, 0.5) == Approx(0.5));
+        CHECK(ApplyEasing(EasingType::SineInOut,  0.5) == Approx(0.5));
+    }
+
+    SECTION("Ease-in curves are below and ease-out curves are above linear")
+    {
+        CHECK(ApplyEasing(EasingType::QuadIn,   0.25) < 0.25);
+        CHECK(ApplyEasing(EasingType::CubicIn,  0.25) < 0.25);
+        CHECK(ApplyEasing(EasingType::SineIn,   0.25) < 0.25);
+        CHECK(ApplyEasing(EasingType::QuadOut,  0.25) > 0.25);
+        CHECK(ApplyEasing(EasingType::CubicOut, 0.25) > 0.25);
+        CHECK(ApplyEasing(EasingType::SineOut,  0.25) > 0.25);
+    }
+}
+
+TEST_CASE("Value animations batch", "[animation][batch]")
+{
+    SECTION("Linear animation of single value")
+    {
+        float value = 1.F;
+        ValueAnimationsBatch<float> batch;
+        batch.Add(value, 3.F, 2.0);
+        CHECK(batch.GetCount() == 1U);
+
+        batch.UpdateAt(1.0);
+        CHECK(value == Approx(2.F));
+        CHECK(batch.GetCount() == 1U);
+
+        batch.UpdateAt(2.0);
+        CHECK(value == 3.F);
+        CHECK(batch.IsEmpty());
+    }
+
+    SECTION("Delayed animation does not change value before its start")
+    {
+        double value = 0.0;
+        ValueAnimationsBatch<double> batch;
+        batch.Add(value, 10.0, 1.0, EasingType::Linear, 1.0);
+
+        batch.UpdateAt(0.5);
+        CHECK(value == 0.0);
+
+        batch.UpdateAt(1.5);
+        CHECK(value == Approx(5.0));
+    }
+
+    SECTION("Eased animation follows easing curve")
+    {
+        double value = 0.0;
+        ValueAnimationsBatch<double> batch;
+        batch.Add(value, 1.0, 1.0, EasingType::QuadIn);
+
+        batch.UpdateAt(0.5);
+        CHECK(value == Approx(0.25));
+    }
+
+    SECTION("Completed animations are removed and others keep running")
+    {
+        std::vector<float> values(8U, 0.F);
+        ValueAnimationsBatch<float> batch;
+        for(size_t index = 0; index < values.size(); ++index)
+        {
+            batch.Add(values[index], 1.F, static_cast<double>(index + 1));
+        }
+
+        batch.UpdateAt(4.0);
+        CHECK(batch.GetCount() == 4U);
+        for(size_t index = 0; index < values.size(); ++index)
+        {
+            CHECK(values[index] == Approx(std::min(4.F / static_cast<float>(index + 1), 1.F)));
+        }
+
+        batch.UpdateAt(8.0);
+        CHECK(batch.IsEmpty());
+        for(float value : values)
+        {
+            CHECK(value == 1.F);
+        }
+    }
+
+    SECTION("Parallel update is equal to serial update")
+    {
+        constexpr size_t values_count = 10000U;
+        std::vector<float> serial_values(values_count, 0.F);
+        std::vector<float> parallel_values(values_count, 0.F);
+
+        tf::Executor executor;
+        ValueAnimationsBatch<float> serial_batch;
+        ValueAnimationsBatch<float> parallel_batch(&executor, 256U);
+        for(size_t index = 0; index < values_count; ++index)
+        {
+            const double duration_sec = 1.0 + static_cast<double>(index % 7U);
+            serial_batch.Add(serial_values[index], 100.F, duration_sec, EasingType::SineInOut);
+            parallel_batch.Add(parallel_values[index], 100.F, duration_sec, EasingType::SineInOut);
+        }
+
+        for(double elapsed_sec : { 0.5, 1.5, 3.0, 6.5 })
+        {
+            serial_batch.UpdateAt(elapsed_sec);
+            parallel_batch.UpdateAt(elapsed_sec);
+            CHECK(parallel_batch.GetCount() == serial_batch.GetCount());
+            CHECK(parallel_values == serial_values);
+        }
+    }
+
+    SECTION("Clear removes all animations")
+    {
+        float value = 0.F;
+        ValueAnimationsBatch<float> batch;
+        batch.Add(value, 1.F, 1.0);
+        batch.Clear();
+        batch.UpdateAt(0.5);
+        CHECK(batch.IsEmpty());
+        CHECK(value == 0.F);
+    }
+}
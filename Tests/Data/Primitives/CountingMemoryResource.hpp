@@ -0,0 +1,68 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/CountingMemoryResource.hpp
+Upstream memory resource counting allocations, used to test linear memory resources.
+
+******************************************************************************/
+
+#pragma once
+
+#include <memory_resource>
+#include <cstddef>
+
+namespace Methane::Data
+{
+
+class CountingMemoryResource final
+    : public std::pmr::memory_resource
+{
+public:
+    [[nodiscard]] size_t GetAllocationsCount() const noexcept   { return m_allocations_count; }
+    [[nodiscard]] size_t GetDeallocationsCount() const noexcept { return m_deallocations_count; }
+    [[nodiscard]] size_t GetAllocatedBytes() const noexcept     { return m_allocated_bytes; }
+
+    void ResetCounters() noexcept
+    {
+        m_allocations_count   = 0U;
+        m_deallocations_count = 0U;
+        m_allocated_bytes     = 0U;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        m_allocations_count++;
+        m_allocated_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+    {
+        m_deallocations_count++;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    size_t m_allocations_count   = 0U;
+    size_t m_deallocations_count = 0U;
+    size_t m_allocated_bytes     = 0U;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,149 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/FrameMemoryPoolTest.cpp
+Unit tests of the frame memory pool
+
+******************************************************************************/
+
+#include "CountingMemoryResource.hpp"
+
+#include <Methane/Data/FrameMemoryPool.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fmt/format.h>
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <iterator>
+
+using namespace Methane::Data;
+
+// Emulates typical temporary allocations of frame update: formatted strings and lists of visible item indices
+static void AllocateFrameTemporaries(std::pmr::memory_resource& memory_resource, uint32_t items_count)
+{
+    std::pmr::vector<uint32_t> visible_indices(&memory_resource);
+    visible_indices.reserve(items_count);
+    for(uint32_t index = 0U; index < items_count; index += 2U)
+        visible_indices.push_back(index);
+
+    std::pmr::vector<std::pmr::string> lines(&memory_resource);
+    for(uint32_t line_index = 0U; line_index < 8U; ++line_index)
+    {
+        std::pmr::string& line = lines.emplace_back();
+        fmt::format_to(std::back_inserter(line), "Frame statistics line {} with {} visible items", line_index, visible_indices.size());
+    }
+}
+
+TEST_CASE("Frame memory pool resources", "[memory][frame]")
+{
+    CountingMemoryResource upstream;
+    FrameMemoryPool pool(1024U, &upstream);
+
+    SECTION("Same resource is returned to the thread during frame")
+    {
+        std::pmr::memory_resource& resource = pool.GetMemoryResource();
+        CHECK(&pool.GetMemoryResource() == &resource);
+        CHECK(pool.GetStatistics().threads_count == 1U);
+    }
+
+    SECTION("Different threads get different resources")
+    {
+        std::pmr::memory_resource& main_resource = pool.GetMemoryResource();
+        std::pmr::memory_resource* thread_resource_ptr = nullptr;
+        std::thread([&pool, &thread_resource_ptr]() { thread_resource_ptr = &pool.GetMemoryResource(); }).join();
+        CHECK(thread_resource_ptr != &main_resource);
+        CHECK(pool.GetStatistics().threads_count == 2U);
+    }
+
+    SECTION("Different pools used from one thread get different resources")
+    {
+        FrameMemoryPool other_pool(1024U, &upstream);
+        std::pmr::memory_resource& resource = pool.GetMemoryResource();
+        CHECK(&other_pool.GetMemoryResource() != &resource);
+        CHECK(&pool.GetMemoryResource() == &resource);
+    }
+
+    SECTION("Frame allocations stay valid during next frame")
+    {
+        auto* const frame_0_ptr = static_cast<uint32_t*>(pool.GetMemoryResource().allocate(sizeof(uint32_t), alignof(uint32_t)));
+        *frame_0_ptr = 42U;
+
+        pool.AdvanceFrame();
+        auto* const frame_1_ptr = static_cast<uint32_t*>(pool.GetMemoryResource().allocate(sizeof(uint32_t), alignof(uint32_t)));
+        *frame_1_ptr = 13U;
+        CHECK(frame_1_ptr != frame_0_ptr);
+        CHECK(*frame_0_ptr == 42U);
+
+        pool.AdvanceFrame();
+        auto* const frame_2_ptr = static_cast<uint32_t*>(pool.GetMemoryResource().allocate(sizeof(uint32_t), alignof(uint32_t)));
+        CHECK(frame_2_ptr == frame_0_ptr);
+        CHECK(*frame_1_ptr == 13U);
+        CHECK(pool.GetStatistics().frame_index == 2U);
+    }
+
+    SECTION("Statistics count allocations of current frame only")
+    {
+        std::ignore = pool.GetMemoryResource().allocate(16U, 8U);
+        std::ignore = pool.GetMemoryResource().allocate(16U, 8U);
+        CHECK(pool.GetStatistics().allocations_count == 2U);
+        CHECK(pool.GetStatistics().allocated_bytes == 32U);
+
+        pool.AdvanceFrame();
+        CHECK(pool.GetStatistics().allocations_count == 0U);
+        std::ignore = pool.GetMemoryResource().allocate(16U, 8U);
+        CHECK(pool.GetStatistics().allocations_count == 1U);
+    }
+}
+
+TEST_CASE("Frame memory pool upstream allocations per frame", "[memory][frame]")
+{
+    constexpr uint32_t frames_count = 16U;
+    constexpr uint32_t items_count  = 4096U;
+    CountingMemoryResource upstream;
+
+    SECTION("General heap allocates temporaries every frame")
+    {
+        for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            upstream.ResetCounters();
+            AllocateFrameTemporaries(upstream, items_count);
+            CHECK(upstream.GetAllocationsCount() >= 10U);
+        }
+    }
+
+    SECTION("Frame memory pool does not allocate from upstream after warm-up frames")
+    {
+        FrameMemoryPool pool(1024U, &upstream);
+        for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            upstream.ResetCounters();
+            AllocateFrameTemporaries(pool.GetMemoryResource(), items_count);
+            pool.AdvanceFrame();
+
+            // Blocks of each frame slot are merged on first reset, so all following frames reuse the same memory
+            if (frame_index >= FrameMemoryPool::g_frame_slots_count * 2U)
+            {
+                CHECK(upstream.GetAllocationsCount() == 0U);
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/LinearBlockAllocatorTest.cpp
+Unit tests of the linear block allocator
+
+******************************************************************************/
+
+#include <Methane/Data/LinearBlockAllocator.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+using namespace Methane::Data;
+using BlockAllocator = LinearBlockAllocator<uint64_t>;
+
+TEST_CASE("Linear block allocator alignment", "[memory][linear][block]")
+{
+    BlockAllocator allocator(1024U);
+
+    SECTION("Allocations are aligned and placed sequentially")
+    {
+        CHECK(allocator.Allocate(3U, 1U) == 0U);
+        CHECK(allocator.Allocate(16U, 256U) == 256U);
+        CHECK(allocator.Allocate(8U, 4U) == 272U);
+        CHECK(allocator.GetUsedSize() == 280U);
+        CHECK(allocator.GetAllocationsCount() == 3U);
+    }
+
+    SECTION("Allocation aligned to the end of block fits exactly")
+    {
+        CHECK(allocator.Allocate(1U, 1U) == 0U);
+        CHECK(allocator.Allocate(512U, 512U) == 512U);
+        CHECK(allocator.GetUsedSize() == 1024U);
+        CHECK_FALSE(allocator.Allocate(1U, 1U).has_value());
+    }
+
+    SECTION("Allocation is rejected when aligned offset does not fit in block")
+    {
+        CHECK(allocator.Allocate(600U, 1U) == 0U);
+        CHECK_FALSE(allocator.Allocate(500U, 256U).has_value());
+        CHECK_FALSE(allocator.Allocate(1U, 2048U).has_value());
+        CHECK(allocator.GetUsedSize() == 600U);
+        CHECK(allocator.GetAllocationsCount() == 1U);
+    }
+
+    SECTION("Zero alignment is rejected")
+    {
+        CHECK_THROWS(allocator.Allocate(16U, 0U));
+    }
+}
+
+TEST_CASE("Linear block allocator reuse", "[memory][linear][block]")
+{
+    BlockAllocator allocator(256U);
+    REQUIRE(allocator.Allocate(128U, 64U) == 0U);
+    REQUIRE(allocator.Allocate(64U, 64U) == 128U);
+
+    SECTION("Block is not reused while some allocations are alive")
+    {
+        allocator.Free();
+        CHECK(allocator.GetAllocationsCount() == 1U);
+        CHECK(allocator.GetUsedSize() == 192U);
+        CHECK(allocator.Allocate(64U, 64U) == 192U);
+        CHECK_FALSE(allocator.Allocate(64U, 64U).has_value());
+    }
+
+    SECTION("Block is reused from the beginning when all allocations are freed")
+    {
+        allocator.Free();
+        allocator.Free();
+        CHECK(allocator.GetAllocationsCount() == 0U);
+        CHECK(allocator.GetUsedSize() == 0U);
+        CHECK(allocator.Allocate(256U, 64U) == 0U);
+    }
+
+    SECTION("Freeing block without allocations is rejected")
+    {
+        allocator.Free();
+        allocator.Free();
+        CHECK_THROWS(allocator.Free());
+    }
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/LinearMemoryResourceTest.cpp
+Unit tests of the linear memory resource
+
+******************************************************************************/
+
+#include "CountingMemoryResource.hpp"
+
+#include <Methane/Data/LinearMemoryResource.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <tuple>
+
+using namespace Methane::Data;
+
+TEST_CASE("Linear memory resource allocations", "[memory][linear]")
+{
+    CountingMemoryResource upstream;
+
+    SECTION("Allocations are aligned and placed sequentially in one block")
+    {
+        LinearMemoryResource resource(1024U, &upstream);
+        void* const first_ptr  = resource.allocate(3U, 1U);
+        void* const second_ptr = resource.allocate(16U, 16U);
+        void* const third_ptr  = resource.allocate(8U, 8U);
+        CHECK(reinterpret_cast<uintptr_t>(second_ptr) % 16U == 0U);
+        CHECK(reinterpret_cast<uintptr_t>(third_ptr) % 8U == 0U);
+        CHECK(static_cast<std::byte*>(second_ptr) > static_cast<std::byte*>(first_ptr));
+        CHECK(static_cast<std::byte*>(third_ptr) == static_cast<std::byte*>(second_ptr) + 16U);
+        CHECK(upstream.GetAllocationsCount() == 1U);
+        CHECK(resource.GetStatistics().allocations_count == 3U);
+        CHECK(resource.GetStatistics().reserved_bytes == 1024U);
+    }
+
+    SECTION("New block is allocated when current block is exhausted")
+    {
+        LinearMemoryResource resource(64U, &upstream);
+        std::ignore = resource.allocate(48U, 8U);
+        std::ignore = resource.allocate(48U, 8U);
+        CHECK(upstream.GetAllocationsCount() == 2U);
+        CHECK(resource.GetStatistics().reserved_bytes == 128U);
+    }
+
+    SECTION("Allocation larger than block size gets dedicated block")
+    {
+        LinearMemoryResource resource(64U, &upstream);
+        std::ignore = resource.allocate(1000U, 8U);
+        CHECK(upstream.GetAllocationsCount() == 1U);
+        CHECK(upstream.GetAllocatedBytes() >= 1000U);
+    }
+
+    SECTION("Deallocation does not return memory to upstream")
+    {
+        LinearMemoryResource resource(64U, &upstream);
+        void* const ptr = resource.allocate(32U, 8U);
+        resource.deallocate(ptr, 32U, 8U);
+        CHECK(upstream.GetDeallocationsCount() == 0U);
+    }
+
+    CHECK(upstream.GetAllocationsCount() == upstream.GetDeallocationsCount());
+}
+
+TEST_CASE("Linear memory resource reset", "[memory][linear]")
+{
+    CountingMemoryResource upstream;
+
+    SECTION("Reset rewinds allocations to the beginning of block")
+    {
+        LinearMemoryResource resource(256U, &upstream);
+        void* const first_ptr = resource.allocate(32U, 8U);
+        std::ignore = resource.allocate(32U, 8U);
+        resource.Reset();
+        CHECK(resource.GetStatistics().allocations_count == 0U);
+        CHECK(resource.GetStatistics().allocated_bytes == 0U);
+        CHECK(resource.allocate(32U, 8U) == first_ptr);
+        CHECK(upstream.GetAllocationsCount() == 1U);
+    }
+
+    SECTION("Reset merges blocks, so that repeated workload does not allocate from upstream")
+    {
+        LinearMemoryResource resource(64U, &upstream);
+        for(uint32_t index = 0U; index < 10U; ++index)
+            std::ignore = resource.allocate(40U, 8U);
+        CHECK(upstream.GetAllocationsCount() == 10U);
+
+        resource.Reset();
+        CHECK(upstream.GetAllocationsCount() == 11U);
+        CHECK(resource.GetStatistics().reserved_bytes == 640U);
+
+        upstream.ResetCounters();
+        for(uint32_t index = 0U; index < 10U; ++index)
+            std::ignore = resource.allocate(40U, 8U);
+        resource.Reset();
+        CHECK(upstream.GetAllocationsCount() == 0U);
+        CHECK(upstream.GetDeallocationsCount() == 0U);
+    }
+
+    SECTION("Release returns all blocks to upstream")
+    {
+        LinearMemoryResource resource(64U, &upstream);
+        std::ignore = resource.allocate(40U, 8U);
+        std::ignore = resource.allocate(40U, 8U);
+        resource.Release();
+        CHECK(upstream.GetDeallocationsCount() == 2U);
+        CHECK(resource.GetStatistics().reserved_bytes == 0U);
+    }
+}
+
+TEST_CASE("Linear memory resource with polymorphic containers", "[memory][linear]")
+{
+    CountingMemoryResource upstream;
+    LinearMemoryResource resource(4096U, &upstream);
+
+    std::pmr::vector<uint32_t> values(&resource);
+    for(uint32_t index = 0U; index < 100U; ++index)
+        values.push_back(index);
+
+    std::pmr::string text("Linear memory resource string which does not fit small string buffer", &resource);
+
+    CHECK(values.size() == 100U);
+    CHECK(values[99] == 99U);
+    CHECK(text.size() > 32U);
+    CHECK(upstream.GetAllocationsCount() == 1U);
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/ParallelForBenchmark.cpp
+Benchmark of per-frame parallel scheduling overhead: task graph construction versus
+re-running cached task graph and parallel for loop without graph.
+
+******************************************************************************/
+
+#include <Methane/Data/ParallelFor.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <string>
+
+using namespace Methane::Data;
+
+// Small per-task work, like commit of one parallel command list, so that scheduling overhead dominates
+static void DoTaskWork(std::vector<uint64_t>& results, uint32_t task_index)
+{
+    uint64_t value = task_index;
+    for(uint32_t i = 0U; i < 64U; ++i)
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    results[task_index] = value;
+}
+
+TEST_CASE("Benchmark per-frame parallel scheduling overhead", "[parallel][benchmark]")
+{
+    tf::Executor executor;
+
+    for(uint32_t tasks_count : { 4U, 16U, 64U })
+    {
+        std::vector<uint64_t> results(tasks_count, 0U);
+        const std::string tasks_suffix = " of " + std::to_string(tasks_count) + " tasks";
+
+        BENCHMARK("Serial loop" + tasks_suffix)
+        {
+            for(uint32_t task_index = 0U; task_index < tasks_count; ++task_index)
+                DoTaskWork(results, task_index);
+            return results.back();
+        };
+
+        BENCHMARK("Task graph constructed per frame" + tasks_suffix)
+        {
+            tf::Taskflow task_flow;
+            task_flow.for_each_index(0U, tasks_count, 1U, [&results](uint32_t task_index) { DoTaskWork(results, task_index); });
+            executor.run(task_flow).get();
+            return results.back();
+        };
+
+        tf::Taskflow cached_task_flow;
+        for(uint32_t task_index = 0U; task_index < tasks_count; ++task_index)
+        {
+            cached_task_flow.emplace([&results, task_index]() { DoTaskWork(results, task_index); });
+        }
+        BENCHMARK("Cached task graph re-run" + tasks_suffix)
+        {
+            executor.run(cached_task_flow).get();
+            return results.back();
+        };
+
+        BENCHMARK("Parallel for without graph" + tasks_suffix)
+        {
+            ParallelFor(executor, 0U, tasks_count, [&results](uint32_t task_index) { DoTaskWork(results, task_index); });
+            return results.back();
+        };
+    }
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/ParallelForTest.cpp
+Unit tests of the parallel for loop dispatched to executor without task graph
+
+******************************************************************************/
+
+#include <Methane/Data/ParallelFor.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+using namespace Methane::Data;
+
+static void CheckAllIndicesVisitedOnce(tf::Executor& executor, uint32_t begin_index, uint32_t end_index, uint32_t chunk_size)
+{
+    std::vector<std::atomic<uint32_t>> visit_counts(end_index);
+    ParallelFor(executor, begin_index, end_index,
+        [&visit_counts](uint32_t index) { visit_counts[index].fetch_add(1U); },
+        chunk_size);
+
+    for(uint32_t index = 0U; index < end_index; ++index)
+    {
+        CHECK(visit_counts[index].load() == (index < begin_index ? 0U : 1U));
+    }
+}
+
+TEST_CASE("Parallel for loop", "[parallel]")
+{
+    tf::Executor executor(4);
+
+    SECTION("Every index is visited once with single index chunks")
+    {
+        CheckAllIndicesVisitedOnce(executor, 0U, 1000U, 1U);
+    }
+
+    SECTION("Every index is visited once with chunks not dividing range evenly")
+    {
+        CheckAllIndicesVisitedOnce(executor, 3U, 1000U, 64U);
+    }
+
+    SECTION("Single chunk range is processed in calling thread")
+    {
+        std::vector<uint32_t> indices;
+        ParallelFor(executor, 0U, 10U, [&indices](uint32_t index) { indices.push_back(index); }, 16U);
+        CHECK(indices == std::vector<uint32_t>{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U });
+    }
+
+    SECTION("Empty range does not call function")
+    {
+        uint32_t calls_count = 0U;
+        ParallelFor(executor, 5U, 5U, [&calls_count](uint32_t) { calls_count++; });
+        CHECK(calls_count == 0U);
+    }
+
+    SECTION("Nested parallel for loops complete")
+    {
+        std::atomic<uint32_t> calls_count{ 0U };
+        ParallelFor(executor, 0U, 16U, [&executor, &calls_count](uint32_t)
+        {
+            ParallelFor(executor, 0U, 16U, [&calls_count](uint32_t) { calls_count.fetch_add(1U); });
+        });
+        CHECK(calls_count.load() == 256U);
+    }
+
+    SECTION("Exception thrown from function is rethrown in calling thread")
+    {
+        std::atomic<uint32_t> calls_count{ 0U };
+        CHECK_THROWS_AS(ParallelFor(executor, 0U, 100U, [&calls_count](uint32_t index)
+        {
+            calls_count.fetch_add(1U);
+            if (index == 50U)
+                throw std::runtime_error("test error");
+        }), std::runtime_error);
+        CHECK(calls_count.load() == 100U);
+    }
+
+    SECTION("Repeated loops on the same executor complete")
+    {
+        std::atomic<uint32_t> calls_count{ 0U };
+        for(uint32_t frame_index = 0U; frame_index < 100U; ++frame_index)
+        {
+            ParallelFor(executor, 0U, 8U, [&calls_count](uint32_t) { calls_count.fetch_add(1U); });
+        }
+        CHECK(calls_count.load() == 800U);
+    }
+}
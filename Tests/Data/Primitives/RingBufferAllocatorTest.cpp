@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/RingBufferAllocatorTest.cpp
+Unit tests of the ring buffer allocator
+
+******************************************************************************/
+
+#include <Methane/Data/RingBufferAllocator.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+using namespace Methane::Data;
+using RingAllocator = RingBufferAllocator<uint64_t>;
+
+TEST_CASE("Ring buffer allocator alignment", "[memory][ring]")
+{
+    RingAllocator allocator(1024U);
+
+    SECTION("Allocations are aligned and placed sequentially")
+    {
+        CHECK(allocator.Allocate(3U, 1U) == 0U);
+        CHECK(allocator.Allocate(16U, 256U) == 256U);
+        CHECK(allocator.Allocate(8U, 4U) == 272U);
+        CHECK(allocator.GetUsedSize() == 280U);
+        CHECK(allocator.GetAllocationsCount() == 3U);
+    }
+
+    SECTION("Allocation larger than buffer is rejected")
+    {
+        CHECK_FALSE(allocator.Allocate(1025U, 1U).has_value());
+        CHECK(allocator.GetAllocationsCount() == 0U);
+    }
+
+    SECTION("Zero size and zero alignment are rejected")
+    {
+        CHECK_THROWS(allocator.Allocate(0U, 1U));
+        CHECK_THROWS(allocator.Allocate(16U, 0U));
+    }
+}
+
+TEST_CASE("Ring buffer allocator wrapping", "[memory][ring]")
+{
+    RingAllocator allocator(1024U);
+    REQUIRE(allocator.Allocate(512U, 256U) == 0U);
+    REQUIRE(allocator.Allocate(256U, 256U) == 512U);
+
+    SECTION("Allocation is rejected while freed space at the buffer beginning is not enough")
+    {
+        CHECK_FALSE(allocator.Allocate(512U, 256U).has_value());
+        CHECK(allocator.GetUsedSize() == 768U);
+    }
+
+    SECTION("Allocation wraps to the buffer beginning after the oldest range is freed")
+    {
+        allocator.Free();
+        CHECK(allocator.Allocate(512U, 256U) == 0U);
+        CHECK(allocator.GetUsedSize() == 1024U);
+        CHECK_FALSE(allocator.Allocate(1U, 1U).has_value());
+    }
+
+    SECTION("Wrapped allocations are placed up to the oldest range")
+    {
+        allocator.Free();
+        CHECK(allocator.Allocate(256U, 256U) == 768U);
+        CHECK(allocator.Allocate(256U, 256U) == 0U);
+        CHECK(allocator.Allocate(256U, 256U) == 256U);
+        CHECK_FALSE(allocator.Allocate(1U, 1U).has_value());
+        CHECK(allocator.GetAllocationsCount() == 4U);
+    }
+
+    SECTION("Ring is rewound to the buffer beginning when all ranges are freed")
+    {
+        allocator.Free();
+        REQUIRE(allocator.Allocate(128U, 256U) == 768U);
+        allocator.Free();
+        allocator.Free();
+        CHECK(allocator.GetUsedSize() == 0U);
+        CHECK(allocator.Allocate(64U, 64U) == 0U);
+    }
+
+    SECTION("Freeing ring without allocations is rejected")
+    {
+        allocator.Free();
+        allocator.Free();
+        CHECK_THROWS(allocator.Free());
+    }
+}
@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Camera/FrustumCullerBenchmark.cpp
+Benchmark of frustum culling for 1 million of instances
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCuller.h>
+#include <Methane/Graphics/Camera.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+static constexpr Size g_instances_count = 1000000U;
+
+static BoundingSpheres CreateRandomSpheres()
+{
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-200.f, 200.f);
+    BoundingSpheres spheres;
+    spheres.Resize(g_instances_count);
+    for(Index index = 0U; index < g_instances_count; ++index)
+    {
+        spheres.Set(index, { position_distribution(rng), position_distribution(rng), position_distribution(rng) }, 1.f);
+    }
+    return spheres;
+}
+
+static BoundingBoxes CreateBoxesAroundSpheres(const BoundingSpheres& spheres)
+{
+    BoundingBoxes boxes;
+    boxes.Resize(spheres.GetCount());
+    for(Index index = 0U; index < spheres.GetCount(); ++index)
+    {
+        const hlslpp::float3 center(spheres.center_x[index], spheres.center_y[index], spheres.center_z[index]);
+        boxes.Set(index, center - hlslpp::float3(spheres.radius[index]), center + hlslpp::float3(spheres.radius[index]));
+    }
+    return boxes;
+}
+
+TEST_CASE("Benchmark frustum culling of 1M instances", "[camera][culling][benchmark]")
+{
+    Camera camera;
+    camera.Resize(FloatSize{ 640.f, 480.f });
+    camera.ResetOrientation({ { 0.f, 0.f, -10.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f } });
+
+    const FrustumCuller   culler(camera);
+    const BoundingSpheres spheres = CreateRandomSpheres();
+    const BoundingBoxes   boxes   = CreateBoxesAroundSpheres(spheres);
+    VisibleIndices        visible_indices;
+    tf::Executor          executor;
+
+    BENCHMARK("Per-instance sphere culling")
+    {
+        visible_indices.clear();
+        for(Index index = 0U; index < g_instances_count; ++index)
+        {
+            if (culler.IsSphereVisible({ spheres.center_x[index], spheres.center_y[index], spheres.center_z[index] }, spheres.radius[index]))
+                visible_indices.push_back(index);
+        }
+        return visible_indices.size();
+    };
+
+    BENCHMARK("Serial batch sphere culling")
+    {
+        culler.CullSpheres(spheres, visible_indices);
+        return visible_indices.size();
+    };
+
+    BENCHMARK("Parallel batch sphere culling")
+    {
+        culler.CullSpheres(spheres, visible_indices, &executor);
+        return visible_indices.size();
+    };
+
+    BENCHMARK("Serial batch box culling")
+    {
+        culler.CullBoxes(boxes, visible_indices);
+        return visible_indices.size();
+    };
+
+    BENCHMARK("Parallel batch box culling")
+    {
+        culler.CullBoxes(boxes, visible_indices, &executor);
+        return visible_indices.size();
+    };
+}
@@ -0,0 +1,182 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Camera/FrustumCullerTest.cpp
+Frustum culler unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCuller.h>
+#include <Methane/Graphics/Camera.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+#include <array>
+#include <memory_resource>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+static const FloatSize           g_test_screen_size { 640.f, 480.f };
+static const Camera::Orientation g_test_orientation { { 0.f, 0.f, -10.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f } };
+
+static Camera CreateTestCamera()
+{
+    Camera camera;
+    camera.Resize(g_test_screen_size);
+    camera.ResetOrientation(g_test_orientation);
+    return camera;
+}
+
+TEST_CASE("Frustum culling of single volumes", "[camera][culling]")
+{
+    const FrustumCuller culler(CreateTestCamera());
+
+    SECTION("Sphere visibility")
+    {
+        CHECK(culler.IsSphereVisible({ 0.f, 0.f, 0.f }, 1.f));
+        CHECK(culler.IsSphereVisible({ 0.f, 0.f, 100.f }, 1.f));
+        CHECK_FALSE(culler.IsSphereVisible({ 0.f, 0.f, -20.f }, 1.f));
+        CHECK_FALSE(culler.IsSphereVisible({ 1000.f, 0.f, 0.f }, 1.f));
+        CHECK_FALSE(culler.IsSphereVisible({ 0.f, -1000.f, 0.f }, 1.f));
+        CHECK_FALSE(culler.IsSphereVisible({ 0.f, 0.f, 200.f }, 1.f));
+    }
+
+    SECTION("Sphere intersecting frustum plane is visible")
+    {
+        CHECK(culler.IsSphereVisible({ 0.f, 0.f, -10.5f }, 1.f));
+        CHECK(culler.IsSphereVisible({ 0.f, 0.f, 115.5f }, 1.f));
+    }
+
+    SECTION("Box visibility")
+    {
+        CHECK(culler.IsBoxVisible({ -1.f, -1.f, -1.f }, { 1.f, 1.f, 1.f }));
+        CHECK(culler.IsBoxVisible({ -1000.f, -1.f, -1.f }, { 1000.f, 1.f, 1.f }));
+        CHECK_FALSE(culler.IsBoxVisible({ -1.f, -1.f, -30.f }, { 1.f, 1.f, -20.f }));
+        CHECK_FALSE(culler.IsBoxVisible({ 999.f, -1.f, -1.f }, { 1001.f, 1.f, 1.f }));
+    }
+}
+
+TEST_CASE("Frustum culling of volume batches", "[camera][culling]")
+{
+    const FrustumCuller culler(CreateTestCamera());
+
+    constexpr Size volumes_count = 10000U;
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-200.f, 200.f);
+    std::uniform_real_distribution<float> size_distribution(0.1f, 5.f);
+
+    BoundingSpheres spheres;
+    BoundingBoxes   boxes;
+    spheres.Resize(volumes_count);
+    boxes.Resize(volumes_count);
+    for(Index index = 0U; index < volumes_count; ++index)
+    {
+        const hlslpp::float3 center(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const float size = size_distribution(rng);
+        spheres.Set(index, center, size);
+        boxes.Set(index, center - hlslpp::float3(size), center + hlslpp::float3(size));
+    }
+
+    VisibleIndices reference_sphere_indices;
+    VisibleIndices reference_box_indices;
+    for(Index index = 0U; index < volumes_count; ++index)
+    {
+        const hlslpp::float3 center(spheres.center_x[index], spheres.center_y[index], spheres.center_z[index]);
+        if (culler.IsSphereVisible(center, spheres.radius[index]))
+            reference_sphere_indices.push_back(index);
+
+        const hlslpp::float3 min(boxes.min_x[index], boxes.min_y[index], boxes.min_z[index]);
+        const hlslpp::float3 max(boxes.max_x[index], boxes.max_y[index], boxes.max_z[index]);
+        if (culler.IsBoxVisible(min, max))
+            reference_box_indices.push_back(index);
+    }
+
+    REQUIRE_FALSE(reference_sphere_indices.empty());
+    REQUIRE(reference_sphere_indices.size() < volumes_count);
+
+    SECTION("Serial batch culling matches single volume culling")
+    {
+        VisibleIndices visible_indices;
+        culler.CullSpheres(spheres, visible_indices);
+        CHECK(visible_indices == reference_sphere_indices);
+        culler.CullBoxes(boxes, visible_indices);
+        CHECK(visible_indices == reference_box_indices);
+    }
+
+    SECTION("Parallel batch culling matches single volume culling")
+    {
+        tf::Executor executor;
+        VisibleIndices visible_indices;
+        culler.CullSpheres(spheres, visible_indices, &executor, 1000U);
+        CHECK(visible_indices == reference_sphere_indices);
+        culler.CullBoxes(boxes, visible_indices, &executor, 1000U);
+        CHECK(visible_indices == reference_box_indices);
+    }
+
+    SECTION("Parallel batch culling with temporary memory resource")
+    {
+        std::array<std::byte, 1024> temp_buffer{};
+        std::pmr::monotonic_buffer_resource temp_memory(temp_buffer.data(), temp_buffer.size(), std::pmr::null_memory_resource());
+        const FrustumCuller temp_memory_culler(CreateTestCamera(), &temp_memory);
+        tf::Executor executor;
+        VisibleIndices visible_indices;
+        temp_memory_culler.CullSpheres(spheres, visible_indices, &executor, 1000U);
+        CHECK(visible_indices == reference_sphere_indices);
+    }
+}
+
+TEST_CASE("Frustum and normal cone culling of clusters", "[camera][culling]")
+{
+    const FrustumCuller  culler(CreateTestCamera());
+    const hlslpp::float3 view_position(0.f, 0.f, -10.f);
+
+    BoundingSpheres spheres;
+    BoundingCones   cones;
+    spheres.Resize(4U);
+    cones.Resize(4U);
+
+    // Cluster facing the camera
+    spheres.Set(0U, { 0.f, 0.f, 0.f }, 1.f);
+    cones.Set(0U, { 0.f, 0.f, 0.f }, { 0.f, 0.f, -1.f }, 0.5f);
+    // Cluster facing away from the camera
+    spheres.Set(1U, { 0.f, 0.f, 0.f }, 1.f);
+    cones.Set(1U, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 1.f }, 0.5f);
+    // Cluster facing away from the camera with disabled cone culling
+    spheres.Set(2U, { 0.f, 0.f, 0.f }, 1.f);
+    cones.Set(2U, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 1.f }, 1.f);
+    // Cluster facing the camera outside of frustum
+    spheres.Set(3U, { 1000.f, 0.f, 0.f }, 1.f);
+    cones.Set(3U, { 1000.f, 0.f, 0.f }, { 0.f, 0.f, -1.f }, 0.5f);
+
+    SECTION("Serial cluster culling")
+    {
+        VisibleIndices visible_indices;
+        culler.CullClusters(spheres, cones, view_position, visible_indices);
+        CHECK(visible_indices == VisibleIndices{ 0U, 2U });
+    }
+
+    SECTION("Parallel cluster culling")
+    {
+        tf::Executor executor;
+        VisibleIndices visible_indices;
+        culler.CullClusters(spheres, cones, view_position, visible_indices, &executor, 1U);
+        CHECK(visible_indices == VisibleIndices{ 0U, 2U });
+    }
+}
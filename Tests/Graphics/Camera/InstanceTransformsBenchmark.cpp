@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Camera/InstanceTransformsBenchmark.cpp
+Benchmark of instance uniforms update with MVP matrices of 1 million of instances
+
+******************************************************************************/
+
+#include <Methane/Graphics/InstanceTransforms.h>
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Graphics/Types.h>
+#include <Methane/Data/AlignedAllocator.hpp>
+#include <Methane/Data/ParallelFor.hpp>
+#include <Methane/Checks.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+static constexpr Size g_instances_count = 1000000U;
+
+// Instance uniforms are laid out in memory the same way as in mesh buffers
+struct META_UNIFORM_ALIGN InstanceUniforms
+{
+    hlslpp::float4x4 mvp_matrix;
+    int32_t          texture_index;
+};
+
+using InstancesUniforms = std::vector<InstanceUniforms, AlignedAllocator<InstanceUniforms, g_uniform_alignment>>;
+
+static InstanceTransforms CreateRandomTransforms()
+{
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-200.f, 200.f);
+    std::uniform_real_distribution<float> angle_distribution(-3.f, 3.f);
+    std::uniform_real_distribution<float> scale_distribution(0.5f, 2.f);
+    InstanceTransforms transforms;
+    transforms.Resize(g_instances_count);
+    for(Index index = 0U; index < g_instances_count; ++index)
+    {
+        const hlslpp::float3 translation(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float4 rotation = CombineRotations(GetAxisRotation({ 0.f, 0.f, 1.f }, angle_distribution(rng)),
+                                                         GetAxisRotation({ 0.f, 1.f, 0.f }, angle_distribution(rng)));
+        transforms.Set(index, translation, rotation, hlslpp::float3(scale_distribution(rng)));
+    }
+    return transforms;
+}
+
+// Per-instance uniforms setter with bounds check, similar to mesh buffers
+static void SetInstanceUniforms(InstancesUniforms& instances_uniforms, InstanceUniforms&& uniforms, Index instance_index)
+{
+    META_CHECK_ARG_LESS(instance_index, instances_uniforms.size());
+    instances_uniforms[instance_index] = std::move(uniforms);
+}
+
+TEST_CASE("Benchmark MVP matrices update of 1M instances", "[camera][transforms][benchmark]")
+{
+    Camera camera;
+    camera.Resize(FloatSize{ 640.f, 480.f });
+    camera.ResetOrientation({ { 0.f, 0.f, -10.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f } });
+
+    const hlslpp::float4x4   view_proj_matrix = camera.GetViewProjMatrix();
+    const InstanceTransforms transforms = CreateRandomTransforms();
+    std::vector<hlslpp::float4x4> model_matrices(g_instances_count);
+    for(Index index = 0U; index < g_instances_count; ++index)
+    {
+        model_matrices[index] = transforms.GetModelMatrix(index);
+    }
+
+    InstancesUniforms instances_uniforms(g_instances_count);
+    auto*             matrices_ptr = reinterpret_cast<RawPtr>(instances_uniforms.data()); // NOSONAR
+    tf::Executor      executor;
+
+    const auto update_instance_uniforms = [&model_matrices, &instances_uniforms, &view_proj_matrix](const Index index)
+    {
+        InstanceUniforms uniforms{};
+        uniforms.mvp_matrix    = hlslpp::transpose(hlslpp::mul(model_matrices[index], view_proj_matrix));
+        uniforms.texture_index = static_cast<int32_t>(index % 8U);
+        SetInstanceUniforms(instances_uniforms, std::move(uniforms), index);
+    };
+
+    BENCHMARK("Serial per-instance matrices update")
+    {
+        for(Index index = 0U; index < g_instances_count; ++index)
+        {
+            update_instance_uniforms(index);
+        }
+        return instances_uniforms.back().texture_index;
+    };
+
+    BENCHMARK("Parallel per-instance matrices update")
+    {
+        constexpr Index instances_chunk_size = 64U;
+        ParallelFor(executor, 0U, g_instances_count, update_instance_uniforms, instances_chunk_size);
+        return instances_uniforms.back().texture_index;
+    };
+
+    BENCHMARK("Serial batch matrices update")
+    {
+        transforms.WriteMvpMatrices(view_proj_matrix, matrices_ptr, sizeof(InstanceUniforms));
+        return instances_uniforms.back().texture_index;
+    };
+
+    BENCHMARK("Parallel batch matrices update")
+    {
+        transforms.WriteMvpMatrices(view_proj_matrix, matrices_ptr, sizeof(InstanceUniforms), &executor);
+        return instances_uniforms.back().texture_index;
+    };
+}
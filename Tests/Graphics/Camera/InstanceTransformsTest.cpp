@@ -0,0 +1,194 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Camera/InstanceTransformsTest.cpp
+Instance transforms unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/InstanceTransforms.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+#include <vector>
+#include <array>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+// Instance uniforms layout with matrix followed by other data, which must not be overwritten
+struct alignas(16) TestUniforms
+{
+    std::array<float, 16> mvp_matrix;
+    int32_t               texture_index;
+};
+
+static constexpr int32_t g_texture_index = 0x5A5A;
+static const hlslpp::float3 g_axis_y{ 0.f, 1.f, 0.f };
+static const hlslpp::float3 g_axis_z{ 0.f, 0.f, 1.f };
+static const hlslpp::float4x4 g_view_proj_matrix(
+    1.2f,  0.1f,  0.3f,  0.3f,
+    -0.2f, 1.6f,  0.2f,  0.2f,
+    0.4f,  -0.3f, 1.1f,  0.9f,
+    2.5f,  -1.5f, 10.2f, 10.f
+);
+
+static hlslpp::float4 GetMatrixRow(const hlslpp::float4x4& matrix, size_t row)
+{
+    const std::array<hlslpp::float4, 4> basis_vectors{
+        hlslpp::float4(1.f, 0.f, 0.f, 0.f),
+        hlslpp::float4(0.f, 1.f, 0.f, 0.f),
+        hlslpp::float4(0.f, 0.f, 1.f, 0.f),
+        hlslpp::float4(0.f, 0.f, 0.f, 1.f),
+    };
+    return hlslpp::mul(basis_vectors[row], matrix);
+}
+
+static bool IsMatrixEqual(const hlslpp::float4x4& matrix, const std::array<float, 16>& elements)
+{
+    bool is_equal = true;
+    for(size_t row = 0U; row < 4U; ++row)
+    {
+        const hlslpp::float4 matrix_row = GetMatrixRow(matrix, row);
+        is_equal &= elements[row * 4U]      == Catch::Approx(matrix_row.x).margin(1E-4);
+        is_equal &= elements[row * 4U + 1U] == Catch::Approx(matrix_row.y).margin(1E-4);
+        is_equal &= elements[row * 4U + 2U] == Catch::Approx(matrix_row.z).margin(1E-4);
+        is_equal &= elements[row * 4U + 3U] == Catch::Approx(matrix_row.w).margin(1E-4);
+    }
+    return is_equal;
+}
+
+static bool IsMatrixEqual(const hlslpp::float4x4& left, const hlslpp::float4x4& right)
+{
+    std::array<float, 16> right_elements{};
+    for(size_t row = 0U; row < 4U; ++row)
+    {
+        const hlslpp::float4 right_row = GetMatrixRow(right, row);
+        right_elements[row * 4U]      = right_row.x;
+        right_elements[row * 4U + 1U] = right_row.y;
+        right_elements[row * 4U + 2U] = right_row.z;
+        right_elements[row * 4U + 3U] = right_row.w;
+    }
+    return IsMatrixEqual(left, right_elements);
+}
+
+static InstanceTransforms CreateRandomTransforms(Size count)
+{
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-100.f, 100.f);
+    std::uniform_real_distribution<float> angle_distribution(-3.f, 3.f);
+    std::uniform_real_distribution<float> scale_distribution(0.1f, 3.f);
+    InstanceTransforms transforms;
+    transforms.Resize(count);
+    for(Index index = 0U; index < count; ++index)
+    {
+        const hlslpp::float3 translation(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 axis(position_distribution(rng), position_distribution(rng), position_distribution(rng) + 200.f);
+        const hlslpp::float3 scale(scale_distribution(rng), scale_distribution(rng), scale_distribution(rng));
+        transforms.Set(index, translation, GetAxisRotation(axis, angle_distribution(rng)), scale);
+    }
+    return transforms;
+}
+
+TEST_CASE("Instance transformation matrices", "[camera][transforms]")
+{
+    SECTION("Resized instances have identity transformation")
+    {
+        InstanceTransforms transforms;
+        transforms.Resize(3U);
+        CHECK(transforms.GetCount() == 3U);
+        CHECK(IsMatrixEqual(transforms.GetModelMatrix(2U), hlslpp::float4x4::identity()));
+    }
+
+    SECTION("Model matrix is composed of scale, rotation and translation")
+    {
+        const float angle_z = 0.7f;
+        const float angle_y = -1.3f;
+        const hlslpp::float4 rotation = CombineRotations(GetAxisRotation(g_axis_z, angle_z), GetAxisRotation(g_axis_y, angle_y));
+
+        InstanceTransforms transforms;
+        transforms.Resize(1U);
+        transforms.Set(0U, { 1.f, -2.f, 3.f }, rotation, { 0.5f, 2.f, 1.5f });
+
+        const hlslpp::float4x4 rotation_matrix = hlslpp::mul(hlslpp::float4x4::rotation_z(angle_z), hlslpp::float4x4::rotation_y(angle_y));
+        const hlslpp::float4x4 model_matrix = hlslpp::mul(hlslpp::mul(hlslpp::float4x4::scale(0.5f, 2.f, 1.5f), rotation_matrix),
+                                                          hlslpp::float4x4::translation(1.f, -2.f, 3.f));
+        CHECK(IsMatrixEqual(transforms.GetModelMatrix(0U), model_matrix));
+    }
+
+    SECTION("Local rotation is applied before current rotation")
+    {
+        InstanceTransforms transforms;
+        transforms.Resize(1U);
+        transforms.Set(0U, { 5.f, 0.f, -1.f }, GetAxisRotation(g_axis_y, 0.4f), hlslpp::float3(2.f));
+        const hlslpp::float4x4 initial_model_matrix = transforms.GetModelMatrix(0U);
+
+        for(size_t step = 0U; step < 100U; ++step)
+        {
+            transforms.Rotate(0U, GetAxisRotation(g_axis_z, 0.01f));
+        }
+
+        const hlslpp::float4x4 rotated_model_matrix = hlslpp::mul(hlslpp::float4x4::rotation_z(1.f), initial_model_matrix);
+        CHECK(IsMatrixEqual(transforms.GetModelMatrix(0U), rotated_model_matrix));
+    }
+}
+
+TEST_CASE("Instance MVP matrices batch writing", "[camera][transforms]")
+{
+    SECTION("Batch matrices are equal to per-instance matrices")
+    {
+        // Instance counts cover 8 and 4 lanes vectorized loops with scalar tail and scalar-only transformation
+        for(const Size instances_count : { 0U, 1U, 3U, 4U, 7U, 8U, 9U, 12U, 13U, 15U, 33U, 1027U })
+        {
+            const InstanceTransforms transforms = CreateRandomTransforms(instances_count);
+            std::vector<TestUniforms> uniforms(instances_count + 1U, TestUniforms{ {}, g_texture_index });
+            transforms.WriteMvpMatrices(g_view_proj_matrix, reinterpret_cast<RawPtr>(uniforms.data()), sizeof(TestUniforms)); // NOSONAR
+
+            bool is_batch_equal = true;
+            bool is_uniform_preserved = true;
+            for(Index index = 0U; index < instances_count; ++index)
+            {
+                const hlslpp::float4x4 mvp_matrix = hlslpp::transpose(hlslpp::mul(transforms.GetModelMatrix(index), g_view_proj_matrix));
+                is_batch_equal &= IsMatrixEqual(mvp_matrix, uniforms[index].mvp_matrix);
+                is_uniform_preserved &= uniforms[index].texture_index == g_texture_index;
+            }
+            CHECK(is_batch_equal);
+            CHECK(is_uniform_preserved);
+            CHECK(uniforms.back().mvp_matrix == std::array<float, 16>{});
+        }
+    }
+
+    SECTION("Parallel batch matrices are equal to serial batch matrices")
+    {
+        constexpr Size instances_count = 10001U;
+        const InstanceTransforms transforms = CreateRandomTransforms(instances_count);
+        std::vector<TestUniforms> serial_uniforms(instances_count);
+        std::vector<TestUniforms> parallel_uniforms(instances_count);
+        tf::Executor executor;
+
+        transforms.WriteMvpMatrices(g_view_proj_matrix, reinterpret_cast<RawPtr>(serial_uniforms.data()), sizeof(TestUniforms)); // NOSONAR
+        transforms.WriteMvpMatrices(g_view_proj_matrix, reinterpret_cast<RawPtr>(parallel_uniforms.data()), sizeof(TestUniforms), &executor, 1000U); // NOSONAR
+
+        bool is_parallel_equal = true;
+        for(Index index = 0U; index < instances_count; ++index)
+            is_parallel_equal &= serial_uniforms[index].mvp_matrix == parallel_uniforms[index].mvp_matrix;
+        CHECK(is_parallel_equal);
+    }
+}
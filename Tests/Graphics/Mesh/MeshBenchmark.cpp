@@ -0,0 +1,74 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshBenchmark.cpp
+Benchmark of the large sphere meshes generation with serial and parallel icosahedron subdivision.
+
+******************************************************************************/
+
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane::Graphics;
+
+struct BenchmarkVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+TEST_CASE("Benchmark large sphere mesh generation", "[mesh][benchmark]")
+{
+    tf::Executor executor;
+
+    for(uint32_t subdivisions_count : { 5U, 7U, 9U })
+    {
+        BENCHMARK("Serial icosahedron subdivision to level " + std::to_string(subdivisions_count))
+        {
+            return IcosahedronMesh<BenchmarkVertex, uint32_t>(BenchmarkVertex::layout, 1.F, subdivisions_count, true).GetIndexCount();
+        };
+        BENCHMARK("Parallel icosahedron subdivision to level " + std::to_string(subdivisions_count))
+        {
+            return IcosahedronMesh<BenchmarkVertex, uint32_t>(BenchmarkVertex::layout, 1.F, subdivisions_count, true, &executor).GetIndexCount();
+        };
+    }
+
+    BENCHMARK("UV sphere generation with 1000x1000 lines")
+    {
+        return SphereMesh<BenchmarkVertex, uint32_t>(BenchmarkVertex::layout, 1.F, 1000U, 1000U).GetIndexCount();
+    };
+}
+
+TEST_CASE("Benchmark vertex packing of large sphere mesh", "[mesh][vertex][benchmark]")
+{
+    const SphereMesh<BenchmarkVertex, uint32_t> sphere_mesh(BenchmarkVertex::layout, 1.F, 1000U, 1000U);
+    const Mesh::VertexLayout packed_layout = BenchmarkVertex::layout.GetPackedLayout({ Mesh::VertexField::Position, Mesh::VertexField::Normal });
+
+    BENCHMARK("Pack 1M vertices with half-float positions and octahedral normals")
+    {
+        return sphere_mesh.GetPackedVertexData(packed_layout).size();
+    };
+}
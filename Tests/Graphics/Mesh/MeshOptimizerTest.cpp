@@ -0,0 +1,147 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshOptimizerTest.cpp
+Unit-tests of the mesh vertex cache and vertex fetch optimization
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <set>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+struct OptimizedVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+using Triangle = std::array<uint32_t, 3>;
+
+// Triangle vertices are rotated to start from the smallest index, so that winding order is preserved in comparison
+template<typename IType>
+static std::multiset<Triangle> GetTriangles(const std::vector<IType>& indices)
+{
+    std::multiset<Triangle> triangles;
+    for(size_t i = 0; i < indices.size(); i += 3)
+    {
+        Triangle triangle{ indices[i], indices[i + 1], indices[i + 2] };
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.insert(triangle);
+    }
+    return triangles;
+}
+
+TEST_CASE("Vertex cache analysis", "[mesh][optimizer]")
+{
+    SECTION("Cache misses of a single triangle")
+    {
+        const std::vector<uint16_t> indices{ 0, 1, 2 };
+        const VertexCacheStatistics stats = AnalyzeVertexCache(indices.data(), static_cast<Data::Size>(indices.size()));
+        CHECK(stats.triangles_count == 1U);
+        CHECK(stats.vertices_count == 3U);
+        CHECK(stats.cache_misses_count == 3U);
+        CHECK(stats.GetAcmr() == 3.0);
+        CHECK(stats.GetAtvr() == 1.0);
+    }
+
+    SECTION("Vertices evicted from FIFO cache are transformed again")
+    {
+        const std::vector<uint16_t> indices{ 0, 1, 2,  3, 4, 5,  0, 1, 2 };
+        CHECK(AnalyzeVertexCache(indices.data(), static_cast<Data::Size>(indices.size()), 16U).cache_misses_count == 6U);
+        CHECK(AnalyzeVertexCache(indices.data(), static_cast<Data::Size>(indices.size()), 4U).cache_misses_count == 9U);
+    }
+}
+
+TEST_CASE("Vertex cache optimization", "[mesh][optimizer]")
+{
+    const SphereMesh<OptimizedVertex, uint32_t> sphere_mesh(OptimizedVertex::layout, 1.F, 100U, 200U);
+    std::vector<uint32_t> indices = sphere_mesh.GetIndices();
+    const auto index_count = static_cast<Data::Size>(indices.size());
+
+    const VertexCacheStatistics initial_stats = AnalyzeVertexCache(indices.data(), index_count);
+    OptimizeVertexCache(indices.data(), index_count);
+    const VertexCacheStatistics optimized_stats = AnalyzeVertexCache(indices.data(), index_count);
+
+    SECTION("Cache miss ratios are reduced")
+    {
+        CHECK(optimized_stats.GetAcmr() < initial_stats.GetAcmr() * 0.75);
+        CHECK(optimized_stats.GetAtvr() < 1.5);
+    }
+
+    SECTION("Triangles with their winding order are preserved")
+    {
+        CHECK(GetTriangles(indices) == GetTriangles(sphere_mesh.GetIndices()));
+    }
+}
+
+TEST_CASE("Vertex fetch optimization", "[mesh][optimizer]")
+{
+    const IcosahedronMesh<OptimizedVertex> icosahedron_mesh(OptimizedVertex::layout, 1.F, 3U, true);
+    std::vector<OptimizedVertex> vertices = icosahedron_mesh.GetVertices();
+    std::vector<uint16_t>        indices  = icosahedron_mesh.GetIndices();
+    const auto index_count = static_cast<Data::Size>(indices.size());
+
+    OptimizeVertexCache(indices.data(), index_count);
+    const std::vector<uint16_t> cache_optimized_indices = indices;
+    OptimizeVertexFetch(reinterpret_cast<Data::RawPtr>(vertices.data()), static_cast<Data::Size>(sizeof(OptimizedVertex)), // NOSONAR
+                        indices.data(), index_count);
+
+    SECTION("Vertices are numbered in order of first use")
+    {
+        uint16_t next_vertex_index = 0U;
+        bool     is_first_use_order = true;
+        for(uint16_t index : indices)
+        {
+            if (index == next_vertex_index)
+                next_vertex_index++;
+            else
+                is_first_use_order &= index < next_vertex_index;
+        }
+        CHECK(is_first_use_order);
+        CHECK(next_vertex_index == icosahedron_mesh.GetVertexCount());
+    }
+
+    SECTION("Remapped indices reference the same vertices")
+    {
+        bool are_vertices_equal = true;
+        for(size_t i = 0; i < indices.size(); ++i)
+        {
+            are_vertices_equal &= vertices[indices[i]].position == icosahedron_mesh.GetVertices()[cache_optimized_indices[i]].position;
+        }
+        CHECK(are_vertices_equal);
+    }
+
+    SECTION("Vertex cache statistics are not changed by vertex fetch optimization")
+    {
+        CHECK(AnalyzeVertexCache(indices.data(), index_count).cache_misses_count ==
+              AnalyzeVertexCache(cache_optimized_indices.data(), index_count).cache_misses_count);
+    }
+}
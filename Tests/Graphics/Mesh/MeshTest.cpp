@@ -0,0 +1,154 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshTest.cpp
+Unit-tests of the mesh generators with 16 and 32-bit indices
+
+******************************************************************************/
+
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+using Catch::Approx;
+
+struct MeshVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+template<typename MeshType>
+static bool AreMeshIndicesValid(const MeshType& mesh)
+{
+    const Data::Size vertex_count = mesh.GetVertexCount();
+    return std::all_of(mesh.GetIndices().begin(), mesh.GetIndices().end(),
+                       [vertex_count](auto index) { return index < vertex_count; });
+}
+
+TEST_CASE("Mesh index type", "[mesh][index]")
+{
+    SECTION("Cube mesh with default 16-bit indices")
+    {
+        const CubeMesh<MeshVertex> cube_mesh(MeshVertex::layout);
+        CHECK(cube_mesh.GetVertexCount() == 24U);
+        CHECK(cube_mesh.GetIndexCount() == 36U);
+        CHECK(cube_mesh.GetIndexFormat() == PixelFormat::R16Uint);
+        CHECK(cube_mesh.GetIndexDataSize() == 36U * sizeof(uint16_t));
+        CHECK(AreMeshIndicesValid(cube_mesh));
+    }
+
+    SECTION("Cube mesh with 32-bit indices")
+    {
+        const CubeMesh<MeshVertex, uint32_t> cube_mesh(MeshVertex::layout);
+        const CubeMesh<MeshVertex>           cube_mesh_16(MeshVertex::layout);
+        CHECK(cube_mesh.GetIndexFormat() == PixelFormat::R32Uint);
+        CHECK(cube_mesh.GetIndexDataSize() == 36U * sizeof(uint32_t));
+        CHECK(std::equal(cube_mesh.GetIndices().begin(), cube_mesh.GetIndices().end(), cube_mesh_16.GetIndices().begin()));
+    }
+
+    SECTION("Uber mesh with 32-bit indices adjusts sub-mesh indices")
+    {
+        UberMesh<MeshVertex, uint32_t> uber_mesh(MeshVertex::layout);
+        uber_mesh.AddSubMesh(CubeMesh<MeshVertex, uint32_t>(MeshVertex::layout), true);
+        uber_mesh.AddSubMesh(SphereMesh<MeshVertex, uint32_t>(MeshVertex::layout), true);
+        CHECK(uber_mesh.GetSubsetCount() == 2U);
+        CHECK(uber_mesh.GetSubset(1).vertices.offset == 24U);
+        CHECK(AreMeshIndicesValid(uber_mesh));
+    }
+}
+
+TEST_CASE("Large sphere mesh", "[mesh][sphere]")
+{
+    constexpr Data::Size lat_lines_count  = 300U;
+    constexpr Data::Size long_lines_count = 400U;
+
+    SECTION("Sphere vertices count exceeds 16-bit index range")
+    {
+        const SphereMesh<MeshVertex, uint32_t> sphere_mesh(MeshVertex::layout, 1.F, lat_lines_count, long_lines_count);
+        CHECK(sphere_mesh.GetVertexCount() == (lat_lines_count - 2) * long_lines_count + 2);
+        CHECK(sphere_mesh.GetVertexCount() > BaseMesh<MeshVertex>::g_max_vertex_count);
+        CHECK(sphere_mesh.GetIndexCount() == (lat_lines_count - 2) * long_lines_count * 6);
+        CHECK(AreMeshIndicesValid(sphere_mesh));
+    }
+
+    SECTION("Sphere generation with 16-bit indices fails on overflow")
+    {
+        CHECK_THROWS(SphereMesh<MeshVertex>(MeshVertex::layout, 1.F, lat_lines_count, long_lines_count));
+    }
+}
+
+TEST_CASE("Icosahedron mesh subdivision", "[mesh][icosahedron]")
+{
+    SECTION("Subdivision vertices and indices count")
+    {
+        for(uint32_t subdivisions_count = 0U; subdivisions_count < 4U; ++subdivisions_count)
+        {
+            const IcosahedronMesh<MeshVertex> icosahedron_mesh(MeshVertex::layout, 1.F, subdivisions_count);
+            const Data::Size faces_multiplier = 1U << (2U * subdivisions_count);
+            CHECK(icosahedron_mesh.GetVertexCount() == 10U * faces_multiplier + 2U);
+            CHECK(icosahedron_mesh.GetIndexCount() == 20U * 3U * faces_multiplier);
+            CHECK(AreMeshIndicesValid(icosahedron_mesh));
+        }
+    }
+
+    SECTION("Subdivision beyond 16-bit index range")
+    {
+        CHECK_THROWS(IcosahedronMesh<MeshVertex>(MeshVertex::layout, 1.F, 7U));
+
+        const IcosahedronMesh<MeshVertex, uint32_t> icosahedron_mesh(MeshVertex::layout, 1.F, 7U);
+        CHECK(icosahedron_mesh.GetVertexCount() == 10U * (1U << 14U) + 2U);
+        CHECK(AreMeshIndicesValid(icosahedron_mesh));
+    }
+
+    SECTION("Parallel subdivision is equal to serial subdivision")
+    {
+        tf::Executor executor;
+        const IcosahedronMesh<MeshVertex, uint32_t> serial_mesh(MeshVertex::layout, 2.F, 6U, true);
+        const IcosahedronMesh<MeshVertex, uint32_t> parallel_mesh(MeshVertex::layout, 2.F, 6U, true, &executor);
+        REQUIRE(parallel_mesh.GetVertexCount() == serial_mesh.GetVertexCount());
+        CHECK(parallel_mesh.GetIndices() == serial_mesh.GetIndices());
+
+        bool are_vertices_equal = true;
+        for(size_t vertex_index = 0; vertex_index < serial_mesh.GetVertexCount(); ++vertex_index)
+        {
+            are_vertices_equal &= parallel_mesh.GetVertices()[vertex_index].position == serial_mesh.GetVertices()[vertex_index].position;
+        }
+        CHECK(are_vertices_equal);
+    }
+
+    SECTION("Spherified vertices are placed on sphere of given radius")
+    {
+        const IcosahedronMesh<MeshVertex> icosahedron_mesh(MeshVertex::layout, 2.F, 2U, true);
+        for(const MeshVertex& vertex : icosahedron_mesh.GetVertices())
+        {
+            CHECK(vertex.position.GetLength() == Approx(2.F));
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshletsBenchmark.cpp
+Benchmark of meshlets generation and headless CPU culling of mesh clusters
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/FrustumCuller.h>
+#include <Methane/Graphics/Camera.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+struct BenchmarkVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+TEST_CASE("Benchmark meshlets generation and culling", "[mesh][meshlets][benchmark]")
+{
+    tf::Executor executor;
+    const IcosahedronMesh<BenchmarkVertex, uint32_t> icosahedron_mesh(BenchmarkVertex::layout, 10.F, 7U, true, &executor);
+
+    BENCHMARK("Meshlets generation of icosahedron with 7 subdivisions")
+    {
+        return Meshlets(icosahedron_mesh).GetCount();
+    };
+
+    const Meshlets meshlets(icosahedron_mesh);
+    BoundingSpheres spheres;
+    BoundingCones   cones;
+    spheres.Resize(meshlets.GetCount());
+    cones.Resize(meshlets.GetCount());
+    for(Index meshlet_index = 0U; meshlet_index < meshlets.GetCount(); ++meshlet_index)
+    {
+        const Meshlets::Bounds& bounds = meshlets.GetBounds()[meshlet_index];
+        spheres.Set(meshlet_index, bounds.center.AsHlsl(), bounds.radius);
+        cones.Set(meshlet_index, bounds.cone_apex.AsHlsl(), bounds.cone_axis.AsHlsl(), bounds.cone_cutoff);
+    }
+
+    // Camera looks at the mesh surface from close distance, so that meshlets are culled both by frustum and by normal cones
+    Camera camera;
+    camera.Resize(FloatSize{ 640.f, 480.f });
+    camera.ResetOrientation({ { 0.f, 0.f, -15.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f } });
+
+    const FrustumCuller  culler(camera);
+    const hlslpp::float3 view_position(0.f, 0.f, -15.f);
+    VisibleIndices       visible_meshlets;
+
+    BENCHMARK("Serial frustum culling of " + std::to_string(meshlets.GetCount()) + " meshlets")
+    {
+        culler.CullSpheres(spheres, visible_meshlets);
+        return visible_meshlets.size();
+    };
+
+    BENCHMARK("Serial cluster culling of " + std::to_string(meshlets.GetCount()) + " meshlets")
+    {
+        culler.CullClusters(spheres, cones, view_position, visible_meshlets);
+        return visible_meshlets.size();
+    };
+
+    BENCHMARK("Parallel cluster culling of " + std::to_string(meshlets.GetCount()) + " meshlets")
+    {
+        culler.CullClusters(spheres, cones, view_position, visible_meshlets, &executor, 1024U);
+        return visible_meshlets.size();
+    };
+}
@@ -0,0 +1,245 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshletsTest.cpp
+Unit-tests of the meshlets generation with cluster bounding spheres and normal cones
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/FrustumCuller.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <set>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+struct MeshletVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+using Triangle = std::array<Data::Index, 3>;
+
+static std::multiset<Triangle> GetMeshTriangles(const Mesh& mesh, const Mesh::Subsets& subsets, const std::vector<uint32_t>& indices)
+{
+    std::multiset<Triangle> triangles;
+    for(const Mesh::Subset& subset : subsets)
+    {
+        const Data::Index base_vertex = subset.indices_adjusted ? 0U : subset.vertices.offset;
+        for(Data::Index i = subset.indices.offset; i < subset.indices.offset + subset.indices.count; i += 3)
+        {
+            triangles.insert({ base_vertex + indices[i], base_vertex + indices[i + 1], base_vertex + indices[i + 2] });
+        }
+    }
+    CHECK(triangles.size() * 3U == mesh.GetIndexCount());
+    return triangles;
+}
+
+static std::multiset<Triangle> GetMeshletTriangles(const Meshlets& meshlets)
+{
+    const std::vector<Data::Index> meshlet_indices = meshlets.GetMeshletIndices();
+    std::multiset<Triangle> triangles;
+    for(size_t i = 0; i < meshlet_indices.size(); i += 3)
+    {
+        triangles.insert({ meshlet_indices[i], meshlet_indices[i + 1], meshlet_indices[i + 2] });
+    }
+    return triangles;
+}
+
+static hlslpp::float3 GetTriangleNormal(const Mesh& mesh, const Triangle& triangle)
+{
+    const hlslpp::float3 p0 = mesh.GetVertexPosition(triangle[0]).AsHlsl();
+    return hlslpp::cross(mesh.GetVertexPosition(triangle[1]).AsHlsl() - p0,
+                         mesh.GetVertexPosition(triangle[2]).AsHlsl() - p0);
+}
+
+static void CheckMeshletLimits(const Meshlets& meshlets, Data::Size max_vertex_count, Data::Size max_triangle_count)
+{
+    for(const Meshlets::Meshlet& meshlet : meshlets.GetMeshlets())
+    {
+        CHECK(meshlet.vertex_count > 0U);
+        CHECK(meshlet.vertex_count <= max_vertex_count);
+        CHECK(meshlet.triangle_count > 0U);
+        CHECK(meshlet.triangle_count <= max_triangle_count);
+
+        // Local vertex indices of meshlet triangles reference unique meshlet vertices
+        const auto vertices_begin = meshlets.GetVertices().begin() + meshlet.vertex_offset;
+        CHECK(std::set<Data::Index>(vertices_begin, vertices_begin + meshlet.vertex_count).size() == meshlet.vertex_count);
+        for(Data::Index i = meshlet.triangle_offset; i < meshlet.triangle_offset + meshlet.triangle_count * 3U; ++i)
+        {
+            CHECK(meshlets.GetTriangles()[i] < meshlet.vertex_count);
+        }
+    }
+}
+
+TEST_CASE("Meshlets generation", "[mesh][meshlets]")
+{
+    SECTION("Meshlets of icosahedron respect limits and cover all triangles")
+    {
+        const IcosahedronMesh<MeshletVertex, uint32_t> icosahedron_mesh(MeshletVertex::layout, 1.F, 4U);
+        const Mesh::Subsets subsets{ Mesh::Subset(icosahedron_mesh.GetType(), { 0, icosahedron_mesh.GetVertexCount() },
+                                                  { 0, icosahedron_mesh.GetIndexCount() }, true) };
+        const Meshlets meshlets(icosahedron_mesh);
+
+        CHECK(meshlets.GetCount() >= icosahedron_mesh.GetIndexCount() / 3U / Meshlets::g_max_triangle_count);
+        CHECK(meshlets.GetBounds().size() == meshlets.GetCount());
+        CheckMeshletLimits(meshlets, Meshlets::g_max_vertex_count, Meshlets::g_max_triangle_count);
+        CHECK(GetMeshletTriangles(meshlets) == GetMeshTriangles(icosahedron_mesh, subsets, icosahedron_mesh.GetIndices()));
+    }
+
+    SECTION("Meshlets with small limits")
+    {
+        const SphereMesh<MeshletVertex, uint32_t> sphere_mesh(MeshletVertex::layout, 1.F, 16U, 16U);
+        const Mesh::Subsets subsets{ Mesh::Subset(sphere_mesh.GetType(), { 0, sphere_mesh.GetVertexCount() },
+                                                  { 0, sphere_mesh.GetIndexCount() }, true) };
+        const Meshlets meshlets(sphere_mesh, {}, 8U, 6U);
+        CheckMeshletLimits(meshlets, 8U, 6U);
+        CHECK(GetMeshletTriangles(meshlets) == GetMeshTriangles(sphere_mesh, subsets, sphere_mesh.GetIndices()));
+    }
+
+    SECTION("Meshlets do not cross uber-mesh subsets")
+    {
+        UberMesh<MeshletVertex, uint32_t> uber_mesh(MeshletVertex::layout);
+        uber_mesh.AddSubMesh(CubeMesh<MeshletVertex, uint32_t>(MeshletVertex::layout), false);
+        uber_mesh.AddSubMesh(SphereMesh<MeshletVertex, uint32_t>(MeshletVertex::layout, 1.F, 32U, 32U), false);
+        uber_mesh.AddSubMesh(IcosahedronMesh<MeshletVertex, uint32_t>(MeshletVertex::layout, 1.F, 3U), false);
+
+        const Meshlets meshlets(uber_mesh, uber_mesh.GetSubsets());
+        CheckMeshletLimits(meshlets, Meshlets::g_max_vertex_count, Meshlets::g_max_triangle_count);
+        CHECK(GetMeshletTriangles(meshlets) == GetMeshTriangles(uber_mesh, uber_mesh.GetSubsets(), uber_mesh.GetIndices()));
+
+        Data::Index next_meshlet_index = 0U;
+        for(Data::Index subset_index = 0U; subset_index < uber_mesh.GetSubsets().size(); ++subset_index)
+        {
+            const Mesh::Subset&        subset          = uber_mesh.GetSubsets()[subset_index];
+            const Mesh::Subset::Slice& subset_meshlets = meshlets.GetSubsetMeshlets(subset_index);
+            CHECK(subset_meshlets.offset == next_meshlet_index);
+            CHECK(subset_meshlets.count > 0U);
+            next_meshlet_index += subset_meshlets.count;
+
+            Data::Size subset_triangles_count = 0U;
+            for(Data::Index meshlet_index = subset_meshlets.offset; meshlet_index < next_meshlet_index; ++meshlet_index)
+            {
+                const Meshlets::Meshlet& meshlet = meshlets.GetMeshlets()[meshlet_index];
+                CHECK(meshlet.subset_index == subset_index);
+                subset_triangles_count += meshlet.triangle_count;
+                for(Data::Index v = meshlet.vertex_offset; v < meshlet.vertex_offset + meshlet.vertex_count; ++v)
+                {
+                    CHECK(meshlets.GetVertices()[v] >= subset.vertices.offset);
+                    CHECK(meshlets.GetVertices()[v] < subset.vertices.offset + subset.vertices.count);
+                }
+            }
+            CHECK(subset_triangles_count * 3U == subset.indices.count);
+        }
+        CHECK(next_meshlet_index == meshlets.GetCount());
+    }
+}
+
+TEST_CASE("Meshlet bounds", "[mesh][meshlets]")
+{
+    const IcosahedronMesh<MeshletVertex, uint32_t> icosahedron_mesh(MeshletVertex::layout, 1.F, 4U);
+    const Meshlets meshlets(icosahedron_mesh);
+    const std::vector<Data::Index> meshlet_indices = meshlets.GetMeshletIndices();
+
+    SECTION("Bounding spheres contain meshlet vertices")
+    {
+        for(Data::Index meshlet_index = 0U; meshlet_index < meshlets.GetCount(); ++meshlet_index)
+        {
+            const Meshlets::Meshlet& meshlet = meshlets.GetMeshlets()[meshlet_index];
+            const Meshlets::Bounds&  bounds  = meshlets.GetBounds()[meshlet_index];
+            for(Data::Index v = meshlet.vertex_offset; v < meshlet.vertex_offset + meshlet.vertex_count; ++v)
+            {
+                const hlslpp::float3 position = icosahedron_mesh.GetVertexPosition(meshlets.GetVertices()[v]).AsHlsl();
+                CHECK(static_cast<float>(hlslpp::length(position - bounds.center.AsHlsl())) <= bounds.radius + 1E-5F);
+            }
+        }
+    }
+
+    SECTION("Normal cones of convex mesh meshlets point outside")
+    {
+        // Cone culling may be disabled only for a few meshlets combining distant triangles
+        Data::Size cone_meshlets_count = 0U;
+        for(const Meshlets::Bounds& bounds : meshlets.GetBounds())
+        {
+            if (bounds.cone_cutoff >= 1.F)
+                continue;
+
+            CHECK(static_cast<float>(hlslpp::dot(bounds.cone_axis.AsHlsl(), bounds.center.AsHlsl())) > 0.F);
+            cone_meshlets_count++;
+        }
+        CHECK(cone_meshlets_count >= meshlets.GetCount() * 3U / 4U);
+    }
+
+    SECTION("Meshlets culled by normal cone have only back-facing triangles")
+    {
+        BoundingSpheres spheres;
+        BoundingCones   cones;
+        spheres.Resize(meshlets.GetCount());
+        cones.Resize(meshlets.GetCount());
+        for(Data::Index meshlet_index = 0U; meshlet_index < meshlets.GetCount(); ++meshlet_index)
+        {
+            const Meshlets::Bounds& bounds = meshlets.GetBounds()[meshlet_index];
+            spheres.Set(meshlet_index, bounds.center.AsHlsl(), bounds.radius);
+            cones.Set(meshlet_index, bounds.cone_apex.AsHlsl(), bounds.cone_axis.AsHlsl(), bounds.cone_cutoff);
+        }
+
+        // Orthographic frustum covers the whole mesh, so that meshlets are culled by normal cones only
+        const FrustumCuller culler(hlslpp::float4x4(0.25F, 0.F,   0.F,   0.F,
+                                                    0.F,   0.25F, 0.F,   0.F,
+                                                    0.F,   0.F,   0.25F, 0.F,
+                                                    0.F,   0.F,   0.5F,  1.F));
+        for(const hlslpp::float3& view_position : { hlslpp::float3(0.F, 0.F, -5.F), hlslpp::float3(3.F, 4.F, 0.F), hlslpp::float3(-2.F, -2.F, 2.F) })
+        {
+            VisibleIndices visible_meshlets;
+            culler.CullClusters(spheres, cones, view_position, visible_meshlets);
+            CHECK(visible_meshlets.size() < meshlets.GetCount() * 3U / 4U);
+            CHECK(visible_meshlets.size() > meshlets.GetCount() / 4U);
+
+            Data::Index visible_index = 0U;
+            for(Data::Index meshlet_index = 0U; meshlet_index < meshlets.GetCount(); ++meshlet_index)
+            {
+                if (visible_index < visible_meshlets.size() && visible_meshlets[visible_index] == meshlet_index)
+                {
+                    ++visible_index;
+                    continue;
+                }
+
+                const Meshlets::Meshlet& meshlet = meshlets.GetMeshlets()[meshlet_index];
+                for(Data::Index i = meshlet.triangle_offset; i < meshlet.triangle_offset + meshlet.triangle_count * 3U; i += 3U)
+                {
+                    const Triangle triangle{ meshlet_indices[i], meshlet_indices[i + 1], meshlet_indices[i + 2] };
+                    const hlslpp::float3 p0 = icosahedron_mesh.GetVertexPosition(triangle[0]).AsHlsl();
+                    CHECK(static_cast<float>(hlslpp::dot(GetTriangleNormal(icosahedron_mesh, triangle), view_position - p0)) <= 0.F);
+                }
+            }
+        }
+    }
+}
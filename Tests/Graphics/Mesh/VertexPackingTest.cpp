@@ -0,0 +1,210 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/VertexPackingTest.cpp
+Unit tests of vertex field packing kernels and packed mesh vertex layouts
+
+******************************************************************************/
+
+#include <Methane/Graphics/VertexPacking.h>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+using Catch::Approx;
+
+struct PackingVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+    Mesh::TexCoord texcoord;
+    Mesh::Color    color;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+        Mesh::VertexField::TexCoord,
+        Mesh::VertexField::Color,
+    };
+};
+
+template<typename T>
+static T ReadPacked(const Data::Bytes& data, size_t offset)
+{
+    T value{};
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+TEST_CASE("Half-float conversion", "[mesh][vertex][packing]")
+{
+    SECTION("Exactly representable values are preserved")
+    {
+        for(const float value : { 0.F, -0.F, 1.F, -2.5F, 0.125F, 1024.F, 65504.F, -65504.F })
+        {
+            CHECK(UnpackHalf(PackHalf(value)) == value);
+        }
+        CHECK(PackHalf(1.F) == 0x3C00U);
+        CHECK(PackHalf(-2.F) == 0xC000U);
+    }
+
+    SECTION("Values are rounded to nearest even half")
+    {
+        CHECK(PackHalf(1.F + 1.F / 2048.F) == 0x3C00U);
+        CHECK(PackHalf(1.F + 3.F / 2048.F) == 0x3C02U);
+        CHECK(UnpackHalf(PackHalf(3.14159F)) == Approx(3.14159F).epsilon(0.001));
+    }
+
+    SECTION("Out of range values are converted to infinity, denormals and zero")
+    {
+        CHECK(PackHalf(65520.F) == 0x7C00U);
+        CHECK(PackHalf(-1.E6F) == 0xFC00U);
+        CHECK(PackHalf(std::numeric_limits<float>::infinity()) == 0x7C00U);
+        CHECK(std::isnan(UnpackHalf(PackHalf(std::numeric_limits<float>::quiet_NaN()))));
+        CHECK(PackHalf(std::ldexp(1.F, -24)) == 0x0001U);
+        CHECK(UnpackHalf(0x0001U) == std::ldexp(1.F, -24));
+        CHECK(PackHalf(1.E-9F) == 0x0000U);
+    }
+}
+
+TEST_CASE("Vertex field packing kernels", "[mesh][vertex][packing]")
+{
+    // Vertex counts cover vectorized loops with scalar tails and scalar-only conversion
+    constexpr size_t max_vertex_count = 19U;
+    constexpr size_t src_stride       = sizeof(PackingVertex);
+    constexpr size_t dst_stride       = 20U;
+
+    std::array<PackingVertex, max_vertex_count> vertices{};
+    for(size_t vertex_index = 0U; vertex_index < max_vertex_count; ++vertex_index)
+    {
+        const auto  angle = static_cast<float>(vertex_index) * 0.7F;
+        const float z     = std::cos(angle * 1.3F);
+        const float r     = std::sqrt(1.F - z * z);
+        vertices[vertex_index].position = Mesh::Position(std::sin(angle) * 10.F, static_cast<float>(vertex_index) - 9.F, 0.5F);
+        vertices[vertex_index].normal   = Mesh::Normal(r * std::cos(angle), r * std::sin(angle), z);
+        vertices[vertex_index].texcoord = Mesh::TexCoord(static_cast<float>(vertex_index) / 16.F - 0.1F, 0.25F);
+        vertices[vertex_index].color    = Mesh::Color(0.F, 0.5F, static_cast<float>(vertex_index) / 10.F);
+    }
+    const auto* src_ptr = reinterpret_cast<Data::ConstRawPtr>(vertices.data()); // NOSONAR
+
+    for(const size_t vertex_count : { 1U, 3U, 4U, 5U, 8U, 19U })
+    {
+        Data::Bytes packed_data(vertex_count * dst_stride + 1U, std::byte{ 0xCDU });
+        PackHalfPositions(src_ptr, src_stride, packed_data.data(), dst_stride, vertex_count);
+        PackOctahedralNormals(src_ptr + 12U, src_stride, packed_data.data() + 8U, dst_stride, vertex_count);
+        PackUnormTexCoords(src_ptr + 24U, src_stride, packed_data.data() + 12U, dst_stride, vertex_count);
+        PackUnormColors(src_ptr + 32U, src_stride, packed_data.data() + 16U, dst_stride, vertex_count);
+        CHECK(packed_data.back() == std::byte{ 0xCDU });
+
+        bool is_position_correct = true;
+        bool is_normal_correct   = true;
+        bool is_texcoord_correct = true;
+        bool is_color_correct    = true;
+        for(size_t vertex_index = 0U; vertex_index < vertex_count; ++vertex_index)
+        {
+            const PackingVertex& vertex = vertices[vertex_index];
+            const size_t packed_offset = vertex_index * dst_stride;
+
+            const auto half_position = ReadPacked<std::array<uint16_t, 4>>(packed_data, packed_offset);
+            for(size_t component_index = 0U; component_index < 3U; ++component_index)
+                is_position_correct &= std::abs(UnpackHalf(half_position[component_index]) - vertex.position[component_index]) <= 0.01F;
+            is_position_correct &= UnpackHalf(half_position[3]) == 1.F;
+
+            const auto oct_normal = ReadPacked<std::array<int16_t, 2>>(packed_data, packed_offset + 8U);
+            const Data::RawVector3F normal = UnpackOctahedralNormal(oct_normal[0], oct_normal[1]);
+            for(size_t component_index = 0U; component_index < 3U; ++component_index)
+                is_normal_correct &= std::abs(normal[component_index] - vertex.normal[component_index]) <= 0.001F;
+
+            const auto unorm_texcoord = ReadPacked<std::array<uint16_t, 2>>(packed_data, packed_offset + 12U);
+            is_texcoord_correct &= unorm_texcoord[0] == static_cast<uint16_t>(std::nearbyint(std::clamp(vertex.texcoord[0], 0.F, 1.F) * 65535.F));
+            is_texcoord_correct &= unorm_texcoord[1] == 16384U;
+
+            const auto unorm_color = ReadPacked<std::array<uint8_t, 4>>(packed_data, packed_offset + 16U);
+            is_color_correct &= unorm_color[0] == 0U && unorm_color[1] == 128U && unorm_color[3] == 255U;
+            is_color_correct &= unorm_color[2] == static_cast<uint8_t>(std::nearbyint(std::min(vertex.color[2], 1.F) * 255.F));
+        }
+        CHECK(is_position_correct);
+        CHECK(is_normal_correct);
+        CHECK(is_texcoord_correct);
+        CHECK(is_color_correct);
+    }
+}
+
+TEST_CASE("Packed mesh vertex layouts", "[mesh][vertex][packing]")
+{
+    const CubeMesh<PackingVertex> cube_mesh(PackingVertex::layout);
+
+    SECTION("Packed layout has compact vertex size, packed formats and semantics")
+    {
+        const Mesh::VertexLayout packed_layout = PackingVertex::layout.GetPackedLayout({
+            Mesh::VertexField::Position, Mesh::VertexField::Normal, Mesh::VertexField::TexCoord, Mesh::VertexField::Color
+        });
+        CHECK(PackingVertex::layout.GetVertexSize() == sizeof(PackingVertex));
+        CHECK(packed_layout.GetVertexSize() == 20U);
+        CHECK(packed_layout.GetFormats() == PixelFormats{ PixelFormat::RGBA16Float, PixelFormat::RG16Snorm, PixelFormat::RG16Unorm, PixelFormat::RGBA8Unorm });
+        CHECK(packed_layout.GetSemantics() == std::vector<std::string_view>{ "POSITION", "OCTNORMAL", "TEXCOORD", "COLOR" });
+        CHECK(PackingVertex::layout.GetFormats() == PixelFormats(4U, PixelFormat::Unknown));
+    }
+
+    SECTION("Partially packed layout keeps float fields unchanged")
+    {
+        const Mesh::VertexLayout packed_layout({ Mesh::VertexField::Position, Mesh::VertexField::Normal, Mesh::VertexField::TexCoord, Mesh::VertexField::Color },
+                                               { Mesh::VertexField::Normal });
+        CHECK(packed_layout.GetVertexSize() == 36U);
+
+        const Data::Bytes packed_data = cube_mesh.GetPackedVertexData(packed_layout);
+        REQUIRE(packed_data.size() == cube_mesh.GetVertexCount() * 36U);
+
+        bool are_vertices_correct = true;
+        for(Data::Index vertex_index = 0U; vertex_index < cube_mesh.GetVertexCount(); ++vertex_index)
+        {
+            const PackingVertex& vertex = cube_mesh.GetVertices()[vertex_index];
+            const size_t packed_offset = vertex_index * 36U;
+            are_vertices_correct &= std::memcmp(packed_data.data() + packed_offset, &vertex.position, sizeof(vertex.position)) == 0;
+            are_vertices_correct &= std::memcmp(packed_data.data() + packed_offset + 16U, &vertex.texcoord, sizeof(vertex.texcoord)) == 0;
+            are_vertices_correct &= std::memcmp(packed_data.data() + packed_offset + 24U, &vertex.color, sizeof(vertex.color)) == 0;
+
+            const auto oct_normal = ReadPacked<std::array<int16_t, 2>>(packed_data, packed_offset + 12U);
+            const Data::RawVector3F normal = UnpackOctahedralNormal(oct_normal[0], oct_normal[1]);
+            for(size_t component_index = 0U; component_index < 3U; ++component_index)
+                are_vertices_correct &= std::abs(normal[component_index] - vertex.normal[component_index]) <= 0.001F;
+        }
+        CHECK(are_vertices_correct);
+    }
+
+    SECTION("Packed layout must have the same fields as mesh layout")
+    {
+        const Mesh::VertexLayout packed_layout({ Mesh::VertexField::Position, Mesh::VertexField::Normal }, { Mesh::VertexField::Position });
+        CHECK_THROWS(cube_mesh.GetPackedVertexData(packed_layout));
+    }
+
+    SECTION("Mesh can not be generated with packed layout")
+    {
+        const Mesh::VertexLayout packed_layout = PackingVertex::layout.GetPackedLayout({ Mesh::VertexField::Position });
+        CHECK_THROWS(CubeMesh<PackingVertex>(packed_layout));
+    }
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/IndirectDrawArgumentsBuilderTest.cpp
+Unit tests of indirect draw arguments builder from visible instance indices
+
+******************************************************************************/
+
+#include <Methane/Graphics/IndirectDrawArgumentsBuilder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+using IndexedArgumentsBuilder = IndirectDrawArgumentsBuilder<Rhi::DrawIndexedIndirectArguments>;
+
+static const Rhi::DrawIndexedIndirectArguments g_instance_draw_arguments{ 36U, 1U, 6U, 2, 0U };
+
+static VisibleIndices GenerateVisibleIndices(Size instances_count, float visible_ratio, uint32_t seed)
+{
+    std::mt19937 rng(seed); // NOSONAR - using pseudorandom generator is safe here
+    std::bernoulli_distribution visible_distribution(visible_ratio);
+    VisibleIndices visible_indices;
+    for(Index instance_index = 0U; instance_index < instances_count; ++instance_index)
+    {
+        if (visible_distribution(rng))
+            visible_indices.push_back(instance_index);
+    }
+    return visible_indices;
+}
+
+static void CheckArgumentsCoverVisibleIndices(const IndexedArgumentsBuilder::Arguments& arguments, const VisibleIndices& visible_indices)
+{
+    VisibleIndices drawn_indices;
+    for(const Rhi::DrawIndexedIndirectArguments& draw_args : arguments)
+    {
+        CHECK(draw_args.index_count == g_instance_draw_arguments.index_count);
+        CHECK(draw_args.start_index == g_instance_draw_arguments.start_index);
+        CHECK(draw_args.base_vertex == g_instance_draw_arguments.base_vertex);
+        CHECK(draw_args.instance_count > 0U);
+        for(Index instance_index = 0U; instance_index < draw_args.instance_count; ++instance_index)
+        {
+            drawn_indices.push_back(draw_args.start_instance + instance_index);
+        }
+    }
+    CHECK(drawn_indices == visible_indices);
+}
+
+TEST_CASE("Indirect draw arguments building", "[graphics][indirect]")
+{
+    SECTION("Empty visible indices produce no draws")
+    {
+        IndexedArgumentsBuilder builder(g_instance_draw_arguments);
+        CHECK(builder.Build({}).empty());
+        CHECK(builder.GetDrawCount() == 0U);
+    }
+
+    SECTION("Consecutive instances are merged in one draw")
+    {
+        IndexedArgumentsBuilder builder(g_instance_draw_arguments);
+        const VisibleIndices visible_indices{ 0U, 1U, 2U, 5U, 7U, 8U, 20U };
+        const IndexedArgumentsBuilder::Arguments& arguments = builder.Build(visible_indices);
+        REQUIRE(arguments.size() == 4U);
+        CHECK(arguments[0].start_instance == 0U);
+        CHECK(arguments[0].instance_count == 3U);
+        CHECK(arguments[1].start_instance == 5U);
+        CHECK(arguments[1].instance_count == 1U);
+        CHECK(arguments[2].start_instance == 7U);
+        CHECK(arguments[2].instance_count == 2U);
+        CHECK(arguments[3].start_instance == 20U);
+        CHECK(arguments[3].instance_count == 1U);
+        CheckArgumentsCoverVisibleIndices(arguments, visible_indices);
+    }
+
+    SECTION("All visible instances are drawn with one draw")
+    {
+        IndexedArgumentsBuilder builder(g_instance_draw_arguments);
+        const VisibleIndices visible_indices = GenerateVisibleIndices(1000U, 1.F, 1U);
+        const IndexedArgumentsBuilder::Arguments& arguments = builder.Build(visible_indices);
+        REQUIRE(arguments.size() == 1U);
+        CHECK(arguments[0].instance_count == 1000U);
+    }
+
+    SECTION("Parallel building matches serial building with ranges crossing chunk boundaries")
+    {
+        tf::Executor executor(4U);
+        const VisibleIndices visible_indices = GenerateVisibleIndices(100000U, 0.7F, 2U);
+        IndexedArgumentsBuilder serial_builder(g_instance_draw_arguments);
+        IndexedArgumentsBuilder parallel_builder(g_instance_draw_arguments, &executor, 1000U);
+
+        const IndexedArgumentsBuilder::Arguments& serial_arguments   = serial_builder.Build(visible_indices);
+        const IndexedArgumentsBuilder::Arguments& parallel_arguments = parallel_builder.Build(visible_indices);
+        REQUIRE(parallel_arguments.size() == serial_arguments.size());
+        CHECK(serial_arguments.size() < visible_indices.size());
+        for(size_t draw_index = 0U; draw_index < serial_arguments.size(); ++draw_index)
+        {
+            CHECK(parallel_arguments[draw_index].start_instance == serial_arguments[draw_index].start_instance);
+            CHECK(parallel_arguments[draw_index].instance_count == serial_arguments[draw_index].instance_count);
+        }
+        CheckArgumentsCoverVisibleIndices(parallel_arguments, visible_indices);
+    }
+
+    SECTION("Non-indexed draw arguments are built from vertex draw template")
+    {
+        IndirectDrawArgumentsBuilder<Rhi::DrawIndirectArguments> builder(Rhi::DrawIndirectArguments{ 3U, 1U, 9U, 0U });
+        const auto& arguments = builder.Build({ 4U, 5U, 6U });
+        REQUIRE(arguments.size() == 1U);
+        CHECK(arguments[0].vertex_count == 3U);
+        CHECK(arguments[0].start_vertex == 9U);
+        CHECK(arguments[0].start_instance == 4U);
+        CHECK(arguments[0].instance_count == 3U);
+    }
+}
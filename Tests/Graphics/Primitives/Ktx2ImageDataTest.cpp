@@ -0,0 +1,235 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/Ktx2ImageDataTest.cpp
+Unit tests of KTX2 image container parsing to texture sub-resources
+
+******************************************************************************/
+
+#include <Methane/Graphics/ImageLoader.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+constexpr uint32_t g_vk_format_rgba8_unorm = 37U;
+constexpr uint32_t g_vk_format_bc1_unorm   = 133U;
+constexpr uint32_t g_vk_format_bc7_srgb    = 146U;
+
+struct Ktx2TestImage
+{
+    uint32_t    vk_format;
+    PixelFormat pixel_format;
+    uint32_t    width;
+    uint32_t    height;
+    uint32_t    layer_count = 0U;
+    uint32_t    face_count  = 1U;
+    uint32_t    level_count = 1U;
+    uint32_t    supercompression_scheme = 0U;
+};
+
+template<typename T>
+static void AppendValue(Bytes& data, const T& value)
+{
+    const auto* value_ptr = reinterpret_cast<const Byte*>(&value); // NOSONAR
+    data.insert(data.end(), value_ptr, value_ptr + sizeof(T));
+}
+
+template<typename T>
+static void WriteValue(Bytes& data, size_t offset, const T& value)
+{
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+// Creates KTX2 container with level data stored from the smallest to the largest MIP, as recommended by specification.
+// Every image byte is filled with its MIP level index to verify sub-resource data pointers.
+static Bytes CreateKtx2Data(const Ktx2TestImage& image)
+{
+    static constexpr std::array<uint8_t, 12> s_identifier{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    Bytes data;
+    for(const uint8_t id_byte : s_identifier)
+        data.push_back(static_cast<Byte>(id_byte));
+
+    for(const uint32_t header_value : { image.vk_format, 1U, image.width, image.height, 0U, image.layer_count,
+                                        image.face_count, image.level_count, image.supercompression_scheme,
+                                        0U, 0U, 0U, 0U })
+        AppendValue(data, header_value);
+
+    AppendValue(data, uint64_t{ 0U });
+    AppendValue(data, uint64_t{ 0U });
+
+    const uint32_t levels_count      = std::max(1U, image.level_count);
+    const size_t   level_index_start = data.size();
+    data.resize(data.size() + levels_count * 3U * sizeof(uint64_t));
+
+    const uint32_t images_count = std::max(1U, image.layer_count) * image.face_count;
+    for(uint32_t mip_level = levels_count; mip_level-- > 0U;)
+    {
+        const uint64_t level_size = static_cast<uint64_t>(GetSlicePitch(image.pixel_format,
+                                                                        GetMipLevelSize(image.width, mip_level),
+                                                                        GetMipLevelSize(image.height, mip_level))) * images_count;
+        const size_t level_offset = data.size();
+        data.resize(data.size() + level_size, static_cast<Byte>(mip_level));
+
+        const size_t level_index_offset = level_index_start + mip_level * 3U * sizeof(uint64_t);
+        WriteValue(data, level_index_offset, static_cast<uint64_t>(level_offset));
+        WriteValue(data, level_index_offset + sizeof(uint64_t), level_size);
+        WriteValue(data, level_index_offset + 2U * sizeof(uint64_t), level_size);
+    }
+    return data;
+}
+
+TEST_CASE("KTX2 image data parsing", "[image][ktx2]")
+{
+    SECTION("KTX2 identifier is recognized")
+    {
+        const Bytes ktx2_data = CreateKtx2Data({ g_vk_format_rgba8_unorm, PixelFormat::RGBA8Unorm, 4U, 4U });
+        CHECK(Ktx2ImageData::IsKtx2Data(Chunk(ktx2_data.data(), static_cast<Size>(ktx2_data.size()))));
+
+        const Bytes png_header{ Byte{ 0x89 }, Byte{ 0x50 }, Byte{ 0x4E }, Byte{ 0x47 } };
+        CHECK_FALSE(Ktx2ImageData::IsKtx2Data(Chunk(png_header.data(), static_cast<Size>(png_header.size()))));
+        CHECK_THROWS(Ktx2ImageData(Chunk(Bytes(png_header))));
+    }
+
+    SECTION("Single level uncompressed image")
+    {
+        const Ktx2ImageData image_data(Chunk(CreateKtx2Data({ g_vk_format_rgba8_unorm, PixelFormat::RGBA8Unorm, 16U, 8U })));
+        CHECK(image_data.GetPixelFormat() == PixelFormat::RGBA8Unorm);
+        CHECK(image_data.GetDimensions() == Dimensions(16U, 8U, 1U));
+        CHECK(image_data.GetMipLevelsCount() == 1U);
+        CHECK_FALSE(image_data.IsArray());
+        CHECK_FALSE(image_data.IsCube());
+        REQUIRE(image_data.GetSubResources().size() == 1U);
+        CHECK(image_data.GetSubResources()[0].GetDataSize() == 16U * 8U * 4U);
+    }
+
+    SECTION("Block-compressed image with full MIP chain")
+    {
+        const Ktx2ImageData image_data(Chunk(CreateKtx2Data({ g_vk_format_bc1_unorm, PixelFormat::BC1Unorm, 16U, 16U, 0U, 1U, 5U })));
+        CHECK(image_data.GetPixelFormat() == PixelFormat::BC1Unorm);
+        CHECK(image_data.GetMipLevelsCount() == 5U);
+
+        const Rhi::SubResources& sub_resources = image_data.GetSubResources();
+        REQUIRE(sub_resources.size() == 5U);
+        const std::array<Size, 5> expected_sizes{ 128U, 32U, 8U, 8U, 8U };
+        for(uint32_t mip_level = 0U; mip_level < 5U; ++mip_level)
+        {
+            const Rhi::SubResource& sub_resource = sub_resources[mip_level];
+            CHECK(sub_resource.GetIndex() == Rhi::SubResource::Index(0U, 0U, mip_level));
+            CHECK(sub_resource.GetDataSize() == expected_sizes[mip_level]);
+            CHECK(*sub_resource.GetDataPtr() == static_cast<Byte>(mip_level));
+        }
+    }
+
+    SECTION("Block-compressed cube array image")
+    {
+        const Ktx2ImageData image_data(Chunk(CreateKtx2Data({ g_vk_format_bc7_srgb, PixelFormat::BC7Unorm_sRGB, 8U, 8U, 2U, 6U, 4U })));
+        CHECK(image_data.GetPixelFormat() == PixelFormat::BC7Unorm_sRGB);
+        CHECK(image_data.IsCube());
+        CHECK(image_data.IsArray());
+        CHECK(image_data.GetArrayLength() == 2U);
+        CHECK(image_data.GetDimensions() == Dimensions(8U, 8U, 6U));
+
+        const Rhi::SubResources& sub_resources = image_data.GetSubResources();
+        REQUIRE(sub_resources.size() == 2U * 6U * 4U);
+
+        // Sub-resources of each level are ordered by array layers and cube faces
+        const Rhi::SubResource& last_face_of_second_layer = sub_resources[11];
+        CHECK(last_face_of_second_layer.GetIndex() == Rhi::SubResource::Index(5U, 1U, 0U));
+        CHECK(last_face_of_second_layer.GetDataSize() == 64U);
+        CHECK(last_face_of_second_layer.GetDataPtr() == sub_resources[0].GetDataPtr() + 11U * 64U);
+
+        const Rhi::SubResource& first_face_of_last_level = sub_resources[36];
+        CHECK(first_face_of_last_level.GetIndex() == Rhi::SubResource::Index(0U, 0U, 3U));
+        CHECK(first_face_of_last_level.GetDataSize() == 16U);
+    }
+
+    SECTION("Unsupported images are rejected")
+    {
+        Ktx2TestImage supercompressed_image{ g_vk_format_bc1_unorm, PixelFormat::BC1Unorm, 16U, 16U };
+        supercompressed_image.supercompression_scheme = 2U;
+        CHECK_THROWS(Ktx2ImageData(Chunk(CreateKtx2Data(supercompressed_image))));
+
+        const Ktx2TestImage partial_mip_chain_image{ g_vk_format_bc1_unorm, PixelFormat::BC1Unorm, 16U, 16U, 0U, 1U, 3U };
+        CHECK_THROWS(Ktx2ImageData(Chunk(CreateKtx2Data(partial_mip_chain_image))));
+
+        Bytes truncated_data = CreateKtx2Data({ g_vk_format_bc1_unorm, PixelFormat::BC1Unorm, 16U, 16U, 0U, 1U, 5U });
+        truncated_data.resize(truncated_data.size() - 64U);
+        CHECK_THROWS(Ktx2ImageData(Chunk(std::move(truncated_data))));
+
+        // Level offset and length summing up past 64-bit range must not wrap around the bounds check
+        Bytes wrapped_level_data = CreateKtx2Data({ g_vk_format_rgba8_unorm, PixelFormat::RGBA8Unorm, 4U, 4U });
+        const size_t level_index_offset = 12U + 13U * sizeof(uint32_t) + 2U * sizeof(uint64_t);
+        WriteValue(wrapped_level_data, level_index_offset, std::numeric_limits<uint64_t>::max() - 15U);
+        WriteValue(wrapped_level_data, level_index_offset + sizeof(uint64_t), uint64_t{ 64U });
+        CHECK_THROWS(Ktx2ImageData(Chunk(std::move(wrapped_level_data))));
+    }
+}
+
+TEST_CASE("KTX2 image data writing", "[image][ktx2]")
+{
+    SECTION("Written MIP chain is parsed back without copy")
+    {
+        std::vector<Bytes> mip_levels;
+        for(uint32_t mip_level = 0U; mip_level < 4U; ++mip_level)
+        {
+            const Size level_size = GetMipLevelSize(8U, mip_level) * GetMipLevelSize(4U, mip_level) * 4U;
+            mip_levels.emplace_back(level_size, static_cast<Byte>(mip_level + 1U));
+        }
+
+        Bytes ktx2_data = Ktx2ImageData::Write(PixelFormat::RGBA8Unorm_sRGB, Dimensions(8U, 4U), mip_levels);
+        const Byte* ktx2_data_ptr = ktx2_data.data();
+        const Size  ktx2_data_size = static_cast<Size>(ktx2_data.size());
+
+        const Ktx2ImageData image_data(Chunk(std::move(ktx2_data)));
+        CHECK(image_data.GetPixelFormat() == PixelFormat::RGBA8Unorm_sRGB);
+        CHECK(image_data.GetDimensions() == Dimensions(8U, 4U, 1U));
+        CHECK(image_data.GetMipLevelsCount() == 4U);
+
+        const Rhi::SubResources& sub_resources = image_data.GetSubResources();
+        REQUIRE(sub_resources.size() == 4U);
+        for(uint32_t mip_level = 0U; mip_level < 4U; ++mip_level)
+        {
+            const Rhi::SubResource& sub_resource = sub_resources[mip_level];
+            CHECK(sub_resource.GetIndex() == Rhi::SubResource::Index(0U, 0U, mip_level));
+            CHECK(sub_resource.GetDataSize() == static_cast<Size>(mip_levels[mip_level].size()));
+            CHECK(sub_resource.GetDataPtr() >= ktx2_data_ptr);
+            CHECK(sub_resource.GetDataPtr() + sub_resource.GetDataSize() <= ktx2_data_ptr + ktx2_data_size);
+            CHECK(static_cast<Size>(sub_resource.GetDataPtr() - ktx2_data_ptr) % 4U == 0U);
+            CHECK(std::equal(mip_levels[mip_level].begin(), mip_levels[mip_level].end(), sub_resource.GetDataPtr()));
+        }
+    }
+
+    SECTION("Unsupported images are rejected")
+    {
+        const std::vector<Bytes> single_level{ Bytes(8U * 8U * 4U) };
+        CHECK_THROWS(Ktx2ImageData::Write(PixelFormat::BGRA8Unorm, Dimensions(8U, 8U), single_level));
+        CHECK_THROWS(Ktx2ImageData::Write(PixelFormat::RGBA8Unorm, Dimensions(8U, 4U), single_level));
+
+        const std::vector<Bytes> partial_mip_chain{ Bytes(8U * 8U * 4U), Bytes(4U * 4U * 4U) };
+        CHECK_THROWS(Ktx2ImageData::Write(PixelFormat::RGBA8Unorm, Dimensions(8U, 8U), partial_mip_chain));
+    }
+}
@@ -0,0 +1,163 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/MipChainGeneratorTest.cpp
+Unit tests of CPU MIP chain generation with box and Kaiser filters in sRGB and linear color spaces
+
+******************************************************************************/
+
+#include <Methane/Graphics/MipChainGenerator.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <functional>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+using Pixel = std::array<uint8_t, 4>;
+
+static const std::array<MipFilter, 2> g_mip_filters{ MipFilter::Box, MipFilter::Kaiser };
+
+static Bytes CreateImagePixels(const Dimensions& dimensions, const std::function<Pixel(uint32_t x, uint32_t y)>& get_pixel)
+{
+    Bytes pixels;
+    pixels.reserve(dimensions.GetWidth() * dimensions.GetHeight() * 4U);
+    for(uint32_t y = 0U; y < dimensions.GetHeight(); ++y)
+        for(uint32_t x = 0U; x < dimensions.GetWidth(); ++x)
+            for(const uint8_t channel_value : get_pixel(x, y))
+                pixels.push_back(static_cast<Byte>(channel_value));
+    return pixels;
+}
+
+static Pixel GetPixel(const Bytes& pixels, size_t pixel_index)
+{
+    Pixel pixel{};
+    for(size_t channel = 0U; channel < pixel.size(); ++channel)
+        pixel[channel] = static_cast<uint8_t>(pixels[pixel_index * 4U + channel]);
+    return pixel;
+}
+
+static bool IsPixelNear(const Pixel& pixel, const Pixel& expected_pixel, int tolerance = 1)
+{
+    for(size_t channel = 0U; channel < pixel.size(); ++channel)
+        if (std::abs(static_cast<int>(pixel[channel]) - static_cast<int>(expected_pixel[channel])) > tolerance)
+            return false;
+    return true;
+}
+
+TEST_CASE("MIP chain generation", "[image][mip]")
+{
+    SECTION("Full chain of MIP levels is generated down to 1x1 size")
+    {
+        for(const MipFilter filter : g_mip_filters)
+        {
+            const Dimensions dimensions(8U, 4U);
+            const Bytes pixels = CreateImagePixels(dimensions, [](uint32_t x, uint32_t y) {
+                return Pixel{ static_cast<uint8_t>(x * 30U), static_cast<uint8_t>(y * 60U), 128U, 255U };
+            });
+            const MipChainGenerator::MipLevels mip_levels = MipChainGenerator({ filter, true }).Generate(dimensions, Chunk(pixels.data(), static_cast<Size>(pixels.size())));
+
+            REQUIRE(mip_levels.size() == 4U);
+            CHECK(MipChainGenerator::GetMipLevelsCount(dimensions) == 4U);
+            CHECK(mip_levels[0] == pixels);
+            CHECK(mip_levels[1].size() == 4U * 2U * 4U);
+            CHECK(mip_levels[2].size() == 2U * 1U * 4U);
+            CHECK(mip_levels[3].size() == 1U * 1U * 4U);
+        }
+    }
+
+    SECTION("Uniform color is preserved in all MIP levels")
+    {
+        for(const MipFilter filter : g_mip_filters)
+        {
+            const Pixel color{ 200U, 100U, 30U, 180U };
+            const Dimensions dimensions(16U, 16U);
+            const Bytes pixels = CreateImagePixels(dimensions, [&color](uint32_t, uint32_t) { return color; });
+            for(const bool srgb_color_space : { true, false })
+            {
+                const MipChainGenerator::MipLevels mip_levels = MipChainGenerator({ filter, srgb_color_space }).Generate(dimensions, Chunk(pixels.data(), static_cast<Size>(pixels.size())));
+
+                REQUIRE(mip_levels.size() == 5U);
+                for(const Bytes& mip_level : mip_levels)
+                {
+                    for(size_t pixel_index = 0U; pixel_index < mip_level.size() / 4U; ++pixel_index)
+                    {
+                        CHECK(IsPixelNear(GetPixel(mip_level, pixel_index), color));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Checkerboard is averaged in linear color space")
+    {
+        for(const MipFilter filter : g_mip_filters)
+        {
+            // Black and white checkerboard with transparent black pixels is averaged to 50% of linear intensity,
+            // which is encoded to 188 in sRGB color space, while alpha channel is always averaged linearly
+            const Dimensions dimensions(16U, 16U);
+            const Bytes pixels = CreateImagePixels(dimensions, [](uint32_t x, uint32_t y) {
+                return (x + y) % 2U ? Pixel{ 255U, 255U, 255U, 255U } : Pixel{ 0U, 0U, 0U, 0U };
+            });
+
+            const MipChainGenerator::MipLevels srgb_mip_levels = MipChainGenerator({ filter, true }).Generate(dimensions, Chunk(pixels.data(), static_cast<Size>(pixels.size())));
+            CHECK(IsPixelNear(GetPixel(srgb_mip_levels[1], 27U), Pixel{ 188U, 188U, 188U, 128U }, 2));
+            CHECK(IsPixelNear(GetPixel(srgb_mip_levels.back(), 0U), Pixel{ 188U, 188U, 188U, 128U }, 2));
+
+            const MipChainGenerator::MipLevels linear_mip_levels = MipChainGenerator({ filter, false }).Generate(dimensions, Chunk(pixels.data(), static_cast<Size>(pixels.size())));
+            CHECK(IsPixelNear(GetPixel(linear_mip_levels[1], 27U), Pixel{ 128U, 128U, 128U, 128U }, 2));
+            CHECK(IsPixelNear(GetPixel(linear_mip_levels.back(), 0U), Pixel{ 128U, 128U, 128U, 128U }, 2));
+        }
+    }
+
+    SECTION("Parallel generation is equal to serial generation")
+    {
+        for(const MipFilter filter : g_mip_filters)
+        {
+            const Dimensions dimensions(100U, 60U);
+            const Bytes pixels = CreateImagePixels(dimensions, [](uint32_t x, uint32_t y) {
+                return Pixel{ static_cast<uint8_t>(x * 7U + y), static_cast<uint8_t>(y * 13U), static_cast<uint8_t>(x ^ y), static_cast<uint8_t>(x + y * 3U) };
+            });
+            const Chunk pixels_chunk(pixels.data(), static_cast<Size>(pixels.size()));
+
+            tf::Executor parallel_executor;
+            const MipChainGenerator::MipLevels serial_mip_levels   = MipChainGenerator({ filter, true }).Generate(dimensions, pixels_chunk);
+            const MipChainGenerator::MipLevels parallel_mip_levels = MipChainGenerator({ filter, true }, &parallel_executor).Generate(dimensions, pixels_chunk);
+
+            REQUIRE(serial_mip_levels.size() == 7U);
+            CHECK(serial_mip_levels[1].size() == 50U * 30U * 4U);
+            CHECK(serial_mip_levels[6].size() == 1U * 1U * 4U);
+            CHECK(parallel_mip_levels == serial_mip_levels);
+        }
+    }
+
+    SECTION("Invalid image data is rejected")
+    {
+        for(const MipFilter filter : g_mip_filters)
+        {
+            const Bytes pixels(8U * 8U * 4U);
+            const MipChainGenerator generator({ filter, true });
+            CHECK_THROWS(generator.Generate(Dimensions(8U, 4U), Chunk(pixels.data(), static_cast<Size>(pixels.size()))));
+            CHECK_THROWS(generator.Generate(Dimensions(8U, 8U, 2U), Chunk(pixels.data(), static_cast<Size>(pixels.size()))));
+        }
+    }
+}
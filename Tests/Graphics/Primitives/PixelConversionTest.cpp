@@ -0,0 +1,112 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/PixelConversionTest.cpp
+Unit tests of pixel format conversion kernels used in image decoding pipeline
+
+******************************************************************************/
+
+#include <Methane/Graphics/PixelConversion.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+static Bytes CreateRgbPixels(size_t pixels_count)
+{
+    Bytes pixels(pixels_count * 3U);
+    for(size_t byte_index = 0U; byte_index < pixels.size(); ++byte_index)
+        pixels[byte_index] = static_cast<Byte>(byte_index * 7U + byte_index / 3U);
+    return pixels;
+}
+
+TEST_CASE("Pixel format conversion", "[image][pixel]")
+{
+    SECTION("RGB pixels are expanded to RGBA with opaque alpha")
+    {
+        // Pixel counts cover vectorized loop with scalar tail and scalar-only conversion
+        for(const size_t pixels_count : { 0U, 1U, 5U, 15U, 16U, 17U, 33U, 100U, 1027U })
+        {
+            const Bytes rgb_pixels = CreateRgbPixels(pixels_count);
+            Bytes rgba_pixels(pixels_count * 4U + 1U, Byte{ 0xCDU });
+            ExpandRgbToRgba(rgb_pixels.data(), rgba_pixels.data(), pixels_count);
+
+            bool is_expansion_correct = true;
+            for(size_t pixel_index = 0U; pixel_index < pixels_count; ++pixel_index)
+            {
+                for(size_t channel = 0U; channel < 3U; ++channel)
+                    is_expansion_correct &= rgba_pixels[pixel_index * 4U + channel] == rgb_pixels[pixel_index * 3U + channel];
+                is_expansion_correct &= rgba_pixels[pixel_index * 4U + 3U] == Byte{ 255U };
+            }
+            CHECK(is_expansion_correct);
+            CHECK(rgba_pixels.back() == Byte{ 0xCDU });
+        }
+    }
+
+    SECTION("sRGB pixels are converted to linear color space with linear alpha")
+    {
+        const std::array<Byte, 8> srgb_pixels{
+            Byte{ 0U }, Byte{ 255U }, Byte{ 188U }, Byte{ 128U },
+            Byte{ 10U }, Byte{ 64U }, Byte{ 200U }, Byte{ 0U },
+        };
+        std::array<float, 8> linear_pixels{};
+        ConvertSrgbToLinear(srgb_pixels.data(), linear_pixels.data(), 2U);
+
+        CHECK(linear_pixels[0] == Catch::Approx(0.F));
+        CHECK(linear_pixels[1] == Catch::Approx(1.F));
+        CHECK(linear_pixels[2] == Catch::Approx(0.5029F).epsilon(0.001));
+        CHECK(linear_pixels[3] == Catch::Approx(128.F / 255.F));
+        CHECK(linear_pixels[4] == Catch::Approx(10.F / 255.F / 12.92F));
+        CHECK(linear_pixels[5] == Catch::Approx(0.0513F).epsilon(0.001));
+        CHECK(linear_pixels[6] == Catch::Approx(0.5776F).epsilon(0.001));
+        CHECK(linear_pixels[7] == Catch::Approx(0.F));
+    }
+
+    SECTION("All channel values are converted equally in vectorized loop and scalar tail")
+    {
+        // 257 pixels cover all 256 channel values in each channel with vectorized loop and scalar tail
+        const size_t pixels_count = 257U;
+        Bytes rgba_pixels(pixels_count * 4U);
+        for(size_t byte_index = 0U; byte_index < rgba_pixels.size(); ++byte_index)
+            rgba_pixels[byte_index] = static_cast<Byte>(byte_index / 4U + byte_index % 4U * 64U);
+
+        std::vector<float> linear_pixels(pixels_count * 4U + 1U, -1.F);
+        std::vector<float> unorm_pixels(pixels_count * 4U + 1U, -1.F);
+        ConvertSrgbToLinear(rgba_pixels.data(), linear_pixels.data(), pixels_count);
+        ConvertUnormToFloat(rgba_pixels.data(), unorm_pixels.data(), pixels_count);
+
+        bool is_conversion_correct = true;
+        for(size_t channel_index = 0U; channel_index < pixels_count * 4U; ++channel_index)
+        {
+            const float unorm_value  = static_cast<float>(std::to_integer<uint8_t>(rgba_pixels[channel_index])) / 255.F;
+            const float linear_value = unorm_value <= 0.04045F ? unorm_value / 12.92F : std::pow((unorm_value + 0.055F) / 1.055F, 2.4F);
+            const float expected_value = channel_index % 4U == 3U ? unorm_value : linear_value;
+            is_conversion_correct &= std::abs(linear_pixels[channel_index] - expected_value) <= 1E-6F;
+            is_conversion_correct &= std::abs(unorm_pixels[channel_index] - unorm_value) <= 1E-6F;
+        }
+        CHECK(is_conversion_correct);
+        CHECK(linear_pixels.back() == -1.F);
+        CHECK(unorm_pixels.back() == -1.F);
+    }
+}
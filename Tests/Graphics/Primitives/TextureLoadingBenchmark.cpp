@@ -0,0 +1,181 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/TextureLoadingBenchmark.cpp
+Benchmark of texture data loading to upload-ready MIP chain from PNG image
+decoded at runtime versus KTX2 image baked offline, and throughput benchmark
+of image decoding to RGBA8 pixels in single and multiple threads.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/PixelConversion.h>
+#include <Methane/Data/ParallelFor.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBI_WRITE_NO_STDIO
+#include <stb_image_write.h>
+
+#include <map>
+#include <string>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+
+// Provider of image files stored in memory returns chunks referencing its data without copy, like memory-mapped files
+class MemoryProvider final : public IProvider
+{
+public:
+    void AddData(const std::string& path, Bytes&& data) { m_data_by_path[path] = std::move(data); }
+
+    bool HasData(const std::string& path) const noexcept override { return m_data_by_path.count(path) > 0; }
+
+    Chunk GetData(const std::string& path) const override
+    {
+        const Bytes& data = m_data_by_path.at(path);
+        return Chunk(data.data(), static_cast<Size>(data.size()));
+    }
+
+    std::vector<std::string> GetFiles(const std::string&) const override { return {}; }
+
+private:
+    std::map<std::string, Bytes, std::less<>> m_data_by_path;
+};
+
+static const Dimensions g_image_dimensions(1024U, 1024U);
+
+static Bytes CreateImagePixels(const Dimensions& dimensions = g_image_dimensions, uint32_t channels_count = 4U)
+{
+    Bytes pixels(static_cast<size_t>(dimensions.GetPixelsCount()) * channels_count);
+    for(uint32_t y = 0U; y < dimensions.GetHeight(); ++y)
+        for(uint32_t x = 0U; x < dimensions.GetWidth(); ++x)
+        {
+            Byte* pixel_ptr = pixels.data() + (static_cast<size_t>(y) * dimensions.GetWidth() + x) * channels_count;
+            pixel_ptr[0] = static_cast<Byte>(x);
+            pixel_ptr[1] = static_cast<Byte>(y);
+            pixel_ptr[2] = static_cast<Byte>((x * y) >> 4U);
+            if (channels_count == 4U)
+                pixel_ptr[3] = Byte{ 255U };
+        }
+    return pixels;
+}
+
+static Bytes EncodePng(const Bytes& pixels, const Dimensions& dimensions = g_image_dimensions, uint32_t channels_count = 4U)
+{
+    Bytes png_data;
+    stbi_write_png_to_func([](void* context_ptr, void* data_ptr, int size)
+        {
+            auto& png_data = *static_cast<Bytes*>(context_ptr);
+            const auto* bytes_ptr = static_cast<const Byte*>(data_ptr);
+            png_data.insert(png_data.end(), bytes_ptr, bytes_ptr + size);
+        },
+        &png_data, static_cast<int>(dimensions.GetWidth()), static_cast<int>(dimensions.GetHeight()), static_cast<int>(channels_count),
+        pixels.data(), static_cast<int>(dimensions.GetWidth() * channels_count));
+    return png_data;
+}
+
+TEST_CASE("Texture loading benchmark", "[image][ktx2][mip][benchmark]")
+{
+    tf::Executor parallel_executor;
+    const MipChainGenerator mip_generator({ MipFilter::Kaiser, true }, &parallel_executor);
+    const Bytes             pixels = CreateImagePixels();
+
+    MemoryProvider memory_provider;
+    memory_provider.AddData("Image.png", EncodePng(pixels));
+    memory_provider.AddData("Image.ktx2", Ktx2ImageData::Write(PixelFormat::RGBA8Unorm_sRGB, g_image_dimensions,
+                                                               mip_generator.Generate(g_image_dimensions, Chunk(pixels.data(), static_cast<Size>(pixels.size())))));
+    const ImageLoader image_loader(memory_provider);
+
+    BENCHMARK("Decode of PNG image")
+    {
+        return image_loader.LoadImageData("Image.png", 4U, false).GetPixels().GetDataSize();
+    };
+
+    BENCHMARK("Decode of PNG image with MIP chain generation on CPU")
+    {
+        const ImageData image_data = image_loader.LoadImageData("Image.png", 4U, false);
+        return mip_generator.Generate(image_data.GetDimensions(), image_data.GetPixels()).size();
+    };
+
+    BENCHMARK("Parsing of baked KTX2 image with MIP chain")
+    {
+        return image_loader.LoadKtx2ImageData("Image.ktx2").GetSubResources().size();
+    };
+}
+
+TEST_CASE("Image decoding benchmark", "[image][pixel][benchmark]")
+{
+    // Benchmark names contain size of RGBA8 output data and threads count to estimate throughput in MB/s per core
+    const Dimensions    image_dimensions(2048U, 2048U);
+    const size_t        pixels_count = image_dimensions.GetPixelsCount();
+    const auto          rgba_data_size = static_cast<Size>(pixels_count * 4U);
+    const std::string   data_size_mb = std::to_string(rgba_data_size / (1024U * 1024U)) + " MB";
+    const Bytes         rgb_pixels = CreateImagePixels(image_dimensions, 3U);
+    const Bytes         rgba_pixels = CreateImagePixels(image_dimensions, 4U);
+    tf::Executor        parallel_executor;
+    const std::string   threads_count = std::to_string(parallel_executor.num_workers()) + " threads";
+
+    MemoryProvider memory_provider;
+    memory_provider.AddData("Image.png", EncodePng(rgb_pixels, image_dimensions, 3U));
+    const ImageLoader image_loader(memory_provider);
+
+    const ImageLoader::ImageInfo image_info = image_loader.GetImageInfo("Image.png");
+    CHECK(image_info.dimensions == image_dimensions);
+    CHECK(image_info.channels_count == 3U);
+
+    Bytes decoded_pixels(rgba_data_size);
+    image_loader.DecodeImageToRgba8("Image.png", decoded_pixels.data(), rgba_data_size, &parallel_executor);
+    CHECK(decoded_pixels == rgba_pixels);
+
+    constexpr size_t rows_tile_size = 32U;
+    const size_t     tile_pixels_count = rows_tile_size * image_dimensions.GetWidth();
+    const auto expand_rows_tile = [&rgb_pixels, &decoded_pixels, tile_pixels_count](size_t tile_index)
+    {
+        ExpandRgbToRgba(rgb_pixels.data() + tile_index * tile_pixels_count * 3U,
+                        decoded_pixels.data() + tile_index * tile_pixels_count * 4U, tile_pixels_count);
+    };
+
+    BENCHMARK("Expansion of RGB pixels to " + data_size_mb + " of RGBA in 1 thread")
+    {
+        ExpandRgbToRgba(rgb_pixels.data(), decoded_pixels.data(), pixels_count);
+        return decoded_pixels.back();
+    };
+
+    BENCHMARK("Expansion of RGB pixels to " + data_size_mb + " of RGBA in " + threads_count)
+    {
+        ParallelFor(parallel_executor, size_t{ 0U }, pixels_count / tile_pixels_count, expand_rows_tile);
+        return decoded_pixels.back();
+    };
+
+    BENCHMARK("Decode of RGB PNG image to " + data_size_mb + " of RGBA in 1 thread")
+    {
+        image_loader.DecodeImageToRgba8("Image.png", decoded_pixels.data(), rgba_data_size);
+        return decoded_pixels.back();
+    };
+
+    BENCHMARK("Decode of RGB PNG image to " + data_size_mb + " of RGBA in " + threads_count)
+    {
+        image_loader.DecodeImageToRgba8("Image.png", decoded_pixels.data(), rgba_data_size, &parallel_executor);
+        return decoded_pixels.back();
+    };
+}
@@ -0,0 +1,86 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/AsyncResourceUploadBenchmark.cpp
+Benchmark of frame time impact of resource streaming with synchronous and asynchronous uploads
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/Buffer.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <vector>
+#include <string_view>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+// Reported time of one benchmark run is divided by this count to get frame time
+static constexpr uint32_t   g_frames_count = 10U;
+
+// Streaming of 500 MB of assets is split in chunks of 8 MB uploaded every frame during 63 frames,
+// each chunk takes 1 ms to upload in emulated transfer queue with 8 GB/s bandwidth
+static constexpr Data::Size g_stream_chunk_size = 8U * 1024U * 1024U;
+static constexpr std::chrono::microseconds g_stream_chunk_upload_duration = 1ms;
+
+TEST_CASE("Frame loop with resource streaming benchmark", "[rhi][context][upload][benchmark]")
+{
+    constexpr std::chrono::microseconds cpu_frame_duration = 1ms;
+    constexpr std::chrono::microseconds gpu_frame_duration = 1ms;
+    constexpr std::array<std::pair<std::string_view, Rhi::ContextOptionMask>, 2> upload_modes{ {
+        { "synchronous",  Rhi::ContextOptionMask{} },
+        { "asynchronous", Rhi::ContextOptionMask{ Rhi::ContextOption::AsyncResourceUploads } }
+    } };
+
+    const Data::Bytes chunk_data(g_stream_chunk_size, std::byte{ 1U });
+    const Rhi::SubResources chunk_sub_resources{ { chunk_data.data(), g_stream_chunk_size } };
+
+    for(const auto& [upload_mode_name, options_mask] : upload_modes)
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(3U, 2U, gpu_frame_duration, options_mask);
+        dynamic_cast<Null::CommandQueue&>(env.render_context.GetUploadCommandKit().GetQueue().GetInterface())
+            .SetEmulatedExecutionDuration(g_stream_chunk_upload_duration);
+
+        // Streamed chunks are uploaded to the ring of buffers, which are not used for rendering until streaming is complete
+        const Rhi::CommandQueue render_cmd_queue = env.render_context.GetRenderCommandKit().GetQueue();
+        std::vector<Rhi::Buffer> stream_buffers;
+        for(uint32_t buffer_index = 0U; buffer_index < 3U; ++buffer_index)
+        {
+            stream_buffers.emplace_back(env.render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(g_stream_chunk_size, 16U)));
+        }
+
+        const FrameUpdateFunction stream_chunk = [&stream_buffers, &chunk_sub_resources, &render_cmd_queue](uint32_t frame_index)
+        {
+            stream_buffers[frame_index % stream_buffers.size()].SetData(chunk_sub_resources, render_cmd_queue);
+        };
+
+        BENCHMARK(fmt::format("{} frames streaming 8 MB per frame with {} uploads, 1 ms CPU and 1 ms GPU per frame",
+                              g_frames_count, upload_mode_name))
+        {
+            return RenderFrames(env, g_frames_count, cpu_frame_duration, stream_chunk);
+        };
+    }
+}
@@ -0,0 +1,160 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/AsyncResourceUploadTest.cpp
+Unit tests of asynchronous resource uploads synchronized with command queues on first use of resources
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/Resource.h>
+#include <Methane/Graphics/Base/CommandList.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+static Null::CommandQueue& GetNullCommandQueue(const Rhi::ICommandKit& cmd_kit)
+{
+    return dynamic_cast<Null::CommandQueue&>(cmd_kit.GetQueue());
+}
+
+TEST_CASE("Asynchronous resource uploads with Null RHI", "[rhi][context][upload]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us, { Rhi::ContextOption::AsyncResourceUploads });
+    const Rhi::RenderContext& render_context = env.render_context;
+    const auto& base_context = dynamic_cast<const Base::Context&>(render_context.GetInterface());
+    const Rhi::CommandQueue render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+    Null::CommandQueue& null_render_queue = GetNullCommandQueue(render_context.GetRenderCommandKit().GetInterface());
+    Null::CommandQueue& null_upload_queue = GetNullCommandQueue(render_context.GetUploadCommandKit().GetInterface());
+    null_upload_queue.SetEmulatedExecutionDuration(20ms);
+
+    Rhi::Buffer          vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(24U * 16U, 16U));
+    const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer });
+    SetBufferData(vertex_buffer, std::vector<float>(24U * 4U, 1.F), render_cmd_queue);
+
+    const Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists[0];
+    const auto& base_cmd_list = dynamic_cast<const Base::CommandList&>(render_cmd_list.GetInterface());
+    const auto& base_vertex_buffer = dynamic_cast<const Base::Resource&>(vertex_buffer.GetInterface());
+    CHECK(base_vertex_buffer.GetUploadBatchIndex() == 1U);
+    CHECK(base_context.HasUnsynchronizedUploads());
+
+    SECTION("Render queue does not wait for uploads of resources which are not used")
+    {
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+        CHECK(base_context.GetExecutedUploadBatchesCount() == 1U);
+        CHECK(base_context.GetSynchronizedUploadBatchIndex() == 0U);
+
+        render_cmd_list.Reset();
+        render_cmd_list.Commit();
+        render_cmd_queue.Execute(env.execute_cmd_list_sets[0]);
+
+        CHECK(base_cmd_list.GetRequiredUploadBatchIndex() == 0U);
+        CHECK(base_context.GetSynchronizedUploadBatchIndex() == 0U);
+        CHECK(null_render_queue.GetEmulatedCompletionTime() < null_upload_queue.GetEmulatedCompletionTime());
+    }
+
+    SECTION("Render queue waits for upload on first use of uploaded resource")
+    {
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+
+        render_cmd_list.Reset();
+        render_cmd_list.SetVertexBuffers(vertex_buffer_set);
+        render_cmd_list.Commit();
+        CHECK(base_cmd_list.GetRequiredUploadBatchIndex() == 1U);
+
+        render_cmd_queue.Execute(env.execute_cmd_list_sets[0]);
+        CHECK(base_context.GetExecutedUploadBatchesCount() == 1U);
+        CHECK(base_context.GetSynchronizedUploadBatchIndex() == 1U);
+        CHECK_FALSE(base_context.HasUnsynchronizedUploads());
+        CHECK(null_render_queue.GetEmulatedCompletionTime() >= null_upload_queue.GetEmulatedCompletionTime());
+    }
+
+    SECTION("Encoded upload batch is executed before command list using uploaded resource")
+    {
+        render_cmd_list.Reset();
+        render_cmd_list.SetVertexBuffers(vertex_buffer_set);
+        render_cmd_list.Commit();
+
+        render_cmd_queue.Execute(env.execute_cmd_list_sets[0]);
+        CHECK(base_context.GetExecutedUploadBatchesCount() == 1U);
+        CHECK(base_context.GetSynchronizedUploadBatchIndex() == 1U);
+    }
+
+    SECTION("Render queue waits only for upload batches up to the required one")
+    {
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+
+        const Rhi::Buffer index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(36U * 4U, PixelFormat::R32Uint));
+        SetBufferData(index_buffer, std::vector<uint32_t>(36U, 0U), render_cmd_queue);
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+        CHECK(base_context.GetExecutedUploadBatchesCount() == 2U);
+
+        render_cmd_list.Reset();
+        render_cmd_list.SetVertexBuffers(vertex_buffer_set);
+        render_cmd_list.Commit();
+        CHECK(base_cmd_list.GetRequiredUploadBatchIndex() == 1U);
+
+        render_cmd_queue.Execute(env.execute_cmd_list_sets[0]);
+        CHECK(base_context.GetSynchronizedUploadBatchIndex() == 1U);
+        CHECK(base_context.HasUnsynchronizedUploads());
+        CHECK(null_render_queue.GetEmulatedCompletionTime() < null_upload_queue.GetEmulatedCompletionTime());
+    }
+
+    SECTION("Next upload batch is encoded to another command list while previous batch is executing")
+    {
+        const Rhi::ICommandList& first_upload_cmd_list = base_context.GetUploadCommandListForEncoding();
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+
+        const Rhi::Buffer index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(36U * 4U, PixelFormat::R32Uint));
+        SetBufferData(index_buffer, std::vector<uint32_t>(36U, 0U), render_cmd_queue);
+
+        const Rhi::ICommandList& second_upload_cmd_list = base_context.GetUploadCommandListForEncoding();
+        CHECK(std::addressof(first_upload_cmd_list) != std::addressof(second_upload_cmd_list));
+        CHECK(dynamic_cast<const Base::Resource&>(index_buffer.GetInterface()).GetUploadBatchIndex() == 2U);
+    }
+}
+
+TEST_CASE("Synchronous resource uploads with Null RHI", "[rhi][context][upload]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+    const auto& base_context = dynamic_cast<const Base::Context&>(render_context.GetInterface());
+    const Rhi::CommandQueue render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+    Null::CommandQueue& null_render_queue = GetNullCommandQueue(render_context.GetRenderCommandKit().GetInterface());
+    Null::CommandQueue& null_upload_queue = GetNullCommandQueue(render_context.GetUploadCommandKit().GetInterface());
+    null_upload_queue.SetEmulatedExecutionDuration(20ms);
+
+    const Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(24U * 16U, 16U));
+    SetBufferData(vertex_buffer, std::vector<float>(24U * 4U, 1.F), render_cmd_queue);
+    CHECK_FALSE(base_context.HasUnsynchronizedUploads());
+
+    render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+    CHECK(base_context.GetExecutedUploadBatchesCount() == 1U);
+    CHECK(base_context.GetSynchronizedUploadBatchIndex() == 1U);
+    CHECK(null_render_queue.GetEmulatedCompletionTime() >= null_upload_queue.GetEmulatedCompletionTime());
+}
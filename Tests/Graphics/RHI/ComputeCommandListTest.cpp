@@ -0,0 +1,168 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ComputeCommandListTest.cpp
+Unit tests of compute state and compute command list dispatches with Null RHI
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeState.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/ResourceBarriers.h>
+#include <Methane/Graphics/Null/ComputeCommandList.h>
+#include <Methane/Data/FileProvider.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+static Rhi::Program CreateComputeProgram(const Rhi::RenderContext& render_context)
+{
+    return Rhi::Program(render_context,
+        Rhi::Program::Settings
+        {
+            Rhi::Program::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::FileProvider::Get(), { "Test", "MainCS" } } },
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors
+            {
+                { Rhi::ShaderType::Compute, "g_particles", Rhi::ProgramArgumentAccessType::Mutable },
+            }
+        });
+}
+
+TEST_CASE("Compute command list dispatches with Null RHI", "[rhi][command-list][compute]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+
+    const Rhi::CommandQueue compute_cmd_queue(render_context, Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const auto& null_cmd_list = dynamic_cast<const Null::ComputeCommandList&>(compute_cmd_list.GetInterface());
+    CHECK(compute_cmd_list.GetInterface().GetType() == Rhi::CommandListType::Compute);
+
+    const Rhi::Program      program = CreateComputeProgram(render_context);
+    const Rhi::ComputeState compute_state(render_context, Rhi::ComputeStateSettingsImpl{ program, Rhi::ThreadGroupSize(64U, 1U, 1U) });
+    const Rhi::Buffer       particles_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForStorageBuffer(1024U * 16U, 16U, false));
+    const Rhi::ProgramBindings program_bindings(program, {
+        { { Rhi::ShaderType::All, "g_particles" }, { { particles_buffer.GetInterface() } } },
+    });
+
+    SECTION("Direct dispatches are encoded with thread groups count")
+    {
+        compute_cmd_list.ResetWithState(compute_state);
+        compute_cmd_list.SetProgramBindings(program_bindings);
+        compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(16U, 1U, 1U));
+        compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 2U));
+        CHECK(null_cmd_list.GetDispatchesCount() == 2U);
+        CHECK(null_cmd_list.GetThreadGroupsCount() == 48U);
+        compute_cmd_list.Commit();
+
+        const Rhi::CommandListSet cmd_list_set(Refs<Rhi::ICommandList>{ compute_cmd_list.GetInterface() });
+        compute_cmd_queue.Execute(cmd_list_set);
+        CHECK(compute_cmd_list.GetState() == Rhi::CommandListState::Pending);
+    }
+
+    SECTION("Indirect dispatch reads thread groups count from arguments buffer")
+    {
+        const std::vector<Rhi::DispatchIndirectArguments> dispatch_arguments{ { 8U, 2U, 1U }, { 0U, 1U, 1U } };
+        const auto arguments_size = static_cast<Data::Size>(sizeof(Rhi::DispatchIndirectArguments) * dispatch_arguments.size());
+        const Rhi::Buffer arguments_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectBuffer(arguments_size, true));
+        arguments_buffer.SetData(Rhi::SubResources{
+            { reinterpret_cast<Data::ConstRawPtr>(dispatch_arguments.data()), arguments_size } // NOSONAR
+        }, compute_cmd_queue);
+
+        compute_cmd_list.ResetWithState(compute_state);
+        compute_cmd_list.DispatchIndirect(arguments_buffer, 0U);
+        compute_cmd_list.DispatchIndirect(arguments_buffer, sizeof(Rhi::DispatchIndirectArguments));
+        CHECK(null_cmd_list.GetDispatchesCount() == 1U);
+        CHECK(null_cmd_list.GetThreadGroupsCount() == 16U);
+
+        CHECK_THROWS(compute_cmd_list.DispatchIndirect(arguments_buffer, 2U));
+        CHECK_THROWS(compute_cmd_list.DispatchIndirect(arguments_buffer, arguments_buffer.GetSettings().size));
+        CHECK_THROWS(compute_cmd_list.DispatchIndirect(particles_buffer, 0U));
+    }
+
+    SECTION("Dispatch requires compute state and non-empty thread groups count")
+    {
+        compute_cmd_list.Reset();
+        CHECK_THROWS(compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+
+        compute_cmd_list.SetComputeState(compute_state);
+        CHECK_THROWS(compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(0U, 1U, 1U)));
+        CHECK_NOTHROW(compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(1U, 1U, 1U)));
+        CHECK(null_cmd_list.GetDispatchesCount() == 1U);
+    }
+
+    SECTION("Unordered access barrier orders dispatches writing the same buffer")
+    {
+        const Rhi::ResourceBarriers uav_barriers({
+            Rhi::ResourceBarrier(particles_buffer.GetInterface(), Rhi::ResourceState::UnorderedAccess, Rhi::ResourceState::UnorderedAccess)
+        });
+        compute_cmd_list.ResetWithState(compute_state);
+        compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(16U, 1U, 1U));
+        CHECK_NOTHROW(compute_cmd_list.SetResourceBarriers(uav_barriers));
+        compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(16U, 1U, 1U));
+        CHECK(null_cmd_list.GetDispatchesCount() == 2U);
+    }
+}
+
+TEST_CASE("Compute state validation", "[rhi][compute]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+    const Rhi::Program compute_program = CreateComputeProgram(render_context);
+
+    SECTION("Compute state can not be created with zero thread group size")
+    {
+        CHECK_THROWS(Rhi::ComputeState(render_context, Rhi::ComputeStateSettingsImpl{ compute_program, Rhi::ThreadGroupSize(0U, 1U, 1U) }));
+    }
+
+    SECTION("Compute state requires program with compute shader")
+    {
+        const Rhi::Program render_program(render_context,
+            Rhi::Program::Settings
+            {
+                Rhi::Program::ShaderSet
+                {
+                    { Rhi::ShaderType::Vertex, { Data::FileProvider::Get(), { "Test", "MainVS" } } },
+                    { Rhi::ShaderType::Pixel,  { Data::FileProvider::Get(), { "Test", "MainPS" } } },
+                },
+                Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::IProgram::InputBufferLayout
+                    {
+                        Rhi::IProgram::InputBufferLayout::ArgumentSemantics { "POSITION" }
+                    }
+                }
+            });
+        CHECK_THROWS(Rhi::ComputeState(render_context, Rhi::ComputeStateSettingsImpl{ render_program, Rhi::ThreadGroupSize(64U, 1U, 1U) }));
+    }
+}
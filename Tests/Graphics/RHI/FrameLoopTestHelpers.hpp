@@ -0,0 +1,139 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/FrameLoopTestHelpers.hpp
+Helpers of frame loop tests and benchmarks rendering frames with Null RHI render context
+and emulated GPU execution duration of the render command queue.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/Null/CommandQueue.h>
+#include <Methane/Platform/AppEnvironment.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <chrono>
+#include <vector>
+#include <functional>
+
+namespace Methane::Graphics::Test
+{
+
+using Clock = std::chrono::steady_clock;
+
+// Parallel executor is shared by all render contexts created in tests
+inline tf::Executor& GetParallelExecutor()
+{
+    static tf::Executor s_parallel_executor;
+    return s_parallel_executor;
+}
+
+inline Rhi::RenderContext CreateRenderContext(const Rhi::RenderContextSettings& settings)
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    REQUIRE(devices.size() > 0);
+    return Rhi::RenderContext(Platform::AppEnvironment{}, devices[0], GetParallelExecutor(), settings);
+}
+
+template<typename DataType>
+void SetBufferData(const Rhi::Buffer& buffer, const std::vector<DataType>& data, const Rhi::CommandQueue& cmd_queue)
+{
+    buffer.SetData(Rhi::SubResources{
+        { reinterpret_cast<Data::ConstRawPtr>(data.data()), static_cast<Data::Size>(sizeof(DataType) * data.size()) } // NOSONAR
+    }, cmd_queue);
+}
+
+struct FrameLoopEnvironment
+{
+    Rhi::RenderContext                 render_context;
+    Rhi::RenderPattern                 render_pattern;
+    Rhi::RenderPass                    render_pass;
+    std::vector<Rhi::RenderCommandList> render_cmd_lists;
+    std::vector<Rhi::CommandListSet>    execute_cmd_list_sets;
+};
+
+inline FrameLoopEnvironment CreateFrameLoopEnvironment(uint32_t frame_buffers_count, uint32_t frames_in_flight_count,
+                                                       std::chrono::microseconds gpu_frame_duration,
+                                                       Rhi::ContextOptionMask options_mask = {})
+{
+    Rhi::RenderContext render_context = CreateRenderContext(Rhi::RenderContextSettings{ FrameSize(640U, 480U) }
+                                                                .SetFrameBuffersCount(frame_buffers_count)
+                                                                .SetFramesInFlightCount(frames_in_flight_count)
+                                                                .SetOptionMask(options_mask));
+    dynamic_cast<Null::CommandQueue&>(render_context.GetRenderCommandKit().GetQueue().GetInterface())
+        .SetEmulatedExecutionDuration(gpu_frame_duration);
+
+    Rhi::RenderPattern render_pattern(render_context, Rhi::RenderPattern::Settings{ });
+    Rhi::RenderPass    render_pass(render_pattern, Rhi::RenderPass::Settings{ { }, render_context.GetSettings().frame_size });
+
+    FrameLoopEnvironment env{ render_context, render_pattern, render_pass, {}, {} };
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists.emplace_back(
+            render_context.GetRenderCommandKit().GetQueue().CreateRenderCommandList(render_pass));
+        env.execute_cmd_list_sets.emplace_back(Refs<Rhi::ICommandList>{ render_cmd_list.GetInterface() }, frame_index);
+    }
+    return env;
+}
+
+// Spins CPU during the given duration to emulate frame update and commands encoding
+inline void EmulateCpuWork(std::chrono::microseconds duration)
+{
+    const Clock::time_point end_time = Clock::now() + duration;
+    while (Clock::now() < end_time);
+}
+
+using FrameUpdateFunction = std::function<void(uint32_t frame_index)>;
+
+// Renders frames in the same way as Graphics::App does and returns elapsed time,
+// optional frame update function is called before encoding of every frame
+inline Clock::duration RenderFrames(const FrameLoopEnvironment& env, uint32_t frames_count, std::chrono::microseconds cpu_frame_duration,
+                                    const FrameUpdateFunction& frame_update = {})
+{
+    const Clock::time_point start_time = Clock::now();
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        env.render_context.WaitForGpu(Rhi::IContext::WaitFor::FramePresented);
+        if (frame_update)
+            frame_update(frame_index);
+
+        const uint32_t frame_buffer_index = env.render_context.GetFrameBufferIndex();
+        const Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists[frame_buffer_index];
+        render_cmd_list.Reset();
+        EmulateCpuWork(cpu_frame_duration);
+        render_cmd_list.Commit();
+
+        env.render_context.GetRenderCommandKit().GetQueue().Execute(env.execute_cmd_list_sets[frame_buffer_index]);
+        env.render_context.Present();
+    }
+    return Clock::now() - start_time;
+}
+
+} // namespace Methane::Graphics::Test
@@ -0,0 +1,52 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/FramesInFlightBenchmark.cpp
+Benchmark of frame loop with different frames in flight counts measuring CPU and GPU work overlap
+with Null RHI emulated GPU execution duration.
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+// Reported time of one benchmark run is divided by this count to get frame time
+static constexpr uint32_t g_frames_count = 10U;
+
+TEST_CASE("Frame loop with frames in flight benchmark", "[rhi][render-context][frames-in-flight][benchmark]")
+{
+    constexpr std::chrono::microseconds cpu_frame_duration = 1ms;
+    constexpr std::chrono::microseconds gpu_frame_duration = 1ms;
+
+    for(uint32_t frames_in_flight_count = 1U; frames_in_flight_count <= 3U; ++frames_in_flight_count)
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(3U, frames_in_flight_count, gpu_frame_duration);
+        BENCHMARK(fmt::format("{} frames with {} in flight, 1 ms CPU and 1 ms GPU per frame", g_frames_count, frames_in_flight_count))
+        {
+            return RenderFrames(env, g_frames_count, cpu_frame_duration);
+        };
+    }
+}
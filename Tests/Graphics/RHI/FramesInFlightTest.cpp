@@ -0,0 +1,83 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/FramesInFlightTest.cpp
+Unit tests of render context frames in flight pacing with Null RHI emulated GPU execution
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+TEST_CASE("Render context frames in flight count", "[rhi][render-context][frames-in-flight]")
+{
+    SECTION("Frames in flight count is equal to frame buffers count by default")
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(3U, 0U, 0us);
+        CHECK(env.render_context.GetFramesInFlightCount() == 3U);
+    }
+
+    SECTION("Frames in flight count is set independently of frame buffers count")
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(3U, 2U, 0us);
+        CHECK(env.render_context.GetSettings().frame_buffers_count == 3U);
+        CHECK(env.render_context.GetFramesInFlightCount() == 2U);
+    }
+
+    SECTION("Frames in flight count is limited by frame buffers count")
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 4U, 0us);
+        CHECK(env.render_context.GetFramesInFlightCount() == 2U);
+    }
+}
+
+TEST_CASE("Render context paces frames by GPU completion", "[rhi][render-context][frames-in-flight]")
+{
+    constexpr uint32_t frames_count = 12U;
+    constexpr std::chrono::microseconds gpu_frame_duration = 2ms;
+
+    SECTION("Single frame in flight waits for GPU completion of every previous frame")
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(3U, 1U, gpu_frame_duration);
+        CHECK(RenderFrames(env, frames_count, 0us) >= gpu_frame_duration * (frames_count - 1U));
+        CHECK(env.render_context.GetFrameIndex() == frames_count);
+    }
+
+    SECTION("Frames in flight are limited by GPU throughput")
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(3U, 3U, gpu_frame_duration);
+        CHECK(RenderFrames(env, frames_count, 0us) >= gpu_frame_duration * (frames_count - 3U));
+        CHECK(env.render_context.GetFrameIndex() == frames_count);
+    }
+
+    SECTION("Render command lists are reusable after frames in flight are completed")
+    {
+        const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+        RenderFrames(env, frames_count, 0us);
+        for(const Rhi::RenderCommandList& render_cmd_list : env.render_cmd_lists)
+        {
+            CHECK(render_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        }
+    }
+}
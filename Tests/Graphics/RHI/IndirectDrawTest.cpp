@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/IndirectDrawTest.cpp
+Unit tests of indirect draws with arguments and draw count buffers using Null RHI
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+TEST_CASE("Indexed indirect draws with Null RHI", "[rhi][command-list][indirect]")
+{
+    constexpr uint32_t index_count = 36U;
+    constexpr uint32_t draws_count = 8U;
+
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+    const Rhi::CommandQueue render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+
+    Rhi::Buffer       vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(24U * 16U, 16U));
+    const Rhi::Buffer index_buffer  = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(index_count * 4U, PixelFormat::R32Uint));
+    SetBufferData(vertex_buffer, std::vector<float>(24U * 4U, 0.F), render_cmd_queue);
+    SetBufferData(index_buffer, std::vector<uint32_t>(index_count, 0U), render_cmd_queue);
+    const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer });
+
+    const auto arguments_size = static_cast<Data::Size>(sizeof(Rhi::DrawIndexedIndirectArguments) * draws_count);
+    const Rhi::Buffer arguments_buffer  = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectBuffer(arguments_size, true));
+    const Rhi::Buffer draw_count_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectBuffer(sizeof(uint32_t), true));
+
+    const Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists[0];
+    const auto& null_cmd_list = dynamic_cast<const Null::RenderCommandList&>(render_cmd_list.GetInterface());
+    render_cmd_list.Reset();
+    render_cmd_list.SetVertexBuffers(vertex_buffer_set);
+    render_cmd_list.SetIndexBuffer(index_buffer);
+
+    SECTION("Each draw from arguments buffer is executed")
+    {
+        std::vector<Rhi::DrawIndexedIndirectArguments> draw_arguments(draws_count);
+        for(uint32_t draw_index = 0U; draw_index < draws_count; ++draw_index)
+        {
+            draw_arguments[draw_index] = { index_count, 1U, 0U, 0, draw_index };
+        }
+        SetBufferData(arguments_buffer, draw_arguments, render_cmd_queue);
+
+        render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 0U, draws_count);
+        CHECK(null_cmd_list.GetDrawsCount() == draws_count);
+        CHECK(null_cmd_list.GetInstancesCount() == draws_count);
+    }
+
+    SECTION("Merged instance ranges reduce draws count")
+    {
+        SetBufferData(arguments_buffer, std::vector<Rhi::DrawIndexedIndirectArguments>{
+            { index_count, 5U, 0U, 0, 0U },
+            { index_count, 3U, 0U, 0, 6U },
+        }, render_cmd_queue);
+
+        render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 0U, 2U);
+        CHECK(null_cmd_list.GetDrawsCount() == 2U);
+        CHECK(null_cmd_list.GetInstancesCount() == 8U);
+    }
+
+    SECTION("Draws count is limited by draw count buffer and empty draws are skipped")
+    {
+        SetBufferData(arguments_buffer, std::vector<Rhi::DrawIndexedIndirectArguments>{
+            { index_count, 2U, 0U, 0, 0U },
+            { index_count, 0U, 0U, 0, 2U },
+            { index_count, 4U, 0U, 0, 4U },
+            { index_count, 8U, 0U, 0, 8U },
+        }, render_cmd_queue);
+        SetBufferData(draw_count_buffer, std::vector<uint32_t>{ 3U }, render_cmd_queue);
+
+        render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 0U, draws_count, &draw_count_buffer);
+        CHECK(null_cmd_list.GetDrawsCount() == 2U);
+        CHECK(null_cmd_list.GetInstancesCount() == 6U);
+    }
+
+    SECTION("Draw statistics are reset with command list")
+    {
+        SetBufferData(arguments_buffer, std::vector<Rhi::DrawIndexedIndirectArguments>{
+            { index_count, 4U, 0U, 0, 0U },
+        }, render_cmd_queue);
+
+        render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer);
+        CHECK(null_cmd_list.GetDrawsCount() == 1U);
+        render_cmd_list.Reset();
+        CHECK(null_cmd_list.GetDrawsCount() == 0U);
+        CHECK(null_cmd_list.GetInstancesCount() == 0U);
+    }
+
+    SECTION("Invalid indirect draw arguments are rejected")
+    {
+        CHECK_THROWS(render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 0U, 0U));
+        CHECK_THROWS(render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 2U));
+        const auto max_draws_count = static_cast<uint32_t>(arguments_buffer.GetSettings().size / sizeof(Rhi::DrawIndexedIndirectArguments));
+        CHECK_THROWS(render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 0U, max_draws_count + 1U));
+        CHECK_THROWS(render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, vertex_buffer));
+        CHECK_THROWS(render_cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, arguments_buffer, 0U, 1U, &draw_count_buffer, draw_count_buffer.GetSettings().size));
+        CHECK(null_cmd_list.GetDrawsCount() == 0U);
+    }
+}
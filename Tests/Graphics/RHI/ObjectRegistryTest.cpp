@@ -0,0 +1,206 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ObjectRegistryTest.cpp
+Unit-tests of the graphics objects registry with interned name identifiers and typed lookup
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/Object.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+namespace
+{
+
+struct ITestObject : virtual Rhi::IObject // NOSONAR
+{
+    [[nodiscard]] virtual int GetValue() const noexcept = 0;
+};
+
+class TestObject final // NOSONAR
+    : public Base::Object
+    , public ITestObject
+{
+public:
+    TestObject(std::string_view name, int value) : Base::Object(name), m_value(value) { }
+
+    int GetValue() const noexcept override { return m_value; }
+
+private:
+    int m_value;
+};
+
+// Test object with the same name identifier for all names to simulate name hash collisions
+class CollidingTestObject final // NOSONAR
+    : public Base::Object
+    , public ITestObject
+{
+public:
+    static constexpr Rhi::ObjectNameId s_name_id = 1U;
+
+    CollidingTestObject(std::string_view name, int value) : Base::Object(name), m_value(value) { }
+
+    Rhi::ObjectNameId GetNameId() const noexcept override { return s_name_id; }
+    int GetValue() const noexcept override { return m_value; }
+
+private:
+    int m_value;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Object name identifiers", "[rhi][object][registry]")
+{
+    using namespace Rhi::ObjectNameLiterals;
+
+    SECTION("Name identifiers are computed at compile time")
+    {
+        static_assert("Test Object"_name_id == Rhi::GetObjectNameId("Test Object"));
+        static_assert("Test Object"_name_id != "Test Object 2"_name_id);
+        CHECK(Rhi::GetObjectNameId(std::string("Test Object")) == "Test Object"_name_id);
+    }
+
+    SECTION("Object name identifier is updated on rename")
+    {
+        TestObject object("Old Name", 1);
+        CHECK(object.GetNameId() == "Old Name"_name_id);
+        CHECK(object.SetName("New Name"));
+        CHECK(object.GetNameId() == "New Name"_name_id);
+        CHECK_FALSE(object.SetName("New Name"));
+    }
+
+    SECTION("Object type identifiers are unique per type")
+    {
+        CHECK(Rhi::ObjectTypeId::Get<ITestObject>() == Rhi::ObjectTypeId::Get<ITestObject>());
+        CHECK(Rhi::ObjectTypeId::Get<ITestObject>() != Rhi::ObjectTypeId::Get<Rhi::IObject>());
+    }
+}
+
+TEST_CASE("Object registry", "[rhi][object][registry]")
+{
+    using namespace Rhi::ObjectNameLiterals;
+
+    Base::ObjectRegistry registry;
+    Rhi::IObjectRegistry& registry_interface = registry;
+    const auto test_object_ptr = std::make_shared<TestObject>("Test Object", 42);
+    registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*test_object_ptr));
+
+    SECTION("Registered object can be found by name and name identifier")
+    {
+        CHECK(registry.HasGraphicsObject("Test Object"));
+        CHECK(registry.HasGraphicsObject("Test Object"_name));
+        CHECK(registry.GetGraphicsObject("Test Object").get() == static_cast<Rhi::IObject*>(test_object_ptr.get()));
+        CHECK_FALSE(registry.HasGraphicsObject("Missing Object"));
+        CHECK_FALSE(registry.GetGraphicsObject("Missing Object"));
+    }
+
+    SECTION("Typed lookup returns object registered with the same interface type")
+    {
+        const Ptr<ITestObject> typed_object_ptr = registry.GetGraphicsObject<ITestObject>("Test Object"_name);
+        REQUIRE(typed_object_ptr);
+        CHECK(typed_object_ptr->GetValue() == 42);
+        CHECK_FALSE(registry.GetGraphicsObject<Rhi::IObject>("Test Object"));
+    }
+
+    SECTION("Renamed object is found by its new name only")
+    {
+        test_object_ptr->SetName("Renamed Object");
+        CHECK_FALSE(registry.HasGraphicsObject("Test Object"));
+        CHECK(registry.GetGraphicsObject<ITestObject>("Renamed Object"));
+        CHECK(registry.GetGraphicsObjectsCount() == 1U);
+    }
+
+    SECTION("Object with empty name is removed from registry")
+    {
+        test_object_ptr->SetName("");
+        CHECK(registry.GetGraphicsObjectsCount() == 0U);
+    }
+
+    SECTION("Adding another object with the same name throws name conflict exception")
+    {
+        const auto other_object_ptr = std::make_shared<TestObject>("Test Object", 1);
+        CHECK_THROWS_AS(registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*other_object_ptr)), Rhi::NameConflictException);
+    }
+
+    SECTION("Removing another object with the same name keeps registered object")
+    {
+        TestObject other_object("Test Object", 1);
+        registry.RemoveGraphicsObject(other_object);
+        CHECK(registry.HasGraphicsObject("Test Object"));
+    }
+
+    SECTION("Removed object can be added again")
+    {
+        registry.RemoveGraphicsObject(*test_object_ptr);
+        CHECK(registry.GetGraphicsObjectsCount() == 0U);
+        registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*test_object_ptr));
+        CHECK(registry.GetGraphicsObjectsCount() == 1U);
+    }
+
+    SECTION("Destroyed object is removed from registry")
+    {
+        auto temp_object_ptr = std::make_shared<TestObject>("Temporary Object", 1);
+        registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*temp_object_ptr));
+        CHECK(registry.GetGraphicsObjectsCount() == 2U);
+        temp_object_ptr.reset();
+        CHECK(registry.GetGraphicsObjectsCount() == 1U);
+    }
+}
+
+TEST_CASE("Object registry with colliding name identifiers", "[rhi][object][registry]")
+{
+    Base::ObjectRegistry registry;
+    Rhi::IObjectRegistry& registry_interface = registry;
+    const auto first_object_ptr  = std::make_shared<CollidingTestObject>("First Object", 1);
+    const auto second_object_ptr = std::make_shared<CollidingTestObject>("Second Object", 2);
+    registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*first_object_ptr));
+    registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*second_object_ptr));
+    const Rhi::ObjectNameId name_id = CollidingTestObject::s_name_id;
+
+    SECTION("Objects with colliding name identifiers are found by their names")
+    {
+        CHECK(registry.GetGraphicsObjectsCount() == 2U);
+        const Ptr<ITestObject> first_typed_ptr  = registry.GetGraphicsObject<ITestObject>(Rhi::ObjectName(name_id, "First Object"));
+        const Ptr<ITestObject> second_typed_ptr = registry.GetGraphicsObject<ITestObject>(Rhi::ObjectName(name_id, "Second Object"));
+        REQUIRE(first_typed_ptr);
+        REQUIRE(second_typed_ptr);
+        CHECK(first_typed_ptr->GetValue() == 1);
+        CHECK(second_typed_ptr->GetValue() == 2);
+        CHECK_FALSE(registry.HasGraphicsObject(Rhi::ObjectName(name_id, "Third Object")));
+    }
+
+    SECTION("Removing object with colliding name identifier keeps other object")
+    {
+        registry.RemoveGraphicsObject(*first_object_ptr);
+        CHECK_FALSE(registry.HasGraphicsObject(Rhi::ObjectName(name_id, "First Object")));
+        CHECK(registry.HasGraphicsObject(Rhi::ObjectName(name_id, "Second Object")));
+    }
+
+    SECTION("Only object with the same name conflicts with registered objects")
+    {
+        const auto same_name_object_ptr = std::make_shared<CollidingTestObject>("Second Object", 3);
+        const auto third_object_ptr     = std::make_shared<CollidingTestObject>("Third Object", 3);
+        CHECK_THROWS_AS(registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*same_name_object_ptr)), Rhi::NameConflictException);
+        CHECK_NOTHROW(registry_interface.AddGraphicsObject(static_cast<ITestObject&>(*third_object_ptr)));
+        CHECK(registry.GetGraphicsObjectsCount() == 3U);
+    }
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ParallelRenderCommandListBenchmark.cpp
+Benchmark of parallel render command list reset and encoding with Null RHI
+scaling with count of per-thread command lists from 1 to 32.
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+static constexpr std::array<uint32_t, 6> g_thread_cmd_lists_counts{ 1U, 2U, 4U, 8U, 16U, 32U };
+
+// Total count of draw calls is split between thread command lists
+static constexpr uint32_t g_draws_count = 8192U;
+
+TEST_CASE("Parallel render command list benchmark", "[rhi][command-list][parallel][benchmark]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::CommandQueue render_cmd_queue = env.render_context.GetRenderCommandKit().GetQueue();
+
+    for(const uint32_t thread_cmd_lists_count : g_thread_cmd_lists_counts)
+    {
+        Rhi::ParallelRenderCommandList parallel_cmd_list = render_cmd_queue.CreateParallelRenderCommandList(env.render_pass);
+        parallel_cmd_list.SetValidationEnabled(false);
+        parallel_cmd_list.SetParallelCommandListsCount(thread_cmd_lists_count);
+
+        const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+        const Rhi::CommandListSet cmd_list_set(Refs<Rhi::ICommandList>{ parallel_cmd_list.GetInterface() });
+
+        BENCHMARK(fmt::format("Reset of {} thread command lists", thread_cmd_lists_count))
+        {
+            parallel_cmd_list.Reset();
+            return parallel_cmd_list.GetState();
+        };
+
+        BENCHMARK(fmt::format("Reset, commit and execute of {} thread command lists", thread_cmd_lists_count))
+        {
+            parallel_cmd_list.Reset();
+            parallel_cmd_list.Commit();
+            render_cmd_queue.Execute(cmd_list_set);
+            return parallel_cmd_list.GetState();
+        };
+
+        BENCHMARK(fmt::format("Frame of {} draw calls encoded in {} thread command lists", g_draws_count, thread_cmd_lists_count))
+        {
+            parallel_cmd_list.Reset();
+            env.render_context.ParallelFor(0U, thread_cmd_lists_count,
+                [&thread_cmd_lists, thread_cmd_lists_count](const uint32_t cmd_list_index)
+                {
+                    const Rhi::RenderCommandList& thread_cmd_list = thread_cmd_lists[cmd_list_index];
+                    const uint32_t begin_draw_index = g_draws_count * cmd_list_index / thread_cmd_lists_count;
+                    const uint32_t end_draw_index   = g_draws_count * (cmd_list_index + 1U) / thread_cmd_lists_count;
+                    for(uint32_t draw_index = begin_draw_index; draw_index < end_draw_index; ++draw_index)
+                    {
+                        thread_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+                    }
+                });
+            parallel_cmd_list.Commit();
+            render_cmd_queue.Execute(cmd_list_set);
+            return parallel_cmd_list.GetState();
+        };
+    }
+}
@@ -0,0 +1,111 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ParallelRenderCommandListTest.cpp
+Unit tests of parallel render command list reset, commit and execution with Null RHI
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/ICommandListDebugGroup.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+static bool AreAllThreadCommandListsInState(const Rhi::ParallelRenderCommandList& parallel_cmd_list, Rhi::CommandListState state)
+{
+    const std::vector<Rhi::RenderCommandList>& thread_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    return std::all_of(thread_cmd_lists.begin(), thread_cmd_lists.end(),
+                       [state](const Rhi::RenderCommandList& cmd_list) { return cmd_list.GetState() == state; });
+}
+
+TEST_CASE("Parallel render command list encoding", "[rhi][command-list][parallel]")
+{
+    constexpr uint32_t thread_cmd_lists_count = 8U;
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::CommandQueue render_cmd_queue = env.render_context.GetRenderCommandKit().GetQueue();
+
+    Rhi::ParallelRenderCommandList parallel_cmd_list = render_cmd_queue.CreateParallelRenderCommandList(env.render_pass);
+    parallel_cmd_list.SetName("Parallel Rendering");
+    parallel_cmd_list.SetParallelCommandListsCount(thread_cmd_lists_count);
+    REQUIRE(parallel_cmd_list.GetParallelCommandLists().size() == thread_cmd_lists_count);
+
+    SECTION("All thread command lists are reset to encoding state")
+    {
+        parallel_cmd_list.Reset();
+        CHECK(parallel_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+        CHECK(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Encoding));
+    }
+
+    SECTION("All thread command lists are reset with debug sub-groups")
+    {
+        const Rhi::CommandListDebugGroup debug_group("Parallel Rendering");
+        parallel_cmd_list.Reset(&debug_group);
+        CHECK(debug_group.GetInterface().HasSubGroups());
+        for(Data::Index cmd_list_index = 0U; cmd_list_index < thread_cmd_lists_count; ++cmd_list_index)
+        {
+            CHECK(debug_group.GetInterface().GetSubGroup(cmd_list_index) != nullptr);
+        }
+        CHECK(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Encoding));
+    }
+
+    SECTION("All thread command lists are committed")
+    {
+        parallel_cmd_list.Reset();
+        parallel_cmd_list.Commit();
+        CHECK(parallel_cmd_list.GetState() == Rhi::CommandListState::Committed);
+        CHECK(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Committed));
+    }
+
+    SECTION("Parallel command list is reusable after execution in multiple frames")
+    {
+        const Rhi::CommandListSet cmd_list_set(Refs<Rhi::ICommandList>{ parallel_cmd_list.GetInterface() });
+        for(uint32_t frame_index = 0U; frame_index < 4U; ++frame_index)
+        {
+            parallel_cmd_list.Reset();
+            REQUIRE(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Encoding));
+            parallel_cmd_list.Commit();
+            render_cmd_queue.Execute(cmd_list_set);
+            CHECK(parallel_cmd_list.GetState() == Rhi::CommandListState::Pending);
+            CHECK(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Pending));
+        }
+    }
+
+    SECTION("Thread command lists count change is applied on next reset and commit")
+    {
+        parallel_cmd_list.Reset();
+        parallel_cmd_list.Commit();
+        render_cmd_queue.Execute(Rhi::CommandListSet(Refs<Rhi::ICommandList>{ parallel_cmd_list.GetInterface() }));
+
+        parallel_cmd_list.SetParallelCommandListsCount(thread_cmd_lists_count * 2U);
+        parallel_cmd_list.Reset();
+        CHECK(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Encoding));
+        parallel_cmd_list.Commit();
+        CHECK(parallel_cmd_list.GetParallelCommandLists().size() == thread_cmd_lists_count * 2U);
+        CHECK(AreAllThreadCommandListsInState(parallel_cmd_list, Rhi::CommandListState::Committed));
+    }
+}
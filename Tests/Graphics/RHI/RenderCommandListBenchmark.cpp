@@ -0,0 +1,135 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandListBenchmark.cpp
+Benchmark of render command list encoding with Null RHI backend measuring cost of draw calls
+through PIMPL wrappers, built with inlined and out-of-line PIMPL implementations.
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Data/FileProvider.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+#ifdef META_PIMPL_INLINE
+static constexpr std::string_view g_pimpl_mode_name = "Inlined PIMPL";
+#else
+static constexpr std::string_view g_pimpl_mode_name = "Out-of-line PIMPL";
+#endif
+
+// Reported time of one benchmark run is divided by this count to get time per draw call
+static constexpr uint32_t g_draws_count = 1000U;
+
+struct DrawCallsEnvironment
+{
+    Rhi::RenderContext                 render_context;
+    Rhi::RenderPattern                 render_pattern;
+    Rhi::RenderPass                    render_pass;
+    Rhi::Program                       program;
+    std::array<Rhi::ProgramBindings, 2> program_bindings;
+    std::array<Rhi::BufferSet, 2>       vertex_buffer_sets;
+    Rhi::RenderCommandList             render_cmd_list;
+};
+
+static Rhi::BufferSet CreateVertexBufferSet(const Rhi::RenderContext& render_context)
+{
+    Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(4096U, 16U));
+    return Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
+}
+
+static DrawCallsEnvironment CreateDrawCallsEnvironment()
+{
+    Rhi::RenderContext render_context = Test::CreateRenderContext(Rhi::RenderContextSettings{ FrameSize(1920U, 1080U) });
+    Rhi::RenderPattern render_pattern(render_context, Rhi::RenderPattern::Settings{ });
+    Rhi::RenderPass    render_pass(render_pattern, Rhi::RenderPass::Settings{ { }, render_context.GetSettings().frame_size });
+    Rhi::Program       program(render_context,
+        Rhi::Program::Settings
+        {
+            Rhi::Program::ShaderSet
+            {
+                { Rhi::ShaderType::Vertex, { Data::FileProvider::Get(), { "Benchmark", "MainVS" } } },
+                { Rhi::ShaderType::Pixel,  { Data::FileProvider::Get(), { "Benchmark", "MainPS" } } },
+            },
+            Rhi::ProgramInputBufferLayouts
+            {
+                Rhi::IProgram::InputBufferLayout
+                {
+                    Rhi::IProgram::InputBufferLayout::ArgumentSemantics { "POSITION" }
+                }
+            },
+            Rhi::ProgramArgumentAccessors{ },
+            render_pattern.GetAttachmentFormats()
+        });
+
+    Rhi::RenderCommandList render_cmd_list = render_context.GetRenderCommandKit().GetQueue().CreateRenderCommandList(render_pass);
+    render_cmd_list.SetValidationEnabled(false);
+
+    return DrawCallsEnvironment
+    {
+        render_context,
+        render_pattern,
+        render_pass,
+        program,
+        { Rhi::ProgramBindings(program, { }), Rhi::ProgramBindings(program, { }) },
+        { CreateVertexBufferSet(render_context), CreateVertexBufferSet(render_context) },
+        render_cmd_list
+    };
+}
+
+TEST_CASE("Render command list draw calls benchmark", "[rhi][command-list][draw][benchmark]")
+{
+    const DrawCallsEnvironment env = CreateDrawCallsEnvironment();
+    const Rhi::RenderCommandList& cmd_list = env.render_cmd_list;
+
+    BENCHMARK(fmt::format("{}: {} draw calls", g_pimpl_mode_name, g_draws_count))
+    {
+        cmd_list.Reset();
+        cmd_list.SetProgramBindings(env.program_bindings[0]);
+        cmd_list.SetVertexBuffers(env.vertex_buffer_sets[0]);
+        for(uint32_t draw_index = 0U; draw_index < g_draws_count; ++draw_index)
+        {
+            cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+        }
+        return cmd_list.GetState();
+    };
+
+    BENCHMARK(fmt::format("{}: {} draw calls with bindings changes", g_pimpl_mode_name, g_draws_count))
+    {
+        cmd_list.Reset();
+        for(uint32_t draw_index = 0U; draw_index < g_draws_count; ++draw_index)
+        {
+            const size_t state_index = draw_index % 2U;
+            cmd_list.SetProgramBindings(env.program_bindings[state_index]);
+            cmd_list.SetVertexBuffers(env.vertex_buffer_sets[state_index]);
+            cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+        }
+        return cmd_list.GetState();
+    };
+}
@@ -0,0 +1,205 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandSequenceTest.cpp
+Unit tests of render command sequence recording, replay and invalidation with Null RHI
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/RenderCommandSequence.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/Base/RenderCommandSequence.h>
+#include <Methane/Data/FileProvider.hpp>
+#include <Methane/Data/Receiver.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+class SequenceInvalidationCounter final
+    : public Data::Receiver<Rhi::IRenderCommandSequenceCallback>
+{
+public:
+    [[nodiscard]] uint32_t GetCount() const noexcept { return m_count; }
+
+private:
+    // IRenderCommandSequenceCallback
+    void OnRenderCommandSequenceInvalidated(Rhi::IRenderCommandSequence&) override { m_count++; }
+
+    uint32_t m_count = 0U;
+};
+
+static Rhi::Program CreateProgram(const Rhi::RenderContext& render_context, const Rhi::RenderPattern& render_pattern)
+{
+    return Rhi::Program(render_context,
+        Rhi::Program::Settings
+        {
+            Rhi::Program::ShaderSet
+            {
+                { Rhi::ShaderType::Vertex, { Data::FileProvider::Get(), { "Test", "MainVS" } } },
+                { Rhi::ShaderType::Pixel,  { Data::FileProvider::Get(), { "Test", "MainPS" } } },
+            },
+            Rhi::ProgramInputBufferLayouts
+            {
+                Rhi::IProgram::InputBufferLayout
+                {
+                    Rhi::IProgram::InputBufferLayout::ArgumentSemantics { "POSITION" }
+                }
+            },
+            Rhi::ProgramArgumentAccessors
+            {
+                { Rhi::ShaderType::All,   "g_constants", Rhi::ProgramArgumentAccessType::Constant },
+                { Rhi::ShaderType::Pixel, "g_uniforms",  Rhi::ProgramArgumentAccessType::Mutable  },
+            },
+            render_pattern.GetAttachmentFormats()
+        });
+}
+
+TEST_CASE("Render command sequence recording and execution", "[rhi][command-list][sequence]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+    const Rhi::CommandQueue render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+
+    const Rhi::Program   program = CreateProgram(render_context, env.render_pattern);
+    const Rhi::Buffer    constants_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+    const Rhi::Buffer    uniforms_buffer  = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+    Rhi::Buffer          vertex_buffer    = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(1024U, 16U));
+    const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer });
+    const Rhi::ProgramBindings program_bindings(program, {
+        { { Rhi::ShaderType::All,   "g_constants" }, { { constants_buffer.GetInterface() } } },
+        { { Rhi::ShaderType::Pixel, "g_uniforms"  }, { { uniforms_buffer.GetInterface() } } },
+    });
+
+    Rhi::RenderCommandSequence command_sequence(env.render_pattern);
+    command_sequence.SetName("Test Sequence");
+    CHECK(command_sequence.GetState() == Rhi::RenderCommandSequenceState::Empty);
+    CHECK(command_sequence.GetCommandsCount() == 0U);
+
+    const auto record_sequence = [&]()
+    {
+        command_sequence.Reset();
+        command_sequence.SetProgramBindings(program_bindings);
+        command_sequence.SetVertexBuffers(vertex_buffer_set, false);
+        command_sequence.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+        command_sequence.Draw(Rhi::RenderPrimitive::Triangle, 3U, 3U);
+        command_sequence.Commit();
+    };
+
+    SECTION("Recorded sequence contains all commands")
+    {
+        record_sequence();
+        CHECK(command_sequence.GetState() == Rhi::RenderCommandSequenceState::Recorded);
+        CHECK(command_sequence.GetCommandsCount() == 4U);
+    }
+
+    SECTION("Commands can not be recorded before reset and after commit")
+    {
+        CHECK_THROWS(command_sequence.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        record_sequence();
+        CHECK_THROWS(command_sequence.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        CHECK(command_sequence.GetCommandsCount() == 4U);
+    }
+
+    SECTION("Recorded sequence is replayed in multiple frames")
+    {
+        record_sequence();
+        const Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists[0];
+        render_cmd_list.SetValidationEnabled(false);
+        for(uint32_t frame_index = 0U; frame_index < 3U; ++frame_index)
+        {
+            render_cmd_list.Reset();
+            render_cmd_list.ReplayCommandSequence(command_sequence);
+            render_cmd_list.ReplayCommandSequence(command_sequence);
+            render_cmd_list.Commit();
+            render_cmd_queue.Execute(env.execute_cmd_list_sets[0]);
+            CHECK(render_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        }
+        CHECK(command_sequence.GetState() == Rhi::RenderCommandSequenceState::Recorded);
+    }
+
+    SECTION("Sequence which is not recorded can not be replayed")
+    {
+        const Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists[0];
+        render_cmd_list.Reset();
+        CHECK_THROWS(render_cmd_list.ReplayCommandSequence(command_sequence));
+        command_sequence.Reset();
+        CHECK_THROWS(render_cmd_list.ReplayCommandSequence(command_sequence));
+    }
+
+    SECTION("Sequence is invalidated when mutable argument binding changes")
+    {
+        SequenceInvalidationCounter invalidation_counter;
+        command_sequence.Connect(invalidation_counter);
+        record_sequence();
+
+        const Rhi::Buffer new_uniforms_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+        program_bindings.Get({ Rhi::ShaderType::Pixel, "g_uniforms" }).SetResourceViews({ { new_uniforms_buffer.GetInterface() } });
+        CHECK(command_sequence.GetState() == Rhi::RenderCommandSequenceState::Invalidated);
+        CHECK(invalidation_counter.GetCount() == 1U);
+
+        const Rhi::RenderCommandList& render_cmd_list = env.render_cmd_lists[0];
+        render_cmd_list.SetValidationEnabled(false);
+        render_cmd_list.Reset();
+        CHECK_THROWS(render_cmd_list.ReplayCommandSequence(command_sequence));
+
+        record_sequence();
+        CHECK(command_sequence.GetState() == Rhi::RenderCommandSequenceState::Recorded);
+        CHECK_NOTHROW(render_cmd_list.ReplayCommandSequence(command_sequence));
+    }
+
+    SECTION("Sequence is not invalidated by bindings changes after re-recording without them")
+    {
+        record_sequence();
+        command_sequence.Reset();
+        command_sequence.SetVertexBuffers(vertex_buffer_set, false);
+        command_sequence.Draw(Rhi::RenderPrimitive::Triangle, 3U);
+        command_sequence.Commit();
+
+        const Rhi::Buffer new_uniforms_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+        program_bindings.Get({ Rhi::ShaderType::Pixel, "g_uniforms" }).SetResourceViews({ { new_uniforms_buffer.GetInterface() } });
+        CHECK(command_sequence.GetState() == Rhi::RenderCommandSequenceState::Recorded);
+    }
+
+    SECTION("Native bundle of sequence is dropped on invalidation and reset")
+    {
+        auto& sequence_base = dynamic_cast<Base::RenderCommandSequence&>(command_sequence.GetInterface());
+        const auto native_bundle_ptr = std::make_shared<Base::Object>("Test Bundle");
+
+        record_sequence();
+        sequence_base.SetNativeBundle(native_bundle_ptr);
+        CHECK(sequence_base.GetNativeBundle() == native_bundle_ptr);
+
+        const Rhi::Buffer new_uniforms_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+        program_bindings.Get({ Rhi::ShaderType::Pixel, "g_uniforms" }).SetResourceViews({ { new_uniforms_buffer.GetInterface() } });
+        CHECK_FALSE(sequence_base.GetNativeBundle());
+
+        record_sequence();
+        sequence_base.SetNativeBundle(native_bundle_ptr);
+        record_sequence();
+        CHECK_FALSE(sequence_base.GetNativeBundle());
+    }
+}
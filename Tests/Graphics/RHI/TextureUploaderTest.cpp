@@ -0,0 +1,190 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/TextureUploaderTest.cpp
+Unit tests of streaming texture uploads in slices with frame budget and shared staging ring using Null RHI
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/TextureUploader.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Graphics/Null/Texture.h>
+#include <Methane/Graphics/Null/CommandQueue.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+static constexpr Data::Size g_row_pitch = 64U * 4U;
+
+static Rhi::SubResources CreateMipSubResources(const Dimensions& dimensions, uint32_t mip_levels_count)
+{
+    Rhi::SubResources sub_resources;
+    for(uint32_t mip_level = 0U; mip_level < mip_levels_count; ++mip_level)
+    {
+        const Data::Size mip_data_size = GetSlicePitch(PixelFormat::RGBA8Unorm, GetMipLevelSize(dimensions.GetWidth(), mip_level),
+                                                       GetMipLevelSize(dimensions.GetHeight(), mip_level));
+        sub_resources.emplace_back(Data::Bytes(mip_data_size, Data::Byte{ 1U }), Rhi::SubResource::Index(0U, 0U, mip_level));
+    }
+    return sub_resources;
+}
+
+TEST_CASE("Texture uploader with Null RHI", "[rhi][texture][upload]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+    Rhi::ICommandQueue& render_cmd_queue = render_context.GetRenderCommandKit().GetQueue().GetInterface();
+    auto& null_upload_queue = dynamic_cast<Null::CommandQueue&>(render_context.GetUploadCommandKit().GetQueue().GetInterface());
+    null_upload_queue.SetEmulatedExecutionDuration(20ms);
+
+    const Dimensions   texture_dimensions(64U, 64U);
+    const Rhi::Texture texture = render_context.CreateTexture(Rhi::TextureSettings::ForImage(texture_dimensions, {}, PixelFormat::RGBA8Unorm, false));
+    const auto&        null_texture = dynamic_cast<const Null::Texture&>(texture.GetInterface());
+
+    SECTION("Texture data is uploaded in slices limited by frame budget")
+    {
+        Rhi::TextureUploader uploader(render_cmd_queue, { 64U * 1024U, 4096U });
+        uint32_t completions_count = 0U;
+        uploader.Enqueue(texture.GetInterface(), CreateMipSubResources(texture_dimensions, 1U),
+                         [&completions_count](Rhi::ITexture&) { completions_count++; });
+
+        for(uint32_t frame_index = 0U; frame_index < 4U; ++frame_index)
+        {
+            uploader.UploadFrame();
+            CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == 4096U);
+            CHECK(uploader.GetLastFrameStatistics().slices_count == 1U);
+            CHECK(uploader.GetLastFrameStatistics().textures_count == 1U);
+        }
+        CHECK(uploader.GetPendingTexturesCount() == 0U);
+        CHECK(null_texture.GetUploadsCount() == 4U);
+        CHECK(null_texture.GetStagedUploadsCount() == 4U);
+        CHECK(null_texture.GetUploadedDataSize() == texture.GetDataSize());
+        CHECK(uploader.GetInFlightStagingSize() == texture.GetDataSize());
+        CHECK(completions_count == 0U);
+        CHECK_FALSE(uploader.IsIdle());
+
+        // Completion callback is not called until upload command queue reaches the fence signalled after the last slice
+        uploader.UploadFrame();
+        CHECK(completions_count == 0U);
+
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::ResourcesUploaded);
+        uploader.UploadFrame();
+        CHECK(completions_count == 1U);
+        CHECK(uploader.GetInFlightStagingSize() == 0U);
+        CHECK(uploader.IsIdle());
+    }
+
+    SECTION("Slices are aligned to the rows of texture")
+    {
+        Rhi::TextureUploader uploader(render_cmd_queue, { 64U * 1024U, 1000U });
+        uploader.Enqueue(texture.GetInterface(), CreateMipSubResources(texture_dimensions, 1U));
+
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == 3U * g_row_pitch);
+        CHECK(null_texture.GetUploadedDataSize() == 3U * g_row_pitch);
+    }
+
+    SECTION("Single row is uploaded when frame budget is smaller than row")
+    {
+        Rhi::TextureUploader uploader(render_cmd_queue, { 4U * g_row_pitch, 100U });
+        uploader.Enqueue(texture.GetInterface(), CreateMipSubResources(texture_dimensions, 1U));
+
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == g_row_pitch);
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == g_row_pitch);
+        CHECK(null_texture.GetUploadedDataSize() == 2U * g_row_pitch);
+    }
+
+    SECTION("Staging ring must fit a single row of texture")
+    {
+        Rhi::TextureUploader uploader(render_cmd_queue, { 100U, 100U });
+        CHECK_THROWS(uploader.Enqueue(texture.GetInterface(), CreateMipSubResources(texture_dimensions, 1U)));
+    }
+
+    SECTION("Staging data in flight is limited by ring size")
+    {
+        constexpr Data::Size ring_size = 6U * g_row_pitch;
+        Rhi::TextureUploader uploader(render_cmd_queue, { ring_size, 4U * g_row_pitch });
+        uploader.Enqueue(texture.GetInterface(), CreateMipSubResources(texture_dimensions, 1U));
+        CHECK(uploader.GetStagingBuffer().GetSettings().size >= ring_size);
+
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == 4U * g_row_pitch);
+
+        // Slice rows are halved to fit in the free space left in staging ring
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == 2U * g_row_pitch);
+        CHECK(uploader.GetInFlightStagingSize() == ring_size);
+
+        // Nothing is uploaded until staging regions are freed by upload command queue fence
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == 0U);
+
+        Data::Size uploaded_data_size = 6U * g_row_pitch;
+        while(uploader.GetPendingTexturesCount())
+        {
+            render_context.WaitForGpu(Rhi::IContext::WaitFor::ResourcesUploaded);
+            uploader.UploadFrame();
+            CHECK(uploader.GetLastFrameStatistics().uploaded_data_size > 0U);
+            CHECK(uploader.GetInFlightStagingSize() <= ring_size);
+            uploaded_data_size += uploader.GetLastFrameStatistics().uploaded_data_size;
+        }
+        CHECK(uploaded_data_size == texture.GetDataSize());
+        CHECK(null_texture.GetStagedUploadsCount() == null_texture.GetUploadsCount());
+    }
+
+    SECTION("Multiple textures are uploaded in one frame within budget")
+    {
+        const Rhi::Texture mip_texture = render_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(16U, 16U), {}, PixelFormat::RGBA8Unorm, true));
+        Rhi::TextureUploader uploader(render_cmd_queue, { 64U * 1024U, 32U * 1024U });
+        uploader.Enqueue(texture.GetInterface(), CreateMipSubResources(texture_dimensions, 1U));
+        uploader.Enqueue(mip_texture.GetInterface(), CreateMipSubResources(Dimensions(16U, 16U), 5U));
+
+        uploader.UploadFrame();
+        CHECK(uploader.GetLastFrameStatistics().textures_count == 2U);
+        CHECK(uploader.GetLastFrameStatistics().slices_count == 6U);
+        CHECK(uploader.GetLastFrameStatistics().uploaded_data_size == texture.GetDataSize() + mip_texture.GetDataSize());
+        CHECK(uploader.GetPendingTexturesCount() == 0U);
+    }
+
+    SECTION("Mipmapped texture upload requires all MIP levels")
+    {
+        const Rhi::Texture mip_texture = render_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(16U, 16U), {}, PixelFormat::RGBA8Unorm, true));
+        Rhi::TextureUploader uploader(render_cmd_queue, { 64U * 1024U, 4096U });
+        CHECK_THROWS(uploader.Enqueue(mip_texture.GetInterface(), CreateMipSubResources(Dimensions(16U, 16U), 1U)));
+    }
+
+    SECTION("Texture slice data range must be aligned to rows")
+    {
+        const Rhi::CommandQueue& cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+        const Data::Bytes slice_data(2U * g_row_pitch);
+        CHECK_THROWS(texture.SetData({ Rhi::SubResource(slice_data.data(), 100U, {}, Rhi::BytesRange(0U, 100U)) }, cmd_queue));
+        CHECK_THROWS(texture.SetData({ Rhi::SubResource(slice_data.data(), g_row_pitch, {}, Rhi::BytesRange(100U, 100U + g_row_pitch)) }, cmd_queue));
+        CHECK_NOTHROW(texture.SetData({ Rhi::SubResource(slice_data.data(), 2U * g_row_pitch, {}, Rhi::BytesRange(g_row_pitch, 3U * g_row_pitch)) }, cmd_queue));
+        CHECK(null_texture.GetUploadedDataSize() == 2U * g_row_pitch);
+    }
+}
@@ -0,0 +1,193 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/TransientAttachmentPoolTest.cpp
+Unit tests of transient attachments placement with lifetime-based aliasing of textures
+
+******************************************************************************/
+
+#include "FrameLoopTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/TransientAttachmentPool.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Graphics::Test;
+using namespace std::chrono_literals;
+
+using TransientPool = Rhi::TransientAttachmentPool;
+
+static const Dimensions g_attachment_dimensions(64U, 32U);
+
+static TransientPool::Request CreateColorRequest(uint32_t first_pass_index, uint32_t last_pass_index,
+                                                 PixelFormat pixel_format = PixelFormat::RGBA8Unorm)
+{
+    return TransientPool::Request{
+        Rhi::TextureSettings::ForImage(g_attachment_dimensions, {}, pixel_format, false,
+                                       Rhi::ResourceUsageMask({ Rhi::ResourceUsage::RenderTarget, Rhi::ResourceUsage::ShaderRead })),
+        first_pass_index, last_pass_index
+    };
+}
+
+TEST_CASE("Transient attachments placement", "[rhi][render-pass][transient]")
+{
+    SECTION("Attachments with disjoint lifetimes are aliased in one block")
+    {
+        const TransientPool::Placement placement = TransientPool::Place({ CreateColorRequest(0U, 0U), CreateColorRequest(1U, 2U) });
+        CHECK(placement.block_settings.size() == 1U);
+        CHECK(placement.block_index_by_request == std::vector<uint32_t>{ 0U, 0U });
+        CHECK(placement.requested_memory_size == 2U * 64U * 32U * 4U);
+        CHECK(placement.placed_memory_size == 64U * 32U * 4U);
+    }
+
+    SECTION("Attachments with overlapping lifetimes are placed in separate blocks")
+    {
+        const TransientPool::Placement placement = TransientPool::Place({ CreateColorRequest(0U, 1U), CreateColorRequest(1U, 2U) });
+        CHECK(placement.block_settings.size() == 2U);
+        CHECK(placement.block_index_by_request == std::vector<uint32_t>{ 0U, 1U });
+        CHECK(placement.requested_memory_size == placement.placed_memory_size);
+    }
+
+    SECTION("Attachments with different pixel formats are not aliased")
+    {
+        const TransientPool::Placement placement = TransientPool::Place({
+            CreateColorRequest(0U, 0U, PixelFormat::RGBA8Unorm),
+            CreateColorRequest(1U, 1U, PixelFormat::R32Float)
+        });
+        CHECK(placement.block_settings.size() == 2U);
+        CHECK(placement.block_settings[1].pixel_format == PixelFormat::R32Float);
+    }
+
+    SECTION("Chain of attachments reuses blocks after the last pass of previous attachment")
+    {
+        // Requests are not sorted by their lifetime to check that placement does not depend on requests order
+        const TransientPool::Placement placement = TransientPool::Place({
+            CreateColorRequest(2U, 3U), CreateColorRequest(0U, 1U), CreateColorRequest(1U, 2U)
+        });
+        CHECK(placement.block_settings.size() == 2U);
+        CHECK(placement.block_index_by_request == std::vector<uint32_t>{ 0U, 0U, 1U });
+    }
+
+    SECTION("Attachment with last pass before the first pass is rejected")
+    {
+        CHECK_THROWS_AS(TransientPool::Place({ CreateColorRequest(2U, 1U) }), Methane::ArgumentExceptionBase<std::out_of_range>);
+    }
+}
+
+TEST_CASE("Transient attachment pool with Null RHI", "[rhi][render-pass][transient]")
+{
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(2U, 2U, 0us);
+    TransientPool pool(env.render_context.GetInterface());
+    const TransientPool::Requests requests{
+        CreateColorRequest(0U, 0U),
+        CreateColorRequest(1U, 1U),
+        { Rhi::TextureSettings::ForDepthStencil(g_attachment_dimensions, PixelFormat::Depth32Float, {}), 0U, 1U }
+    };
+
+    SECTION("Aliased attachments share the same texture")
+    {
+        const Ptrs<Rhi::ITexture> textures = pool.Acquire(requests, 0U);
+        REQUIRE(textures.size() == 3U);
+        CHECK(textures[0] == textures[1]);
+        CHECK(textures[0] != textures[2]);
+        CHECK(textures[2]->GetSettings().type == Rhi::TextureType::DepthStencil);
+        CHECK(pool.GetTexturesCount() == 2U);
+    }
+
+    SECTION("Textures are reused by subsequent requests of the same frame")
+    {
+        const Ptrs<Rhi::ITexture> first_textures  = pool.Acquire(requests, 0U);
+        const Ptrs<Rhi::ITexture> second_textures = pool.Acquire(requests, 0U);
+        CHECK(first_textures == second_textures);
+        CHECK(pool.GetTexturesCount() == 2U);
+    }
+
+    SECTION("Textures are not shared between frames in flight")
+    {
+        const Ptrs<Rhi::ITexture> frame_0_textures = pool.Acquire(requests, 0U);
+        const Ptrs<Rhi::ITexture> frame_1_textures = pool.Acquire(requests, 1U);
+        CHECK(frame_0_textures[0] != frame_1_textures[0]);
+        CHECK(frame_0_textures[2] != frame_1_textures[2]);
+        CHECK(pool.GetTexturesCount() == 4U);
+    }
+}
+
+TEST_CASE("Transient attachments of frame render passes with Null RHI", "[rhi][render-pass][transient]")
+{
+    constexpr uint32_t frame_buffers_count = 2U;
+    constexpr uint32_t frames_count        = 6U;
+    const FrameLoopEnvironment env = CreateFrameLoopEnvironment(frame_buffers_count, frame_buffers_count, 0us);
+    const Rhi::RenderContext& render_context = env.render_context;
+    const Rhi::CommandQueue   render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+    const Rhi::RenderPattern  offscreen_pattern = render_context.CreateRenderPattern({
+        { Rhi::RenderPattern::ColorAttachment(0U, PixelFormat::RGBA8Unorm, 1U,
+                                              Rhi::RenderPassAttachment::LoadAction::Clear,
+                                              Rhi::RenderPassAttachment::StoreAction::Store) },
+        std::nullopt, std::nullopt,
+        Rhi::RenderPassAccessMask(Rhi::RenderPassAccess::ShaderResources),
+        false
+    });
+
+    // Post-processing chain of the frame: scene pass is sampled by blur pass, which is sampled by tone-mapping pass,
+    // so scene and tone-mapping attachments have disjoint lifetimes and are aliased
+    const TransientPool::Requests requests{
+        CreateColorRequest(0U, 1U), // scene
+        CreateColorRequest(1U, 2U), // blur
+        CreateColorRequest(2U, 2U), // tone-mapping
+    };
+
+    TransientPool pool(render_context.GetInterface());
+    std::vector<Ptrs<Rhi::ITexture>> frame_buffer_textures(frame_buffers_count);
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        render_context.WaitForGpu(Rhi::IContext::WaitFor::FramePresented);
+        const uint32_t frame_buffer_index = render_context.GetFrameBufferIndex();
+        const Ptrs<Rhi::ITexture> textures = pool.Acquire(requests, frame_buffer_index);
+        REQUIRE(textures.size() == requests.size());
+        CHECK(textures[0] == textures[2]);
+        CHECK(textures[0] != textures[1]);
+
+        // Textures of the frame buffer are reused in the next frames without re-creation
+        if (frame_buffer_textures[frame_buffer_index].empty())
+            frame_buffer_textures[frame_buffer_index] = textures;
+        else
+            CHECK(frame_buffer_textures[frame_buffer_index] == textures);
+
+        std::vector<Rhi::RenderCommandList> pass_cmd_lists;
+        Refs<Rhi::ICommandList>             pass_cmd_list_refs;
+        for(const Ptr<Rhi::ITexture>& texture_ptr : textures)
+        {
+            const Rhi::RenderPass render_pass = offscreen_pattern.CreateRenderPass({
+                { Rhi::TextureView(*texture_ptr) }, g_attachment_dimensions.AsRectSize()
+            });
+            const Rhi::RenderCommandList& pass_cmd_list = pass_cmd_lists.emplace_back(render_cmd_queue.CreateRenderCommandList(render_pass));
+            pass_cmd_list.Reset();
+            pass_cmd_list.Commit();
+            pass_cmd_list_refs.emplace_back(pass_cmd_list.GetInterface());
+        }
+
+        render_cmd_queue.Execute(Rhi::CommandListSet(pass_cmd_list_refs, frame_buffer_index));
+        render_context.Present();
+    }
+
+    render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+    CHECK(pool.GetLastPlacement().placed_memory_size * 3U == pool.GetLastPlacement().requested_memory_size * 2U);
+    CHECK(pool.GetTexturesCount() == 2U * frame_buffers_count);
+}
@@ -0,0 +1,136 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Types/PixelFormatTest.cpp
+Unit-tests of pixel format block sizes and image data layout math
+
+******************************************************************************/
+
+#include <Methane/Graphics/Types.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane::Graphics;
+
+TEST_CASE("Pixel format blocks", "[pixel-format]")
+{
+    SECTION("Uncompressed formats have 1x1 pixel blocks")
+    {
+        const PixelFormatBlock block = GetPixelFormatBlock(PixelFormat::RGBA8Unorm);
+        CHECK(block.width == 1U);
+        CHECK(block.height == 1U);
+        CHECK(block.size == 4U);
+        CHECK_FALSE(IsBlockCompressedFormat(PixelFormat::RGBA8Unorm));
+        CHECK_FALSE(IsBlockCompressedFormat(PixelFormat::Depth32Float));
+    }
+
+    SECTION("BC1 and BC4 formats have 8 bytes blocks of 4x4 pixels")
+    {
+        for(const PixelFormat pixel_format : { PixelFormat::BC1Unorm, PixelFormat::BC1Unorm_sRGB, PixelFormat::BC4Unorm, PixelFormat::BC4Snorm })
+        {
+            const PixelFormatBlock block = GetPixelFormatBlock(pixel_format);
+            CHECK(block.width == 4U);
+            CHECK(block.height == 4U);
+            CHECK(block.size == 8U);
+            CHECK(IsBlockCompressedFormat(pixel_format));
+        }
+    }
+
+    SECTION("BC3, BC5 and BC7 formats have 16 bytes blocks of 4x4 pixels")
+    {
+        for(const PixelFormat pixel_format : { PixelFormat::BC3Unorm, PixelFormat::BC5Snorm, PixelFormat::BC7Unorm_sRGB })
+        {
+            const PixelFormatBlock block = GetPixelFormatBlock(pixel_format);
+            CHECK(block.width == 4U);
+            CHECK(block.height == 4U);
+            CHECK(block.size == 16U);
+            CHECK(IsBlockCompressedFormat(pixel_format));
+        }
+    }
+
+    SECTION("ASTC formats have 16 bytes blocks of variable size")
+    {
+        CHECK(GetPixelFormatBlock(PixelFormat::ASTC4x4Unorm).width == 4U);
+        CHECK(GetPixelFormatBlock(PixelFormat::ASTC6x6Unorm_sRGB).height == 6U);
+        CHECK(GetPixelFormatBlock(PixelFormat::ASTC8x8Unorm).width == 8U);
+        CHECK(GetPixelFormatBlock(PixelFormat::ASTC8x8Unorm).size == 16U);
+        CHECK(IsBlockCompressedFormat(PixelFormat::ASTC8x8Unorm_sRGB));
+    }
+
+    SECTION("Pixel size is undefined for block-compressed formats")
+    {
+        CHECK_THROWS(GetPixelSize(PixelFormat::BC7Unorm));
+    }
+
+    SECTION("sRGB color space of block-compressed formats")
+    {
+        CHECK(IsSrgbColorSpace(PixelFormat::BC1Unorm_sRGB));
+        CHECK(IsSrgbColorSpace(PixelFormat::BC7Unorm_sRGB));
+        CHECK(IsSrgbColorSpace(PixelFormat::ASTC4x4Unorm_sRGB));
+        CHECK_FALSE(IsSrgbColorSpace(PixelFormat::BC7Unorm));
+        CHECK_FALSE(IsSrgbColorSpace(PixelFormat::BC5Unorm));
+    }
+}
+
+TEST_CASE("Pixel format image layout", "[pixel-format]")
+{
+    SECTION("MIP level size is halved down to one pixel")
+    {
+        CHECK(GetMipLevelSize(256U, 0U) == 256U);
+        CHECK(GetMipLevelSize(256U, 3U) == 32U);
+        CHECK(GetMipLevelSize(5U, 1U) == 2U);
+        CHECK(GetMipLevelSize(256U, 8U) == 1U);
+        CHECK(GetMipLevelSize(256U, 12U) == 1U);
+    }
+
+    SECTION("Uncompressed formats row and slice pitch")
+    {
+        CHECK(GetRowPitch(PixelFormat::RGBA8Unorm, 13U) == 52U);
+        CHECK(GetBlockRowsCount(PixelFormat::RGBA8Unorm, 7U) == 7U);
+        CHECK(GetSlicePitch(PixelFormat::R16Float, 10U, 3U) == 60U);
+    }
+
+    SECTION("Block-compressed formats row and slice pitch")
+    {
+        CHECK(GetRowPitch(PixelFormat::BC1Unorm, 256U) == 512U);
+        CHECK(GetSlicePitch(PixelFormat::BC1Unorm, 256U, 256U) == 32768U);
+        CHECK(GetSlicePitch(PixelFormat::BC7Unorm, 256U, 256U) == 65536U);
+        CHECK(GetSlicePitch(PixelFormat::ASTC8x8Unorm, 256U, 256U) == 16384U);
+    }
+
+    SECTION("Partial blocks are rounded up to whole blocks")
+    {
+        CHECK(GetRowPitch(PixelFormat::BC3Unorm, 1U) == 16U);
+        CHECK(GetRowPitch(PixelFormat::BC3Unorm, 5U) == 32U);
+        CHECK(GetBlockRowsCount(PixelFormat::BC3Unorm, 2U) == 1U);
+        CHECK(GetBlockRowsCount(PixelFormat::ASTC6x6Unorm, 13U) == 3U);
+        CHECK(GetSlicePitch(PixelFormat::BC4Unorm, 2U, 2U) == 8U);
+        CHECK(GetSlicePitch(PixelFormat::ASTC6x6Unorm, 13U, 7U) == 96U);
+    }
+
+    SECTION("Full MIP chain size of block-compressed texture")
+    {
+        Methane::Data::Size mip_chain_size = 0U;
+        for(uint32_t mip_level = 0U; mip_level < 9U; ++mip_level)
+        {
+            mip_chain_size += GetSlicePitch(PixelFormat::BC1Unorm, GetMipLevelSize(256U, mip_level), GetMipLevelSize(256U, mip_level));
+        }
+        // 32768 + 8192 + 2048 + 512 + 128 + 32 + 8 + 8 + 8
+        CHECK(mip_chain_size == 43704U);
+    }
+}
@@ -0,0 +1,147 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/App/FrameUpdatePipelineTest.cpp
+Unit tests of the frame update pipeline with optional parallel update of the next frame
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Platform/FrameUpdatePipeline.h>
+
+#include <taskflow/taskflow.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Platform;
+using namespace std::chrono_literals;
+
+static tf::Executor& GetParallelExecutor()
+{
+    static tf::Executor s_parallel_executor;
+    return s_parallel_executor;
+}
+
+TEST_CASE("Frame update pipeline executes update and render sequentially by default", "[app][frame-update]")
+{
+    std::vector<std::string> calls;
+    FrameUpdatePipeline pipeline(GetParallelExecutor(),
+                                 [&calls]() { calls.emplace_back("update"); },
+                                 [&calls]() { calls.emplace_back("render"); });
+    CHECK_FALSE(pipeline.IsPipelined());
+
+    pipeline.Execute();
+    pipeline.Execute();
+
+    CHECK(calls == std::vector<std::string>{ "update", "render", "update", "render" });
+}
+
+TEST_CASE("Frame update pipeline updates next frame while rendering current frame", "[app][frame-update]")
+{
+    // Application state is copied per frame: update writes the next frame state, while render reads the current one
+    std::array<uint32_t, 2> frame_states{ };
+    std::atomic<uint32_t>   updated_frames_count{ 0U };
+    std::vector<uint32_t>   rendered_states;
+    std::mutex              update_mutex;
+    std::condition_variable update_started_condition;
+    bool                    is_next_frame_update_started = false;
+
+    FrameUpdatePipeline pipeline(GetParallelExecutor(),
+        [&]()
+        {
+            const uint32_t frame_index = updated_frames_count.load();
+            frame_states[frame_index % frame_states.size()] = frame_index;
+            {
+                std::lock_guard lock(update_mutex);
+                is_next_frame_update_started = true;
+            }
+            update_started_condition.notify_one();
+            updated_frames_count++;
+        },
+        [&]()
+        {
+            const uint32_t frame_index = static_cast<uint32_t>(rendered_states.size());
+            {
+                // Rendering of the current frame overlaps update of the next frame
+                std::unique_lock lock(update_mutex);
+                CHECK(update_started_condition.wait_for(lock, 1s, [&]() { return is_next_frame_update_started; }));
+            }
+            rendered_states.push_back(frame_states[frame_index % frame_states.size()]);
+        });
+
+    pipeline.SetPipelined(true);
+    CHECK(pipeline.IsPipelined());
+
+    constexpr uint32_t frames_count = 8U;
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        {
+            std::lock_guard lock(update_mutex);
+            is_next_frame_update_started = false;
+        }
+        pipeline.Execute();
+
+        // Next frame update is completed before returning from the frame
+        CHECK(updated_frames_count == frame_index + 2U);
+    }
+
+    CHECK(rendered_states == std::vector<uint32_t>{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U });
+}
+
+TEST_CASE("Frame update pipeline completes next frame update on render error", "[app][frame-update]")
+{
+    std::atomic<uint32_t> updated_frames_count{ 0U };
+    FrameUpdatePipeline pipeline(GetParallelExecutor(),
+                                 [&updated_frames_count]() { updated_frames_count++; },
+                                 []() { throw std::runtime_error("render error"); });
+    pipeline.SetPipelined(true);
+
+    CHECK_THROWS_AS(pipeline.Execute(), std::runtime_error);
+    CHECK(updated_frames_count == 2U);
+}
+
+TEST_CASE("Frame update pipeline updates frame in advance after enabling pipelining", "[app][frame-update]")
+{
+    uint32_t updated_frames_count = 0U;
+    uint32_t rendered_frames_count = 0U;
+    FrameUpdatePipeline pipeline(GetParallelExecutor(),
+                                 [&updated_frames_count]() { updated_frames_count++; },
+                                 [&rendered_frames_count]() { rendered_frames_count++; });
+
+    pipeline.SetPipelined(true);
+    pipeline.Execute();
+    CHECK(updated_frames_count == 2U);
+
+    pipeline.SetPipelined(false);
+    pipeline.Execute();
+    CHECK(updated_frames_count == 3U);
+
+    pipeline.SetPipelined(true);
+    pipeline.Execute();
+    CHECK(updated_frames_count == 5U);
+    CHECK(rendered_frames_count == 3U);
+}
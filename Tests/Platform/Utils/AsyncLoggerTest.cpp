@@ -0,0 +1,257 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Platform/Utils/AsyncLoggerTest.cpp
+Unit tests of the asynchronous logger with lock-free records queue
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Platform/AsyncLogger.h>
+
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Platform;
+
+struct ThrowingFormatArg { };
+
+template<>
+struct fmt::formatter<ThrowingFormatArg>
+{
+    constexpr auto parse(fmt::format_parse_context& ctx) { return ctx.begin(); }
+
+    template<typename FormatContext>
+    auto format(const ThrowingFormatArg&, FormatContext&) const -> decltype(std::declval<FormatContext>().out())
+    { throw fmt::format_error("throwing argument"); }
+};
+
+class CaptureLogger final : public ILogger
+{
+public:
+    void Log(std::string_view message) override
+    {
+        std::lock_guard lock(m_mutex);
+        std::istringstream lines_stream{ std::string(message) };
+        for(std::string line; std::getline(lines_stream, line);)
+        {
+            m_lines.push_back(line);
+        }
+    }
+
+    std::vector<std::string> GetLines() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_lines;
+    }
+
+private:
+    mutable std::mutex       m_mutex;
+    std::vector<std::string> m_lines;
+};
+
+TEST_CASE("Async logger writes records of all producer threads", "[async-logger]")
+{
+    constexpr size_t threads_count = 4U;
+    constexpr size_t thread_records_count = 1000U;
+
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{ 256U, 64U, AsyncLogger::DropPolicy::WaitForSpace });
+
+    std::vector<std::thread> producer_threads;
+    for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        producer_threads.emplace_back([&async_logger, thread_index]()
+        {
+            for(size_t record_index = 0U; record_index < thread_records_count; ++record_index)
+            {
+                async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "{}:{}", thread_index, record_index);
+            }
+        });
+    }
+    for(std::thread& producer_thread : producer_threads)
+    {
+        producer_thread.join();
+    }
+    async_logger.Flush();
+
+    const std::vector<std::string> lines = capture_logger.GetLines();
+    CHECK(lines.size() == threads_count * thread_records_count);
+    CHECK(async_logger.GetWrittenRecordsCount() == threads_count * thread_records_count);
+    CHECK(async_logger.GetDroppedRecordsCount() == 0U);
+
+    // Records of each thread are written in the order of logging
+    std::vector<size_t> next_record_index_by_thread(threads_count, 0U);
+    bool is_order_valid = true;
+    for(const std::string& line : lines)
+    {
+        const size_t separator_pos = line.find(':');
+        const size_t thread_index = std::stoul(line.substr(0U, separator_pos));
+        const size_t record_index = std::stoul(line.substr(separator_pos + 1U));
+        is_order_valid &= next_record_index_by_thread[thread_index]++ == record_index;
+    }
+    CHECK(is_order_valid);
+}
+
+TEST_CASE("Async logger filters records by category levels", "[async-logger]")
+{
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{});
+
+    const LogCategoryId render_category_id = async_logger.RegisterCategory("Render");
+    const LogCategoryId input_category_id  = async_logger.RegisterCategory("Input");
+    CHECK(async_logger.RegisterCategory("Render") == render_category_id);
+    CHECK(render_category_id != input_category_id);
+
+    async_logger.SetCategoryLevel(render_category_id, LogLevel::Warning);
+    async_logger.SetCategoryLevel(input_category_id, LogLevel::Off);
+    CHECK_FALSE(async_logger.IsEnabled(render_category_id, LogLevel::Info));
+    CHECK(async_logger.IsEnabled(render_category_id, LogLevel::Error));
+
+    CHECK_FALSE(async_logger.Log(render_category_id, LogLevel::Debug, "skipped {}", 1));
+    CHECK(async_logger.Log(render_category_id, LogLevel::Warning, "frame {} is late", 2));
+    CHECK_FALSE(async_logger.Log(input_category_id, LogLevel::Error, "skipped {}", 3));
+    CHECK(async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Error, "device lost"));
+    async_logger.Flush();
+
+    CHECK(capture_logger.GetLines() == std::vector<std::string>{
+        "[Render] WARNING: frame 2 is late",
+        "ERROR: device lost"
+    });
+}
+
+TEST_CASE("Async logger truncates long messages", "[async-logger]")
+{
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{ 16U, 8U });
+
+    async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "{}", "0123456789");
+    async_logger.Log(std::string_view("short"));
+    async_logger.Flush();
+
+    CHECK(capture_logger.GetLines() == std::vector<std::string>{
+        "01234567 <...truncated>",
+        "short"
+    });
+}
+
+TEST_CASE("Async logger discards newest records on queue overflow", "[async-logger]")
+{
+    constexpr size_t records_count = 10000U;
+
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{ 4U, 32U, AsyncLogger::DropPolicy::DiscardNewest });
+
+    size_t logged_records_count = 0U;
+    for(size_t record_index = 0U; record_index < records_count; ++record_index)
+    {
+        if (async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "record {}", record_index))
+            logged_records_count++;
+    }
+    async_logger.Flush();
+
+    CHECK(logged_records_count + async_logger.GetDroppedRecordsCount() == records_count);
+    CHECK(async_logger.GetWrittenRecordsCount() == logged_records_count);
+
+    async_logger.Stop();
+    const std::vector<std::string> lines = capture_logger.GetLines();
+    if (async_logger.GetDroppedRecordsCount() > 0U)
+    {
+        CHECK(lines.size() > logged_records_count);
+        CHECK(lines.back().find("log records were dropped") != std::string::npos);
+    }
+}
+
+TEST_CASE("Async logger writes records synchronously after stop", "[async-logger]")
+{
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{});
+
+    async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "queued");
+    async_logger.Stop();
+    CHECK(capture_logger.GetLines() == std::vector<std::string>{ "queued" });
+
+    async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Warning, "after {}", "stop");
+    CHECK(capture_logger.GetLines() == std::vector<std::string>{ "queued", "WARNING: after stop" });
+}
+
+TEST_CASE("Async logger commits records with format errors", "[async-logger]")
+{
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{});
+
+    CHECK(async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "bad {}", ThrowingFormatArg{}));
+    CHECK(async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "good"));
+    async_logger.Flush();
+
+    const std::vector<std::string> lines = capture_logger.GetLines();
+    REQUIRE(lines.size() == 2U);
+    CHECK(lines[0] == "<log message format error: throwing argument>");
+    CHECK(lines[1] == "good");
+
+    async_logger.Stop();
+    async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "bad {}", ThrowingFormatArg{});
+    CHECK(capture_logger.GetLines().back() == "<log message format error: throwing argument>");
+}
+
+TEST_CASE("Async logger ignores unknown categories", "[async-logger]")
+{
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{});
+
+    constexpr auto unknown_category_id = static_cast<LogCategoryId>(AsyncLogger::g_max_categories_count);
+    CHECK(async_logger.GetCategoryLevel(unknown_category_id) == LogLevel::Off);
+    CHECK_FALSE(async_logger.IsEnabled(unknown_category_id, LogLevel::Error));
+    CHECK_FALSE(async_logger.Log(unknown_category_id, LogLevel::Error, "unknown"));
+    async_logger.Flush();
+
+    CHECK(capture_logger.GetLines().empty());
+}
+
+TEST_CASE("Async logger writes records of producers racing with stop", "[async-logger]")
+{
+    constexpr size_t threads_count = 4U;
+    constexpr size_t thread_records_count = 2000U;
+
+    CaptureLogger capture_logger;
+    AsyncLogger async_logger(capture_logger, AsyncLogger::Settings{ 8U, 32U });
+
+    std::vector<std::thread> threads;
+    for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        threads.emplace_back([&async_logger, thread_index]()
+        {
+            for(size_t record_index = 0U; record_index < thread_records_count; ++record_index)
+            {
+                async_logger.Log(AsyncLogger::g_default_category_id, LogLevel::Info, "{}:{}", thread_index, record_index);
+            }
+        });
+    }
+    async_logger.Stop();
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(capture_logger.GetLines().size() == threads_count * thread_records_count);
+}
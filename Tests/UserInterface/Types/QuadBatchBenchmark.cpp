@@ -0,0 +1,76 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Types/QuadBatchBenchmark.cpp
+Benchmark of user interface encoding to quad batch for 10, 100 and 1000 widgets
+
+******************************************************************************/
+
+#include "QuadBatchTestHelpers.hpp"
+
+#include <Methane/UserInterface/QuadBatch.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static const FrameSize g_frame_size { 1920U, 1080U };
+static constexpr uint32_t g_glyphs_per_widget = 16U;
+
+// Each widget is a panel with badge and text label, the same quads are gathered from Panel, Badge and TextItem
+static size_t EncodeWidgets(QuadBatch& quad_batch, uint32_t widgets_count, const Rhi::Texture& atlas_texture, const Rhi::Texture& badge_texture)
+{
+    static const Color4F s_panel_color { 0.F, 0.F, 0.F, 0.66F };
+    static const Color4F s_text_color  { 1.F, 1.F, 1.F, 1.F };
+    static const FloatRect s_glyph_texcoord_rect { 0.25F, 0.25F, 0.03125F, 0.0625F };
+
+    quad_batch.Reset(g_frame_size);
+    for(uint32_t widget_index = 0U; widget_index < widgets_count; ++widget_index)
+    {
+        const auto x = static_cast<int32_t>((widget_index % 32U) * 60U);
+        const auto y = static_cast<int32_t>((widget_index / 32U) * 30U);
+        quad_batch.AddQuad(FrameRect{ x, y, 56U, 26U }, s_panel_color);
+        quad_batch.AddTexturedQuad(FrameRect{ x + 2, y + 2, 22U, 22U }, badge_texture, QuadBatch::TextureMode::RgbaFloat, s_text_color);
+        for(uint32_t glyph_index = 0U; glyph_index < g_glyphs_per_widget; ++glyph_index)
+        {
+            const FloatRect glyph_rect{ static_cast<float>(x + 26) + static_cast<float>(glyph_index) * 2.F, static_cast<float>(y + 4), 2.F, 18.F };
+            quad_batch.AddTexturedQuad(glyph_rect, s_glyph_texcoord_rect, atlas_texture, QuadBatch::TextureMode::RFloatToAlpha, s_text_color);
+        }
+    }
+    return quad_batch.GetDrawRanges().size();
+}
+
+TEST_CASE("Benchmark user interface batch encoding", "[ui][batch][benchmark]")
+{
+    const Rhi::RenderContext render_context = Test::CreateTestRenderContext(g_frame_size);
+    const Rhi::Texture atlas_texture = Test::CreateTestTexture(render_context, PixelFormat::R8Unorm, "Font Atlas");
+    const Rhi::Texture badge_texture = Test::CreateTestTexture(render_context, PixelFormat::RGBA8Unorm, "Badge");
+
+    for(uint32_t widgets_count : { 10U, 100U, 1000U })
+    {
+        QuadBatch quad_batch;
+        BENCHMARK("Batch encoding of " + std::to_string(widgets_count) + " widgets")
+        {
+            return EncodeWidgets(quad_batch, widgets_count, atlas_texture, badge_texture);
+        };
+        CHECK(quad_batch.GetQuadCount() == widgets_count * (g_glyphs_per_widget + 2U));
+    }
+}
@@ -0,0 +1,200 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Types/QuadBatchTest.cpp
+Unit-tests of the quad batch gathering user interface quads for batched rendering
+
+******************************************************************************/
+
+#include "QuadBatchTestHelpers.hpp"
+
+#include <Methane/UserInterface/QuadBatch.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+using Catch::Approx;
+
+using TextureMode = QuadBatch::TextureMode;
+
+static const FrameSize g_frame_size { 800U, 600U };
+static const Color4F   g_color { 0.25F, 0.5F, 0.75F, 1.F };
+
+TEST_CASE("Quad batch vertices", "[ui][batch][vertices]")
+{
+    QuadBatch quad_batch;
+    quad_batch.Reset(g_frame_size);
+
+    SECTION("Empty batch after reset")
+    {
+        CHECK(quad_batch.IsEmpty());
+        CHECK(quad_batch.GetQuadCount() == 0U);
+        CHECK(quad_batch.GetDrawRanges().empty());
+        CHECK(quad_batch.GetFrameSize() == g_frame_size);
+    }
+
+    SECTION("Quad screen rect is converted to normalized device coordinates")
+    {
+        quad_batch.AddQuad(FrameRect{ 200, 150, 400, 300 }, g_color);
+        REQUIRE(quad_batch.GetQuadCount() == 1U);
+
+        const QuadBatch::Vertices& vertices = quad_batch.GetVertices();
+        REQUIRE(vertices.size() == QuadBatch::g_vertices_per_quad);
+
+        // Vertices order: top-left, bottom-left, bottom-right, top-right
+        CHECK(vertices[0].position.GetX() == Approx(-0.5F));
+        CHECK(vertices[0].position.GetY() == Approx(0.5F));
+        CHECK(vertices[1].position.GetX() == Approx(-0.5F));
+        CHECK(vertices[1].position.GetY() == Approx(-0.5F));
+        CHECK(vertices[2].position.GetX() == Approx(0.5F));
+        CHECK(vertices[2].position.GetY() == Approx(-0.5F));
+        CHECK(vertices[3].position.GetX() == Approx(0.5F));
+        CHECK(vertices[3].position.GetY() == Approx(0.5F));
+
+        for(const QuadBatch::Vertex& vertex : vertices)
+        {
+            CHECK(vertex.texcoord.GetZ() == static_cast<float>(TextureMode::Disabled));
+            CHECK(vertex.color.GetX() == g_color.GetRed());
+            CHECK(vertex.color.GetY() == g_color.GetGreen());
+            CHECK(vertex.color.GetZ() == g_color.GetBlue());
+            CHECK(vertex.color.GetW() == g_color.GetAlpha());
+        }
+    }
+
+    SECTION("Full frame quad covers whole normalized device coordinates range")
+    {
+        quad_batch.AddQuad(FrameRect{ 0, 0, g_frame_size.GetWidth(), g_frame_size.GetHeight() }, g_color);
+        const QuadBatch::Vertices& vertices = quad_batch.GetVertices();
+        CHECK(vertices[0].position.GetX() == Approx(-1.F));
+        CHECK(vertices[0].position.GetY() == Approx(1.F));
+        CHECK(vertices[2].position.GetX() == Approx(1.F));
+        CHECK(vertices[2].position.GetY() == Approx(-1.F));
+    }
+
+    SECTION("Textured quad keeps texture coordinates and mode")
+    {
+        const Rhi::RenderContext render_context = Test::CreateTestRenderContext(g_frame_size);
+        const Rhi::Texture atlas_texture = Test::CreateTestTexture(render_context, PixelFormat::R8Unorm, "Atlas");
+        quad_batch.AddTexturedQuad(FloatRect{ 10.F, 20.F, 8.F, 12.F }, FloatRect{ 0.25F, 0.5F, 0.125F, 0.25F },
+                                   atlas_texture, TextureMode::RFloatToAlpha, g_color);
+
+        const QuadBatch::Vertices& vertices = quad_batch.GetVertices();
+        REQUIRE(vertices.size() == QuadBatch::g_vertices_per_quad);
+        CHECK(vertices[0].texcoord.GetX() == Approx(0.25F));
+        CHECK(vertices[0].texcoord.GetY() == Approx(0.5F));
+        CHECK(vertices[2].texcoord.GetX() == Approx(0.375F));
+        CHECK(vertices[2].texcoord.GetY() == Approx(0.75F));
+        CHECK(vertices[0].texcoord.GetZ() == static_cast<float>(TextureMode::RFloatToAlpha));
+        CHECK(vertices[0].position.GetX() == Approx(10.F / 400.F - 1.F));
+        CHECK(vertices[0].position.GetY() == Approx(1.F - 20.F / 300.F));
+    }
+
+    SECTION("Reset clears batch content")
+    {
+        quad_batch.AddQuad(FrameRect{ 0, 0, 10U, 10U }, g_color);
+        quad_batch.Reset(FrameSize{ 100U, 100U });
+        CHECK(quad_batch.IsEmpty());
+        CHECK(quad_batch.GetDrawRanges().empty());
+        CHECK(quad_batch.GetFrameSize() == FrameSize{ 100U, 100U });
+    }
+}
+
+TEST_CASE("Quad batch draw ranges", "[ui][batch][ranges]")
+{
+    const Rhi::RenderContext render_context = Test::CreateTestRenderContext(g_frame_size);
+    const Rhi::Texture atlas_texture = Test::CreateTestTexture(render_context, PixelFormat::R8Unorm, "Atlas");
+    const Rhi::Texture badge_texture = Test::CreateTestTexture(render_context, PixelFormat::RGBA8Unorm, "Badge");
+    const FrameRect    quad_rect{ 0, 0, 16U, 16U };
+
+    QuadBatch quad_batch;
+    quad_batch.Reset(g_frame_size);
+
+    SECTION("Untextured quads are merged in one range")
+    {
+        for(int i = 0; i < 5; ++i)
+            quad_batch.AddQuad(quad_rect, g_color);
+
+        REQUIRE(quad_batch.GetDrawRanges().size() == 1U);
+        CHECK_FALSE(quad_batch.GetDrawRanges()[0].texture.IsInitialized());
+        CHECK(quad_batch.GetDrawRanges()[0].start_quad == 0U);
+        CHECK(quad_batch.GetDrawRanges()[0].quad_count == 5U);
+    }
+
+    SECTION("Untextured quads are merged with textured quads of any texture")
+    {
+        quad_batch.AddQuad(quad_rect, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, atlas_texture, TextureMode::RFloatToAlpha, g_color);
+        quad_batch.AddQuad(quad_rect, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, atlas_texture, TextureMode::RFloatToAlpha, g_color);
+
+        REQUIRE(quad_batch.GetDrawRanges().size() == 1U);
+        CHECK(quad_batch.GetDrawRanges()[0].texture == atlas_texture);
+        CHECK(quad_batch.GetDrawRanges()[0].quad_count == 4U);
+    }
+
+    SECTION("Texture switch starts new range preserving quads order")
+    {
+        quad_batch.AddQuad(quad_rect, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, badge_texture, TextureMode::RgbaFloat, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, atlas_texture, TextureMode::RFloatToAlpha, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, atlas_texture, TextureMode::RFloatToAlpha, g_color);
+        quad_batch.AddQuad(quad_rect, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, badge_texture, TextureMode::RgbaFloat, g_color);
+
+        const QuadBatch::DrawRanges& draw_ranges = quad_batch.GetDrawRanges();
+        REQUIRE(draw_ranges.size() == 3U);
+        CHECK(draw_ranges[0].texture == badge_texture);
+        CHECK(draw_ranges[0].start_quad == 0U);
+        CHECK(draw_ranges[0].quad_count == 2U);
+        CHECK(draw_ranges[1].texture == atlas_texture);
+        CHECK(draw_ranges[1].start_quad == 2U);
+        CHECK(draw_ranges[1].quad_count == 3U);
+        CHECK(draw_ranges[2].texture == badge_texture);
+        CHECK(draw_ranges[2].start_quad == 5U);
+        CHECK(draw_ranges[2].quad_count == 1U);
+        CHECK(quad_batch.GetQuadCount() == 6U);
+    }
+
+    SECTION("Textured quad with disabled texture mode does not switch texture")
+    {
+        quad_batch.AddTexturedQuad(quad_rect, atlas_texture, TextureMode::RFloatToAlpha, g_color);
+        quad_batch.AddTexturedQuad(quad_rect, badge_texture, TextureMode::Disabled, g_color);
+        REQUIRE(quad_batch.GetDrawRanges().size() == 1U);
+        CHECK(quad_batch.GetDrawRanges()[0].quad_count == 2U);
+    }
+}
+
+TEST_CASE("Quad batch indices", "[ui][batch][indices]")
+{
+    SECTION("No indices for zero quads")
+    {
+        CHECK(QuadBatch::GenerateQuadIndices(0U).empty());
+    }
+
+    SECTION("Two triangles per quad with shared diagonal")
+    {
+        const std::vector<uint32_t> indices = QuadBatch::GenerateQuadIndices(3U);
+        REQUIRE(indices.size() == 3U * QuadBatch::g_indices_per_quad);
+        const std::vector<uint32_t> second_quad_indices(indices.begin() + 6, indices.begin() + 12);
+        CHECK(second_quad_indices == std::vector<uint32_t>{ 4U, 5U, 6U, 6U, 7U, 4U });
+        CHECK(indices.back() == 8U);
+    }
+}
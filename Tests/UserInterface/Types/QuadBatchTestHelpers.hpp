@@ -0,0 +1,58 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Types/QuadBatchTestHelpers.hpp
+Helpers of quad batch tests and benchmarks creating textures with Null RHI render context
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Platform/AppEnvironment.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace tf
+{
+class Executor { public: Executor() = default; };
+}
+
+namespace Methane::UserInterface::Test
+{
+
+namespace rhi = Methane::Graphics::Rhi;
+
+inline rhi::RenderContext CreateTestRenderContext(const Graphics::FrameSize& frame_size)
+{
+    static tf::Executor s_fake_executor;
+    const rhi::Devices& devices = rhi::System::Get().UpdateGpuDevices();
+    REQUIRE(devices.size() > 0);
+    return rhi::RenderContext(Platform::AppEnvironment{}, devices[0], s_fake_executor, rhi::RenderContextSettings{ frame_size });
+}
+
+inline rhi::Texture CreateTestTexture(const rhi::RenderContext& render_context, Graphics::PixelFormat pixel_format, const std::string& name)
+{
+    rhi::Texture texture(render_context, rhi::TextureSettings::ForImage(Graphics::Dimensions(256U, 256U), std::nullopt, pixel_format, false));
+    texture.SetName(name);
+    return texture;
+}
+
+} // namespace Methane::UserInterface::Test
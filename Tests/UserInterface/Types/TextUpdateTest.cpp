@@ -0,0 +1,146 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Types/TextUpdateTest.cpp
+Unit-tests of memory allocations made by dynamic text updates, like in HUD
+
+******************************************************************************/
+
+#include "FakePlatformApp.hpp"
+
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/UserInterface/Text.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::Platform;
+using namespace Methane::UserInterface;
+
+namespace tf
+{
+class Executor { public: Executor() = default; };
+}
+
+static std::atomic<size_t> g_allocations_count{ 0U };
+
+// Global allocation operators are replaced to count heap allocations made on the text update path
+void* operator new(std::size_t size)
+{
+    ++g_allocations_count;
+    if (void* ptr = std::malloc(size ? size : 1U); ptr)
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static const FakeApp      g_fake_app(1.F, 96);
+static const FrameSize    g_frame_size { 1280U, 720U };
+static tf::Executor       g_fake_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    CHECK(devices.size() > 0);
+    return devices[0];
+}
+
+// Formats HUD-like frame statistics text without heap allocations
+static std::string_view FormatFrameText(std::array<char, 128>& text_buffer, uint32_t frame_index)
+{
+    const auto result = fmt::format_to_n(text_buffer.data(), text_buffer.size(),
+                                         "{:d} FPS, {:.2f} ms, {:.2f}% CPU",
+                                         55U + frame_index % 10U,
+                                         16.F + static_cast<float>(frame_index % 7U) * 0.13F,
+                                         20.F + static_cast<float>(frame_index % 13U) * 1.7F);
+    return std::string_view(text_buffer.data(), result.size);
+}
+
+TEST_CASE("Text update memory allocations", "[ui][text][memory]")
+{
+    const Rhi::RenderContext  render_context(AppEnvironment{}, GetTestDevice(), g_fake_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::CommandQueue   render_cmd_queue(render_context, Rhi::CommandListType::Render);
+    const Rhi::RenderPattern  render_pattern(render_context, Rhi::RenderPatternSettings{});
+    UserInterface::Context    ui_context(g_fake_app, render_cmd_queue, render_pattern);
+
+    const FontLibrary font_library;
+    const Font font = font_library.AddFont(Data::FontProvider::Get(),
+        Font::Settings
+        {
+            Font::Description{ "Test", "Fonts/RobotoMono/RobotoMono-Regular.ttf", 12U },
+            ui_context.GetFontResolutionDpi(),
+            Font::GetAlphabetDefault()
+        }
+    );
+
+    std::array<char, 128> text_buffer{ };
+    Text text(ui_context, font,
+        Text::SettingsUtf8
+        {
+            "HUD Frame Text",
+            std::string(FormatFrameText(text_buffer, 0U)),
+            UnitRect{ Units::Pixels, Point2I{ 10, 10 }, FrameSize{ 400U, 50U } },
+            Text::Layout{ Text::Wrap::Word, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
+            Color4F(1.F, 1.F, 1.F, 1.F),
+            false
+        }
+    );
+
+    constexpr uint32_t warm_up_frames_count = 16U;
+    for(uint32_t frame_index = 1U; frame_index <= warm_up_frames_count; ++frame_index)
+    {
+        text.SetText(FormatFrameText(text_buffer, frame_index));
+    }
+
+    SECTION("Text update does not allocate memory after warm-up frames")
+    {
+        for(uint32_t frame_index = warm_up_frames_count + 1U; frame_index <= warm_up_frames_count * 2U; ++frame_index)
+        {
+            const std::string_view frame_text = FormatFrameText(text_buffer, frame_index);
+            const size_t allocations_count = g_allocations_count;
+            text.SetText(frame_text);
+            const size_t text_update_allocations_count = g_allocations_count - allocations_count;
+            CHECK(text_update_allocations_count == 0U);
+            CHECK(text.GetTextUtf8() == frame_text);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tools/TextureBaker/TextureBaker.cpp
+Offline texture baking tool, which decodes source image, generates full MIP chain
+and writes it to KTX2 container loaded by ImageLoader without decoding.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Data/FileProvider.hpp>
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+#include <taskflow/taskflow.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+int main(int argc, char* argv[])
+{
+    CLI::App app("Methane Texture Baker: generates full MIP chain of the image and writes it to KTX2 file", "MethaneTextureBaker");
+
+    std::string input_path;
+    std::string output_path;
+    MipFilter   mip_filter = MipFilter::Kaiser;
+    bool        is_linear_color_space = false;
+
+    app.add_option("input", input_path, "Source image file path")->required()->check(CLI::ExistingFile);
+    app.add_option("output", output_path, "Output KTX2 file path")->required();
+    app.add_option("-f,--filter", mip_filter, "MIP filter: box or kaiser")
+        ->transform(CLI::CheckedTransformer(std::map<std::string, MipFilter>{ { "box", MipFilter::Box }, { "kaiser", MipFilter::Kaiser } }, CLI::ignore_case));
+    app.add_flag("-l,--linear", is_linear_color_space, "Image colors are in linear color space instead of sRGB");
+
+    CLI11_PARSE(app, argc, argv);
+
+    try
+    {
+        tf::Executor parallel_executor;
+        const ImageLoader image_loader(Data::FileProvider::Get());
+        const ImageData   image_data = image_loader.LoadImageData(std::filesystem::absolute(input_path).string(), 4U, false);
+
+        const MipChainGenerator mip_generator({ mip_filter, !is_linear_color_space }, &parallel_executor);
+        const MipChainGenerator::MipLevels mip_levels = mip_generator.Generate(image_data.GetDimensions(), image_data.GetPixels());
+
+        const PixelFormat pixel_format = is_linear_color_space ? PixelFormat::RGBA8Unorm : PixelFormat::RGBA8Unorm_sRGB;
+        const Data::Bytes ktx2_data = Ktx2ImageData::Write(pixel_format, image_data.GetDimensions(), mip_levels);
+
+        std::ofstream fs(output_path, std::ios::binary);
+        fs.write(reinterpret_cast<const char*>(ktx2_data.data()), static_cast<std::streamsize>(ktx2_data.size())); // NOSONAR
+        if (!fs.good())
+            throw std::runtime_error(fmt::format("failed to write output file '{}'", output_path));
+
+        std::cout << fmt::format("Image {}x{} was baked with {} MIP levels to '{}' ({} bytes)",
+                                 image_data.GetDimensions().GetWidth(), image_data.GetDimensions().GetHeight(),
+                                 mip_levels.size(), output_path, ktx2_data.size()) << std::endl;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "Texture baking has failed: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}